@@ -123,6 +123,9 @@
 // エンジン内部エラー | Internal engine error
 # include <Siv3D/Error/InternalEngineError.hpp>
 
+// タスクのキャンセルエラー | Task canceled error
+# include <Siv3D/Error/TaskCanceledError.hpp>
+
 ////////////////////////////////////////////////////////////////
 //
 //	レンジとビュー | Range and View
@@ -240,6 +243,12 @@
 // スレッド | Thread
 # include <Siv3D/Threading.hpp>
 
+// タスクを実行する場所 | Task executor
+# include <Siv3D/TaskExecutor.hpp>
+
+// キャンセルトークン | Cancellation token
+# include <Siv3D/CancellationToken.hpp>
+
 // 非同期タスク | Asynchronous task
 # include <Siv3D/AsyncTask.hpp>
 
@@ -391,6 +400,12 @@
 // プロファイラー | Profiler
 # include <Siv3D/Profiler.hpp> // ToDo
 
+// 計測区間の統計情報 | Profiled scope statistics
+# include <Siv3D/ProfilerScopeStat.hpp>
+
+// 計測区間 | Profiled scope
+# include <Siv3D/ProfilerScope.hpp>
+
 // 処理にかかった時間の測定 | Clock counter in milliseconds
 # include <Siv3D/MillisecClock.hpp>
 
@@ -463,6 +478,9 @@
 // ファイルオープンモード / File open mode
 # include <Siv3D/OpenMode.hpp>
 
+// 非同期読み込みの範囲 | Async read request
+# include <Siv3D/AsyncReadRequest.hpp>
+
 // 読み込み専用バイナリファイル | Binary file reader
 # include <Siv3D/BinaryReader.hpp>
 
@@ -499,6 +517,21 @@
 // Zstandard 方式による可逆圧縮 | Lossless compression with Zstandard algorithm
 # include <Siv3D/Compression.hpp>
 
+// Zstandard の再利用可能な圧縮コンテキスト | Reusable Zstandard compression context
+# include <Siv3D/Compressor.hpp>
+
+// Zstandard の再利用可能な展開コンテキスト | Reusable Zstandard decompression context
+# include <Siv3D/Decompressor.hpp>
+
+// Zstandard 形式で圧縮しながら書き込む IWriter | IWriter that compresses data with Zstandard
+# include <Siv3D/CompressionWriter.hpp>
+
+// Zstandard 形式のデータを展開しながら読み込む IReader | IReader that decompresses Zstandard data
+# include <Siv3D/DecompressionReader.hpp>
+
+// シーク可能な Zstandard 形式のデータを部分的に展開して読み込む IReader | IReader that decompresses only the needed frames of seekable Zstandard data
+# include <Siv3D/SeekableDecompressionReader.hpp>
+
 //// ZIP 圧縮ファイルの読み込み | ZIP reader
 //# include <Siv3D/ZIPReader.hpp>
 //
@@ -534,6 +567,11 @@
 # include <Siv3D/JSONIterator.hpp>
 # include <Siv3D/JSONPointer.hpp> // ToDo
 
+// JSON データの逐次読み書き | Streaming JSON reader/writer
+# include <Siv3D/JSONEvent.hpp>
+# include <Siv3D/JSONReader.hpp>
+# include <Siv3D/JSONWriter.hpp>
+
 //// JSON データの検証 | JSON validation
 //# include <Siv3D/JSONValidator.hpp>
 
@@ -602,6 +640,12 @@
 // ログの種類 | The type of the log message
 # include <Siv3D/LogType.hpp>
 
+// 非同期ログのキューが一杯のときの動作 | Behavior when the asynchronous log queue is full
+# include <Siv3D/LogOverflowPolicy.hpp>
+
+// ロガーの統計情報 | Logger statistics
+# include <Siv3D/LoggerStat.hpp>
+
 // ロガー | Logger
 # include <Siv3D/Logger.hpp>
 # include <Siv3D/LoggerBuffer.hpp>
@@ -907,6 +951,12 @@
 # include <Siv3D/Geometry2D/SmallestEnclosingCircle.hpp>
 # include <Siv3D/Geometry2D/Misc.hpp> // ToDo
 
+// ブロードフェーズのアルゴリズム | Broad-phase algorithm
+# include <Siv3D/BroadPhaseAlgorithm.hpp>
+
+// 多数の図形の交差判定 | Broad-phase collision detection
+# include <Siv3D/BroadPhase2D.hpp>
+
 // 長方形詰込み | Rectangle packing
 # include <Siv3D/RectanglePack.hpp>
 
@@ -1217,8 +1267,12 @@
 //// ボックスフィルタ | Box filter
 //# include <Siv3D/BoxFilterSize.hpp>
 
+// リサンプリングのフィルタ | Resample filter
+# include <Siv3D/ResampleFilter.hpp>
+
 // 画像 | Image
 # include <Siv3D/Image.hpp> // ToDo
+# include <Siv3D/ImageParallel.hpp>
 
 // 追加の画像処理 | Extra image processing
 # include <Siv3D/ImageProcessing.hpp>
@@ -1241,6 +1295,9 @@
 //
 ////////////////////////////////////////////////////////////////
 
+// 画像デコードのオプション | Image decode options
+# include <Siv3D/ImageDecodeOptions.hpp>
+
 // 画像デコーダのインタフェース | Image decoder interface
 # include <Siv3D/IImageDecoder.hpp>
 
@@ -1250,6 +1307,9 @@
 // 画像デコーダ | Image decoder
 # include <Siv3D/ImageDecoder.hpp>
 
+// 画像デコーダの統計情報 | Image decoder statistics
+# include <Siv3D/ImageDecoderStat.hpp>
+
 // 画像エンコーダ | Image encoder
 # include <Siv3D/ImageEncoder.hpp>
 
@@ -1579,6 +1639,15 @@
 // 2D 描画の座標変換スコープ | Coordinate transformation scope for 2D rendering
 # include <Siv3D/Transformer2D.hpp>
 
+// 2D 描画のコマンドリスト | Command list for 2D rendering
+# include <Siv3D/Renderer2DCommandList.hpp>
+
+// 2D 描画コールの並べ替え | Draw call reordering for 2D rendering
+# include <Siv3D/DrawCallReorder.hpp>
+
+// CPU による 2D 描画 | Software 2D rendering
+# include <Siv3D/SoftwareRenderer2D.hpp>
+
 ////////////////////////////////////////////////////////////////
 //
 //	2D カメラコントロール | 2D Camera
@@ -1623,6 +1692,7 @@
 # include <Siv3D/FontMethod.hpp>
 # include <Siv3D/FontFile.hpp>
 # include <Siv3D/FontFaceProperties.hpp>
+# include <Siv3D/FontCacheStat.hpp>
 # include <Siv3D/GlyphInfo.hpp>
 # include <Siv3D/ResolvedGlyph.hpp>
 # include <Siv3D/Font.hpp>
@@ -10,11 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
-# include "Platform.hpp"
-# if SIV3D_PLATFORM(WINDOWS)
-#	include <execution>
-# endif
-# include <future>
+# include <atomic>
 # include "Threading.hpp"
 
 # include "detail/ArrayParallel.ipp"
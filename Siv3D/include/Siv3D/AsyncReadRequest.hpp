@@ -0,0 +1,46 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <functional>
+# include "Common.hpp"
+
+namespace s3d
+{
+	class Blob;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	AsyncReadRequest
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 非同期読み込みで読み込む範囲
+	struct AsyncReadRequest
+	{
+		/// @brief 先頭から数えた読み込み開始位置（バイト）
+		int64 pos = 0;
+
+		/// @brief 読み込むサイズ（バイト）
+		int64 size = 0;
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	AsyncReadCallback
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 非同期読み込みで、1 つの範囲の読み込みが終わったときに呼ばれる関数
+	/// @remark 引数は要求のインデックスと読み込んだデータです。I/O スレッドから呼ばれます。
+	using AsyncReadCallback = std::function<void(size_t index, Blob&& blob)>;
+}
@@ -11,11 +11,90 @@
 
 # pragma once
 # include <future>
+# include <memory>
+# include <mutex>
+# include <optional>
+# include <functional>
+# include <coroutine>
 # include <type_traits>
 # include "Platform.hpp"
+# include "Array.hpp"
+# include "Threading.hpp"
+# include "TaskExecutor.hpp"
+# include "CancellationToken.hpp"
 
 namespace s3d
 {
+	template <class Type>
+	class AsyncTask;
+
+	namespace detail
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	TaskCompletion
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 非同期処理の完了を、登録された関数に通知するクラス
+		class TaskCompletion
+		{
+		public:
+
+			/// @brief 完了を記録し、登録されている関数をすべて呼びます。
+			void complete();
+
+			/// @brief 完了したときに呼ぶ関数を登録します。
+			/// @param f 完了を記録したスレッドで呼ばれる関数。すでに完了している場合は、この関数の中でただちに呼ばれます。
+			void onComplete(std::function<void()> f);
+
+		private:
+
+			std::mutex m_mutex;
+
+			Array<std::function<void()>> m_callbacks;
+
+			bool m_completed = false;
+		};
+
+		/// @brief タスクの完了後に callback を呼びます。
+		/// @param completion タスクの完了通知。nullptr の場合は、スレッドプールで wait を呼んで完了を待ってから callback を呼びます。
+		void WhenReady(std::shared_ptr<TaskCompletion> completion, std::function<void()> wait, std::function<void()> callback);
+
+		template <class Type>
+		struct AsyncTaskPromise;
+
+		template <class Type>
+		struct AsyncTaskAwaiter;
+
+		/// @brief 完了したタスクを引数に取る継続
+		template <class Fty, class Type>
+		concept TaskContinuation = std::invocable<Fty, AsyncTask<Type>>;
+
+		/// @brief タスクの結果を引数に取る継続
+		template <class Fty, class Type>
+		concept ValueContinuation = (not TaskContinuation<Fty, Type>)
+			&& ((std::is_void_v<Type> && std::invocable<Fty>) || ((not std::is_void_v<Type>) && std::invocable<Fty, Type>));
+
+		template <class Fty, class Type>
+		struct ContinuationResult
+		{
+			using type = std::invoke_result_t<Fty, AsyncTask<Type>>;
+		};
+
+		template <class Fty, class Type> requires (ValueContinuation<Fty, Type> && (not std::is_void_v<Type>))
+		struct ContinuationResult<Fty, Type>
+		{
+			using type = std::invoke_result_t<Fty, Type>;
+		};
+
+		template <class Fty> requires ValueContinuation<Fty, void>
+		struct ContinuationResult<Fty, void>
+		{
+			using type = std::invoke_result_t<Fty>;
+		};
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	AsyncTask
@@ -31,6 +110,8 @@ namespace s3d
 
 		using base_type = std::future<Type>;
 
+		using promise_type = detail::AsyncTaskPromise<Type>;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	(constructor)
@@ -45,6 +126,13 @@ namespace s3d
 		[[nodiscard]]
 		AsyncTask(base_type&& other) noexcept;
 
+		/// @brief 完了通知付きの非同期処理を作成します。
+		/// @param other 非同期処理の結果
+		/// @param completion 結果が設定されたときに完了を通知するオブジェクト
+		/// @remark 通常、ユーザーが直接呼び出す必要はありません。
+		[[nodiscard]]
+		AsyncTask(base_type&& other, std::shared_ptr<detail::TaskCompletion> completion) noexcept;
+
 		[[nodiscard]] 
 		AsyncTask(AsyncTask&& other) noexcept;
 
@@ -158,9 +246,56 @@ namespace s3d
 		[[nodiscard]]
 		std::shared_future<Type> share() noexcept;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	then
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief タスクの完了後に実行する処理を登録します。
+		/// @tparam Fty 実行する関数の型
+		/// @param f タスクの結果（Type が void の場合は引数なし）、または完了したタスクを引数に取る関数
+		/// @param executor f を実行する場所
+		/// @return f の戻り値を結果とする新しいタスク
+		/// @remark このタスクは無効になります。タスクの結果を引数に取る f は、タスクが例外を送出した場合は呼ばれず、例外が新しいタスクに伝わります。
+		/// @remark `Async()` の `TaskExecutor` を取らないオーバーロードや std::future から作られたタスクでは、継続ごとに作られる専用のスレッドが完了を待ちます。スレッドプールのワーカーは使いません。
+		template <class Fty> requires (detail::TaskContinuation<Fty, Type> || detail::ValueContinuation<Fty, Type>)
+		[[nodiscard]]
+		auto then(Fty&& f, TaskExecutor executor = TaskExecutor::ThreadPool);
+
+		/// @brief タスクの完了後に実行する処理を登録します。
+		/// @tparam Fty 実行する関数の型
+		/// @param f タスクの結果（Type が void の場合は引数なし）、または完了したタスクを引数に取る関数
+		/// @param executor f を実行する場所
+		/// @param cancellationToken f を実行する前にキャンセルされていた場合、f は呼ばれず、新しいタスクは `TaskCanceledError` を送出します。
+		/// @return f の戻り値を結果とする新しいタスク
+		/// @remark このタスクは無効になります。
+		template <class Fty> requires (detail::TaskContinuation<Fty, Type> || detail::ValueContinuation<Fty, Type>)
+		[[nodiscard]]
+		auto then(Fty&& f, TaskExecutor executor, const CancellationToken& cancellationToken);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator co_await
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief コルーチンの中でタスクの完了を待ちます。
+		/// @return タスクの結果を返す awaiter
+		/// @remark コルーチンは、タスクを完了させたスレッドで再開します。実行する場所を変えるには `ResumeOn()` を使ってください。このタスクは無効になります。
+		[[nodiscard]]
+		detail::AsyncTaskAwaiter<Type> operator co_await() noexcept;
+
 	private:
 
 		base_type m_data;
+
+		/// @brief 完了通知。std::future から作られたタスクでは nullptr
+		std::shared_ptr<detail::TaskCompletion> m_completion;
+
+		template <class Fty>
+		[[nodiscard]]
+		auto thenImpl(Fty&& f, TaskExecutor executor, std::optional<CancellationToken> cancellationToken);
 	};
 
 	template <class Fty, class... Args> requires std::invocable<std::decay_t<Fty>, std::decay_t<Args>...>
@@ -183,6 +318,77 @@ namespace s3d
 	template <class Fty, class... Args> requires std::invocable<std::decay_t<Fty>, std::decay_t<Args>...>
 	[[nodiscard]]
 	auto Async(Fty&& f, Args&&... args);
+
+	/// @brief 指定した場所で実行される非同期処理のタスクを作成します。
+	/// @tparam Fty 非同期処理のタスクで実行する関数の型
+	/// @tparam ...Args 非同期処理のタスクで実行する関数の引数の型
+	/// @param executor タスクを実行する場所
+	/// @param f 非同期処理のタスクで実行する関数
+	/// @param ...args 非同期処理のタスクで実行する関数の引数
+	/// @remark `TaskExecutor::ThreadPool` では、タスクごとにスレッドを作らず、共有のスレッドプールで実行します。長い時間ブロックする処理には、`TaskExecutor` を取らないオーバーロードを使ってください。
+	/// @return 作成された非同期処理のタスク
+	template <class Fty, class... Args> requires std::invocable<std::decay_t<Fty>, std::decay_t<Args>...>
+	[[nodiscard]]
+	auto Async(TaskExecutor executor, Fty&& f, Args&&... args);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	WhenAll
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief すべてのタスクが完了したときに完了するタスクを作成します。
+	/// @tparam Type タスクの結果の型
+	/// @param tasks タスクの一覧
+	/// @return 結果を tasks と同じ順に並べた配列（Type が void の場合は void）を結果とするタスク
+	/// @remark いずれかのタスクが例外を送出した場合、すべてのタスクの完了後に、最初に送出された例外が新しいタスクに伝わります。
+	template <class Type>
+	[[nodiscard]]
+	auto WhenAll(Array<AsyncTask<Type>> tasks);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	WhenAny
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief いずれかのタスクが完了したときに完了するタスクを作成します。
+	/// @tparam Type タスクの結果の型
+	/// @param tasks タスクの一覧
+	/// @return 最初に完了したタスクのインデックスと結果の組（Type が void の場合はインデックス）を結果とするタスク
+	/// @remark 最初に完了したタスクが例外を送出した場合、その例外が新しいタスクに伝わります。残りのタスクは完了するまで実行されます。
+	/// @throw Error tasks が空の場合
+	template <class Type>
+	[[nodiscard]]
+	auto WhenAny(Array<AsyncTask<Type>> tasks);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ResumeOn
+	//
+	////////////////////////////////////////////////////////////////
+
+	namespace detail
+	{
+		struct ResumeOnAwaiter
+		{
+			TaskExecutor executor;
+
+			[[nodiscard]]
+			bool await_ready() const noexcept;
+
+			void await_suspend(std::coroutine_handle<> handle) const;
+
+			constexpr void await_resume() const noexcept {}
+		};
+	}
+
+	/// @brief コルーチンの実行を、指定した場所に移します。
+	/// @param executor コルーチンを再開する場所
+	/// @return awaiter
+	/// @remark `co_await ResumeOn(TaskExecutor::MainThread);` のように使います。
+	[[nodiscard]]
+	detail::ResumeOnAwaiter ResumeOn(TaskExecutor executor) noexcept;
 }
 
 # include "detail/AsyncTask.ipp"
@@ -15,6 +15,9 @@
 # include "IReader.hpp"
 # include "StringView.hpp"
 # include "OpenMode.hpp"
+# include "Array.hpp"
+# include "AsyncTask.hpp"
+# include "AsyncReadRequest.hpp"
 
 namespace s3d
 {
@@ -238,6 +241,40 @@ namespace s3d
 		[[nodiscard]]
 		Blob lookaheadBlob(int64 pos, int64 size);
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	readBlobAsync
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ファイルからデータを非同期で読み込みます。
+		/// @param pos 先頭から数えた読み込み開始位置（バイト）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 読み込んだデータを返す非同期処理のタスク
+		/// @remark 読み込み位置は変化しません。読み込みが終わる前にファイルを閉じても、読み込みは続きます。
+		[[nodiscard]]
+		AsyncTask<Blob> readBlobAsync(int64 pos, int64 size) const;
+
+		/// @brief ファイルの複数の範囲からデータを非同期でまとめて読み込みます。
+		/// @param requests 読み込む範囲の一覧
+		/// @return 要求と同じ順に並んだ、読み込んだデータの一覧を返す非同期処理のタスク
+		/// @remark 読み込み位置は変化しません。Linux では io_uring を使って要求をまとめて発行します。
+		[[nodiscard]]
+		AsyncTask<Array<Blob>> readBlobAsync(Array<AsyncReadRequest> requests) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	readAsync
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ファイルの複数の範囲からデータを非同期でまとめて読み込み、1 つの範囲の読み込みが終わるたびに関数を呼びます。
+		/// @param requests 読み込む範囲の一覧
+		/// @param onComplete 1 つの範囲の読み込みが終わるたびに呼ばれる関数。引数は要求のインデックスと読み込んだデータです。
+		/// @remark onComplete は I/O スレッドから、要求とは異なる順に、複数のスレッドから同時に呼ばれることがあります。
+		/// @remark ファイルが開いていない場合、onComplete はこの関数の中で空のデータとともに呼ばれます。
+		void readAsync(Array<AsyncReadRequest> requests, AsyncReadCallback onComplete) const;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	path
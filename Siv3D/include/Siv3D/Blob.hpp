@@ -72,6 +72,7 @@ namespace s3d
 
 		/// @brief IReader からデータを読み込んでバイナリデータを作成します。
 		/// @param reader IReader
+		/// @remark IReader のサイズが不明（-1）な場合は、終端まで読み込みます。
 		[[nodiscard]]
 		explicit Blob(IReader& reader);
 
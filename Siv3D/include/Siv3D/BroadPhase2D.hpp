@@ -0,0 +1,233 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <span>
+# include <variant>
+# include "Common.hpp"
+# include "Array.hpp"
+# include "2DShapes.hpp"
+# include "Polygon.hpp"
+# include "BroadPhaseAlgorithm.hpp"
+
+namespace s3d
+{
+	/// @brief BroadPhase2D に登録できる図形
+	using BroadPhaseShape = std::variant<Circle, RectF, Line, Triangle, Quad, Polygon>;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	BroadPhase2D
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 多数の 2D 図形の中から、交差する図形を効率よく求めるためのクラス
+	/// @remark バウンディングボックスで候補を絞り込み（ブロードフェーズ）、候補どうしを `Geometry2D::Intersect()` で判定（ナローフェーズ）します。
+	/// @remark const メンバ関数は複数のスレッドから同時に呼び出すことができます。
+	class BroadPhase2D
+	{
+	private:
+
+		class BroadPhase2DDetail;
+
+	public:
+
+		/// @brief 図形の ID の型
+		using IDType = uint32;
+
+		/// @brief 交差する 2 つの図形の ID の組（first < second）
+		using IDPair = std::pair<IDType, IDType>;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		BroadPhase2D();
+
+		/// @brief 空の BroadPhase2D を作成します。
+		/// @param algorithm 候補の絞り込みに使うアルゴリズム
+		/// @param margin AABBTree で、図形のバウンディングボックスを広げる幅。図形がこの幅以内で動いた場合はツリーを更新しません。
+		[[nodiscard]]
+		explicit BroadPhase2D(BroadPhaseAlgorithm algorithm, double margin = 4.0);
+
+		[[nodiscard]]
+		BroadPhase2D(BroadPhase2D&& other) noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(destructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デストラクタ
+		~BroadPhase2D();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator =
+		//
+		////////////////////////////////////////////////////////////////
+
+		BroadPhase2D& operator =(BroadPhase2D&& other) noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	add
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 図形を追加します。
+		/// @param shape 図形
+		/// @return 追加した図形の ID
+		/// @remark 削除された図形の ID は、後から追加した図形に再利用されます。
+		IDType add(BroadPhaseShape shape);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	update
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 図形を移動・変形します。
+		/// @param id 図形の ID
+		/// @param shape 新しい図形
+		/// @return 内部のツリーや並び順を更新した場合 true, 図形の置き換えだけで済んだ場合は false
+		bool update(IDType id, BroadPhaseShape shape);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	remove
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 図形を削除します。
+		/// @param id 図形の ID
+		void remove(IDType id);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	clear
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief すべての図形を削除します。
+		void clear();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	contains
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 指定した ID の図形が存在するかを返します。
+		/// @param id 図形の ID
+		/// @return 存在する場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool contains(IDType id) const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	size, isEmpty
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 図形の個数を返します。
+		/// @return 図形の個数
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief 図形が 1 つも無いかを返します。
+		/// @return 図形が 1 つも無い場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getAlgorithm
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 候補の絞り込みに使うアルゴリズムを返します。
+		/// @return 候補の絞り込みに使うアルゴリズム
+		[[nodiscard]]
+		BroadPhaseAlgorithm getAlgorithm() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getShape
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 図形を返します。
+		/// @param id 図形の ID
+		/// @return 図形
+		/// @throw std::out_of_range 指定した ID の図形が存在しない場合
+		[[nodiscard]]
+		const BroadPhaseShape& getShape(IDType id) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	query
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief バウンディングボックスが指定した領域と重なる図形の ID 一覧を返します。
+		/// @param region 領域
+		/// @return 図形の ID 一覧（昇順）
+		/// @remark 図形そのものとの交差判定は行いません。
+		[[nodiscard]]
+		Array<IDType> query(const RectF& region) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	intersects
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 指定した図形と交差する図形の ID 一覧を返します。
+		/// @param shape 図形
+		/// @return 交差する図形の ID 一覧（昇順）
+		[[nodiscard]]
+		Array<IDType> intersects(const BroadPhaseShape& shape) const;
+
+		/// @brief 複数の図形それぞれについて、交差する図形の ID 一覧を並列に求めます。
+		/// @param shapes 図形の一覧
+		/// @return `shapes` の各図形と交差する図形の ID 一覧（昇順）
+		[[nodiscard]]
+		Array<Array<IDType>> intersects(std::span<const BroadPhaseShape> shapes) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	findPairs
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 登録されている図形どうしで、交差する組の一覧を並列に求めます。
+		/// @return 交差する図形の ID の組の一覧（昇順）
+		[[nodiscard]]
+		Array<IDPair> findPairs() const;
+
+		/// @brief 登録されている図形どうしで、バウンディングボックスが重なる組の一覧を並列に求めます。
+		/// @return バウンディングボックスが重なる図形の ID の組の一覧（昇順）
+		/// @remark 図形そのものどうしの交差判定は行いません。独自のナローフェーズを使う場合に利用します。
+		[[nodiscard]]
+		Array<IDPair> findCandidatePairs() const;
+
+	private:
+
+		std::unique_ptr<BroadPhase2DDetail> pImpl;
+	};
+}
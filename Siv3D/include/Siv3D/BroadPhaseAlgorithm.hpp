@@ -0,0 +1,42 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Types.hpp"
+
+namespace s3d
+{
+	struct FormatData;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	BroadPhaseAlgorithm
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief BroadPhase2D が候補の絞り込みに使うアルゴリズム
+	enum class BroadPhaseAlgorithm : uint8
+	{
+		/// @brief 動的 AABB ツリー。個別のクエリが多い場合や、図形の大きさがばらばらな場合に向いています。
+		AABBTree,
+
+		/// @brief X 軸方向のソートとスイープ (Sort and Sweep)。すべての図形が毎フレーム少しずつ動き、交差する組をまとめて求める場合に向いています。
+		SortAndSweep,
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, BroadPhaseAlgorithm value);
+}
@@ -0,0 +1,78 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <atomic>
+# include <memory>
+# include "Common.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	CancellationToken
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 非同期処理のキャンセルを伝えるトークン | Token that propagates cancellation to asynchronous tasks
+	/// @remark コピーしたトークンは状態を共有します。どれか 1 つで `cancel()` を呼ぶと、すべてのコピーがキャンセル済みになります。 | Copies share their state. Calling `cancel()` on any copy cancels all of them.
+	class CancellationToken
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief キャンセルされていない新しいトークンを作成します。 | Creates a new token that is not canceled.
+		[[nodiscard]]
+		CancellationToken();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	cancel
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief キャンセルを要求します。 | Requests cancellation.
+		/// @remark すでに実行中の処理は中断されません。処理の中で `isCanceled()` を確認してください。 | Work that is already running is not interrupted. Check `isCanceled()` inside the work.
+		void cancel() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isCanceled
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief キャンセルが要求されているかを返します。 | Returns whether cancellation has been requested.
+		/// @return キャンセルが要求されている場合 true, それ以外の場合は false | true if cancellation has been requested, false otherwise
+		[[nodiscard]]
+		bool isCanceled() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	throwIfCanceled
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief キャンセルが要求されている場合、`TaskCanceledError` を送出します。 | Throws `TaskCanceledError` if cancellation has been requested.
+		void throwIfCanceled() const;
+
+	private:
+
+		std::shared_ptr<std::atomic<bool>> m_canceled;
+	};
+}
+
+# include "detail/CancellationToken.ipp"
@@ -13,6 +13,7 @@
 # include "Common.hpp"
 # include "StringView.hpp"
 # include "Blob.hpp"
+# include "Array.hpp"
 
 namespace s3d
 {
@@ -27,6 +28,12 @@ namespace s3d
 		/// @brief 最大の圧縮レベル（最高品質）
 		inline constexpr int32 MaxLevel = 22;
 
+		/// @brief 辞書のデフォルトの最大サイズ（バイト）
+		inline constexpr size_t DefaultDictionaryCapacity = (110 * 1024);
+
+		/// @brief シーク可能な圧縮データの、1 フレームあたりのデフォルトのサイズ（展開後のバイト数）
+		inline constexpr size_t DefaultSeekableFrameSize = (1024 * 1024);
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	Compress
@@ -202,5 +209,93 @@ namespace s3d
 		/// @param outputPath 保存先のファイルパス
 		/// @return 保存に成功した場合 true, それ以外の場合は false
 		bool DecompressFileToFile(FilePathView inputPath, FilePathView outputPath);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	TrainDictionary
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief サンプルデータから圧縮用の辞書を作成します。
+		/// @param samples サンプルデータ。圧縮したいデータと似た内容の小さなデータを数百個以上用意します。
+		/// @param dictionaryCapacity 辞書の最大サイズ（バイト）
+		/// @return 作成された辞書。作成に失敗した場合は空の Blob
+		/// @remark 数 KB 以下の小さなデータを多数圧縮する場合、辞書を `Compressor` と `Decompressor` に渡すことで圧縮率と速度が向上します。
+		[[nodiscard]]
+		Blob TrainDictionary(const Array<Blob>& samples, size_t dictionaryCapacity = DefaultDictionaryCapacity);
+
+		/// @brief サンプルデータから圧縮用の辞書を作成します。
+		/// @param samples すべてのサンプルデータを連結したデータの先頭ポインタ
+		/// @param sampleSizes 各サンプルデータのサイズ（バイト）
+		/// @param dictionaryCapacity 辞書の最大サイズ（バイト）
+		/// @return 作成された辞書。作成に失敗した場合は空の Blob
+		[[nodiscard]]
+		Blob TrainDictionary(const void* samples, const Array<size_t>& sampleSizes, size_t dictionaryCapacity = DefaultDictionaryCapacity);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	CompressSeekable
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief バイナリデータを、ランダムアクセス可能な形式で圧縮します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @param frameSize 1 フレームあたりのサイズ（展開後のバイト数）
+		/// @return 圧縮されたデータ
+		/// @remark データを `frameSize` ごとに独立したフレームとして並列に圧縮し、末尾にフレームの索引を付加します（Zstandard seekable format）。
+		/// @remark 圧縮されたデータは `Compression::Decompress()` でも展開できます。`SeekableDecompressionReader` を使うと、必要なフレームだけを展開して読み込めます。
+		/// @remark `frameSize` を小さくするとランダムアクセスが速くなり、大きくすると圧縮率が向上します。
+		[[nodiscard]]
+		Blob CompressSeekable(const void* data, size_t size, int32 compressionLevel = DefaultLevel, size_t frameSize = DefaultSeekableFrameSize);
+
+		/// @brief バイナリデータを、ランダムアクセス可能な形式で圧縮します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param dst 圧縮されたデータの格納先
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @param frameSize 1 フレームあたりのサイズ（展開後のバイト数）
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		bool CompressSeekable(const void* data, size_t size, Blob& dst, int32 compressionLevel = DefaultLevel, size_t frameSize = DefaultSeekableFrameSize);
+
+		/// @brief バイナリデータを、ランダムアクセス可能な形式で圧縮します。
+		/// @param blob 圧縮するデータ
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @param frameSize 1 フレームあたりのサイズ（展開後のバイト数）
+		/// @return 圧縮されたデータ
+		[[nodiscard]]
+		Blob CompressSeekable(const Blob& blob, int32 compressionLevel = DefaultLevel, size_t frameSize = DefaultSeekableFrameSize);
+
+		/// @brief バイナリデータを、ランダムアクセス可能な形式で圧縮します。
+		/// @param blob 圧縮するデータ
+		/// @param dst 圧縮されたデータの格納先
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @param frameSize 1 フレームあたりのサイズ（展開後のバイト数）
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		bool CompressSeekable(const Blob& blob, Blob& dst, int32 compressionLevel = DefaultLevel, size_t frameSize = DefaultSeekableFrameSize);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	CompressSeekableToFile
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief バイナリデータを、ランダムアクセス可能な形式で圧縮してファイルに保存します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param outputPath 保存するファイルのパス
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @param frameSize 1 フレームあたりのサイズ（展開後のバイト数）
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool CompressSeekableToFile(const void* data, size_t size, FilePathView outputPath, int32 compressionLevel = DefaultLevel, size_t frameSize = DefaultSeekableFrameSize);
+
+		/// @brief バイナリデータを、ランダムアクセス可能な形式で圧縮してファイルに保存します。
+		/// @param blob 圧縮するデータ
+		/// @param outputPath 保存するファイルのパス
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @param frameSize 1 フレームあたりのサイズ（展開後のバイト数）
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool CompressSeekableToFile(const Blob& blob, FilePathView outputPath, int32 compressionLevel = DefaultLevel, size_t frameSize = DefaultSeekableFrameSize);
 	}
 }
@@ -0,0 +1,229 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IWriter.hpp"
+# include "Blob.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	CompressionWriter
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 書き込んだデータを Zstandard 方式で逐次圧縮し、別の IWriter に書き出す Writer
+	/// @remark 書き出したデータは `Compression::Decompress()` や `DecompressionReader` で展開できます。
+	class CompressionWriter : public IWriter
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		CompressionWriter();
+
+		/// @brief 圧縮したデータの書き出し先を IWriter で指定して開きます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer 圧縮したデータの書き出し先
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		template <class Writer>
+			requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+		[[nodiscard]]
+		explicit CompressionWriter(Writer&& writer, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 圧縮したデータの書き出し先を IWriter で指定して開きます。
+		/// @param writer 圧縮したデータの書き出し先
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		[[nodiscard]]
+		explicit CompressionWriter(std::unique_ptr<IWriter>&& writer, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 圧縮したデータの書き出し先を IWriter で指定し、辞書を使って開きます。
+		/// @param writer 圧縮したデータの書き出し先
+		/// @param dictionary 辞書
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		[[nodiscard]]
+		CompressionWriter(std::unique_ptr<IWriter>&& writer, const Blob& dictionary, int32 compressionLevel = Compression::DefaultLevel);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(destructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デストラクタ
+		/// @remark 書き込み中のフレームを終了してから閉じます。
+		~CompressionWriter() override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	open
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮したデータの書き出し先を IWriter で指定して開きます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer 圧縮したデータの書き出し先
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Writer>
+			requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+		bool open(Writer&& writer, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 圧縮したデータの書き出し先を IWriter で指定して開きます。
+		/// @param writer 圧縮したデータの書き出し先
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IWriter>&& writer, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 圧縮したデータの書き出し先を IWriter で指定し、辞書を使って開きます。
+		/// @param writer 圧縮したデータの書き出し先
+		/// @param dictionary 辞書
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IWriter>&& writer, const Blob& dictionary, int32 compressionLevel = Compression::DefaultLevel);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	close
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込み中のフレームを終了し、書き出し先の IWriter を破棄します。
+		/// @return フレームの終了に成功した場合 true, それ以外の場合は false
+		bool close();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	release
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込み中のフレームを終了し、書き出し先の IWriter の所有権を返します。
+		/// @return 書き出し先の IWriter。開いていない場合は nullptr
+		/// @remark `MemoryWriter` に書き出した結果を取り出す場合などに使います。
+		[[nodiscard]]
+		std::unique_ptr<IWriter> release();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isOpen
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを書き込み可能であるかを返します。
+		/// @return 書き込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを書き込み可能であるかを返します。
+		/// @return 書き込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	size
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief これまでに書き込まれた、圧縮前のデータのサイズを返します。
+		/// @return 圧縮前のデータのサイズ（バイト）
+		[[nodiscard]]
+		int64 size() const override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getPos
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の書き込み位置を返します。
+		/// @return 現在の書き込み位置（圧縮前のデータのバイト数）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setPos
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込み位置を変更します。
+		/// @param pos 新しい書き込み位置（バイト）
+		/// @return 常に false
+		/// @remark 圧縮しながら書き出すため、書き込み位置は変更できません。
+		bool setPos(int64 pos) override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	write
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを圧縮して書き出します。
+		/// @param src 書き込むデータ
+		/// @param sizeBytes 書き込むサイズ（バイト）
+		/// @return 実際に書き込んだサイズ（バイト）
+		/// @remark 圧縮されたデータは内部でバッファリングされ、まとまった量ごとに書き出し先へ書き出されます。
+		int64 write(const void* src, int64 sizeBytes) override;
+
+		/// @brief データを圧縮して書き出します。
+		/// @param src 書き込むデータ
+		/// @return 書き込みに成功した場合 true, それ以外の場合は false
+		bool write(const Concept::TriviallyCopyable auto& src);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	flush
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 内部でバッファリングされているデータを書き出し先へ書き出します。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark フレームは終了しないため、続けて書き込むことができます。
+		bool flush();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	finish
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込み中のフレームを終了します。
+		/// @return フレームの終了に成功した場合 true, それ以外の場合は false
+		/// @remark この後に書き込んだデータは新しいフレームになります。
+		bool finish();
+
+	private:
+
+		class CompressionWriterDetail;
+
+		std::shared_ptr<CompressionWriterDetail> pImpl;
+	};
+}
+
+# include "detail/CompressionWriter.ipp"
@@ -0,0 +1,139 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Blob.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	Compressor
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief Zstandard 方式の圧縮器
+	/// @remark 圧縮コンテキストを呼び出し間で再利用するため、小さなデータを繰り返し圧縮する場合に `Compression::Compress()` より効率的です。
+	/// @remark 1 つのオブジェクトを複数のスレッドから同時に使用することはできません。
+	class Compressor
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトの圧縮レベルで圧縮器を作成します。
+		[[nodiscard]]
+		Compressor();
+
+		/// @brief 圧縮器を作成します。
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		[[nodiscard]]
+		explicit Compressor(int32 compressionLevel);
+
+		/// @brief 辞書を使う圧縮器を作成します。
+		/// @param dictionary 辞書。`Compression::TrainDictionary()` で作成したものを使います。
+		/// @param compressionLevel 圧縮レベル（1 ～ 22）
+		/// @remark 圧縮したデータを展開するには、同じ辞書を使う `Decompressor` が必要です。
+		[[nodiscard]]
+		explicit Compressor(const Blob& dictionary, int32 compressionLevel = Compression::DefaultLevel);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isValid
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮器が使用可能であるかを返します。
+		/// @return 使用可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isValid() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮器が使用可能であるかを返します。
+		/// @return 使用可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	compressionLevel
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮レベルを返します。
+		/// @return 圧縮レベル
+		[[nodiscard]]
+		int32 compressionLevel() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	hasDictionary
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 辞書を使っているかを返します。
+		/// @return 辞書を使っている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool hasDictionary() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	compress
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief バイナリデータを圧縮します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @return 圧縮されたデータ
+		[[nodiscard]]
+		Blob compress(const void* data, size_t size);
+
+		/// @brief バイナリデータを圧縮します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param dst 圧縮されたデータの格納先
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		/// @remark dst の容量は再利用されます。
+		bool compress(const void* data, size_t size, Blob& dst);
+
+		/// @brief バイナリデータを圧縮します。
+		/// @param blob 圧縮するデータ
+		/// @return 圧縮されたデータ
+		[[nodiscard]]
+		Blob compress(const Blob& blob);
+
+		/// @brief バイナリデータを圧縮します。
+		/// @param blob 圧縮するデータ
+		/// @param dst 圧縮されたデータの格納先
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		/// @remark dst の容量は再利用されます。
+		bool compress(const Blob& blob, Blob& dst);
+
+	private:
+
+		class CompressorDetail;
+
+		std::shared_ptr<CompressorDetail> pImpl;
+	};
+}
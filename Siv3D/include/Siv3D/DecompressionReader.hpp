@@ -0,0 +1,232 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IReader.hpp"
+# include "Blob.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	DecompressionReader
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 別の IReader から Zstandard 方式で圧縮されたデータを読み込み、逐次展開する Reader
+	/// @remark 展開したデータ全体をメモリに置く必要がないため、大きなデータを少しずつ処理できます。
+	class DecompressionReader : public IReader
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		DecompressionReader();
+
+		/// @brief 圧縮されたデータの読み込み元を IReader で指定して開きます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader 圧縮されたデータの読み込み元
+		template <class Reader>
+			requires (std::is_base_of_v<IReader, Reader> && (not std::is_lvalue_reference_v<Reader>))
+		[[nodiscard]]
+		explicit DecompressionReader(Reader&& reader);
+
+		/// @brief 圧縮されたデータの読み込み元を IReader で指定して開きます。
+		/// @param reader 圧縮されたデータの読み込み元
+		[[nodiscard]]
+		explicit DecompressionReader(std::unique_ptr<IReader>&& reader);
+
+		/// @brief 圧縮されたデータの読み込み元を IReader で指定し、辞書を使って開きます。
+		/// @param reader 圧縮されたデータの読み込み元
+		/// @param dictionary 圧縮に使用した辞書
+		[[nodiscard]]
+		DecompressionReader(std::unique_ptr<IReader>&& reader, const Blob& dictionary);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	open
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮されたデータの読み込み元を IReader で指定して開きます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader 圧縮されたデータの読み込み元
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Reader>
+			requires (std::is_base_of_v<IReader, Reader> && (not std::is_lvalue_reference_v<Reader>))
+		bool open(Reader&& reader);
+
+		/// @brief 圧縮されたデータの読み込み元を IReader で指定して開きます。
+		/// @param reader 圧縮されたデータの読み込み元
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		/// @brief 圧縮されたデータの読み込み元を IReader で指定し、辞書を使って開きます。
+		/// @param reader 圧縮されたデータの読み込み元
+		/// @param dictionary 圧縮に使用した辞書
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IReader>&& reader, const Blob& dictionary);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	close
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 読み込み元の IReader を破棄して閉じます。
+		void close();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	supportsLookahead
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief lookahead をサポートしているかを返します。
+		/// @return false
+		[[nodiscard]]
+		bool supportsLookahead() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isOpen
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを読み込み可能であるかを返します。
+		/// @return 読み込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを読み込み可能であるかを返します。
+		/// @return 読み込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	size
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 展開後のデータのサイズを返します。
+		/// @return 展開後のデータのサイズ（バイト）。サイズが不明な場合は -1
+		/// @remark 読み込み元が複数のフレームを含む場合、すべてのフレームのサイズの合計を返します。
+		/// @remark CompressionWriter で書き出したデータなど、展開後のサイズが記録されていないフレームを含む場合や、読み込み元のサイズが不明な場合は -1 を返します。その場合は、read() が 0 を返すまで読み込んでください。
+		[[nodiscard]]
+		int64 size() const override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getPos
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の読み込み位置を返します。
+		/// @return 現在の読み込み位置（展開後のデータのバイト数）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setPos
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 読み込み位置を変更します。
+		/// @param pos 新しい読み込み位置（展開後のデータのバイト数）
+		/// @return 新しい読み込み位置（バイト）
+		/// @remark 前方へは展開しながら読み飛ばします。後方へ戻る場合は先頭から展開し直すため、読み込み元が setPos() をサポートしている必要があります。
+		int64 setPos(int64 pos) override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	skip
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを展開しながら読み飛ばします。
+		/// @param offset 読み飛ばすサイズ（バイト）
+		/// @return 新しい読み込み位置（バイト）
+		int64 skip(int64 offset) override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	read
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを展開して読み込み、その分読み込み位置を前進させます。
+		/// @param dst 読み込んだデータの格納先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 size) override;
+
+		/// @brief 指定した位置からデータを展開して読み込みます。
+		/// @param dst 読み込んだデータの格納先
+		/// @param pos 先頭から数えた読み込み開始位置（展開後のデータのバイト数）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 pos, int64 size) override;
+
+		/// @brief データを展開して読み込み、その分読み込み位置を前進させます。
+		/// @param dst 読み込んだデータの格納先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		bool read(Concept::TriviallyCopyable auto& dst);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	lookahead
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief サポートしていません。
+		/// @return 0
+		int64 lookahead(void* dst, int64 size) const override;
+
+		/// @brief サポートしていません。
+		/// @return 0
+		int64 lookahead(void* dst, int64 pos, int64 size) const override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	hasError
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 展開中にエラーが発生したかを返します。
+		/// @return 圧縮されたデータが壊れているなどの理由で展開に失敗した場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool hasError() const noexcept;
+
+	private:
+
+		class DecompressionReaderDetail;
+
+		std::shared_ptr<DecompressionReaderDetail> pImpl;
+	};
+}
+
+# include "detail/DecompressionReader.ipp"
@@ -0,0 +1,120 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Blob.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	Decompressor
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief Zstandard 方式の展開器
+	/// @remark 展開コンテキストを呼び出し間で再利用するため、小さなデータを繰り返し展開する場合に `Compression::Decompress()` より効率的です。
+	/// @remark 1 つのオブジェクトを複数のスレッドから同時に使用することはできません。
+	class Decompressor
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 展開器を作成します。
+		[[nodiscard]]
+		Decompressor();
+
+		/// @brief 辞書を使う展開器を作成します。
+		/// @param dictionary 圧縮に使用した辞書
+		[[nodiscard]]
+		explicit Decompressor(const Blob& dictionary);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isValid
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 展開器が使用可能であるかを返します。
+		/// @return 使用可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isValid() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 展開器が使用可能であるかを返します。
+		/// @return 使用可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	hasDictionary
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 辞書を使っているかを返します。
+		/// @return 辞書を使っている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool hasDictionary() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	decompress
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮されたデータを展開します。
+		/// @param data 圧縮されたデータの先頭ポインタ
+		/// @param size 圧縮されたデータのサイズ（バイト）
+		/// @return 展開されたデータ
+		[[nodiscard]]
+		Blob decompress(const void* data, size_t size);
+
+		/// @brief 圧縮されたデータを展開します。
+		/// @param data 圧縮されたデータの先頭ポインタ
+		/// @param size 圧縮されたデータのサイズ（バイト）
+		/// @param dst 展開されたデータの格納先
+		/// @return 展開に成功した場合 true, それ以外の場合は false
+		/// @remark dst の容量は再利用されます。
+		bool decompress(const void* data, size_t size, Blob& dst);
+
+		/// @brief 圧縮されたデータを展開します。
+		/// @param blob 圧縮されたデータ
+		/// @return 展開されたデータ
+		[[nodiscard]]
+		Blob decompress(const Blob& blob);
+
+		/// @brief 圧縮されたデータを展開します。
+		/// @param blob 圧縮されたデータ
+		/// @param dst 展開されたデータの格納先
+		/// @return 展開に成功した場合 true, それ以外の場合は false
+		/// @remark dst の容量は再利用されます。
+		bool decompress(const Blob& blob, Blob& dst);
+
+	private:
+
+		class DecompressorDetail;
+
+		std::shared_ptr<DecompressorDetail> pImpl;
+	};
+}
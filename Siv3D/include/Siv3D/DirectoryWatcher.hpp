@@ -14,6 +14,7 @@
 # include "FileChange.hpp"
 # include "Optional.hpp"
 # include "Array.hpp"
+# include "Duration.hpp"
 
 namespace s3d
 {
@@ -28,6 +29,9 @@ namespace s3d
 	{
 	public:
 
+		/// @brief 同じファイルへの変更をまとめる時間のデフォルト
+		static constexpr Duration DefaultCoalescingWindow{ 0.25 };
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	(constructor)
@@ -41,8 +45,11 @@ namespace s3d
 		/// @brief ディレクトリを監視を開始します。
 		/// @param directory 監視するディレクトリ
 		/// @param applicableExtensions 監視するファイルの拡張子。空の場合はすべてのファイルを監視します。
+		/// @param coalescingWindow 同じファイルへの変更を 1 つにまとめる時間
+		/// @remark Linux では、最初の変更から coalescingWindow の間に同じファイルに対して発生した変更（作成・変更・削除・名前の変更）を 1 つにまとめてから `retrieveChanges()` に渡します。
+		/// @remark macOS では FSEvents の latency として使われます。Windows では使われません。
 		[[nodiscard]]
-		explicit DirectoryWatcher(FilePathView directory, const Array<String>& applicableExtensions = {});
+		explicit DirectoryWatcher(FilePathView directory, const Array<String>& applicableExtensions = {}, const Duration& coalescingWindow = DefaultCoalescingWindow);
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -0,0 +1,104 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Array.hpp"
+# include "FloatRect.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	DrawCallInfo
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 並べ替えの対象となる 1 つの描画コール
+	struct DrawCallInfo
+	{
+		/// @brief 描画ステートの ID. 同じ ID の描画コールは 1 つに統合できます。
+		uint32 stateID = 0;
+
+		/// @brief 描画される領域のバウンディングボックス
+		FloatRect bounds{ 0.0f, 0.0f, 0.0f, 0.0f };
+
+		/// @brief インデックスの数
+		uint32 indexCount = 0;
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	MergedDrawCall
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 並べ替えの後、統合された描画コール
+	struct MergedDrawCall
+	{
+		/// @brief 描画ステートの ID
+		uint32 stateID = 0;
+
+		/// @brief DrawCallReorderResult::order の中で、この描画コールに含まれる最初の要素の位置
+		uint32 first = 0;
+
+		/// @brief この描画コールに含まれる、元の描画コールの数
+		uint32 count = 0;
+
+		/// @brief インデックスの数の合計
+		uint32 indexCount = 0;
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	DrawCallReorderResult
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 描画コールの並べ替えの結果
+	struct DrawCallReorderResult
+	{
+		/// @brief 並べ替え後の、元の描画コールのインデックス
+		Array<uint32> order;
+
+		/// @brief 統合された描画コール
+		Array<MergedDrawCall> drawCalls;
+
+		/// @brief 統合によって削減された描画コールの数を返します。
+		/// @return 統合によって削減された描画コールの数
+		[[nodiscard]]
+		size_t numSaved() const noexcept
+		{
+			return (order.size() - drawCalls.size());
+		}
+	};
+
+	namespace DrawCallReorder
+	{
+		/// @brief 同じステートの描画コールを探すときに、さかのぼる描画コールの数のデフォルト
+		inline constexpr size_t DefaultLookback = 64;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Reorder
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 描画結果を変えない範囲で描画コールを並べ替え、同じステートの描画コールを統合します。
+		/// @param drawCalls 描画コールの配列（描画順）
+		/// @param lookback 同じステートの描画コールを探すときに、さかのぼる（統合後の）描画コールの数の上限
+		/// @return 並べ替えの結果
+		/// @remark 各描画コールは、バウンディングボックスが重なるより前の描画コールを追い越しません。
+		/// @remark バウンディングボックスが重ならない描画コールどうしは、描画順を入れ替えても結果が変わらないことを前提とします。
+		[[nodiscard]]
+		DrawCallReorderResult Reorder(std::span<const DrawCallInfo> drawCalls, size_t lookback = DefaultLookback);
+	}
+}
@@ -0,0 +1,52 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "../Error.hpp"
+# include "../String.hpp"
+
+namespace s3d
+{	
+	////////////////////////////////////////////////////////////////
+	//
+	//	TaskCanceledError
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 非同期処理のタスクがキャンセルされたことを表すエラー | Error indicating that an asynchronous task was canceled
+	class TaskCanceledError final : public Error
+	{
+	public:
+
+		using Error::Error;
+
+		/// @brief エラーを作成します。 | Creates an error.
+		/// @param location エラーの発生箇所 | Error location
+		[[nodiscard]]
+		explicit TaskCanceledError(const std::source_location& location = std::source_location::current())
+			: Error{ "The task was canceled.", location } {}
+		
+		////////////////////////////////////////////////////////////////
+		//
+		//	type
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief エラーの種類を返します。 | Returns the type of the error.
+		/// @return U"TaskCanceledError"
+		[[nodiscard]]
+		constexpr String type() const override
+		{
+			return U"TaskCanceledError";
+		}
+	};
+}
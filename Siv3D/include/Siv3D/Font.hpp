@@ -11,12 +11,15 @@
 
 # pragma once
 # include "Common.hpp"
+# include "Array.hpp"
 # include "AssetHandle.hpp"
 # include "FontMethod.hpp"
 # include "FontStyle.hpp"
 # include "GlyphIndex.hpp"
 # include "GlyphInfo.hpp"
 # include "ResolvedGlyph.hpp"
+# include "PredefinedYesNo.hpp"
+# include "FontCacheStat.hpp"
 
 namespace s3d
 {
@@ -340,6 +343,55 @@ namespace s3d
 		[[nodiscard]]
 		double getYAdvanceFromGlyphIndex(GlyphIndex glyphIndex) const;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	getResolvedGlyphs
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列をシェーピングし、グリフの配列を返します。
+		/// @param s 文字列
+		/// @param ligature リガチャを有効にするか
+		/// @return グリフの配列
+		/// @remark シェーピングの結果は文字列ごとに LRU キャッシュに保存され、同じ文字列では再利用されます。
+		[[nodiscard]]
+		Array<ResolvedGlyph> getResolvedGlyphs(StringView s, Ligature ligature = Ligature::Yes) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	preload
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列に含まれるグリフをあらかじめラスタライズし、グリフキャッシュに追加します。
+		/// @param chars 文字列
+		/// @return すべてのグリフをキャッシュできた場合 true, それ以外の場合は false
+		/// @remark キャッシュに無いグリフはまとめて並列にラスタライズされます。多くの文字を使う場合、個別に追加するよりも高速です。
+		/// @remark シェーピングキャッシュには追加されず、キャッシュのヒット数・ミス数も変化しません。
+		bool preload(StringView chars) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getCacheStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief グリフキャッシュとシェーピングキャッシュの統計情報を返します。
+		/// @return キャッシュの統計情報
+		[[nodiscard]]
+		FontCacheStat getCacheStat() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setShapingCacheCapacity
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief シェーピングキャッシュに保存する文字列の最大数を設定します。
+		/// @param capacity 保存する文字列の最大数。0 の場合はキャッシュしません。
+		/// @return *this
+		const Font& setShapingCacheCapacity(size_t capacity) const;
+
 
 
 
@@ -0,0 +1,71 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "PointVector.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	FontCacheStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief フォントのキャッシュの統計情報
+	struct FontCacheStat
+	{
+		/// @brief グリフキャッシュに見つかったグリフの参照回数
+		uint64 glyphHits = 0;
+
+		/// @brief グリフキャッシュに見つからず、ラスタライズしたグリフの参照回数
+		uint64 glyphMisses = 0;
+
+		/// @brief キャッシュされているグリフの数
+		uint32 cachedGlyphs = 0;
+
+		/// @brief グリフアトラスの幅と高さ（ピクセル）
+		Size atlasSize{ 0, 0 };
+
+		/// @brief グリフアトラスのうち、グリフが配置されている領域の面積（ピクセル）
+		int64 atlasUsedArea = 0;
+
+		/// @brief シェーピングキャッシュに見つかった文字列の参照回数
+		uint64 shapingHits = 0;
+
+		/// @brief シェーピングキャッシュに見つからず、シェーピングした文字列の参照回数
+		uint64 shapingMisses = 0;
+
+		/// @brief キャッシュされているシェーピング結果の数
+		uint32 cachedShapes = 0;
+
+		/// @brief シェーピングキャッシュの容量
+		uint32 shapingCacheCapacity = 0;
+
+		/// @brief グリフキャッシュのヒット率を返します。
+		/// @return グリフキャッシュのヒット率 [0.0, 1.0]。参照が無い場合は 0.0
+		[[nodiscard]]
+		constexpr double glyphHitRate() const noexcept;
+
+		/// @brief シェーピングキャッシュのヒット率を返します。
+		/// @return シェーピングキャッシュのヒット率 [0.0, 1.0]。参照が無い場合は 0.0
+		[[nodiscard]]
+		constexpr double shapingHitRate() const noexcept;
+
+		/// @brief グリフアトラスの使用率を返します。
+		/// @return グリフアトラスの面積に対する、グリフが配置されている領域の割合 [0.0, 1.0]
+		[[nodiscard]]
+		constexpr double atlasOccupancy() const noexcept;
+	};
+}
+
+# include "detail/FontCacheStat.ipp"
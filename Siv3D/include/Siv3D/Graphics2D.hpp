@@ -13,6 +13,7 @@
 # include "Common.hpp"
 # include "PointVector.hpp"
 # include "2DShapes.hpp"
+# include "FloatRect.hpp"
 # include "BlendState.hpp"
 # include "RasterizerState.hpp"
 # include "SamplerState.hpp"
@@ -172,6 +173,67 @@ namespace s3d
 		/// @return 現在のレンダーターゲットのサイズ（ピクセル）
 		[[nodiscard]]
 		Size GetRenderTargetSize() noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	SetDrawCallReorderingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 2D 描画の Draw コール並べ替えの有効無効を設定します（デフォルトでは無効）。
+		/// @param enabled 並べ替えを有効にする場合 true, 無効にする場合 false
+		/// @remark 有効な場合、描画結果が変わらない範囲で、重ならない図形の Draw コールをテクスチャ・シェーダ・ブレンドステートごとにまとめます。
+		/// @remark 削減された Draw コール回数は `Profiler::GetStat().drawCallsSaved` で取得できます。
+		void SetDrawCallReorderingEnabled(bool enabled);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	IsDrawCallReorderingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 2D 描画の Draw コール並べ替えが有効であるかを返します。
+		/// @return 並べ替えが有効である場合 true, 無効である場合 false
+		[[nodiscard]]
+		bool IsDrawCallReorderingEnabled() noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DrawRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 複数の長方形をまとめて描きます。
+		/// @param rects 長方形の配列
+		/// @param color 色
+		/// @remark 長方形ごとに `RectF::draw()` を呼ぶよりも、頂点の構築と描画コマンドの発行のコストが小さくなります。
+		void DrawRects(std::span<const FloatRect> rects, const ColorF& color);
+
+		/// @brief 複数の長方形をまとめて描きます。
+		/// @param rects 長方形の配列
+		/// @param colors 各長方形の色。`rects` と同じ要素数である必要があります。
+		/// @throw Error 要素数が一致しない場合
+		void DrawRects(std::span<const FloatRect> rects, std::span<const Float4> colors);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DrawCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 同じ半径の複数の円をまとめて描きます。
+		/// @param centers 円の中心座標の配列
+		/// @param r 円の半径
+		/// @param color 色
+		/// @remark 円ごとに `Circle::draw()` を呼ぶよりも、頂点の構築と描画コマンドの発行のコストが小さくなります。
+		void DrawCircles(std::span<const Float2> centers, float r, const ColorF& color);
+
+		/// @brief 複数の円をまとめて描きます。
+		/// @param centers 円の中心座標の配列
+		/// @param rs 各円の半径。`centers` と同じ要素数である必要があります。
+		/// @param colors 各円の色。`centers` と同じ要素数である必要があります。
+		/// @throw Error 要素数が一致しない場合
+		void DrawCircles(std::span<const Float2> centers, std::span<const float> rs, std::span<const Float4> colors);
 	}
 }
 
@@ -18,6 +18,7 @@
 # include "Optional.hpp"
 # include "Grid.hpp"
 # include "PredefinedYesNo.hpp"
+# include "ImageDecodeOptions.hpp"
 
 namespace s3d
 {
@@ -124,6 +125,16 @@ namespace s3d
 		/// @return デコードされた画像
 		[[nodiscard]]
 		virtual Image decode(IReader& reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha) const = 0;
+
+		/// @brief 縮小やデコードする範囲を指定して、画像ファイルをデコードします。
+		/// @param reader IReader
+		/// @param pathHint 画像ファイルのパス（わかる場合）
+		/// @param options デコード方法
+		/// @return デコードされた画像
+		/// @remark デフォルトの実装は、画像全体をデコードしてから範囲を切り出します。縮小は行いません。
+		/// @remark 縮小や範囲の指定によってデコードの処理を減らせるデコーダは、この関数をオーバーライドします。
+		[[nodiscard]]
+		virtual Image decode(IReader& reader, FilePathView pathHint, const ImageDecodeOptions& options) const;
 	
 		////////////////////////////////////////////////////////////////
 		//
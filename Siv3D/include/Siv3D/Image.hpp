@@ -150,6 +150,37 @@ namespace s3d
 		[[nodiscard]]
 		Image(Size size, Arg::generator0_1_<FunctionRef<Color(Vec2)>> generator);
 
+		/// @brief 各ピクセルの色を関数で生成して画像データを作成します（並列実行）。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param generator ピクセルの座標 (x, y) から色を返す関数。複数のスレッドから同時に呼ばれます。
+		[[nodiscard]]
+		Image(Size size, Arg::parallelGenerator_<FunctionRef<Color(int32, int32)>> generator);
+
+		/// @brief 各ピクセルの色を関数で生成して画像データを作成します（並列実行）。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param generator ピクセルの座標から色を返す関数。複数のスレッドから同時に呼ばれます。
+		[[nodiscard]]
+		Image(Size size, Arg::parallelGenerator_<FunctionRef<Color(Point)>> generator);
+
+		/// @brief 各ピクセルの色を関数で生成して画像データを作成します（並列実行）。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param generator ピクセルの中心の正規化座標 (0.0-1.0) から色を返す関数。複数のスレッドから同時に呼ばれます。
+		[[nodiscard]]
+		Image(Size size, Arg::parallelGenerator0_1_<FunctionRef<Color(double, double)>> generator);
+
+		/// @brief 各ピクセルの色を関数で生成して画像データを作成します（並列実行）。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param generator ピクセルの中心の正規化座標 (0.0-1.0) から色を返す関数。複数のスレッドから同時に呼ばれます。
+		[[nodiscard]]
+		Image(Size size, Arg::parallelGenerator0_1_<FunctionRef<Color(Vec2)>> generator);
+
+		/// @brief 1 行ずつ関数で書き込んで画像データを作成します（並列実行）。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param generator 行の y 座標と、その行のピクセル列を受け取り、ピクセル列を書き込む関数。複数のスレッドから同時に呼ばれます。
+		/// @remark 関数の呼び出しは 1 行につき 1 回なので、ピクセルごとの呼び出しのコストがかからず、関数の中で SIMD 命令を使うこともできます。
+		[[nodiscard]]
+		Image(Size size, Arg::rowGenerator_<FunctionRef<void(int32, std::span<Color>)>> generator);
+
 		/// @brief 画像ファイルの内容から画像データを作成します。
 		/// @param path 画像ファイルのパス
 		/// @param premultiplyAlpha アルファ乗算処理を適用するか
@@ -617,6 +648,52 @@ namespace s3d
 		/// @remark 高さが増えた部分は `fillColor` で塗りつぶされます。
 		void resizeHeight(size_t height, Color fillColor);
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	parallel_count_if
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 条件を満たすピクセルの個数を返します（並列実行）。
+		/// @tparam Fty 条件を記述した関数の型
+		/// @param f 条件を記述した関数
+		/// @return 条件を満たすピクセルの個数
+		template <class Fty>
+		[[nodiscard]]
+		isize parallel_count_if(Fty f) const requires std::predicate<Fty&, const Color&>;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	parallel_each
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief すべてのピクセルに対して関数を並列実行します。
+		/// @tparam Fty 関数の型
+		/// @param f 関数
+		template <class Fty>
+		void parallel_each(Fty f) requires std::invocable<Fty&, Color&>;
+
+		/// @brief すべてのピクセルに対して関数を並列実行します。
+		/// @tparam Fty 関数の型
+		/// @param f 関数
+		template <class Fty>
+		void parallel_each(Fty f) const requires std::invocable<Fty&, const Color&>;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	parallel_map
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief すべてのピクセルに対して関数を適用した結果からなる新しい画像を返します（並列実行）。
+		/// @tparam Fty 関数の型
+		/// @param f ピクセルの色から新しい色を返す関数
+		/// @return 新しい画像
+		template <class Fty>
+		[[nodiscard]]
+		Image parallel_map(Fty f) const requires std::is_invocable_r_v<Color, Fty&, const Color&>;
+
 
 
 
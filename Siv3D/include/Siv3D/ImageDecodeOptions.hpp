@@ -0,0 +1,58 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "Common.hpp"
+# include "PointVector.hpp"
+# include "Rect.hpp"
+# include "Optional.hpp"
+# include "PredefinedYesNo.hpp"
+# include "Utility.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ImageDecodeOptions
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 画像のデコード方法の指定
+	struct ImageDecodeOptions
+	{
+		/// @brief アルファ乗算処理を適用するか
+		PremultiplyAlpha premultiplyAlpha = PremultiplyAlpha::Yes;
+
+		/// @brief 縮小してデコードする場合の目標サイズ（デコードする範囲を縮小した後のサイズ）
+		/// @remark デコーダは、幅と高さがともに目標サイズ以上になる範囲で、できるだけ小さくデコードします。縮小に対応していないデコーダは元のサイズでデコードします。
+		Optional<Size> targetSize;
+
+		/// @brief デコードする範囲（元の画像の座標）。none の場合は画像全体
+		/// @remark 画像の外側の部分は無視されます。
+		Optional<Rect> region;
+
+		/// @brief 画像のサイズに対して、実際にデコードする範囲を返します。
+		/// @param imageSize 元の画像のサイズ
+		/// @return `region` と画像の共通部分。`region` が none の場合は画像全体
+		[[nodiscard]]
+		constexpr Rect getRegion(Size imageSize) const noexcept;
+
+		/// @brief 指定した縮小率の候補から、`targetSize` を満たす最も小さい縮小率を選びます。
+		/// @param regionSize デコードする範囲のサイズ
+		/// @param maxDenominator 縮小率 1/n の n の最大値（2 の累乗）
+		/// @return 縮小率 1/n の n
+		[[nodiscard]]
+		constexpr int32 getScaleDenominator(Size regionSize, int32 maxDenominator) const noexcept;
+	};
+}
+
+# include "detail/ImageDecodeOptions.ipp"
@@ -12,6 +12,7 @@
 # pragma once
 # include "Common.hpp"
 # include "IImageDecoder.hpp"
+# include "ImageDecoderStat.hpp"
 
 namespace s3d
 {
@@ -58,6 +59,23 @@ namespace s3d
 		/// @return デコードされた画像、デコードに失敗した場合は空の画像
 		[[nodiscard]]
 		Image Decode(IReader& reader, PremultiplyAlpha premultiplyAlpha, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 縮小やデコードする範囲を指定して、画像ファイルをデコードします。
+		/// @param path 画像ファイルのパス
+		/// @param options デコード方法
+		/// @param imageFormat 画像フォーマット、指定しない場合はファイルの拡張子から判断
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		/// @remark JPEG は DCT 領域で縮小し、範囲を含む MCU だけをデコードします。PNG は範囲の最後の行までだけをデコードします。
+		[[nodiscard]]
+		Image Decode(FilePathView path, const ImageDecodeOptions& options, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 縮小やデコードする範囲を指定して、画像ファイルをデコードします。
+		/// @param reader 画像ファイルをさす IReader
+		/// @param options デコード方法
+		/// @param imageFormat 画像フォーマット、指定しない場合はファイルの拡張子から判断
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		[[nodiscard]]
+		Image Decode(IReader& reader, const ImageDecodeOptions& options, ImageFormat imageFormat = ImageFormat::Unspecified);
 	
 		////////////////////////////////////////////////////////////////
 		//
@@ -78,6 +96,82 @@ namespace s3d
 		/// @return デコードされた 16-bit グレースケール画像、デコードに失敗した場合は空の画像
 		[[nodiscard]]
 		Grid<uint16> DecodeGray16(IReader& reader, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DecodeBatch
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 複数の画像ファイルを並列にデコードします。
+		/// @param paths 画像ファイルのパスの一覧
+		/// @param premultiplyAlpha アルファ乗算処理を適用するか
+		/// @param imageFormat 画像フォーマット、指定しない場合はファイルのヘッダと拡張子から判断
+		/// @return paths と同じ順に並べたデコードされた画像。デコードに失敗したファイルは空の画像
+		/// @remark ファイルはメモリマップトファイルとして開き、コピーせずにデコードします。
+		/// @remark キャッシュ容量が 0 でない場合は、ファイルの内容が同じ画像をキャッシュから返します。
+		/// @remark デコード中に `Add()` や `Remove()` を呼んではいけません。
+		[[nodiscard]]
+		Array<Image> DecodeBatch(const Array<FilePath>& paths, PremultiplyAlpha premultiplyAlpha, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 縮小やデコードする範囲を指定して、複数の画像ファイルを並列にデコードします。
+		/// @param paths 画像ファイルのパスの一覧
+		/// @param options デコード方法
+		/// @param imageFormat 画像フォーマット、指定しない場合はファイルのヘッダと拡張子から判断
+		/// @return paths と同じ順に並べたデコードされた画像。デコードに失敗したファイルは空の画像
+		[[nodiscard]]
+		Array<Image> DecodeBatch(const Array<FilePath>& paths, const ImageDecodeOptions& options, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	SetCacheCapacity
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `DecodeBatch()` がデコードした画像を保持するキャッシュの容量を設定します。
+		/// @param capacityBytes キャッシュ容量（バイト）。0 の場合はキャッシュしません。
+		/// @remark デフォルトでは 0 です。容量を超えた場合は、最も長い間使われていない画像を破棄します。
+		void SetCacheCapacity(size_t capacityBytes);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetCacheCapacity
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `DecodeBatch()` のキャッシュの容量を返します。
+		/// @return キャッシュ容量（バイト）
+		[[nodiscard]]
+		size_t GetCacheCapacity() noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ClearCache
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `DecodeBatch()` のキャッシュに保持されている画像をすべて破棄します。
+		void ClearCache();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 画像デコーダごとのデコード時間と、キャッシュの統計情報を返します。
+		/// @return 画像デコーダの統計情報
+		[[nodiscard]]
+		ImageDecoderStat GetStat();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ResetStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デコード時間と、キャッシュのヒット数・ミス数を 0 にします。
+		void ResetStat();
 	
 		////////////////////////////////////////////////////////////////
 		//
@@ -0,0 +1,85 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "ImageFormat.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ImageDecodeTiming
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 画像デコーダごとのデコード時間の統計
+	struct ImageDecodeTiming
+	{
+		/// @brief 画像フォーマット
+		ImageFormat imageFormat = ImageFormat::Unknown;
+
+		/// @brief 画像デコーダの名前
+		String decoderName;
+
+		/// @brief デコードした回数
+		uint64 decodeCount = 0;
+
+		/// @brief デコードにかかった合計時間（ミリ秒）
+		double totalMillisec = 0.0;
+
+		/// @brief 1 回のデコードにかかった時間の最大値（ミリ秒）
+		double maxMillisec = 0.0;
+
+		/// @brief 1 回のデコードにかかった時間の平均を返します。
+		/// @return 1 回のデコードにかかった時間の平均（ミリ秒）。デコードしていない場合は 0.0
+		[[nodiscard]]
+		constexpr double averageMillisec() const noexcept;
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ImageDecoderStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 画像デコーダの統計情報
+	struct ImageDecoderStat
+	{
+		/// @brief 画像デコーダごとのデコード時間。一度もデコードしていない画像デコーダは含まれません。
+		Array<ImageDecodeTiming> timings;
+
+		/// @brief `ImageDecoder::DecodeBatch()` で、キャッシュに見つかった画像の数
+		uint64 cacheHits = 0;
+
+		/// @brief `ImageDecoder::DecodeBatch()` で、キャッシュに見つからずデコードした画像の数
+		uint64 cacheMisses = 0;
+
+		/// @brief キャッシュされている画像の数
+		uint32 cachedImages = 0;
+
+		/// @brief キャッシュされている画像の合計サイズ（バイト）
+		size_t cachedBytes = 0;
+
+		/// @brief キャッシュの容量（バイト）
+		size_t cacheCapacityBytes = 0;
+
+		/// @brief キャッシュのヒット率を返します。
+		/// @return キャッシュのヒット率 [0.0, 1.0]。参照が無い場合は 0.0
+		[[nodiscard]]
+		constexpr double cacheHitRate() const noexcept;
+	};
+}
+
+# include "detail/ImageDecoderStat.ipp"
@@ -13,7 +13,44 @@
 # include <Siv3D/IImageEncoder.hpp>
 
 namespace s3d
-{	
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	BCnEncodeOptions
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief BCn エンコードのオプション
+	struct BCnEncodeOptions
+	{
+		/// @brief BC1 / BC3 のカラーブロックの品質レベル（0 ～ 18）
+		/// @remark 大きいほど高品質ですが、エンコードに時間がかかります。
+		uint32 bc1QualityLevel = 18;
+
+		/// @brief BC3 のアルファブロック、BC4 / BC5 の探索半径（1 ～ 32）
+		uint32 bc345SearchRadius = 3;
+
+		/// @brief BC7 の品質レベル（0 ～ 4）
+		/// @remark 大きいほど高品質ですが、エンコードに時間がかかります。
+		uint32 bc7UberLevel = 0;
+
+		/// @brief BC7 のモード 1 / 7 で探索するパーティションの最大数（0 ～ 64）
+		uint32 bc7MaxPartitions = 64;
+
+		/// @brief BC7 の誤差を知覚的な色空間で評価するか
+		bool perceptual = true;
+
+		/// @brief RDO (Rate Distortion Optimization) の強さ
+		/// @remark 0 より大きい場合、画質を少し犠牲にして、エンコード結果を LZ 系の圧縮で小さくなりやすいブロック列に置き換えます。一般的な値は 0.5 ～ 4.0 です。
+		float rdoLambda = 0.0f;
+
+		/// @brief RDO で一致するブロックを探索する範囲（バイト）
+		uint32 rdoLookbackWindowSize = 128;
+
+		/// @brief RDO で滑らかなブロックの誤差に掛ける係数。0 の場合は rdoLambda から自動で決定します。
+		float rdoSmoothBlockErrorScale = 0.0f;
+	};
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	BCnEncoder
@@ -103,10 +140,22 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC1(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		/// @brief Image を BC1 形式でエンコードして書き出します。
+		/// @param image エンコードする Image
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックのエンコードは複数のスレッドで並列に行われます。
+		bool encodeBC1(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
+		/// @brief Image を BC1 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC1(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC1(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -114,10 +163,22 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC3(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		/// @brief Image を BC3 形式でエンコードして書き出します。
+		/// @param image エンコードする Image
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックのエンコードは複数のスレッドで並列に行われます。
+		bool encodeBC3(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
+		/// @brief Image を BC3 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC3(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC3(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -125,10 +186,22 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC4(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		/// @brief Image を BC4 形式でエンコードして書き出します。
+		/// @param image エンコードする Image
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックのエンコードは複数のスレッドで並列に行われます。
+		bool encodeBC4(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
+		/// @brief Image を BC4 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC4(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC4(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -136,10 +209,22 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC5(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		/// @brief Image を BC5 形式でエンコードして書き出します。
+		/// @param image エンコードする Image
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックのエンコードは複数のスレッドで並列に行われます。
+		bool encodeBC5(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
+		/// @brief Image を BC5 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC5(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC5(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -147,9 +232,21 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC7(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		/// @brief Image を BC7 形式でエンコードして書き出します。
+		/// @param image エンコードする Image
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックのエンコードは複数のスレッドで並列に行われます。
+		bool encodeBC7(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 
+		/// @brief Image を BC7 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param options エンコードのオプション
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC7(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC7(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, const BCnEncodeOptions& options = {}) const;
 	};
 }
@@ -109,5 +109,14 @@ namespace s3d
 		/// @return 作成した Image
 		[[nodiscard]]
 		Image decode(IReader& reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha) const override;
+
+		/// @brief 縮小やデコードする範囲を指定して、JPEG 形式の画像データをデコードします。
+		/// @param reader 画像データの IReader インタフェース
+		/// @param pathHint ファイルパス（オプション）
+		/// @param options デコード方法（`premultiplyAlpha` は無視されます）
+		/// @return 作成した Image
+		/// @remark 縮小は DCT 領域での 1/2, 1/4, 1/8 のスケーリングで行います。範囲を指定した場合は、範囲を含む MCU の列と行だけをデコードします。
+		[[nodiscard]]
+		Image decode(IReader& reader, FilePathView pathHint, const ImageDecodeOptions& options) const override;
 	};
 }
@@ -110,6 +110,15 @@ namespace s3d
 		[[nodiscard]]
 		Image decode(IReader& reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha) const override;
 
+		/// @brief デコードする範囲を指定して、PNG 形式の画像データをデコードします。
+		/// @param reader 画像データの IReader インタフェース
+		/// @param pathHint ファイルパス（オプション）
+		/// @param options デコード方法（`targetSize` は無視されます）
+		/// @return 作成した Image
+		/// @remark 範囲を指定した場合は、範囲の最後の行までを 1 行ずつデコードし、範囲内の画素だけを保持します。インターレースされた画像では画像全体をデコードします。
+		[[nodiscard]]
+		Image decode(IReader& reader, FilePathView pathHint, const ImageDecodeOptions& options) const override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	decodeGray16
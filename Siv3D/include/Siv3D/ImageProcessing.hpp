@@ -10,8 +10,12 @@
 //-----------------------------------------------
 
 # pragma once
+# include <array>
 # include "Common.hpp"
 # include "PointVector.hpp"
+# include "Array.hpp"
+# include "Grid.hpp"
+# include "ResampleFilter.hpp"
 
 namespace s3d
 {
@@ -28,6 +32,315 @@ namespace s3d
 
 		[[nodiscard]]
 		Image Resize(const Image& src, const Size& size);
+
+		/// @brief 指定したフィルタで画像をリサンプリングします。
+		/// @param src 元の画像
+		/// @param size 新しい幅と高さ（ピクセル）
+		/// @param filter リサンプリングに使うフィルタ
+		/// @return リサンプリングした画像
+		/// @remark 処理は行の帯ごとに複数のスレッドで並列に行われます。
+		[[nodiscard]]
+		Image Resample(const Image& src, const Size& size, ResampleFilter filter = ResampleFilter::Mitchell);
+
+		/// @brief 指定したフィルタで画像をリサンプリングし、結果を dst に書き込みます。
+		/// @param src 元の画像
+		/// @param dst 書き込み先の画像。現在の幅と高さが出力のサイズになります。
+		/// @param filter リサンプリングに使うフィルタ
+		/// @remark `src` と `dst` に同じ画像を渡すこともできます。その場合、元の画像は一時的に複製されます。
+		void Resample(const Image& src, Image& dst, ResampleFilter filter = ResampleFilter::Mitchell);
+
+		/// @brief ミップマップを生成します。
+		/// @param src 元の画像（レベル 0）
+		/// @param mipmaps レベル 1 以降の画像の書き込み先。要素数と各画像のサイズは必要に応じて変更され、既存のメモリは再利用されます。
+		/// @param filter リサンプリングに使うフィルタ
+		/// @remark 各レベルは 1 つ前のレベルから生成されます。
+		void GenerateMipmaps(const Image& src, Array<Image>& mipmaps, ResampleFilter filter = ResampleFilter::Box);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GaussianBlur
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ガウスぼかしをかけた画像を返します。
+		/// @param src 元の画像
+		/// @param sigma ガウス関数の標準偏差（ピクセル）。フィルタの半径は ceil(3 * sigma) になります。
+		/// @return ぼかした画像
+		/// @remark 水平・垂直の 2 回の 1 次元フィルタに分けて処理します。画像の外側は端のピクセルが続くものとして扱います。
+		/// @remark 処理は行の帯ごとに複数のスレッドで並列に行われます。
+		[[nodiscard]]
+		Image GaussianBlur(const Image& src, double sigma);
+
+		/// @brief ガウスぼかしをかけたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param sigma ガウス関数の標準偏差（要素）
+		/// @return ぼかしたグリッド
+		[[nodiscard]]
+		Grid<uint8> GaussianBlur(const Grid<uint8>& src, double sigma);
+
+		/// @brief ガウスぼかしをかけたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param sigma ガウス関数の標準偏差（要素）
+		/// @return ぼかしたグリッド
+		[[nodiscard]]
+		Grid<uint16> GaussianBlur(const Grid<uint16>& src, double sigma);
+
+		/// @brief ガウスぼかしをかけたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param sigma ガウス関数の標準偏差（要素）
+		/// @return ぼかしたグリッド
+		[[nodiscard]]
+		Grid<float> GaussianBlur(const Grid<float>& src, double sigma);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BoxBlur
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ボックスぼかし（(2 * radius + 1) 四方の平均）をかけた画像を返します。
+		/// @param src 元の画像
+		/// @param radius フィルタの半径（ピクセル）
+		/// @return ぼかした画像
+		/// @remark 累積和を使うため、処理時間は半径によらずほぼ一定です。
+		[[nodiscard]]
+		Image BoxBlur(const Image& src, int32 radius);
+
+		/// @brief ボックスぼかし（(2 * radius + 1) 四方の平均）をかけたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius フィルタの半径（要素）
+		/// @return ぼかしたグリッド
+		[[nodiscard]]
+		Grid<uint8> BoxBlur(const Grid<uint8>& src, int32 radius);
+
+		/// @brief ボックスぼかし（(2 * radius + 1) 四方の平均）をかけたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius フィルタの半径（要素）
+		/// @return ぼかしたグリッド
+		[[nodiscard]]
+		Grid<uint16> BoxBlur(const Grid<uint16>& src, int32 radius);
+
+		/// @brief ボックスぼかし（(2 * radius + 1) 四方の平均）をかけたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius フィルタの半径（要素）
+		/// @return ぼかしたグリッド
+		[[nodiscard]]
+		Grid<float> BoxBlur(const Grid<float>& src, int32 radius);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Convolve
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 3x3 のカーネルで畳み込んだ画像を返します。
+		/// @param src 元の画像
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだ画像
+		/// @remark アルファチャンネルは元の画像の値をそのまま使います。
+		[[nodiscard]]
+		Image Convolve(const Image& src, const std::array<float, 9>& kernel);
+
+		/// @brief 5x5 のカーネルで畳み込んだ画像を返します。
+		/// @param src 元の画像
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだ画像
+		/// @remark アルファチャンネルは元の画像の値をそのまま使います。
+		[[nodiscard]]
+		Image Convolve(const Image& src, const std::array<float, 25>& kernel);
+
+		/// @brief 3x3 のカーネルで畳み込んだグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだグリッド
+		[[nodiscard]]
+		Grid<uint8> Convolve(const Grid<uint8>& src, const std::array<float, 9>& kernel);
+
+		/// @brief 5x5 のカーネルで畳み込んだグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだグリッド
+		[[nodiscard]]
+		Grid<uint8> Convolve(const Grid<uint8>& src, const std::array<float, 25>& kernel);
+
+		/// @brief 3x3 のカーネルで畳み込んだグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだグリッド
+		[[nodiscard]]
+		Grid<uint16> Convolve(const Grid<uint16>& src, const std::array<float, 9>& kernel);
+
+		/// @brief 5x5 のカーネルで畳み込んだグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだグリッド
+		[[nodiscard]]
+		Grid<uint16> Convolve(const Grid<uint16>& src, const std::array<float, 25>& kernel);
+
+		/// @brief 3x3 のカーネルで畳み込んだグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだグリッド
+		[[nodiscard]]
+		Grid<float> Convolve(const Grid<float>& src, const std::array<float, 9>& kernel);
+
+		/// @brief 5x5 のカーネルで畳み込んだグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param kernel カーネル（行優先）
+		/// @return 畳み込んだグリッド
+		[[nodiscard]]
+		Grid<float> Convolve(const Grid<float>& src, const std::array<float, 25>& kernel);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Dilate, Erode
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief (2 * radius + 1) 四方の最大値で膨張させた画像を返します。
+		/// @param src 元の画像
+		/// @param radius 半径（ピクセル）
+		/// @return 膨張させた画像
+		/// @remark 各チャンネルを独立に処理します。
+		[[nodiscard]]
+		Image Dilate(const Image& src, int32 radius = 1);
+
+		/// @brief (2 * radius + 1) 四方の最大値で膨張させたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius 半径（要素）
+		/// @return 膨張させたグリッド
+		[[nodiscard]]
+		Grid<uint8> Dilate(const Grid<uint8>& src, int32 radius = 1);
+
+		/// @brief (2 * radius + 1) 四方の最大値で膨張させたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius 半径（要素）
+		/// @return 膨張させたグリッド
+		[[nodiscard]]
+		Grid<uint16> Dilate(const Grid<uint16>& src, int32 radius = 1);
+
+		/// @brief (2 * radius + 1) 四方の最大値で膨張させたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius 半径（要素）
+		/// @return 膨張させたグリッド
+		[[nodiscard]]
+		Grid<float> Dilate(const Grid<float>& src, int32 radius = 1);
+
+		/// @brief (2 * radius + 1) 四方の最小値で収縮させた画像を返します。
+		/// @param src 元の画像
+		/// @param radius 半径（ピクセル）
+		/// @return 収縮させた画像
+		/// @remark 各チャンネルを独立に処理します。
+		[[nodiscard]]
+		Image Erode(const Image& src, int32 radius = 1);
+
+		/// @brief (2 * radius + 1) 四方の最小値で収縮させたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius 半径（要素）
+		/// @return 収縮させたグリッド
+		[[nodiscard]]
+		Grid<uint8> Erode(const Grid<uint8>& src, int32 radius = 1);
+
+		/// @brief (2 * radius + 1) 四方の最小値で収縮させたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius 半径（要素）
+		/// @return 収縮させたグリッド
+		[[nodiscard]]
+		Grid<uint16> Erode(const Grid<uint16>& src, int32 radius = 1);
+
+		/// @brief (2 * radius + 1) 四方の最小値で収縮させたグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param radius 半径（要素）
+		/// @return 収縮させたグリッド
+		[[nodiscard]]
+		Grid<float> Erode(const Grid<float>& src, int32 radius = 1);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Grayscale, Threshold
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 画像の輝度を返します。
+		/// @param src 元の画像
+		/// @return 各ピクセルの輝度 (0.299R + 0.587G + 0.114B の 8 ビット近似)
+		[[nodiscard]]
+		Grid<uint8> Grayscale(const Image& src);
+
+		/// @brief 二値化したグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param threshold しきい値
+		/// @return `threshold` より大きい要素は 255, それ以外の要素は 0 のグリッド
+		[[nodiscard]]
+		Grid<uint8> Threshold(const Grid<uint8>& src, uint8 threshold);
+
+		/// @brief 二値化したグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param threshold しきい値
+		/// @return `threshold` より大きい要素は 255, それ以外の要素は 0 のグリッド
+		[[nodiscard]]
+		Grid<uint8> Threshold(const Grid<uint16>& src, uint16 threshold);
+
+		/// @brief 二値化したグリッドを返します。
+		/// @param src 元のグリッド
+		/// @param threshold しきい値
+		/// @return `threshold` より大きい要素は 255, それ以外の要素は 0 のグリッド
+		[[nodiscard]]
+		Grid<uint8> Threshold(const Grid<float>& src, float threshold);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Sobel, Canny
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief Sobel フィルタによる勾配の大きさを返します。
+		/// @param src 元のグリッド
+		/// @return 各要素の勾配の大きさ sqrt(gx^2 + gy^2)
+		[[nodiscard]]
+		Grid<float> Sobel(const Grid<uint8>& src);
+
+		/// @brief Sobel フィルタによる勾配の大きさを返します。
+		/// @param src 元のグリッド
+		/// @return 各要素の勾配の大きさ sqrt(gx^2 + gy^2)
+		[[nodiscard]]
+		Grid<float> Sobel(const Grid<uint16>& src);
+
+		/// @brief Sobel フィルタによる勾配の大きさを返します。
+		/// @param src 元のグリッド
+		/// @return 各要素の勾配の大きさ sqrt(gx^2 + gy^2)
+		[[nodiscard]]
+		Grid<float> Sobel(const Grid<float>& src);
+
+		/// @brief Canny 法でエッジを検出します。
+		/// @param src 元のグリッド
+		/// @param lowThreshold 弱いエッジとみなす勾配の大きさ（Sobel フィルタの値）
+		/// @param highThreshold 強いエッジとみなす勾配の大きさ（Sobel フィルタの値）
+		/// @return エッジの要素は 255, それ以外の要素は 0 のグリッド
+		/// @remark ノイズの多い入力には、事前に `GaussianBlur()` をかけてください。
+		[[nodiscard]]
+		Grid<uint8> Canny(const Grid<uint8>& src, double lowThreshold, double highThreshold);
+
+		/// @brief 画像の輝度から Canny 法でエッジを検出します。
+		/// @param src 元の画像
+		/// @param lowThreshold 弱いエッジとみなす勾配の大きさ（Sobel フィルタの値）
+		/// @param highThreshold 強いエッジとみなす勾配の大きさ（Sobel フィルタの値）
+		/// @return エッジの要素は 255, それ以外の要素は 0 のグリッド
+		[[nodiscard]]
+		Grid<uint8> Canny(const Image& src, double lowThreshold, double highThreshold);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	CompositePremultiplied
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 乗算済みアルファの画像を dst に合成します。
+		/// @param src 合成する画像（乗算済みアルファ）
+		/// @param dst 合成先の画像（乗算済みアルファ）
+		/// @param pos 合成先での src の左上の座標
+		/// @remark dst = src + dst * (1 - src.a) を各チャンネルについて計算します。dst からはみ出す部分は無視されます。
+		void CompositePremultiplied(const Image& src, Image& dst, const Point& pos = Point{ 0, 0 });
 	}
 }
 
@@ -0,0 +1,82 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Types.hpp"
+
+namespace s3d
+{
+	struct FormatData;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	JSONEvent
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief JSONReader が読み進めたときに発生するイベント | Event produced by JSONReader
+	enum class JSONEvent : uint8
+	{
+		/// @brief まだ読み込みを開始していない | Reading has not started yet
+		None,
+
+		/// @brief オブジェクトの開始 `{` | Start of an object
+		BeginObject,
+
+		/// @brief オブジェクトの終了 `}` | End of an object
+		EndObject,
+
+		/// @brief 配列の開始 `[` | Start of an array
+		BeginArray,
+
+		/// @brief 配列の終了 `]` | End of an array
+		EndArray,
+
+		/// @brief オブジェクトのキー | Object key
+		Key,
+
+		/// @brief 文字列 | String
+		String,
+
+		/// @brief 真偽値 | Boolean
+		Bool,
+
+		/// @brief 負の整数 | Negative integer
+		NumberInt,
+
+		/// @brief 0 以上の整数 | Non-negative integer
+		NumberUint,
+
+		/// @brief 浮動小数点数 | Floating-point number
+		NumberFloat,
+
+		/// @brief null | Null
+		Null,
+
+		/// @brief ドキュメントの終端 | End of the document
+		EndOfDocument,
+
+		/// @brief 構文エラー、または読み込みエラー | Syntax or read error
+		Error,
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief JSONReader のイベントを文字列に変換します。
+	/// @param formatData 文字列バッファ
+	/// @param value JSONReader のイベント
+	/// @remark この関数は Format 用の関数です。通常、ユーザーが直接呼び出す必要はありません。
+	void Formatter(FormatData& formatData, JSONEvent value);
+}
@@ -0,0 +1,289 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "IReader.hpp"
+# include "MappedMemoryView.hpp"
+# include "JSONEvent.hpp"
+
+namespace s3d
+{
+	class JSON;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	JSONReader
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief JSON を先頭から順に読み進め、要素ごとのイベントを返すプル型のパーサ
+	/// @remark `JSON::Load()` と異なり、ドキュメント全体の木構造を作らないため、巨大な JSON を一定のメモリ量で処理できます。
+	/// @remark 不要な部分木は `skip()` で、値を作らずに読み飛ばせます。必要な部分木だけを `readJSON()` で JSON オブジェクトにすることもできます。
+	class JSONReader
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		JSONReader();
+
+		/// @brief JSON ファイルを開きます。
+		/// @param path ファイルパス
+		[[nodiscard]]
+		explicit JSONReader(FilePathView path);
+
+		/// @brief JSON データの読み込み元を IReader で指定して開きます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader JSON データの読み込み元
+		template <class Reader>
+			requires (std::is_base_of_v<IReader, Reader> && (not std::is_lvalue_reference_v<Reader>))
+		[[nodiscard]]
+		explicit JSONReader(Reader&& reader);
+
+		/// @brief JSON データの読み込み元を IReader で指定して開きます。
+		/// @param reader JSON データの読み込み元
+		[[nodiscard]]
+		explicit JSONReader(std::unique_ptr<IReader>&& reader);
+
+		/// @brief メモリ上の UTF-8 の JSON データを開きます。
+		/// @param data データの先頭ポインタ
+		/// @param size データのサイズ（バイト）
+		/// @remark データはコピーされません。JSONReader を使い終わるまでデータを保持する必要があります。
+		[[nodiscard]]
+		JSONReader(const void* data, size_t size);
+
+		/// @brief `MemoryMappedFileView` などでマップされたメモリ上の JSON データを開きます。
+		/// @param view マップされたメモリ
+		/// @remark データはコピーされません。JSONReader を使い終わるまでマップを保持する必要があります。
+		[[nodiscard]]
+		explicit JSONReader(const MappedMemoryView& view);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	open
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief JSON ファイルを開きます。
+		/// @param path ファイルパス
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path);
+
+		/// @brief JSON データの読み込み元を IReader で指定して開きます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader JSON データの読み込み元
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Reader>
+			requires (std::is_base_of_v<IReader, Reader> && (not std::is_lvalue_reference_v<Reader>))
+		bool open(Reader&& reader);
+
+		/// @brief JSON データの読み込み元を IReader で指定して開きます。
+		/// @param reader JSON データの読み込み元
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		/// @brief メモリ上の UTF-8 の JSON データを開きます。
+		/// @param data データの先頭ポインタ
+		/// @param size データのサイズ（バイト）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		/// @remark データはコピーされません。JSONReader を使い終わるまでデータを保持する必要があります。
+		bool open(const void* data, size_t size);
+
+		/// @brief `MemoryMappedFileView` などでマップされたメモリ上の JSON データを開きます。
+		/// @param view マップされたメモリ
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		/// @remark データはコピーされません。JSONReader を使い終わるまでマップを保持する必要があります。
+		bool open(const MappedMemoryView& view);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	close
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 読み込み元を閉じます。
+		void close();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isOpen
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief JSON データを読み込み可能であるかを返します。
+		/// @return 読み込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief JSON データを読み込み可能であるかを返します。
+		/// @return 読み込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	next
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 次の要素まで読み進めます。
+		/// @return 読み進めた要素のイベント。ドキュメントの終端に達した場合は `JSONEvent::EndOfDocument`, エラーが発生した場合は `JSONEvent::Error`
+		JSONEvent next();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getEvent
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在のイベントを返します。
+		/// @return 最後に `next()` などで読み進めた要素のイベント
+		[[nodiscard]]
+		JSONEvent getEvent() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getDepth
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の要素を囲むオブジェクトと配列の数を返します。
+		/// @return 入れ子の深さ。`BeginObject` や `BeginArray` の直後は、そのオブジェクトや配列を含みます。
+		[[nodiscard]]
+		size_t getDepth() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getString, getStringUTF8
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在のキー、または文字列の値を返します。
+		/// @return 現在のイベントが `Key` または `String` の場合はその文字列、それ以外の場合は空の文字列
+		[[nodiscard]]
+		String getString() const;
+
+		/// @brief 現在のキー、または文字列の値を UTF-8 で返します。
+		/// @return 現在のイベントが `Key` または `String` の場合はその文字列、それ以外の場合は空の文字列
+		/// @remark 返す文字列は、次に読み進めるまで有効です。変換やコピーを行わないため、`getString()` より高速です。
+		[[nodiscard]]
+		std::string_view getStringUTF8() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getBool, getInt64, getUint64, getDouble
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の真偽値を返します。
+		/// @return 現在のイベントが `Bool` の場合はその値、それ以外の場合は false
+		[[nodiscard]]
+		bool getBool() const noexcept;
+
+		/// @brief 現在の数値を int64 型で返します。
+		/// @return 現在のイベントが数値の場合はその値、それ以外の場合は 0
+		[[nodiscard]]
+		int64 getInt64() const noexcept;
+
+		/// @brief 現在の数値を uint64 型で返します。
+		/// @return 現在のイベントが数値の場合はその値、それ以外の場合は 0
+		[[nodiscard]]
+		uint64 getUint64() const noexcept;
+
+		/// @brief 現在の数値を double 型で返します。
+		/// @return 現在のイベントが数値の場合はその値、それ以外の場合は 0.0
+		[[nodiscard]]
+		double getDouble() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	skip
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の値を、値を作らずに読み飛ばします。
+		/// @return 読み飛ばした後のイベント
+		/// @remark 現在のイベントが `BeginObject` や `BeginArray` の場合、対応する `EndObject` や `EndArray` まで読み飛ばします。
+		/// @remark 現在のイベントが `Key` の場合、そのキーの値を読み飛ばします。
+		/// @remark 読み飛ばした範囲は、括弧と文字列の対応以外の構文を検証しません。
+		JSONEvent skip();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	readJSON
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の値を JSON オブジェクトとして読み込みます。
+		/// @return 読み込んだ JSON オブジェクト。エラーが発生した場合は `JSON::Invalid()`
+		/// @remark 現在のイベントが `BeginObject` や `BeginArray` の場合、対応する `EndObject` や `EndArray` までを読み込みます。
+		/// @remark 現在のイベントが `Key` の場合、そのキーの値を読み込みます。
+		/// @remark 読み込む値の中のオブジェクトと配列の入れ子が 512 段を超える場合はエラーになります。
+		[[nodiscard]]
+		JSON readJSON();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getPos
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 読み込んだデータのサイズを返します。
+		/// @return 先頭から現在の要素の直後までのサイズ（バイト）
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	hasError
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief エラーが発生したかを返します。
+		/// @return 構文エラーや読み込みエラーが発生した場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool hasError() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getErrorMessage
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 発生したエラーの内容を返します。
+		/// @return エラーの内容。エラーが発生していない場合は空の文字列
+		[[nodiscard]]
+		String getErrorMessage() const;
+
+	private:
+
+		class JSONReaderDetail;
+
+		std::shared_ptr<JSONReaderDetail> pImpl;
+	};
+}
+
+# include "detail/JSONReader.ipp"
@@ -0,0 +1,281 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "IWriter.hpp"
+
+namespace s3d
+{
+	class JSON;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	JSONWriter
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief JSON の要素を先頭から順に、IWriter へ直接書き出すクラス
+	/// @remark JSON オブジェクトを作らずに書き出すため、巨大な JSON を一定のメモリ量で出力できます。
+	/// @remark オブジェクトや配列の対応が取れていない書き込みを行うと、例外 `Error` が発生します。
+	/// @remark バッファリングされているデータは、`close()` を呼ぶか、最後のコピーが破棄されるときに書き出されます。
+	class JSONWriter
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		JSONWriter();
+
+		/// @brief JSON ファイルを書き込み用に開きます。
+		/// @param path ファイルパス
+		[[nodiscard]]
+		explicit JSONWriter(FilePathView path);
+
+		/// @brief 書き出し先を IWriter で指定して開きます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer 書き出し先
+		template <class Writer>
+			requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+		[[nodiscard]]
+		explicit JSONWriter(Writer&& writer);
+
+		/// @brief 書き出し先を IWriter で指定して開きます。
+		/// @param writer 書き出し先
+		[[nodiscard]]
+		explicit JSONWriter(std::unique_ptr<IWriter>&& writer);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	open
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief JSON ファイルを書き込み用に開きます。
+		/// @param path ファイルパス
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path);
+
+		/// @brief 書き出し先を IWriter で指定して開きます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer 書き出し先
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Writer>
+			requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+		bool open(Writer&& writer);
+
+		/// @brief 書き出し先を IWriter で指定して開きます。
+		/// @param writer 書き出し先
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IWriter>&& writer);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	close
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief バッファリングされているデータを書き出し、書き出し先を閉じます。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		bool close();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isOpen
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込み可能であるかを返します。
+		/// @return 書き込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込み可能であるかを返します。
+		/// @return 書き込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setIndent
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief インデントの形式を設定します。
+		/// @param indent インデントに使う文字
+		/// @param spaceCount 1 段あたりのインデントの文字数。0 の場合は改行やインデントを含まない形式で書き出します。
+		/// @return *this
+		/// @remark デフォルトでは、改行やインデントを含まない形式で書き出します。
+		JSONWriter& setIndent(char32 indent = U' ', size_t spaceCount = 2);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	startObject, endObject, startArray, endArray
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief オブジェクトを開始します。
+		/// @return *this
+		JSONWriter& startObject();
+
+		/// @brief オブジェクトを終了します。
+		/// @return *this
+		JSONWriter& endObject();
+
+		/// @brief 配列を開始します。
+		/// @return *this
+		JSONWriter& startArray();
+
+		/// @brief 配列を終了します。
+		/// @return *this
+		JSONWriter& endArray();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	key
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief オブジェクトのキーを書き込みます。
+		/// @param key キー
+		/// @return *this
+		JSONWriter& key(StringView key);
+
+		/// @brief オブジェクトのキーを書き込みます。
+		/// @param key キー
+		/// @return *this
+		JSONWriter& key(const char32* key);
+
+		/// @brief オブジェクトのキーを UTF-8 で書き込みます。
+		/// @param key キー
+		/// @return *this
+		JSONWriter& keyUTF8(std::string_view key);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	write
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief null を書き込みます。
+		/// @return *this
+		JSONWriter& write(std::nullptr_t);
+
+		/// @brief 真偽値を書き込みます。
+		/// @param value 値
+		/// @return *this
+		JSONWriter& write(bool value);
+
+		/// @brief 整数を書き込みます。
+		/// @param value 値
+		/// @return *this
+		JSONWriter& write(Concept::SignedIntegral auto value);
+
+		/// @brief 整数を書き込みます。
+		/// @param value 値
+		/// @return *this
+		JSONWriter& write(Concept::UnsignedIntegral auto value);
+
+		/// @brief 浮動小数点数を書き込みます。
+		/// @param value 値
+		/// @return *this
+		/// @remark NaN と無限大は null として書き込みます。
+		JSONWriter& write(Concept::FloatingPoint auto value);
+
+		/// @brief 文字列を書き込みます。
+		/// @param value 文字列
+		/// @return *this
+		JSONWriter& write(StringView value);
+
+		/// @brief 文字列を書き込みます。
+		/// @param value 文字列
+		/// @return *this
+		JSONWriter& write(const char32* value);
+
+		/// @brief 文字列を書き込みます。
+		/// @param value 文字列
+		/// @return *this
+		JSONWriter& write(const String& value);
+
+		/// @brief UTF-8 の文字列は `writeUTF8()` で書き込みます。
+		JSONWriter& write(const char* value) = delete;
+
+		/// @brief JSON オブジェクトを書き込みます。
+		/// @param value JSON オブジェクト
+		/// @return *this
+		JSONWriter& write(const JSON& value);
+
+		/// @brief UTF-8 の文字列を書き込みます。
+		/// @param value 文字列
+		/// @return *this
+		JSONWriter& writeUTF8(std::string_view value);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	flush
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief バッファリングされているデータを書き出し先へ書き出します。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		bool flush();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isComplete
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ルートの値を書き終えたかを返します。
+		/// @return ルートの値を書き終え、開いているオブジェクトや配列がない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isComplete() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	hasError
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き出しに失敗したかを返します。
+		/// @return 書き出し先への書き込みに失敗したことがある場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool hasError() const noexcept;
+
+	private:
+
+		class JSONWriterDetail;
+
+		std::shared_ptr<JSONWriterDetail> pImpl;
+
+		JSONWriter& writeInt64(int64 value);
+
+		JSONWriter& writeUint64(uint64 value);
+
+		JSONWriter& writeDouble(double value);
+	};
+}
+
+# include "detail/JSONWriter.ipp"
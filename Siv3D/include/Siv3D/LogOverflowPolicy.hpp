@@ -0,0 +1,45 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Types.hpp"
+
+namespace s3d
+{
+	struct FormatData;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	LogOverflowPolicy
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 非同期ログのキューが一杯のときの動作 | Behavior when the asynchronous log queue is full
+	enum class LogOverflowPolicy : uint8
+	{
+		/// @brief キューに空きができるまで待つ | Wait until the queue has space
+		Block,
+
+		/// @brief メッセージを破棄する | Drop the message
+		Drop,
+
+		/// @brief メッセージを破棄し、破棄した数を次の書き出しでログに出力する | Drop the message and log the number of dropped messages on the next write
+		Count,
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, LogOverflowPolicy value);
+}
@@ -15,6 +15,8 @@
 # include "LoggerBuffer.hpp"
 # include "Formatter.hpp"
 # include "Format.hpp"
+# include "LogOverflowPolicy.hpp"
+# include "LoggerStat.hpp"
 
 namespace s3d
 {
@@ -104,6 +106,58 @@ namespace s3d
 			/// @return ログのレベル
 			[[nodiscard]]
 			LogType getOutputLevel() const noexcept;
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	enableAsync
+			//
+			////////////////////////////////////////////////////////////////
+
+			/// @brief ログの書き出しを専用のスレッドで行うようにします。
+			/// @param capacity キューに保持できるメッセージの数
+			/// @param overflowPolicy キューが一杯のときの動作
+			/// @remark 呼び出し元のスレッドはメッセージをキューにコピーするだけになり、UTF-8 への変換や出力先への書き込みは専用のスレッドでまとめて行われます。
+			void enableAsync(size_t capacity = 8192, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block) const;
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	disableAsync
+			//
+			////////////////////////////////////////////////////////////////
+
+			/// @brief キューのメッセージをすべて書き出し、ログの書き出しを呼び出し元のスレッドで行うように戻します。
+			void disableAsync() const;
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	isAsync
+			//
+			////////////////////////////////////////////////////////////////
+
+			/// @brief ログの書き出しを専用のスレッドで行っているかを返します。
+			/// @return 非同期モードの場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool isAsync() const noexcept;
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	flush
+			//
+			////////////////////////////////////////////////////////////////
+
+			/// @brief この関数を呼ぶ前にキューに追加されたメッセージがすべて書き出されるまで待ちます。
+			void flush() const;
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	getStat
+			//
+			////////////////////////////////////////////////////////////////
+
+			/// @brief ロガーの統計情報を返します。
+			/// @return ロガーの統計情報
+			[[nodiscard]]
+			LoggerStat getStat() const;
 		};
 	}
 
@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	LoggerStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief ロガーの統計情報 | Logger statistics
+	struct LoggerStat
+	{
+		/// @brief 書き出したメッセージの数 | Number of messages written
+		uint64 messageCount = 0;
+
+		/// @brief 書き出したバイト数 | Number of bytes written
+		uint64 byteCount = 0;
+
+		/// @brief 出力先への書き込みの回数。非同期モードでは複数のメッセージをまとめて書き込みます。 | Number of writes to the output. In asynchronous mode, several messages are written at once.
+		uint64 writeCount = 0;
+
+		/// @brief キューが一杯だったために破棄したメッセージの数 | Number of messages dropped because the queue was full
+		uint64 droppedMessageCount = 0;
+
+		/// @brief キューで書き出しを待っているメッセージの数 | Number of messages waiting in the queue
+		uint64 queuedMessageCount = 0;
+
+		/// @brief ロガーの作成からの、1 秒あたりの平均メッセージ数 | Average number of messages per second since the logger was created
+		double messagesPerSecond = 0.0;
+
+		/// @brief ロガーの作成からの、1 秒あたりの平均バイト数 | Average number of bytes per second since the logger was created
+		double bytesPerSecond = 0.0;
+	};
+}
@@ -16,6 +16,9 @@ namespace s3d::Arg
 {
 	SIV3D_NAMED_PARAMETER(generator);			// Array, Image, Grid
 	SIV3D_NAMED_PARAMETER(generator0_1);		// Image
+	SIV3D_NAMED_PARAMETER(parallelGenerator);	// Image
+	SIV3D_NAMED_PARAMETER(parallelGenerator0_1);	// Image
+	SIV3D_NAMED_PARAMETER(rowGenerator);		// Image
 	SIV3D_NAMED_PARAMETER(reserve);				// Array
 
 	SIV3D_NAMED_PARAMETER(center);				// Rect, RectF, Circle
@@ -11,10 +11,13 @@
 
 # pragma once
 # include "Common.hpp"
+# include "Array.hpp"
+# include "StringView.hpp"
 
 namespace s3d
 {
 	struct ProfilerStat;
+	struct ProfilerScopeStat;
 
 	namespace Profiler
 	{
@@ -48,5 +51,51 @@ namespace s3d
 
 		[[nodiscard]]
 		const ProfilerStat& GetStat();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	EnableScopeProfiling
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `ProfilerScope` による計測の ON / OFF を設定します。
+		/// @param enabled 計測を有効にするか
+		/// @remark デフォルトでは無効です。無効な間の `ProfilerScope` のコストはフラグの読み取り 1 回だけです。
+		void EnableScopeProfiling(bool enabled);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	IsScopeProfilingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `ProfilerScope` による計測が有効かを返します。
+		/// @return 計測が有効な場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool IsScopeProfilingEnabled() noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetScopeStats
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 直前のフレームの計測区間の統計を、スレッドごとの階層構造（深さ優先の順）で返します。
+		/// @return 計測区間の統計の一覧
+		/// @remark メインスレッドから呼び出す必要があります。
+		[[nodiscard]]
+		const Array<ProfilerScopeStat>& GetScopeStats();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ExportChromeTrace
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 直近のフレームで記録した計測区間を、Chrome のトレースイベント形式の JSON ファイルに保存します。
+		/// @param path 保存するファイルのパス
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		/// @remark 保存したファイルは chrome://tracing や Perfetto で開くことができます。
+		bool ExportChromeTrace(FilePathView path);
 	}
 }
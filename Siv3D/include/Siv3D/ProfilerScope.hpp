@@ -0,0 +1,57 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ProfilerScope
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief オブジェクトの生存期間を計測区間として記録するクラス | Records the lifetime of the object as a profiled scope
+	/// @remark `Profiler::EnableScopeProfiling(true)` を呼ぶまでは何も記録しません。 | Nothing is recorded until `Profiler::EnableScopeProfiling(true)` is called.
+	/// @remark 記録はスレッドごとのバッファに対してロックなしで行われ、フレームの終わりに集計されます。 | Records are written to per-thread buffers without locking and aggregated at the end of each frame.
+	class ProfilerScope
+	{
+	public:
+
+		/// @brief 計測区間を開始します。 | Begins a profiled scope.
+		/// @param name 計測区間の名前。文字列リテラルなど、プログラムの終了まで有効な文字列である必要があります。 | Name of the scope. Must stay valid until the program exits, such as a string literal.
+		[[nodiscard]]
+		explicit ProfilerScope(const char32* name) noexcept;
+
+		ProfilerScope(const ProfilerScope&) = delete;
+
+		ProfilerScope& operator =(const ProfilerScope&) = delete;
+
+		/// @brief 計測区間を終了します。 | Ends the profiled scope.
+		~ProfilerScope();
+
+	private:
+
+		const char32* m_name = nullptr;
+
+		uint64 m_begin = 0;
+
+		uint32 m_depth = 0;
+	};
+}
+
+# define SIV3D_PROFILER_SCOPE_CONCAT_IMPL(a, b) a##b
+# define SIV3D_PROFILER_SCOPE_CONCAT(a, b) SIV3D_PROFILER_SCOPE_CONCAT_IMPL(a, b)
+
+/// @brief 現在のスコープを計測区間として記録します。 | Records the current scope as a profiled scope.
+/// @param name 計測区間の名前（文字列リテラル） | Name of the scope (string literal)
+# define SIV3D_PROFILE_SCOPE(name) const s3d::ProfilerScope SIV3D_PROFILER_SCOPE_CONCAT(siv3dProfilerScope, __LINE__){ name }
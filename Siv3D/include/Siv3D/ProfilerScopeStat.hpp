@@ -0,0 +1,58 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ProfilerScopeStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 計測区間の統計情報 | Statistics of a profiled scope
+	/// @remark `Profiler::GetScopeStats()` は、親の直後に子が並ぶ深さ優先の順で返します。 | `Profiler::GetScopeStats()` returns scopes in depth-first order, with children following their parent.
+	struct ProfilerScopeStat
+	{
+		/// @brief 計測区間の名前 | Name of the scope
+		String name;
+
+		/// @brief 計測したスレッドの番号 | Index of the thread the scope was recorded on
+		uint32 threadIndex = 0;
+
+		/// @brief 親の計測区間のインデックス。親が無い場合は -1 | Index of the parent scope, or -1 if it has no parent
+		int32 parent = -1;
+
+		/// @brief 入れ子の深さ | Nesting depth
+		int32 depth = 0;
+
+		/// @brief 直前のフレームで計測区間に入った回数 | Number of times the scope was entered in the last frame
+		int32 callCount = 0;
+
+		/// @brief 直前のフレームでの合計時間（ミリ秒） | Total time in the last frame (milliseconds)
+		double totalMillisec = 0.0;
+
+		/// @brief 直前のフレームでの、子の計測区間を除いた時間（ミリ秒） | Time in the last frame excluding child scopes (milliseconds)
+		double selfMillisec = 0.0;
+
+		/// @brief 直近のフレームでの合計時間の平均（ミリ秒） | Average total time over recent frames (milliseconds)
+		double averageMillisec = 0.0;
+
+		/// @brief 直近のフレームでの合計時間の最小値（ミリ秒） | Minimum total time over recent frames (milliseconds)
+		double minMillisec = 0.0;
+
+		/// @brief 直近のフレームでの合計時間の最大値（ミリ秒） | Maximum total time over recent frames (milliseconds)
+		double maxMillisec = 0.0;
+	};
+}
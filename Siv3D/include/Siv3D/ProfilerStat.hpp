@@ -24,12 +24,22 @@ namespace s3d
 	/// @brief プロファイラの統計情報 | Profiler statistics
 	struct ProfilerStat
 	{
+		/// @brief 1 秒あたりのフレーム数 | Frames per second
+		int32 fps = 0;
+
+		/// @brief 1 秒あたりに描画された三角形の数 | Number of triangles drawn per second
+		int64 trianglesPerSecond = 0;
+
 		/// @brief Draw コール回数 | Number of draw calls
 		int32 drawCalls = 0;
 
 		/// @brief 描画された三角形の数 | Number of drawn triangles
 		int32 triangleCount = 0;
 
+		/// @brief 並べ替えによって削減された Draw コール回数 | Number of draw calls saved by reordering
+		/// @remark `Graphics2D::SetDrawCallReorderingEnabled(true)` のときのみ計測されます。 | Only measured when `Graphics2D::SetDrawCallReorderingEnabled(true)`.
+		int32 drawCallsSaved = 0;
+
 		/// @brief テクスチャの数 | Number of textures
 		int32 textureCount = 0;
 
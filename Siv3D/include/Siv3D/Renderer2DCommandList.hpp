@@ -0,0 +1,335 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Vertex2D.hpp"
+# include "Mat3x2.hpp"
+# include "2DShapes.hpp"
+# include "LineCap.hpp"
+# include "FloatRect.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	Renderer2DCommandList
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 2D 描画を記録する、描画エンジンに依存しないコマンドリスト
+	/// @remark 異なるコマンドリストには、別々のスレッドから同時に記録できます。
+	/// @remark 記録した内容は、メインスレッドで `draw()` を呼んだ時点の描画ステートで、記録順に描画されます。
+	class Renderer2DCommandList
+	{
+	public:
+
+		/// @brief 1 回のバッファ確保で描画される頂点とインデックスの範囲
+		/// @remark インデックスは vertexOffset を 0 とする値です。1 つの範囲の頂点数とインデックス数はそれぞれ 65535 以下です。
+		struct Batch
+		{
+			uint32 vertexOffset = 0;
+
+			uint32 vertexCount = 0;
+
+			uint32 indexOffset = 0;
+
+			uint32 indexCount = 0;
+		};
+
+		/// @brief コマンドリストの座標変換スコープオブジェクト
+		/// @remark このオブジェクトが存在するスコープでは、コマンドリストへの記録に、指定した座標変換行列が適用されます。
+		class ScopedTransform
+		{
+		public:
+
+			/// @brief 座標変換行列をコマンドリストの座標変換スタックにプッシュします。
+			/// @param commandList コマンドリスト
+			/// @param transform 座標変換行列
+			[[nodiscard]]
+			ScopedTransform(Renderer2DCommandList& commandList, const Mat3x2& transform);
+
+			/// @brief デストラクタ
+			~ScopedTransform();
+
+			ScopedTransform(const ScopedTransform&) = delete;
+
+			ScopedTransform& operator =(const ScopedTransform&) = delete;
+
+		private:
+
+			Renderer2DCommandList& m_commandList;
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		Renderer2DCommandList();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	pushTransform, popTransform
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 座標変換行列をプッシュします。
+		/// @param transform 座標変換行列
+		/// @remark 以降の記録には、transform * 現在の座標変換行列 が適用されます。
+		void pushTransform(const Mat3x2& transform);
+
+		/// @brief 最後にプッシュした座標変換行列をポップします。
+		/// @remark プッシュされた座標変換行列が無い場合は何もしません。
+		void popTransform();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getTransform
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の座標変換行列を返します。
+		/// @return 現在の座標変換行列
+		[[nodiscard]]
+		const Mat3x2& getTransform() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addLine
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 線分を記録します。
+		/// @param line 線分
+		/// @param thickness 線の太さ
+		/// @param color 色
+		void addLine(const Line& line, double thickness, const ColorF& color);
+
+		/// @brief 線分を記録します。
+		/// @param line 線分
+		/// @param cap 線端のスタイル
+		/// @param thickness 線の太さ
+		/// @param color 色
+		/// @remark 丸い線端の分割数は、現在の座標変換行列の拡大率をもとに決まります。
+		void addLine(const Line& line, LineCap cap, double thickness, const ColorF& color);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addTriangle
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 三角形を記録します。
+		/// @param triangle 三角形
+		/// @param color 色
+		void addTriangle(const Triangle& triangle, const ColorF& color);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addRect
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 長方形を記録します。
+		/// @param rect 長方形
+		/// @param color 色
+		void addRect(const RectF& rect, const ColorF& color);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 複数の長方形をまとめて記録します。
+		/// @param rects 長方形の配列
+		/// @param color 色
+		/// @remark 長方形ごとに `addRect()` を呼んだ場合と同じ頂点とインデックスを記録します。
+		void addRects(std::span<const FloatRect> rects, const ColorF& color);
+
+		/// @brief 複数の長方形をまとめて記録します。
+		/// @param rects 長方形の配列
+		/// @param colors 各長方形の色。`rects` と同じ要素数である必要があります。
+		/// @throw Error 要素数が一致しない場合
+		void addRects(std::span<const FloatRect> rects, std::span<const Float4> colors);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCircle
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 円を記録します。
+		/// @param circle 円
+		/// @param color 色
+		/// @remark 円の分割数は、現在の座標変換行列の拡大率をもとに決まります。
+		void addCircle(const Circle& circle, const ColorF& color);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 同じ半径の複数の円をまとめて記録します。
+		/// @param centers 円の中心座標の配列
+		/// @param r 円の半径
+		/// @param color 色
+		/// @remark 円ごとに `addCircle()` を呼んだ場合と同じ頂点とインデックスを記録します。
+		void addCircles(std::span<const Float2> centers, float r, const ColorF& color);
+
+		/// @brief 複数の円をまとめて記録します。
+		/// @param centers 円の中心座標の配列
+		/// @param rs 各円の半径。`centers` と同じ要素数である必要があります。
+		/// @param colors 各円の色。`centers` と同じ要素数である必要があります。
+		/// @throw Error 要素数が一致しない場合
+		void addCircles(std::span<const Float2> centers, std::span<const float> rs, std::span<const Float4> colors);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCirclePie
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 扇形を記録します。
+		/// @param circle 円
+		/// @param startAngle 扇形の開始角度（ラジアン, 0 時の方向から時計回り）
+		/// @param angle 扇形の角度（ラジアン）
+		/// @param color 色
+		/// @remark 扇形の分割数は、現在の座標変換行列の拡大率をもとに決まります。
+		void addCirclePie(const Circle& circle, double startAngle, double angle, const ColorF& color);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addQuad
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 凸四角形を記録します。
+		/// @param quad 凸四角形
+		/// @param color 色
+		void addQuad(const Quad& quad, const ColorF& color);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addRoundRect
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 角丸長方形を記録します。
+		/// @param roundRect 角丸長方形
+		/// @param color 色
+		void addRoundRect(const RoundRect& roundRect, const ColorF& color);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	append
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 別のコマンドリストの内容を末尾に追加します。
+		/// @param other 別のコマンドリスト
+		/// @remark other に記録された座標は other の座標変換が適用済みのものであり、このコマンドリストの座標変換は適用されません。
+		void append(const Renderer2DCommandList& other);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	clear
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 記録した内容と座標変換スタックを消去します。
+		/// @remark 確保したメモリは再利用のために保持されます。
+		void clear() noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isEmpty
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 記録された内容が無いかを返します。
+		/// @return 記録された内容が無い場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	num_vertices, num_indices
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 記録された頂点の数を返します。
+		/// @return 記録された頂点の数
+		[[nodiscard]]
+		size_t num_vertices() const noexcept;
+
+		/// @brief 記録されたインデックスの数を返します。
+		/// @return 記録されたインデックスの数
+		[[nodiscard]]
+		size_t num_indices() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getVertices, getIndices, getBatches
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 記録された頂点の配列を返します。
+		/// @return 記録された頂点の配列
+		[[nodiscard]]
+		const Array<Vertex2D>& getVertices() const noexcept;
+
+		/// @brief 記録されたインデックスの配列を返します。
+		/// @return 記録されたインデックスの配列
+		/// @remark 各インデックスは、それが属する Batch の vertexOffset を 0 とする値です。
+		[[nodiscard]]
+		const Array<Vertex2D::IndexType>& getIndices() const noexcept;
+
+		/// @brief 記録されたバッチの配列を返します。
+		/// @return 記録されたバッチの配列
+		[[nodiscard]]
+		const Array<Batch>& getBatches() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	draw
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 記録した内容を、記録順にメインの描画コマンドに追加します。
+		/// @remark メインスレッドから呼ぶ必要があります。現在の 2D 描画ステート（座標変換、ブレンドステートなど）が適用されます。
+		void draw() const;
+
+	private:
+
+		Array<Vertex2D> m_vertices;
+
+		Array<Vertex2D::IndexType> m_indices;
+
+		Array<Batch> m_batches;
+
+		Array<Mat3x2> m_transforms;
+
+		float m_maxScaling = 1.0f;
+
+		[[nodiscard]]
+		Vertex2D* allocate(Vertex2D::IndexType vertexCount, Vertex2D::IndexType indexCount, Vertex2D::IndexType*& pIndex, Vertex2D::IndexType& indexOffset);
+
+		template <class Builder>
+		void record(Builder builder);
+	};
+}
@@ -0,0 +1,51 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Types.hpp"
+
+namespace s3d
+{
+	struct FormatData;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ResampleFilter
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 画像のリサンプリングに使うフィルタ
+	enum class ResampleFilter : uint8
+	{
+		/// @brief ボックスフィルタ（縮小時は面積平均、拡大時は最近傍）
+		Box,
+
+		/// @brief バイリニア（三角フィルタ）
+		Bilinear,
+
+		/// @brief バイキュービック（Catmull-Rom）
+		Bicubic,
+
+		/// @brief Lanczos3
+		Lanczos3,
+
+		/// @brief Mitchell-Netravali (B = 1/3, C = 1/3)
+		Mitchell,
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, ResampleFilter value);
+}
@@ -0,0 +1,261 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IReader.hpp"
+# include "Blob.hpp"
+# include "StringView.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	SeekableDecompressionReader
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief `Compression::CompressSeekable()` で圧縮されたデータを、必要な部分だけ展開しながら読み込む Reader
+	/// @remark 読み込み位置を含むフレームだけを展開し、最近使ったフレームをキャッシュします。
+	/// @remark 1 つのオブジェクトを複数のスレッドから同時に使用することはできません。
+	class SeekableDecompressionReader : public IReader
+	{
+	public:
+
+		/// @brief 展開したフレームをキャッシュするデフォルトの個数
+		static constexpr size_t DefaultCacheCapacity = 4;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		SeekableDecompressionReader();
+
+		/// @brief 圧縮されたファイルをメモリマップトファイルとして開きます。
+		/// @param path ファイルパス
+		/// @param cacheCapacity 展開したフレームをキャッシュする個数
+		[[nodiscard]]
+		explicit SeekableDecompressionReader(FilePathView path, size_t cacheCapacity = DefaultCacheCapacity);
+
+		/// @brief メモリ上の圧縮されたデータを開きます。
+		/// @param blob 圧縮されたデータ
+		/// @param cacheCapacity 展開したフレームをキャッシュする個数
+		[[nodiscard]]
+		explicit SeekableDecompressionReader(const Blob& blob, size_t cacheCapacity = DefaultCacheCapacity);
+
+		/// @brief メモリ上の圧縮されたデータを開きます。
+		/// @param blob 圧縮されたデータ
+		/// @param cacheCapacity 展開したフレームをキャッシュする個数
+		[[nodiscard]]
+		explicit SeekableDecompressionReader(Blob&& blob, size_t cacheCapacity = DefaultCacheCapacity);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	open
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮されたファイルをメモリマップトファイルとして開きます。
+		/// @param path ファイルパス
+		/// @param cacheCapacity 展開したフレームをキャッシュする個数
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path, size_t cacheCapacity = DefaultCacheCapacity);
+
+		/// @brief メモリ上の圧縮されたデータを開きます。
+		/// @param blob 圧縮されたデータ
+		/// @param cacheCapacity 展開したフレームをキャッシュする個数
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(const Blob& blob, size_t cacheCapacity = DefaultCacheCapacity);
+
+		/// @brief メモリ上の圧縮されたデータを開きます。
+		/// @param blob 圧縮されたデータ
+		/// @param cacheCapacity 展開したフレームをキャッシュする個数
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(Blob&& blob, size_t cacheCapacity = DefaultCacheCapacity);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	close
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮されたデータを閉じ、キャッシュを破棄します。
+		void close();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	supportsLookahead
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief lookahead をサポートしているかを返します。
+		/// @return true
+		[[nodiscard]]
+		bool supportsLookahead() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isOpen
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを読み込み可能であるかを返します。
+		/// @return 読み込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを読み込み可能であるかを返します。
+		/// @return 読み込み可能である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	size
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 展開後のデータのサイズを返します。
+		/// @return 展開後のデータのサイズ（バイト）
+		[[nodiscard]]
+		int64 size() const override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getPos
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 現在の読み込み位置を返します。
+		/// @return 現在の読み込み位置（展開後のデータのバイト数）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setPos
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 読み込み位置を変更します。
+		/// @param pos 新しい読み込み位置（展開後のデータのバイト数）
+		/// @return 新しい読み込み位置（バイト）
+		/// @remark 読み込み位置の変更だけではフレームを展開しません。
+		int64 setPos(int64 pos) override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	skip
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 読み込み位置を変更します。
+		/// @param offset 現在の読み込み位置からの移動量（バイト）
+		/// @return 新しい読み込み位置（バイト）
+		int64 skip(int64 offset) override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	read
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データを展開して読み込み、その分読み込み位置を前進させます。
+		/// @param dst 読み込んだデータの格納先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 size) override;
+
+		/// @brief 指定した位置からデータを展開して読み込み、読み込んだ範囲の末尾に読み込み位置を移動させます。
+		/// @param dst 読み込んだデータの格納先
+		/// @param pos 先頭から数えた読み込み開始位置（展開後のデータのバイト数）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 pos, int64 size) override;
+
+		/// @brief データを展開して読み込み、その分読み込み位置を前進させます。
+		/// @param dst 読み込んだデータの格納先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		bool read(Concept::TriviallyCopyable auto& dst);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	lookahead
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 読み込み位置を変更せずに、データを展開して読み込みます。
+		/// @param dst 読み込んだデータの格納先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 lookahead(void* dst, int64 size) const override;
+
+		/// @brief 読み込み位置を変更せずに、指定した位置からデータを展開して読み込みます。
+		/// @param dst 読み込んだデータの格納先
+		/// @param pos 先頭から数えた読み込み開始位置（展開後のデータのバイト数）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 lookahead(void* dst, int64 pos, int64 size) const override;
+
+		/// @brief 読み込み位置を変更せずに、データを展開して読み込みます。
+		/// @param dst 読み込んだデータの格納先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		bool lookahead(Concept::TriviallyCopyable auto& dst) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	numFrames
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 圧縮されたデータに含まれるフレームの個数を返します。
+		/// @return フレームの個数
+		[[nodiscard]]
+		size_t numFrames() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	decompressAll
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データ全体を展開します。
+		/// @return 展開されたデータ。失敗した場合は空の Blob
+		/// @remark フレームを複数のスレッドで並列に展開します。読み込み位置とキャッシュは変化しません。
+		[[nodiscard]]
+		Blob decompressAll() const;
+
+		/// @brief データ全体を展開します。
+		/// @param dst 展開されたデータの格納先
+		/// @return 展開に成功した場合 true, それ以外の場合は false
+		/// @remark フレームを複数のスレッドで並列に展開します。読み込み位置とキャッシュは変化しません。
+		bool decompressAll(Blob& dst) const;
+
+	private:
+
+		class SeekableDecompressionReaderDetail;
+
+		std::shared_ptr<SeekableDecompressionReaderDetail> pImpl;
+	};
+}
+
+# include "detail/SeekableDecompressionReader.ipp"
@@ -0,0 +1,147 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Optional.hpp"
+# include "Image.hpp"
+# include "BlendState.hpp"
+# include "ProfilerStat.hpp"
+# include "Renderer2DCommandList.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	SoftwareRenderer2D
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief CPU で Image に 2D 描画を行うオフスクリーンレンダラー
+	/// @remark GPU を使わないため、サムネイルの作成や、描画結果をピクセル単位で比較する回帰テストに使えます。
+	/// @remark Renderer2DCommandList に記録した図形を描画します。テクスチャとパターンは頂点色で、カスタムシェーダは無視して描画されます。
+	class SoftwareRenderer2D
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトのシーンサイズと背景色でレンダーターゲットを作成します。
+		[[nodiscard]]
+		SoftwareRenderer2D();
+
+		/// @brief レンダーターゲットを作成します。
+		/// @param size レンダーターゲットのサイズ
+		/// @param backgroundColor 背景色
+		[[nodiscard]]
+		explicit SoftwareRenderer2D(const Size& size, const ColorF& backgroundColor = ColorF{ 0.0, 1.0 });
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	beginFrame
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 新しいフレームを開始します。
+		/// @param backgroundColor 背景色
+		/// @remark レンダーターゲットを背景色で塗りつぶし、統計情報をリセットします。
+		void beginFrame(const ColorF& backgroundColor);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	resize
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief レンダーターゲットのサイズを変更します。
+		/// @param size 新しいサイズ
+		/// @remark 描画されていないコマンドは flush() で描画してから呼ぶ必要があります。
+		void resize(const Size& size);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setBlendState, setScissorRect
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 以降の描画に使うブレンドステートを設定します。
+		/// @param state ブレンドステート
+		void setBlendState(const BlendState& state);
+
+		/// @brief 以降の描画に使うシザー矩形を設定します。
+		/// @param rect シザー矩形。none の場合はシザー矩形を使いません。
+		void setScissorRect(const Optional<Rect>& rect);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setDrawCallReorderingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief Draw コールの並べ替えを有効にするかを設定します。
+		/// @param enabled 有効にする場合 true, それ以外の場合は false
+		/// @remark `Graphics2D::SetDrawCallReorderingEnabled()` と同じ並べ替えを行います。
+		void setDrawCallReorderingEnabled(bool enabled);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	draw
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief コマンドリストに記録した内容を、現在のステートで描画コマンドに追加します。
+		/// @param commandList コマンドリスト
+		void draw(const Renderer2DCommandList& commandList);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	flush
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 追加された描画コマンドをレンダーターゲットに描画します。
+		void flush();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getImage
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief レンダーターゲットを返します。
+		/// @return レンダーターゲット
+		/// @remark flush() までに追加された描画コマンドの結果が反映されています。
+		[[nodiscard]]
+		const Image& getImage() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief beginFrame() 以降の描画の統計情報を返します。
+		/// @return 統計情報。drawCalls, triangleCount, drawCallsSaved のみが設定されます。
+		[[nodiscard]]
+		ProfilerStat getStat() const noexcept;
+
+	private:
+
+		class SoftwareRenderer2DDetail;
+
+		std::shared_ptr<SoftwareRenderer2DDetail> pImpl;
+	};
+}
@@ -0,0 +1,46 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "Types.hpp"
+
+namespace s3d
+{
+	struct FormatData;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	TaskExecutor
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 非同期処理のタスクを実行する場所 | Where an asynchronous task runs
+	enum class TaskExecutor : uint8
+	{
+		/// @brief `Threading::ParallelFor()` と共有する、ワークスティーリング方式のスレッドプールで実行する | Run on the work-stealing thread pool shared with `Threading::ParallelFor()`
+		ThreadPool,
+
+		/// @brief メインスレッドで、次の `System::Update()` の中で実行する | Run on the main thread during the next `System::Update()`
+		MainThread,
+
+		/// @brief 呼び出し元、または前のタスクを完了させたスレッドでただちに実行する | Run immediately on the calling thread, or on the thread that completed the previous task
+		Inline,
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, TaskExecutor value);
+}
@@ -10,7 +10,10 @@
 //-----------------------------------------------
 
 # pragma once
+# include <functional>
 # include "Common.hpp"
+# include "FunctionRef.hpp"
+# include "TaskExecutor.hpp"
 
 namespace s3d
 {
@@ -26,5 +29,67 @@ namespace s3d
 		/// @return サポートされるスレッド数 | Number of concurrent threads supported
 		[[nodiscard]]
 		size_t GetConcurrency() noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetWorkerCount
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 並列処理に使われるワーカースレッドの数を返します。 | Returns the number of worker threads used for parallel processing.
+		/// @return ワーカースレッドの数 | Number of worker threads
+		/// @remark デフォルトでは `GetConcurrency() - 1` です。並列処理を呼び出したスレッドも処理に参加します。 | Defaults to `GetConcurrency() - 1`. The calling thread also takes part in the processing.
+		[[nodiscard]]
+		size_t GetWorkerCount();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	SetWorkerCount
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 並列処理に使われるワーカースレッドの数を設定します。 | Sets the number of worker threads used for parallel processing.
+		/// @param numWorkers ワーカースレッドの数。0 の場合は呼び出し元のスレッドのみで処理します。 | Number of worker threads. If 0, all work runs on the calling thread.
+		/// @remark 並列処理の実行中に呼び出してはいけません。 | Must not be called while parallel processing is in progress.
+		void SetWorkerCount(size_t numWorkers);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ParallelFor
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 範囲 [begin, end) をチャンクに分割し、ワーカースレッドで並列に処理します。 | Splits the range [begin, end) into chunks and processes them in parallel on the worker threads.
+		/// @param begin 範囲の開始 | Beginning of the range
+		/// @param end 範囲の終端 | End of the range
+		/// @param f 各チャンク [chunkBegin, chunkEnd) に対して呼ばれる関数 | Function called for each chunk [chunkBegin, chunkEnd)
+		/// @param grainSize チャンクの最小サイズ。0 の場合は自動で決定します。 | Minimum chunk size. If 0, it is chosen automatically.
+		/// @remark 範囲はワーカー間のワークスティーリングによって再分割されます。関数が例外を送出した場合、すべてのチャンクの終了後に呼び出し元で再送出されます。 | The range is re-split between workers by work stealing. If the function throws, the exception is rethrown on the calling thread after all chunks have finished.
+		void ParallelFor(size_t begin, size_t end, FunctionRef<void(size_t, size_t)> f, size_t grainSize = 0);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Post
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 関数を指定した場所で実行するよう要求します。 | Requests that a function be run on the specified executor.
+		/// @param executor 関数を実行する場所 | Where the function runs
+		/// @param f 実行する関数 | Function to run
+		/// @remark `TaskExecutor::ThreadPool` でワーカースレッドが 0 の場合は、呼び出し元のスレッドでただちに実行します。 | With `TaskExecutor::ThreadPool` and no worker threads, the function runs immediately on the calling thread.
+		/// @remark `TaskExecutor::ThreadPool` で関数が例外を送出した場合、例外はログに出力されて破棄されます。それ以外の場所では、例外は実行したスレッドに伝わります。 | With `TaskExecutor::ThreadPool`, an exception thrown by the function is logged and discarded. With other executors, the exception propagates on the thread that runs the function.
+		/// @remark `TaskExecutor::ThreadPool` の関数はワーカースレッドだけが実行し、`ParallelFor()` の完了を待つスレッドが実行することはありません。 | `TaskExecutor::ThreadPool` functions run only on worker threads, never on a thread that is waiting for `ParallelFor()` to finish.
+		void Post(TaskExecutor executor, std::function<void()> f);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ProcessMainThreadTasks
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `TaskExecutor::MainThread` に積まれた関数を実行します。 | Runs the functions posted to `TaskExecutor::MainThread`.
+		/// @return 実行した関数の数 | Number of functions run
+		/// @remark `System::Update()` の中で毎フレーム呼ばれます。実行中に新しく積まれた関数は、次の呼び出しで実行されます。 | Called every frame from `System::Update()`. Functions posted while this runs are run on the next call.
+		size_t ProcessMainThreadTasks();
 	}
 }
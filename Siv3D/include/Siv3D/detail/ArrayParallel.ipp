@@ -23,64 +23,21 @@ namespace s3d
 	template <class Fty>
 	isize Array<Type, Allocator>::parallel_count_if(Fty f) const requires std::predicate<Fty&, const value_type&>
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		return std::count_if(std::execution::par, m_container.begin(), m_container.end(), detail::PassFunction(std::forward<Fty>(f)));
-
-	# else
-
 		if (m_container.empty())
 		{
 			return 0;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return std::count_if(m_container.begin(), m_container.end(), detail::PassFunction(std::forward<Fty>(f)));
-		}
-
-		const size_t countPerthread = Max<size_t>(1, ((m_container.size() + (numThreads - 1)) / numThreads));
-
-		Array<std::future<isize>> tasks;
+		std::atomic<isize> result{ 0 };
 
-		auto it = m_container.begin();
-		size_t countLeft = m_container.size();
+		const auto first = m_container.begin();
 
-		for (size_t i = 0; i < (numThreads - 1); ++i)
+		Threading::ParallelFor(0, m_container.size(), [&](const size_t begin, const size_t end)
 		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			tasks.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				return std::count_if(it, (it + n), f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		isize result = 0;
-		
-		if (countLeft)
-		{
-			result = std::count_if(it, (it + countLeft), f);
-		}
-
-		for (auto& task : tasks)
-		{
-			result += task.get();
-		}
-
-		return result;
+			result.fetch_add(std::count_if((first + begin), (first + end), f), std::memory_order_relaxed);
+		});
 
-	# endif
+		return result.load();
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -93,120 +50,34 @@ namespace s3d
 	template <class Fty>
 	void Array<Type, Allocator>::parallel_each(Fty f) requires std::invocable<Fty&, value_type&>
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		std::for_each(std::execution::par, m_container.begin(), m_container.end(), detail::PassFunction(std::forward<Fty>(f)));
-
-	# else
-
 		if (m_container.empty())
 		{
 			return;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return each(std::forward<Fty>(f));
-		}
-
-		const size_t countPerthread = Max<size_t>(1, ((size() + (numThreads - 1)) / numThreads));
-
-		Array<std::future<void>> tasks;
-
-		auto it = m_container.begin();
-		size_t countLeft = size();
+		const auto first = m_container.begin();
 
-		for (size_t i = 0; i < (numThreads - 1); ++i)
+		Threading::ParallelFor(0, m_container.size(), [&](const size_t begin, const size_t end)
 		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			tasks.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, (it + n), f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			std::for_each(it, (it + countLeft), f);
-		}
-
-		for (auto& task : tasks)
-		{
-			task.get();
-		}
-
-	# endif
+			std::for_each((first + begin), (first + end), f);
+		});
 	}
 
 	template <class Type, class Allocator>
 	template <class Fty>
 	void Array<Type, Allocator>::parallel_each(Fty f) const requires std::invocable<Fty&, const value_type&>
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		std::for_each(std::execution::par, m_container.begin(), m_container.end(), detail::PassFunction(std::forward<Fty>(f)));
-
-	# else
-
 		if (m_container.empty())
 		{
 			return;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return each(std::forward<Fty>(f));
-		}
-
-		const size_t countPerthread = Max<size_t>(1, ((size() + (numThreads - 1)) / numThreads));
-
-		Array<std::future<void>> tasks;
-
-		auto it = m_container.begin();
-		size_t countLeft = size();
+		const auto first = m_container.begin();
 
-		for (size_t i = 0; i < (numThreads - 1); ++i)
+		Threading::ParallelFor(0, m_container.size(), [&](const size_t begin, const size_t end)
 		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			tasks.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, (it + n), f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			std::for_each(it, (it + countLeft), f);
-		}
-
-		for (auto& task : tasks)
-		{
-			task.get();
-		}
-
-	# endif
+			std::for_each((first + begin), (first + end), f);
+		});
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -226,63 +97,19 @@ namespace s3d
 			return Array<result_value_type>{};
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return map(std::forward<Fty>(f));
-		}
-
 		Array<result_value_type> result(m_container.size());
 
-		const size_t countPerthread = Max<size_t>(1, ((m_container.size() + (numThreads - 1)) / numThreads));
-
-		Array<std::future<void>> tasks;
-
-		auto itDst = result.begin();
-		auto itSrc = m_container.begin();
-		size_t countLeft = m_container.size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			tasks.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-			{
-				const auto itSrcEnd = (itSrc + n);
-
-				while (itSrc != itSrcEnd)
-				{
-					*itDst++ = f(*itSrc++);
-				}
-			}));
+		const auto itSrc = m_container.begin();
+		const auto itDst = result.begin();
 
-			itDst += n;
-			itSrc += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
+		Threading::ParallelFor(0, m_container.size(), [&](const size_t begin, const size_t end)
 		{
-			const auto itSrcEnd = m_container.end();
-
-			while (itSrc != itSrcEnd)
+			for (size_t i = begin; i < end; ++i)
 			{
-				*itDst++ = f(*itSrc++);
+				itDst[i] = f(itSrc[i]);
 			}
-		}
-
-		for (auto& task : tasks)
-		{
-			task.get();
-		}
+		});
 
 		return result;
 	}
 }
-
@@ -13,6 +13,141 @@
 
 namespace s3d
 {
+	namespace detail
+	{
+		/// @brief f の戻り値、または f が送出した例外を promise に設定します。
+		template <class Type, class Fty>
+		void FulfillPromise(std::promise<Type>& promise, Fty&& f) noexcept
+		{
+			try
+			{
+				if constexpr (std::is_void_v<Type>)
+				{
+					std::forward<Fty>(f)();
+					promise.set_value();
+				}
+				else
+				{
+					promise.set_value(std::forward<Fty>(f)());
+				}
+			}
+			catch (...)
+			{
+				promise.set_exception(std::current_exception());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	AsyncTaskPromise
+		//
+		////////////////////////////////////////////////////////////////
+
+		template <class Type>
+		struct AsyncTaskPromiseBase
+		{
+			std::promise<Type> promise;
+
+			std::shared_ptr<TaskCompletion> completion = std::make_shared<TaskCompletion>();
+
+			[[nodiscard]]
+			AsyncTask<Type> get_return_object()
+			{
+				return AsyncTask<Type>{ promise.get_future(), completion };
+			}
+
+			// コルーチンは呼び出し元のスレッドでただちに実行を始め、終了時にフレームを破棄する
+			[[nodiscard]]
+			std::suspend_never initial_suspend() const noexcept
+			{
+				return{};
+			}
+
+			[[nodiscard]]
+			std::suspend_never final_suspend() const noexcept
+			{
+				return{};
+			}
+
+			void unhandled_exception()
+			{
+				promise.set_exception(std::current_exception());
+				completion->complete();
+			}
+		};
+
+		template <class Type>
+		struct AsyncTaskPromise : AsyncTaskPromiseBase<Type>
+		{
+			void return_value(Type value)
+			{
+				this->promise.set_value(std::move(value));
+				this->completion->complete();
+			}
+		};
+
+		template <>
+		struct AsyncTaskPromise<void> : AsyncTaskPromiseBase<void>
+		{
+			void return_void()
+			{
+				this->promise.set_value();
+				this->completion->complete();
+			}
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	AsyncTaskAwaiter
+		//
+		////////////////////////////////////////////////////////////////
+
+		template <class Type>
+		struct AsyncTaskAwaiter
+		{
+			AsyncTask<Type> task;
+
+			[[nodiscard]]
+			bool await_ready() const
+			{
+				return task.isReady();
+			}
+
+			void await_suspend(std::coroutine_handle<> handle)
+			{
+				// 継続がこの関数の中で実行され、コルーチンのフレームが破棄されても安全なように、タスクをフレームの外に移す
+				AsyncTask<Type> pending = std::move(task);
+
+				(void)pending.then([this, handle](AsyncTask<Type>&& completed)
+					{
+						task = std::move(completed);
+						handle.resume();
+					}, TaskExecutor::Inline);
+			}
+
+			Type await_resume()
+			{
+				return task.get();
+			}
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ResumeOnAwaiter
+		//
+		////////////////////////////////////////////////////////////////
+
+		inline bool ResumeOnAwaiter::await_ready() const noexcept
+		{
+			return (executor == TaskExecutor::Inline);
+		}
+
+		inline void ResumeOnAwaiter::await_suspend(const std::coroutine_handle<> handle) const
+		{
+			Threading::Post(executor, [handle]() { handle.resume(); });
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	(constructor)
@@ -23,9 +158,15 @@ namespace s3d
 	AsyncTask<Type>::AsyncTask(base_type&& other) noexcept
 		: m_data{ std::move(other) } {}
 
+	template <class Type>
+	AsyncTask<Type>::AsyncTask(base_type&& other, std::shared_ptr<detail::TaskCompletion> completion) noexcept
+		: m_data{ std::move(other) }
+		, m_completion{ std::move(completion) } {}
+
 	template <class Type>
 	AsyncTask<Type>::AsyncTask(AsyncTask&& other) noexcept
-		: m_data{ std::move(other.m_data) } {}
+		: m_data{ std::move(other.m_data) }
+		, m_completion{ std::move(other.m_completion) } {}
 
 	template <class Type>
 	template <class Fty, class... Args>
@@ -46,6 +187,7 @@ namespace s3d
 	AsyncTask<Type>& AsyncTask<Type>::operator =(base_type&& other) noexcept
 	{
 		m_data = std::move(other);
+		m_completion.reset();
 		return *this;
 	}
 
@@ -53,6 +195,7 @@ namespace s3d
 	AsyncTask<Type>& AsyncTask<Type>::operator =(AsyncTask&& other) noexcept
 	{
 		m_data = std::move(other.m_data);
+		m_completion = std::move(other.m_completion);
 		return *this;
 	}
 
@@ -143,6 +286,100 @@ namespace s3d
 		return m_data.share();
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	then
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Type>
+	template <class Fty> requires (detail::TaskContinuation<Fty, Type> || detail::ValueContinuation<Fty, Type>)
+	auto AsyncTask<Type>::then(Fty&& f, const TaskExecutor executor)
+	{
+		return thenImpl(std::forward<Fty>(f), executor, std::nullopt);
+	}
+
+	template <class Type>
+	template <class Fty> requires (detail::TaskContinuation<Fty, Type> || detail::ValueContinuation<Fty, Type>)
+	auto AsyncTask<Type>::then(Fty&& f, const TaskExecutor executor, const CancellationToken& cancellationToken)
+	{
+		return thenImpl(std::forward<Fty>(f), executor, cancellationToken);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator co_await
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Type>
+	detail::AsyncTaskAwaiter<Type> AsyncTask<Type>::operator co_await() noexcept
+	{
+		return{ std::move(*this) };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Type>
+	template <class Fty>
+	auto AsyncTask<Type>::thenImpl(Fty&& f, const TaskExecutor executor, std::optional<CancellationToken> cancellationToken)
+	{
+		using Result = typename detail::ContinuationResult<std::decay_t<Fty>, Type>::type;
+
+		struct State
+		{
+			base_type antecedent;
+
+			std::decay_t<Fty> f;
+
+			std::optional<CancellationToken> cancellationToken;
+
+			std::promise<Result> promise;
+		};
+
+		auto state = std::make_shared<State>(State{ std::move(m_data), std::forward<Fty>(f), std::move(cancellationToken), {} });
+		auto completion = std::make_shared<detail::TaskCompletion>();
+		AsyncTask<Result> result{ state->promise.get_future(), completion };
+
+		detail::WhenReady(std::move(m_completion),
+			[state]() { state->antecedent.wait(); },
+			[state, completion, executor]()
+			{
+				Threading::Post(executor, [state, completion]()
+					{
+						detail::FulfillPromise(state->promise, [&]() -> Result
+							{
+								if (state->cancellationToken)
+								{
+									state->cancellationToken->throwIfCanceled();
+								}
+
+								if constexpr (detail::TaskContinuation<std::decay_t<Fty>, Type>)
+								{
+									return std::invoke(state->f, AsyncTask<Type>{ std::move(state->antecedent) });
+								}
+								else if constexpr (std::is_void_v<Type>)
+								{
+									state->antecedent.get();
+									return std::invoke(state->f);
+								}
+								else
+								{
+									return std::invoke(state->f, state->antecedent.get());
+								}
+							});
+
+						completion->complete();
+					});
+			});
+
+		return result;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	Async
@@ -154,4 +391,192 @@ namespace s3d
 	{
 		return AsyncTask<std::invoke_result_t<std::decay_t<Fty>, std::decay_t<Args>...>>{ std::forward<Fty>(f), std::forward<Args>(args)... };
 	}
+
+	template <class Fty, class... Args> requires std::invocable<std::decay_t<Fty>, std::decay_t<Args>...>
+	auto Async(const TaskExecutor executor, Fty&& f, Args&&... args)
+	{
+		using Result = std::invoke_result_t<std::decay_t<Fty>, std::decay_t<Args>...>;
+
+		auto promise = std::make_shared<std::promise<Result>>();
+		auto completion = std::make_shared<detail::TaskCompletion>();
+		AsyncTask<Result> result{ promise->get_future(), completion };
+
+		auto function = std::make_shared<std::function<Result()>>(
+			[f = std::forward<Fty>(f), ...args = std::forward<Args>(args)]() mutable -> Result
+			{
+				return std::invoke(std::move(f), std::move(args)...);
+			});
+
+		Threading::Post(executor, [promise, completion, function]()
+			{
+				detail::FulfillPromise(*promise, *function);
+				completion->complete();
+			});
+
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	WhenAll
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Type>
+	auto WhenAll(Array<AsyncTask<Type>> tasks)
+	{
+		using Result = std::conditional_t<std::is_void_v<Type>, void, Array<Type>>;
+
+		struct State
+		{
+			std::promise<Result> promise;
+
+			/// @brief 各タスクの結果（Type が void の場合は使わない）
+			Array<std::optional<std::conditional_t<std::is_void_v<Type>, bool, Type>>> values;
+
+			std::atomic<size_t> remainingCount{ 0 };
+
+			std::atomic<bool> failed{ false };
+
+			std::exception_ptr exception;
+		};
+
+		auto state = std::make_shared<State>();
+		auto completion = std::make_shared<detail::TaskCompletion>();
+		AsyncTask<Result> result{ state->promise.get_future(), completion };
+
+		const size_t taskCount = tasks.size();
+		state->values.resize(taskCount);
+		state->remainingCount.store(taskCount, std::memory_order_relaxed);
+
+		const auto finish = [state, completion]()
+		{
+			if (state->exception)
+			{
+				state->promise.set_exception(state->exception);
+			}
+			else if constexpr (std::is_void_v<Type>)
+			{
+				state->promise.set_value();
+			}
+			else
+			{
+				Array<Type> values(Arg::reserve = state->values.size());
+
+				for (auto& value : state->values)
+				{
+					values.push_back(std::move(*value));
+				}
+
+				state->promise.set_value(std::move(values));
+			}
+
+			completion->complete();
+		};
+
+		if (taskCount == 0)
+		{
+			finish();
+			return result;
+		}
+
+		for (size_t i = 0; i < taskCount; ++i)
+		{
+			(void)tasks[i].then([state, finish, i](AsyncTask<Type>&& task)
+				{
+					try
+					{
+						if constexpr (std::is_void_v<Type>)
+						{
+							task.get();
+						}
+						else
+						{
+							state->values[i].emplace(task.get());
+						}
+					}
+					catch (...)
+					{
+						if (not state->failed.exchange(true))
+						{
+							state->exception = std::current_exception();
+						}
+					}
+
+					if (state->remainingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						finish();
+					}
+				}, TaskExecutor::Inline);
+		}
+
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	WhenAny
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Type>
+	auto WhenAny(Array<AsyncTask<Type>> tasks)
+	{
+		using Result = std::conditional_t<std::is_void_v<Type>, size_t, std::pair<size_t, Type>>;
+
+		if (tasks.isEmpty())
+		{
+			throw Error{ "WhenAny(): tasks must not be empty" };
+		}
+
+		struct State
+		{
+			std::promise<Result> promise;
+
+			std::atomic<bool> done{ false };
+		};
+
+		auto state = std::make_shared<State>();
+		auto completion = std::make_shared<detail::TaskCompletion>();
+		AsyncTask<Result> result{ state->promise.get_future(), completion };
+
+		for (size_t i = 0; i < tasks.size(); ++i)
+		{
+			(void)tasks[i].then([state, completion, i](AsyncTask<Type>&& task)
+				{
+					if (state->done.exchange(true))
+					{
+						return;
+					}
+
+					detail::FulfillPromise(state->promise, [&]() -> Result
+						{
+							if constexpr (std::is_void_v<Type>)
+							{
+								task.get();
+								return i;
+							}
+							else
+							{
+								return Result{ i, task.get() };
+							}
+						});
+
+					completion->complete();
+				}, TaskExecutor::Inline);
+		}
+
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ResumeOn
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline detail::ResumeOnAwaiter ResumeOn(const TaskExecutor executor) noexcept
+	{
+		return{ executor };
+	}
 }
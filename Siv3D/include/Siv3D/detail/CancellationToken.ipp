@@ -0,0 +1,62 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "../Error/TaskCanceledError.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline CancellationToken::CancellationToken()
+		: m_canceled{ std::make_shared<std::atomic<bool>>(false) } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	cancel
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline void CancellationToken::cancel() const noexcept
+	{
+		m_canceled->store(true, std::memory_order_release);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isCanceled
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline bool CancellationToken::isCanceled() const noexcept
+	{
+		return m_canceled->load(std::memory_order_acquire);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	throwIfCanceled
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline void CancellationToken::throwIfCanceled() const
+	{
+		if (isCanceled())
+		{
+			throw TaskCanceledError{};
+		}
+	}
+}
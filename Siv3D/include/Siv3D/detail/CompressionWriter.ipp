@@ -0,0 +1,53 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Writer>
+		requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+	CompressionWriter::CompressionWriter(Writer&& writer, const int32 compressionLevel)
+		: CompressionWriter{}
+	{
+		open(std::forward<Writer>(writer), compressionLevel);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Writer>
+		requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+	bool CompressionWriter::open(Writer&& writer, const int32 compressionLevel)
+	{
+		return open(std::make_unique<Writer>(std::forward<Writer>(writer)), compressionLevel);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	write
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::write(const Concept::TriviallyCopyable auto& src)
+	{
+		return (write(std::addressof(src), sizeof(src)) == sizeof(src));
+	}
+}
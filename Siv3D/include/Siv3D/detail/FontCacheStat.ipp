@@ -0,0 +1,33 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	constexpr double FontCacheStat::glyphHitRate() const noexcept
+	{
+		const uint64 total = (glyphHits + glyphMisses);
+		return (total ? (static_cast<double>(glyphHits) / total) : 0.0);
+	}
+
+	constexpr double FontCacheStat::shapingHitRate() const noexcept
+	{
+		const uint64 total = (shapingHits + shapingMisses);
+		return (total ? (static_cast<double>(shapingHits) / total) : 0.0);
+	}
+
+	constexpr double FontCacheStat::atlasOccupancy() const noexcept
+	{
+		const int64 area = (static_cast<int64>(atlasSize.x) * atlasSize.y);
+		return (area ? (static_cast<double>(atlasUsedArea) / area) : 0.0);
+	}
+}
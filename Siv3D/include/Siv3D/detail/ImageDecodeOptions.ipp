@@ -0,0 +1,50 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+
+namespace s3d
+{
+	constexpr Rect ImageDecodeOptions::getRegion(const Size imageSize) const noexcept
+	{
+		if (not region)
+		{
+			return{ 0, 0, imageSize };
+		}
+
+		const int32 x0 = Clamp(region->x, 0, imageSize.x);
+		const int32 y0 = Clamp(region->y, 0, imageSize.y);
+		const int32 x1 = Clamp((region->x + region->w), x0, imageSize.x);
+		const int32 y1 = Clamp((region->y + region->h), y0, imageSize.y);
+
+		return{ x0, y0, (x1 - x0), (y1 - y0) };
+	}
+
+	constexpr int32 ImageDecodeOptions::getScaleDenominator(const Size regionSize, const int32 maxDenominator) const noexcept
+	{
+		if (not targetSize)
+		{
+			return 1;
+		}
+
+		int32 denominator = 1;
+
+		while ((denominator < maxDenominator)
+			&& (targetSize->x <= ((regionSize.x + (denominator * 2) - 1) / (denominator * 2)))
+			&& (targetSize->y <= ((regionSize.y + (denominator * 2) - 1) / (denominator * 2))))
+		{
+			denominator *= 2;
+		}
+
+		return denominator;
+	}
+}
@@ -0,0 +1,27 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+
+namespace s3d
+{
+	constexpr double ImageDecodeTiming::averageMillisec() const noexcept
+	{
+		return (decodeCount ? (totalMillisec / decodeCount) : 0.0);
+	}
+
+	constexpr double ImageDecoderStat::cacheHitRate() const noexcept
+	{
+		const uint64 total = (cacheHits + cacheMisses);
+		return (total ? (static_cast<double>(cacheHits) / total) : 0.0);
+	}
+}
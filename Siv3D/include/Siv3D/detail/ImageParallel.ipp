@@ -0,0 +1,75 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	parallel_count_if
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Fty>
+	isize Image::parallel_count_if(Fty f) const requires std::predicate<Fty&, const Color&>
+	{
+		return m_pixels.parallel_count_if(std::forward<Fty>(f));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	parallel_each
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Fty>
+	void Image::parallel_each(Fty f) requires std::invocable<Fty&, Color&>
+	{
+		m_pixels.parallel_each(std::forward<Fty>(f));
+	}
+
+	template <class Fty>
+	void Image::parallel_each(Fty f) const requires std::invocable<Fty&, const Color&>
+	{
+		m_pixels.parallel_each(std::forward<Fty>(f));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	parallel_map
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Fty>
+	Image Image::parallel_map(Fty f) const requires std::is_invocable_r_v<Color, Fty&, const Color&>
+	{
+		Image result(m_size);
+
+		if (not result)
+		{
+			return result;
+		}
+
+		const Color* const pSrc = m_pixels.data();
+		Color* const pDst = result.m_pixels.data();
+
+		Threading::ParallelFor(0, m_pixels.size(), [&](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				pDst[i] = f(pSrc[i]);
+			}
+		});
+
+		return result;
+	}
+}
@@ -0,0 +1,42 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Reader>
+		requires (std::is_base_of_v<IReader, Reader> && (not std::is_lvalue_reference_v<Reader>))
+	JSONReader::JSONReader(Reader&& reader)
+		: JSONReader{}
+	{
+		open(std::forward<Reader>(reader));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Reader>
+		requires (std::is_base_of_v<IReader, Reader> && (not std::is_lvalue_reference_v<Reader>))
+	bool JSONReader::open(Reader&& reader)
+	{
+		return open(std::make_unique<Reader>(std::forward<Reader>(reader)));
+	}
+}
@@ -0,0 +1,63 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Writer>
+		requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+	JSONWriter::JSONWriter(Writer&& writer)
+		: JSONWriter{}
+	{
+		open(std::forward<Writer>(writer));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Writer>
+		requires (std::is_base_of_v<IWriter, Writer> && (not std::is_lvalue_reference_v<Writer>))
+	bool JSONWriter::open(Writer&& writer)
+	{
+		return open(std::make_unique<Writer>(std::forward<Writer>(writer)));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	write
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter& JSONWriter::write(const Concept::SignedIntegral auto value)
+	{
+		return writeInt64(static_cast<int64>(value));
+	}
+
+	JSONWriter& JSONWriter::write(const Concept::UnsignedIntegral auto value)
+	{
+		return writeUint64(static_cast<uint64>(value));
+	}
+
+	JSONWriter& JSONWriter::write(const Concept::FloatingPoint auto value)
+	{
+		return writeDouble(static_cast<double>(value));
+	}
+}
@@ -0,0 +1,576 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <atomic>
+# include <cerrno>
+# include <cstring>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# include <linux/io_uring.h>
+# include <Siv3D/EngineLog.hpp>
+# include "IOUringReader.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief カーネルと共有するリングのインデックスを読み込みます。
+		[[nodiscard]]
+		static uint32 LoadAcquire(uint32* p) noexcept
+		{
+			return std::atomic_ref<uint32>{ *p }.load(std::memory_order_acquire);
+		}
+
+		/// @brief カーネルと共有するリングのインデックスを書き込みます。
+		static void StoreRelease(uint32* p, const uint32 value) noexcept
+		{
+			std::atomic_ref<uint32>{ *p }.store(value, std::memory_order_release);
+		}
+
+		/// @brief IORING_OP_READ をサポートしないカーネルのために、pread で残りを読み込みます。
+		[[nodiscard]]
+		static int64 ReadAt(const int fd, Byte* dst, const int64 pos, const int64 size) noexcept
+		{
+			int64 totalReadBytes = 0;
+
+			while (totalReadBytes < size)
+			{
+				const ssize_t result = ::pread(fd, (dst + totalReadBytes), static_cast<size_t>(size - totalReadBytes), static_cast<off_t>(pos + totalReadBytes));
+
+				if (0 < result)
+				{
+					totalReadBytes += result;
+				}
+				else if ((result < 0) && (errno == EINTR))
+				{
+					continue;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			return totalReadBytes;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	IOUringReader::~IOUringReader()
+	{
+		if (m_thread.joinable())
+		{
+			{
+				std::lock_guard lock{ m_mutex };
+				m_stop = true;
+			}
+
+			m_condition.notify_one();
+
+			m_thread.join();
+		}
+
+		release();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	init
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool IOUringReader::init()
+	{
+		io_uring_params params{};
+		m_ringFD = static_cast<int>(::syscall(__NR_io_uring_setup, QueueDepth, &params));
+
+		if (m_ringFD < 0)
+		{
+			LOG_INFO(fmt::format("ℹ️ BinaryReader: io_uring is not available (errno: {0}). Async reads use I/O threads", errno));
+			m_ringFD = -1;
+			return false;
+		}
+
+		m_sqRingSize = (params.sq_off.array + (params.sq_entries * sizeof(uint32)));
+		m_cqRingSize = (params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe)));
+
+		// SQ と CQ のリングを 1 回の mmap で共有できる場合
+		const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP);
+
+		if (singleMap)
+		{
+			m_sqRingSize = m_cqRingSize = Max(m_sqRingSize, m_cqRingSize);
+		}
+
+		m_sqRing = ::mmap(nullptr, m_sqRingSize, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_POPULATE), m_ringFD, IORING_OFF_SQ_RING);
+
+		if (m_sqRing == MAP_FAILED)
+		{
+			m_sqRing = nullptr;
+			LOG_FAIL("❌ BinaryReader: Failed to map the io_uring submission queue");
+			release();
+			return false;
+		}
+
+		if (singleMap)
+		{
+			m_cqRing = m_sqRing;
+		}
+		else
+		{
+			m_cqRing = ::mmap(nullptr, m_cqRingSize, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_POPULATE), m_ringFD, IORING_OFF_CQ_RING);
+
+			if (m_cqRing == MAP_FAILED)
+			{
+				m_cqRing = nullptr;
+				LOG_FAIL("❌ BinaryReader: Failed to map the io_uring completion queue");
+				release();
+				return false;
+			}
+		}
+
+		m_sqEntriesSize = (params.sq_entries * sizeof(io_uring_sqe));
+		void* sqEntries = ::mmap(nullptr, m_sqEntriesSize, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_POPULATE), m_ringFD, IORING_OFF_SQES);
+
+		if (sqEntries == MAP_FAILED)
+		{
+			LOG_FAIL("❌ BinaryReader: Failed to map the io_uring submission queue entries");
+			release();
+			return false;
+		}
+
+		{
+			Byte* const sqRing = static_cast<Byte*>(m_sqRing);
+
+			m_sq =
+			{
+				.head		= reinterpret_cast<uint32*>(sqRing + params.sq_off.head),
+				.tail		= reinterpret_cast<uint32*>(sqRing + params.sq_off.tail),
+				.mask		= *reinterpret_cast<uint32*>(sqRing + params.sq_off.ring_mask),
+				.entryCount	= *reinterpret_cast<uint32*>(sqRing + params.sq_off.ring_entries),
+				.array		= reinterpret_cast<uint32*>(sqRing + params.sq_off.array),
+				.entries	= static_cast<io_uring_sqe*>(sqEntries),
+			};
+		}
+
+		{
+			Byte* const cqRing = static_cast<Byte*>(m_cqRing);
+
+			m_cq =
+			{
+				.head		= reinterpret_cast<uint32*>(cqRing + params.cq_off.head),
+				.tail		= reinterpret_cast<uint32*>(cqRing + params.cq_off.tail),
+				.mask		= *reinterpret_cast<uint32*>(cqRing + params.cq_off.ring_mask),
+				.entries	= reinterpret_cast<io_uring_cqe*>(cqRing + params.cq_off.cqes),
+			};
+		}
+
+		m_thread = std::thread{ [this]() { run(); } };
+
+		LOG_INFO(fmt::format("ℹ️ BinaryReader: Async reads use io_uring (queue depth: {0})", m_sq.entryCount));
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	submit
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool IOUringReader::submit(const int fd, std::shared_ptr<const void> owner, Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete)
+	{
+		if (requests.isEmpty())
+		{
+			return true;
+		}
+
+		{
+			// 失敗している場合は、requests と onComplete を受け取らずに返す
+			std::lock_guard lock{ m_mutex };
+
+			if (m_failed)
+			{
+				return false;
+			}
+		}
+
+		const auto batch = std::make_shared<const Batch>(Batch{ fd, std::move(owner), std::move(requests), std::move(onComplete) });
+
+		// 読み込み先の確保は、要求したスレッドで行う
+		Array<std::unique_ptr<Operation>> operations(Arg::reserve = batch->requests.size());
+
+		for (size_t i = 0; i < batch->requests.size(); ++i)
+		{
+			auto operation = std::make_unique<Operation>();
+			operation->batch = batch;
+			operation->index = i;
+			operation->blob.resize(static_cast<size_t>(batch->requests[i].size));
+			operations << std::move(operation);
+		}
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			if (not m_failed)
+			{
+				for (auto& operation : operations)
+				{
+					m_pending.push_back(std::move(operation));
+				}
+
+				m_condition.notify_one();
+
+				return true;
+			}
+		}
+
+		// 確認した後に I/O スレッドが終了した場合は、この場で読み込む
+		for (auto& operation : operations)
+		{
+			ReadRemaining(*operation);
+			Complete(std::move(operation));
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Get
+	//
+	////////////////////////////////////////////////////////////////
+
+	IOUringReader* IOUringReader::Get()
+	{
+		static IOUringReader reader;
+		static const bool available = reader.init();
+		return (available ? &reader : nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	release
+	//
+	////////////////////////////////////////////////////////////////
+
+	void IOUringReader::release()
+	{
+		if (m_sq.entries)
+		{
+			::munmap(m_sq.entries, m_sqEntriesSize);
+			m_sq.entries = nullptr;
+		}
+
+		if (m_cqRing && (m_cqRing != m_sqRing))
+		{
+			::munmap(m_cqRing, m_cqRingSize);
+		}
+
+		m_cqRing = nullptr;
+
+		if (m_sqRing)
+		{
+			::munmap(m_sqRing, m_sqRingSize);
+			m_sqRing = nullptr;
+		}
+
+		if (m_ringFD != -1)
+		{
+			::close(m_ringFD);
+			m_ringFD = -1;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	prepareRead
+	//
+	////////////////////////////////////////////////////////////////
+
+	void IOUringReader::prepareRead(Operation* operation)
+	{
+		const AsyncReadRequest& request = operation->batch->requests[operation->index];
+		const int64 remainingBytes = (request.size - operation->readBytes);
+
+		// SQ のテールを更新するのは I/O スレッドだけ
+		const uint32 tail = *m_sq.tail;
+		const uint32 index = (tail & m_sq.mask);
+
+		io_uring_sqe& sqe = m_sq.entries[index];
+		std::memset(&sqe, 0, sizeof(sqe));
+		sqe.opcode		= IORING_OP_READ;
+		sqe.fd			= operation->batch->fd;
+		sqe.addr		= reinterpret_cast<uint64>(operation->blob.data() + operation->readBytes);
+		sqe.len			= static_cast<uint32>(Min(remainingBytes, MaxReadSizePerEntry));
+		sqe.off			= static_cast<uint64>(request.pos + operation->readBytes);
+		sqe.user_data	= reinterpret_cast<uint64>(operation);
+
+		m_sq.array[index] = index;
+		StoreRelease(m_sq.tail, (tail + 1));
+
+		m_inFlight.insert(operation);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	enter
+	//
+	////////////////////////////////////////////////////////////////
+
+	IOUringReader::EnterResult IOUringReader::enter(const uint32 submitCount, const uint32 waitCount)
+	{
+		const uint32 flags = ((0 < waitCount) ? IORING_ENTER_GETEVENTS : 0);
+
+		for (;;)
+		{
+			if (0 <= ::syscall(__NR_io_uring_enter, m_ringFD, submitCount, waitCount, flags, nullptr, 0))
+			{
+				return EnterResult::Success;
+			}
+
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			// CQ に空きがない場合など。完了を処理してから再試行する
+			if ((errno == EAGAIN) || (errno == EBUSY))
+			{
+				return EnterResult::Busy;
+			}
+
+			LOG_FAIL(fmt::format("❌ BinaryReader: io_uring_enter() failed (errno: {0}). Falling back to I/O threads", errno));
+
+			return EnterResult::Failed;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	reapCompletions
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t IOUringReader::reapCompletions(std::deque<Operation*>& retries)
+	{
+		uint32 head = *m_cq.head;
+		const uint32 tail = LoadAcquire(m_cq.tail);
+		size_t count = 0;
+
+		for (; head != tail; ++head, ++count)
+		{
+			const io_uring_cqe& cqe = m_cq.entries[head & m_cq.mask];
+			Operation* operation = reinterpret_cast<Operation*>(cqe.user_data);
+			m_inFlight.erase(operation);
+			const AsyncReadRequest& request = operation->batch->requests[operation->index];
+			const int32 result = cqe.res;
+
+			if (0 < result)
+			{
+				operation->readBytes += result;
+
+				// 一部だけが読み込まれた場合は、残りを再び発行する
+				if (operation->readBytes < request.size)
+				{
+					retries.push_back(operation);
+					continue;
+				}
+			}
+			else if ((result == -EINTR) || (result == -EAGAIN))
+			{
+				retries.push_back(operation);
+				continue;
+			}
+			else if ((result == -EINVAL) || (result == -EOPNOTSUPP))
+			{
+				// IORING_OP_READ をサポートしない古いカーネル
+				ReadRemaining(*operation);
+			}
+			else if (result < 0)
+			{
+				LOG_FAIL(fmt::format("❌ BinaryReader: Async read failed (errno: {0})", -result));
+			}
+
+			Complete(std::unique_ptr<Operation>{ operation });
+		}
+
+		StoreRelease(m_cq.head, head);
+
+		return count;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Complete
+	//
+	////////////////////////////////////////////////////////////////
+
+	void IOUringReader::Complete(std::unique_ptr<Operation> operation)
+	{
+		operation->blob.resize(static_cast<size_t>(operation->readBytes));
+		operation->batch->onComplete(operation->index, std::move(operation->blob));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ReadRemaining
+	//
+	////////////////////////////////////////////////////////////////
+
+	void IOUringReader::ReadRemaining(Operation& operation)
+	{
+		const AsyncReadRequest& request = operation.batch->requests[operation.index];
+
+		operation.readBytes += ReadAt(operation.batch->fd, (operation.blob.data() + operation.readBytes),
+			(request.pos + operation.readBytes), (request.size - operation.readBytes));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	abandon
+	//
+	////////////////////////////////////////////////////////////////
+
+	void IOUringReader::abandon(std::deque<Operation*>& retries)
+	{
+		// すでに届いている完了を処理する
+		reapCompletions(retries);
+
+		// カーネルがまだ受け取っていない SQE は、pread で読み込む
+		for (uint32 head = LoadAcquire(m_sq.head); head != *m_sq.tail; ++head)
+		{
+			Operation* operation = reinterpret_cast<Operation*>(m_sq.entries[m_sq.array[head & m_sq.mask]].user_data);
+			m_inFlight.erase(operation);
+			retries.push_back(operation);
+		}
+
+		std::deque<std::unique_ptr<Operation>> pending;
+		{
+			std::lock_guard lock{ m_mutex };
+			m_failed = true;
+			pending.swap(m_pending);
+		}
+
+		for (Operation* operation : retries)
+		{
+			pending.emplace_back(operation);
+		}
+
+		retries.clear();
+
+		for (auto& operation : pending)
+		{
+			ReadRemaining(*operation);
+			Complete(std::move(operation));
+		}
+
+		// カーネルが受け取った読み込みは、後から読み込み先に書き込まれる可能性があるため、読み込み先を解放せずに失敗として通知する
+		for (Operation* operation : m_inFlight)
+		{
+			operation->batch->onComplete(operation->index, Blob{});
+		}
+
+		m_inFlight.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	run
+	//
+	////////////////////////////////////////////////////////////////
+
+	void IOUringReader::run()
+	{
+		// SQE に積んでから、まだ CQE を受け取っていない読み込みの数
+		uint32 inFlightCount = 0;
+
+		std::deque<Operation*> retries;
+
+		// 読み込むデータがない要求。コールバックはロックの外で呼ぶ
+		Array<std::unique_ptr<Operation>> emptyOperations;
+
+		for (;;)
+		{
+			while ((not retries.empty()) && (inFlightCount < m_sq.entryCount))
+			{
+				prepareRead(retries.front());
+				retries.pop_front();
+				++inFlightCount;
+			}
+
+			{
+				std::unique_lock lock{ m_mutex };
+
+				if ((inFlightCount == 0) && retries.empty())
+				{
+					m_condition.wait(lock, [this]() { return (m_stop || (not m_pending.empty())); });
+
+					if (m_pending.empty())
+					{
+						return;
+					}
+				}
+
+				while ((not m_pending.empty()) && (inFlightCount < m_sq.entryCount))
+				{
+					std::unique_ptr<Operation> operation = std::move(m_pending.front());
+					m_pending.pop_front();
+
+					if (operation->blob.isEmpty())
+					{
+						emptyOperations << std::move(operation);
+						continue;
+					}
+
+					prepareRead(operation.release());
+					++inFlightCount;
+				}
+			}
+
+			for (auto& operation : emptyOperations)
+			{
+				Complete(std::move(operation));
+			}
+
+			emptyOperations.clear();
+
+			if (inFlightCount == 0)
+			{
+				continue;
+			}
+
+			// カーネルがまだ受け取っていない SQE をすべて発行し、少なくとも 1 つの完了を待つ
+			const uint32 submitCount = (*m_sq.tail - LoadAcquire(m_sq.head));
+
+			const EnterResult result = enter(submitCount, 1);
+
+			if (result == EnterResult::Failed)
+			{
+				abandon(retries);
+				return;
+			}
+			else if (result == EnterResult::Busy)
+			{
+				std::this_thread::yield();
+			}
+
+			inFlightCount -= static_cast<uint32>(reapCompletions(retries));
+		}
+	}
+}
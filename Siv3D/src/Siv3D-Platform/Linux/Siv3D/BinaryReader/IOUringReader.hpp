@@ -0,0 +1,190 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <mutex>
+# include <condition_variable>
+# include <thread>
+# include <deque>
+# include <memory>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashSet.hpp>
+# include <Siv3D/Blob.hpp>
+# include <Siv3D/AsyncReadRequest.hpp>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	IOUringReader
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief io_uring を使って、複数の読み込みをまとめてカーネルに発行するクラス
+	/// @remark liburing を使わず、システムコールを直接呼びます。発行と完了の処理は 1 つの I/O スレッドで行います。
+	class IOUringReader
+	{
+	public:
+
+		[[nodiscard]]
+		IOUringReader() = default;
+
+		/// @brief 発行済みの読み込みがすべて完了してから、I/O スレッドを終了します。
+		~IOUringReader();
+
+		/// @brief io_uring を初期化し、I/O スレッドを起動します。
+		/// @return 初期化に成功した場合 true, カーネルが io_uring をサポートしていない場合などは false
+		[[nodiscard]]
+		bool init();
+
+		/// @brief 読み込みを要求します。
+		/// @param fd 読み込むファイルのファイルディスクリプタ
+		/// @param owner 読み込みがすべて終わるまで fd を開いたままにするためのオブジェクト
+		/// @param requests 読み込む範囲。ファイルの範囲に収まっている必要があります。
+		/// @param onComplete 1 つの範囲の読み込みが終わるたびに、I/O スレッドから呼ばれる関数
+		/// @return 要求を受け付けた場合 true, io_uring が使えなくなって I/O スレッドが終了している場合は false
+		[[nodiscard]]
+		bool submit(int fd, std::shared_ptr<const void> owner, Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete);
+
+		/// @brief io_uring を使える場合、共有のインスタンスを返します。
+		/// @return 共有のインスタンス。io_uring を使えない場合は nullptr
+		[[nodiscard]]
+		static IOUringReader* Get();
+
+	private:
+
+		/// @brief サブミッションキューのエントリ数
+		static constexpr uint32 QueueDepth = 256;
+
+		/// @brief 1 つの SQE で読み込む最大のサイズ（バイト）
+		static constexpr int64 MaxReadSizePerEntry = (1LL << 30);
+
+		struct Batch
+		{
+			int fd = -1;
+
+			std::shared_ptr<const void> owner;
+
+			Array<AsyncReadRequest> requests;
+
+			AsyncReadCallback onComplete;
+		};
+
+		/// @brief 1 つの範囲の読み込み。ポインタを SQE の user_data に使う
+		struct Operation
+		{
+			std::shared_ptr<const Batch> batch;
+
+			size_t index = 0;
+
+			Blob blob;
+
+			int64 readBytes = 0;
+		};
+
+		struct SubmissionQueue
+		{
+			uint32* head = nullptr;
+
+			uint32* tail = nullptr;
+
+			uint32 mask = 0;
+
+			uint32 entryCount = 0;
+
+			uint32* array = nullptr;
+
+			io_uring_sqe* entries = nullptr;
+
+		} m_sq;
+
+		struct CompletionQueue
+		{
+			uint32* head = nullptr;
+
+			uint32* tail = nullptr;
+
+			uint32 mask = 0;
+
+			io_uring_cqe* entries = nullptr;
+
+		} m_cq;
+
+		int m_ringFD = -1;
+
+		void* m_sqRing = nullptr;
+
+		size_t m_sqRingSize = 0;
+
+		void* m_cqRing = nullptr;
+
+		size_t m_cqRingSize = 0;
+
+		size_t m_sqEntriesSize = 0;
+
+		std::mutex m_mutex;
+
+		std::condition_variable m_condition;
+
+		/// @brief まだ SQE に積まれていない読み込み
+		std::deque<std::unique_ptr<Operation>> m_pending;
+
+		/// @brief SQE に積んでから、まだ CQE を受け取っていない読み込み（I/O スレッドだけが使う）
+		HashSet<Operation*> m_inFlight;
+
+		bool m_stop = false;
+
+		/// @brief io_uring_enter() が回復できないエラーで失敗し、I/O スレッドが終了したか
+		bool m_failed = false;
+
+		std::thread m_thread;
+
+		void release();
+
+		/// @brief 読み込みの残りの部分を SQE に積みます。
+		void prepareRead(Operation* operation);
+
+		enum class EnterResult
+		{
+			/// @brief 発行または待機に成功した
+			Success,
+
+			/// @brief CQ に空きがないなど。完了を処理してから再試行できる
+			Busy,
+
+			/// @brief 回復できないエラー
+			Failed,
+		};
+
+		/// @brief 積んだ SQE を発行し、waitCount 個の完了を待ちます。
+		[[nodiscard]]
+		EnterResult enter(uint32 submitCount, uint32 waitCount);
+
+		/// @brief 完了した読み込みを処理し、まだ残りがある読み込みを retries に追加します。
+		/// @return 完了を処理した CQE の数
+		size_t reapCompletions(std::deque<Operation*>& retries);
+
+		static void Complete(std::unique_ptr<Operation> operation);
+
+		/// @brief 読み込みの残りを pread で読み込みます。
+		static void ReadRemaining(Operation& operation);
+
+		/// @brief io_uring が使えなくなったときに、残っているすべての読み込みを終わらせます。
+		void abandon(std::deque<Operation*>& retries);
+
+		void run();
+	};
+}
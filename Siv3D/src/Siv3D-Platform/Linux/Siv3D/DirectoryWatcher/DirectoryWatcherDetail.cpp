@@ -0,0 +1,555 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cerrno>
+# include <array>
+# include <dirent.h>
+# include <unistd.h>
+# include <sys/stat.h>
+# include <sys/inotify.h>
+# include <sys/epoll.h>
+# include <sys/eventfd.h>
+# include <Siv3D/RangeFormatter.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "DirectoryWatcherDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		using Clock = FileChangeCoalescer::Clock;
+
+		static constexpr uint32 WatchMask = (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR | IN_DONT_FOLLOW | IN_EXCL_UNLINK);
+
+		/// @brief IN_MOVED_FROM と対になる IN_MOVED_TO が、別の read() で届くのを待つ時間
+		/// @remark 2 つのイベントは続けてキューに積まれるが、その間に read() が EAGAIN を返すことがある
+		static constexpr std::chrono::milliseconds MovedToTimeout{ 10 };
+
+		[[nodiscard]]
+		static constexpr FileAction ToFileAction(const uint32 mask) noexcept
+		{
+			if (mask & (IN_CREATE | IN_MOVED_TO))
+			{
+				return FileAction::Added;
+			}
+			else if (mask & IN_MODIFY)
+			{
+				return FileAction::Modified;
+			}
+			else if (mask & (IN_DELETE | IN_MOVED_FROM))
+			{
+				return FileAction::Removed;
+			}
+			else
+			{
+				return FileAction::Unknown;
+			}
+		}
+
+		[[nodiscard]]
+		static bool IsDirectoryEntry(const dirent& entry, const std::string& directory)
+		{
+			if (entry.d_type != DT_UNKNOWN)
+			{
+				return (entry.d_type == DT_DIR);
+			}
+
+			// d_type をサポートしないファイルシステム
+			struct stat s;
+
+			if (::lstat((directory + entry.d_name).c_str(), &s) != 0)
+			{
+				return false;
+			}
+
+			return S_ISDIR(s.st_mode);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	DirectoryWatcher::DirectoryWatcherDetail::~DirectoryWatcherDetail()
+	{
+		if (m_thread.joinable())
+		{
+			m_thread.request_stop();
+
+			const uint64 value = 1;
+			[[maybe_unused]] const ssize_t result = ::write(m_wakeFD, &value, sizeof(value));
+
+			m_thread.join();
+		}
+
+		if (not isActive())
+		{
+			return;
+		}
+
+		closeHandles();
+
+		LOG_INFO(fmt::format("ℹ️ DirectoryWatcher: Stopped watching `{}`", m_directory));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	start
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& coalescingWindow)
+	{
+		if (directory.isEmpty()
+			|| (not FileSystem::IsDirectory(directory)))
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcherDetail::start(): `{}` is not a directory", directory));
+			return false;
+		}
+
+		m_directory = FileSystem::FullPath(directory);
+		m_extensionFilter.set(applicableExtensions);
+		m_coalescer = FileChangeCoalescer{ std::chrono::duration_cast<Clock::duration>(coalescingWindow) };
+		m_buffer.resize(BufferSize);
+
+		m_inotifyFD	= ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		m_epollFD	= ::epoll_create1(EPOLL_CLOEXEC);
+		m_wakeFD	= ::eventfd(0, (EFD_NONBLOCK | EFD_CLOEXEC));
+
+		if ((m_inotifyFD == -1) || (m_epollFD == -1) || (m_wakeFD == -1))
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcher: Failed to initialize inotify (errno: {0})", errno));
+			closeHandles();
+			return false;
+		}
+
+		for (const int fd : { m_inotifyFD, m_wakeFD })
+		{
+			epoll_event event{ .events = EPOLLIN, .data = { .fd = fd } };
+
+			if (::epoll_ctl(m_epollFD, EPOLL_CTL_ADD, fd, &event) == -1)
+			{
+				LOG_FAIL(fmt::format("❌ DirectoryWatcher: epoll_ctl() failed (errno: {0})", errno));
+				closeHandles();
+				return false;
+			}
+		}
+
+		addWatches(m_directory, false, Clock::now());
+
+		if (m_watches.empty())
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcher: inotify_add_watch() failed. `{}`", m_directory));
+			closeHandles();
+			return false;
+		}
+
+		m_thread = std::jthread{ DirectoryWatcherDetail::Run, this };
+
+		if (m_extensionFilter)
+		{
+			LOG_INFO(fmt::format("ℹ️ DirectoryWatcher: Started to watch `{}` ({} directories). applicableExtensions = {}", m_directory, m_watches.size(), Format(m_extensionFilter.getSortedExtensions())));
+		}
+		else
+		{
+			LOG_INFO(fmt::format("ℹ️ DirectoryWatcher: Started to watch `{}` ({} directories)", m_directory, m_watches.size()));
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isActive
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWatcher::DirectoryWatcherDetail::isActive() const
+	{
+		return (m_inotifyFD != -1);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	retrieveChanges
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DirectoryWatcher::DirectoryWatcherDetail::retrieveChanges(Array<FileChange>& fileChanges)
+	{
+		std::lock_guard lock{ m_fileChanges.mutex };
+
+		fileChanges.assign(m_fileChanges.fileChanges.begin(), m_fileChanges.fileChanges.end());
+
+		m_fileChanges.fileChanges.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clearChanges
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DirectoryWatcher::DirectoryWatcherDetail::clearChanges()
+	{
+		std::lock_guard lock{ m_fileChanges.mutex };
+
+		m_fileChanges.fileChanges.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	directory
+	//
+	////////////////////////////////////////////////////////////////
+
+	const FilePath& DirectoryWatcher::DirectoryWatcherDetail::directory() const noexcept
+	{
+		return m_directory;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	applicableExtensions
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Array<String>& DirectoryWatcher::DirectoryWatcherDetail::applicableExtensions() const
+	{
+		return m_extensionFilter.getSortedExtensions();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DirectoryWatcher::DirectoryWatcherDetail::closeHandles()
+	{
+		for (int* fd : { &m_wakeFD, &m_epollFD, &m_inotifyFD })
+		{
+			if (*fd != -1)
+			{
+				::close(std::exchange(*fd, -1));
+			}
+		}
+
+		m_watches.clear();
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::addWatches(const FilePath& directory, const bool reportContents, const Clock::time_point now)
+	{
+		// 深いディレクトリでもスタックを使い切らないよう、再帰呼び出しをしない
+		Array<FilePath> directories = { directory };
+
+		while (directories)
+		{
+			const FilePath current = std::move(directories.back());
+			directories.pop_back();
+
+			const std::string nativePath = Unicode::ToUTF8(current);
+			const int wd = ::inotify_add_watch(m_inotifyFD, nativePath.c_str(), WatchMask);
+
+			if (wd == -1)
+			{
+				if (errno == ENOSPC)
+				{
+					LOG_FAIL(fmt::format("❌ DirectoryWatcher: The inotify watch limit has been reached. Increase fs.inotify.max_user_watches to watch `{}`", current));
+				}
+
+				// ENOENT などは、すでに削除されたディレクトリ
+				continue;
+			}
+
+			m_watches[wd] = current;
+
+			DIR* dir = ::opendir(nativePath.c_str());
+
+			if (not dir)
+			{
+				continue;
+			}
+
+			// 作成されたディレクトリの中身は、watch を追加する前に作られている可能性があるので、走査して報告する
+			while (const dirent* entry = ::readdir(dir))
+			{
+				const std::string_view name{ entry->d_name };
+
+				if ((name == ".") || (name == ".."))
+				{
+					continue;
+				}
+
+				const bool isDirectory = IsDirectoryEntry(*entry, nativePath);
+
+				if (reportContents)
+				{
+					enqueue(current, name, isDirectory, FileAction::Added, now);
+				}
+
+				if (isDirectory)
+				{
+					directories.push_back(current + Unicode::FromUTF8(name) + U'/');
+				}
+			}
+
+			::closedir(dir);
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::removeWatches(const FilePath& directory)
+	{
+		Array<int> removed;
+
+		for (const auto& [wd, path] : m_watches)
+		{
+			if (path.starts_with(directory))
+			{
+				removed << wd;
+			}
+		}
+
+		for (const int wd : removed)
+		{
+			// 後で届く IN_IGNORED は、m_watches に無いので無視される
+			::inotify_rm_watch(m_inotifyFD, wd);
+			m_watches.erase(wd);
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::renameWatches(const FilePath& from, const FilePath& to)
+	{
+		for (auto& [wd, path] : m_watches)
+		{
+			if (path.starts_with(from))
+			{
+				path = (to + path.substr(from.size()));
+			}
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::removeMovedDirectory()
+	{
+		if (m_movedDirectory)
+		{
+			removeWatches(m_movedDirectory->path);
+			m_movedDirectory.reset();
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::expireMovedDirectory(const Clock::time_point now)
+	{
+		if (m_movedDirectory && (m_movedDirectory->deadline <= now))
+		{
+			removeMovedDirectory();
+		}
+	}
+
+	int32 DirectoryWatcher::DirectoryWatcherDetail::timeoutMillisec(const Clock::time_point now) const
+	{
+		const int32 timeout = m_coalescer.timeoutMillisec(now);
+
+		if (not m_movedDirectory)
+		{
+			return timeout;
+		}
+
+		// IN_MOVED_TO を待つ期限より前に起きないよう切り上げる
+		const int32 movedTimeout = ((m_movedDirectory->deadline <= now) ? 0
+			: static_cast<int32>(std::chrono::ceil<std::chrono::milliseconds>(m_movedDirectory->deadline - now).count()));
+
+		return ((timeout == -1) ? movedTimeout : Min(timeout, movedTimeout));
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::enqueue(const FilePath& directory, const std::string_view name, const bool isDirectory, const FileAction action, const Clock::time_point now)
+	{
+		const String fileName = Unicode::FromUTF8(name);
+
+		// 拡張子フィルタがある場合、対象外の変更はキューに積まない
+		if (m_extensionFilter
+			&& (isDirectory || (not m_extensionFilter.includes(FileSystem::Extension(fileName)))))
+		{
+			return;
+		}
+
+		FilePath path = (directory + fileName);
+
+		if (isDirectory)
+		{
+			path.push_back(U'/');
+		}
+
+		m_coalescer.add(std::move(path), action, now);
+	}
+
+	bool DirectoryWatcher::DirectoryWatcherDetail::readEvents()
+	{
+		const Clock::time_point now = Clock::now();
+
+		for (;;)
+		{
+			const ssize_t length = ::read(m_inotifyFD, m_buffer.data(), m_buffer.size());
+
+			if (length <= 0)
+			{
+				if ((length == -1) && (errno == EINTR))
+				{
+					continue;
+				}
+
+				if ((length == -1) && (errno != EAGAIN))
+				{
+					LOG_FAIL(fmt::format("❌ DirectoryWatcher: Failed to read inotify events (errno: {0})", errno));
+					return false;
+				}
+
+				// 対になる IN_MOVED_TO がまだキューに積まれていない可能性があるので、m_movedDirectory は期限まで残す
+				return true;
+			}
+
+			for (const uint8* p = m_buffer.data(); p < (m_buffer.data() + length);)
+			{
+				const inotify_event& event = *reinterpret_cast<const inotify_event*>(p);
+				p += (sizeof(inotify_event) + event.len);
+
+				// IN_MOVED_FROM の次のイベント（前の read() で届いた場合も含む）が、同じ cookie の IN_MOVED_TO でなければ、ディレクトリは監視対象の外に移動された
+				if (m_movedDirectory
+					&& (not ((event.mask & IN_MOVED_TO) && (event.cookie == m_movedDirectory->cookie))))
+				{
+					removeMovedDirectory();
+				}
+
+				if (event.mask & IN_Q_OVERFLOW)
+				{
+					LOG_WARN(fmt::format("⚠️ DirectoryWatcher: The inotify event queue overflowed. Some changes in `{}` were lost", m_directory));
+					continue;
+				}
+
+				const auto it = m_watches.find(event.wd);
+
+				if (it == m_watches.end())
+				{
+					continue;
+				}
+
+				if (event.mask & IN_IGNORED)
+				{
+					m_watches.erase(it);
+					continue;
+				}
+
+				const FileAction action = ToFileAction(event.mask);
+
+				if ((event.len == 0) || (action == FileAction::Unknown))
+				{
+					continue;
+				}
+
+				const std::string_view name{ event.name };
+				const bool isDirectory = (event.mask & IN_ISDIR);
+
+				if (not isDirectory)
+				{
+					enqueue(it->second, name, false, action, now);
+					continue;
+				}
+
+				// addWatches() と removeWatches() は m_watches を変更するので、パスをコピーしておく
+				const FilePath parent = it->second;
+				enqueue(parent, name, true, action, now);
+
+				const FilePath path = (parent + Unicode::FromUTF8(name) + U'/');
+
+				if (event.mask & IN_MOVED_FROM)
+				{
+					m_movedDirectory = MovedDirectory{ event.cookie, path, (now + MovedToTimeout) };
+				}
+				else if (event.mask & IN_MOVED_TO)
+				{
+					if (m_movedDirectory)
+					{
+						// 監視対象の中での移動。移動の後に届くイベントを失わないよう、watch はそのまま使う
+						renameWatches(m_movedDirectory->path, path);
+						m_movedDirectory.reset();
+					}
+					else
+					{
+						// 名前の変更では、Windows と同じくディレクトリの中身を報告しない
+						addWatches(path, false, now);
+					}
+				}
+				else if (event.mask & IN_CREATE)
+				{
+					addWatches(path, true, now);
+				}
+			}
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::flushChanges(const Clock::time_point now)
+	{
+		m_coalescer.flush(m_readyChanges, now);
+
+		if (not m_readyChanges)
+		{
+			return;
+		}
+
+		{
+			std::lock_guard lock{ m_fileChanges.mutex };
+
+			m_fileChanges.fileChanges.append(m_readyChanges);
+		}
+
+		m_readyChanges.clear();
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::Run(std::stop_token stop_token, DirectoryWatcherDetail* watcher)
+	{
+		std::array<epoll_event, 2> events;
+
+		while (not stop_token.stop_requested())
+		{
+			// 保留中の変更や、IN_MOVED_TO を待っているディレクトリがあれば、最も早い期限まで待つ
+			const int timeout = watcher->timeoutMillisec(Clock::now());
+			const int count = ::epoll_wait(watcher->m_epollFD, events.data(), static_cast<int>(events.size()), timeout);
+
+			if (count == -1)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				LOG_FAIL(fmt::format("❌ DirectoryWatcher: epoll_wait() failed (errno: {0})", errno));
+				return;
+			}
+
+			for (int i = 0; i < count; ++i)
+			{
+				if ((events[i].data.fd == watcher->m_inotifyFD)
+					&& (not watcher->readEvents()))
+				{
+					return;
+				}
+			}
+
+			const Clock::time_point now = Clock::now();
+			watcher->expireMovedDirectory(now);
+			watcher->flushChanges(now);
+		}
+	}
+}
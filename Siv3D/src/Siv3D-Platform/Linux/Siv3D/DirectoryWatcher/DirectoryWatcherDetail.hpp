@@ -0,0 +1,166 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <thread>
+# include <mutex>
+# include <Siv3D/DirectoryWatcher.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/ExtensionFilter/ExtensionFilter.hpp>
+# include <Siv3D/DirectoryWatcher/FileChangeCoalescer.hpp>
+
+namespace s3d
+{
+	/// @remark 監視するディレクトリ以下のすべてのディレクトリに inotify の watch を追加し、1 つのスレッドが epoll でイベントを待ちます。
+	/// @remark 拡張子フィルタはキューに積む前に適用し、同じファイルへの変更は FileChangeCoalescer でまとめます。
+	class DirectoryWatcher::DirectoryWatcherDetail
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		DirectoryWatcherDetail() = default;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(destructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		~DirectoryWatcherDetail();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	start
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& coalescingWindow);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isActive
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool isActive() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	retrieveChanges
+		//
+		////////////////////////////////////////////////////////////////
+
+		void retrieveChanges(Array<FileChange>& fileChanges);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	clearChanges
+		//
+		////////////////////////////////////////////////////////////////
+
+		void clearChanges();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	directory
+		//
+		////////////////////////////////////////////////////////////////
+
+		const FilePath& directory() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	applicableExtensions
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		const Array<String>& applicableExtensions() const;
+
+	private:
+
+		static constexpr size_t BufferSize = (64 * 1024);
+
+		FilePath m_directory;
+
+		ExtensionFilter m_extensionFilter;
+
+		int m_inotifyFD = -1;
+
+		int m_epollFD = -1;
+
+		// スレッドを起こすための eventfd
+		int m_wakeFD = -1;
+
+		// 以下はスレッドの開始後、スレッドからのみアクセスする
+
+		// watch descriptor -> ディレクトリのパス（末尾は '/'）
+		HashMap<int, FilePath> m_watches;
+
+		struct MovedDirectory
+		{
+			uint32 cookie = 0;
+
+			FilePath path;
+
+			// この時刻までに IN_MOVED_TO が届かなければ、監視対象の外に移動されたとみなす
+			FileChangeCoalescer::Clock::time_point deadline;
+		};
+
+		// IN_MOVED_TO を待っている、移動されたディレクトリ
+		Optional<MovedDirectory> m_movedDirectory;
+
+		FileChangeCoalescer m_coalescer;
+
+		Array<uint8> m_buffer;
+
+		Array<FileChange> m_readyChanges;
+
+		std::jthread m_thread;
+
+		struct FileChanges
+		{
+			std::mutex mutex;
+
+			Array<FileChange> fileChanges;
+		
+		} m_fileChanges;
+
+		void closeHandles();
+
+		void addWatches(const FilePath& directory, bool reportContents, FileChangeCoalescer::Clock::time_point now);
+
+		void removeWatches(const FilePath& directory);
+
+		void renameWatches(const FilePath& from, const FilePath& to);
+
+		void removeMovedDirectory();
+
+		void expireMovedDirectory(FileChangeCoalescer::Clock::time_point now);
+
+		[[nodiscard]]
+		int32 timeoutMillisec(FileChangeCoalescer::Clock::time_point now) const;
+
+		void enqueue(const FilePath& directory, std::string_view name, bool isDirectory, FileAction action, FileChangeCoalescer::Clock::time_point now);
+
+		bool readEvents();
+
+		void flushChanges(FileChangeCoalescer::Clock::time_point now);
+
+		static void Run(std::stop_token stop_token, DirectoryWatcherDetail* watcher);
+	};
+}
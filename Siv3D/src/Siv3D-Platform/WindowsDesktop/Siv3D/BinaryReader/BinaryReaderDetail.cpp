@@ -12,11 +12,45 @@
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/FormatUtility.hpp>
 # include <Siv3D/Resource.hpp>
+# include <Siv3D/Blob.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/BinaryReader/AsyncReadWorkers.hpp>
 # include "BinaryReaderDetail.hpp"
 
 namespace s3d
 {
+	namespace
+	{
+		/// @brief ファイルの読み込み位置を変えずに、指定した位置から読み込みます。
+		/// @return 読み込んだサイズ（バイト）
+		[[nodiscard]]
+		static int64 ReadAt(const HANDLE handle, void* const dst, const int64 pos, const int64 size) noexcept
+		{
+			int64 totalReadBytes = 0;
+
+			while (totalReadBytes < size)
+			{
+				const int64 offset = (pos + totalReadBytes);
+				OVERLAPPED overlapped{};
+				overlapped.Offset = static_cast<DWORD>(offset);
+				overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+				const DWORD toReadBytes = static_cast<DWORD>(Min<int64>((size - totalReadBytes), 0x4000'0000));
+				DWORD readBytes = 0;
+
+				if ((not ::ReadFile(handle, (static_cast<Byte*>(dst) + totalReadBytes), toReadBytes, &readBytes, &overlapped))
+					|| (readBytes == 0))
+				{
+					break;
+				}
+
+				totalReadBytes += readBytes;
+			}
+
+			return totalReadBytes;
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	(destructor)
@@ -130,6 +164,10 @@ namespace s3d
 		{
 			m_file.file.close();
 			m_file.readPos = 0;
+			{
+				std::lock_guard lock{ m_file.asyncHandleMutex };
+				m_file.asyncHandle.reset();
+			}
 			LOG_INFO(fmt::format("📥 BinaryReader: File `{0}` closed", m_info.fullPath));
 		}
 
@@ -298,6 +336,62 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	readAsync
+	//
+	////////////////////////////////////////////////////////////////
+
+	void BinaryReader::BinaryReaderDetail::readAsync(Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete) const
+	{
+		if (isResource())
+		{
+			// リソースはモジュールが読み込まれている間有効
+			AsyncReadWorkers::Get().submit([pointer = m_resource.pointer](void* dst, const int64 pos, const int64 size)
+				{
+					std::memcpy(dst, (pointer + pos), static_cast<size_t>(size));
+					return size;
+				}, std::move(requests), std::move(onComplete));
+			return;
+		}
+
+		// 同期読み込みのストリームの位置を変えないよう、別のハンドルで読み込む
+		std::shared_ptr<void> asyncHandle;
+		{
+			std::lock_guard lock{ m_file.asyncHandleMutex };
+
+			if (not m_file.asyncHandle)
+			{
+				const HANDLE handle = ::CreateFileW(m_info.fullPath.toWstr().c_str(), GENERIC_READ, (FILE_SHARE_READ | FILE_SHARE_WRITE),
+					nullptr, OPEN_EXISTING, (FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS), nullptr);
+
+				if (handle != INVALID_HANDLE_VALUE)
+				{
+					m_file.asyncHandle = std::shared_ptr<void>{ handle, ::CloseHandle };
+				}
+			}
+
+			asyncHandle = m_file.asyncHandle;
+		}
+
+		if (not asyncHandle)
+		{
+			LOG_FAIL(fmt::format("❌ BinaryReader `{0}`: Failed to open the file for async reads", m_info.fullPath));
+
+			for (size_t i = 0; i < requests.size(); ++i)
+			{
+				onComplete(i, Blob{});
+			}
+
+			return;
+		}
+
+		AsyncReadWorkers::Get().submit([handle = std::move(asyncHandle)](void* dst, const int64 pos, const int64 size)
+			{
+				return ReadAt(handle.get(), dst, pos, size);
+			}, std::move(requests), std::move(onComplete));
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	path
@@ -10,8 +10,11 @@
 //-----------------------------------------------
 
 # include <fstream>
+# include <mutex>
 # include <Siv3D/Windows/Windows.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/AsyncReadRequest.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/Byte.hpp>
 # include <Siv3D/NonNull.hpp>
@@ -57,6 +60,8 @@ namespace s3d
 		[[nodiscard]]
 		int64 lookahead(NonNull<void*> dst, int64 pos, int64 readSize);
 
+		void readAsync(Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete) const;
+
 		[[nodiscard]]
 		const FilePath& path() const noexcept;
 
@@ -80,6 +85,12 @@ namespace s3d
 
 			int64 readPos = 0;
 
+			/// @brief 非同期読み込み用のハンドル。最初の非同期読み込みで開き、読み込みが終わるまで共有して保持する
+			mutable std::shared_ptr<void> asyncHandle;
+
+			/// @brief asyncHandle を保護する。readAsync() は const で、複数のスレッドから同時に呼ばれることがある
+			mutable std::mutex asyncHandleMutex;
+
 			int64 read(NonNull<void*> dst, int64 readSize, int64 fileSize, const FilePath& fullPath);
 
 			int64 lookahead(NonNull<void*> dst, int64 readSize, int64 fileSize, const FilePath& fullPath);
@@ -43,7 +43,7 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool start(const FilePathView directory, const Array<String>& applicableExtensions);
+		bool start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& coalescingWindow);
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -10,9 +10,11 @@
 //-----------------------------------------------
 
 # include <array>
+# include <thread>
 # include <Siv3D/Windows/MinWindows.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/Time.hpp>
+# include <Siv3D/ScopeExit.hpp>
 # include "CLogger.hpp"
 
 namespace s3d
@@ -29,6 +31,12 @@ namespace s3d
 			L": [debug] ",
 			L": [trace] ",
 		};
+
+		static void AppendPrefix(std::wstring& output, const LogType type, const int64 timeMillisec)
+		{
+			output.append(std::to_wstring(timeMillisec));
+			output.append(LogTypeStrings[FromEnum(type)]);
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -38,7 +46,8 @@ namespace s3d
 	////////////////////////////////////////////////////////////////
 
 	CLogger::CLogger()
-		: m_outputLevel{ SIV3D_BUILD(DEBUG) ? LogType::Trace : LogType::Info } {}
+		: m_outputLevel{ SIV3D_BUILD(DEBUG) ? LogType::Trace : LogType::Info }
+		, m_startMicrosec{ Time::GetMicrosec() } {}
 
 	////////////////////////////////////////////////////////////////
 	//
@@ -48,12 +57,24 @@ namespace s3d
 
 	void CLogger::writeln(const std::string_view s)
 	{
-		writeImpl((Unicode::ToWstring(s) + L'\n').c_str());
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ none, 0, std::string{ s } }); }))
+		{
+			return;
+		}
+
+		const std::wstring output = (Unicode::ToWstring(s) + L'\n');
+		writeImpl(output.c_str(), output.size());
 	}
 
 	void CLogger::writeln(const StringView s)
 	{
-		writeImpl((s.toWstr() + L'\n').c_str());
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ none, 0, String{ s } }); }))
+		{
+			return;
+		}
+
+		const std::wstring output = (s.toWstr() + L'\n');
+		writeImpl(output.c_str(), output.size());
 	}
 
 	void CLogger::writeln(const LogType type, const std::string_view s)
@@ -63,12 +84,17 @@ namespace s3d
 			return;
 		}
 
-		std::wstring output = std::to_wstring(Time::GetMillisec());
-		output.append(LogTypeStrings[FromEnum(type)]);
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ type, Time::GetMillisec(), std::string{ s } }); }))
+		{
+			return;
+		}
+
+		std::wstring output;
+		AppendPrefix(output, type, Time::GetMillisec());
 		output.append(Unicode::ToWstring(s));
 		output.push_back(L'\n');
 
-		writeImpl(output.c_str());
+		writeImpl(output.c_str(), output.size());
 	}
 
 	void CLogger::writeln(const LogType type, const StringView s)
@@ -78,12 +104,17 @@ namespace s3d
 			return;
 		}
 
-		std::wstring output = std::to_wstring(Time::GetMillisec());
-		output.append(LogTypeStrings[FromEnum(type)]);
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ type, Time::GetMillisec(), String{ s } }); }))
+		{
+			return;
+		}
+
+		std::wstring output;
+		AppendPrefix(output, type, Time::GetMillisec());
 		output.append(Unicode::ToWstring(s));
 		output.push_back(L'\n');
 
-		writeImpl(output.c_str());
+		writeImpl(output.c_str(), output.size());
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -108,16 +139,170 @@ namespace s3d
 		return m_outputLevel.load();
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	enableAsync
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CLogger::enableAsync(const size_t capacity, const LogOverflowPolicy overflowPolicy)
+	{
+		std::lock_guard lock{ m_asyncMutex };
+
+		releaseAsyncWriter();
+
+		m_asyncWriterStorage = std::make_unique<AsyncLogWriter>(capacity, overflowPolicy,
+			[this](const std::span<const AsyncLogWriter::Entry> entries) { return writeBatch(entries); }, m_counters);
+		m_asyncWriter.store(m_asyncWriterStorage.get());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	disableAsync
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CLogger::disableAsync()
+	{
+		std::lock_guard lock{ m_asyncMutex };
+
+		releaseAsyncWriter();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isAsync
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CLogger::isAsync() const noexcept
+	{
+		return (m_asyncWriter.load(std::memory_order_acquire) != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CLogger::flush()
+	{
+		withAsyncWriter([](AsyncLogWriter& writer) { writer.flush(); });
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	LoggerStat CLogger::getStat() const
+	{
+		LoggerStat stat;
+		stat.messageCount			= m_counters.messageCount.load(std::memory_order_relaxed);
+		stat.byteCount				= m_counters.byteCount.load(std::memory_order_relaxed);
+		stat.writeCount				= m_counters.writeCount.load(std::memory_order_relaxed);
+		stat.droppedMessageCount	= m_counters.droppedMessageCount.load(std::memory_order_relaxed);
+
+		withAsyncWriter([&](const AsyncLogWriter& writer) { stat.queuedMessageCount = writer.getQueuedCount(); });
+
+		if (const double elapsedSec = ((Time::GetMicrosec() - m_startMicrosec) / 1'000'000.0);
+			0.0 < elapsedSec)
+		{
+			stat.messagesPerSecond	= (stat.messageCount / elapsedSec);
+			stat.bytesPerSecond		= (stat.byteCount / elapsedSec);
+		}
+
+		return stat;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	(private function)
 	//
 	////////////////////////////////////////////////////////////////
 
-	void CLogger::writeImpl(const wchar_t* s)
+	template <class Fty>
+	bool CLogger::withAsyncWriter(Fty f) const
 	{
-		std::lock_guard lock{ m_mutex };
+		if (not m_asyncWriter.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		// 先に使用中として数えてから読む。releaseAsyncWriter() が m_asyncWriter を入れ替えた後に数えた場合は、新しい値が読まれる
+		m_asyncUsers.fetch_add(1);
+		const ScopeExit release = [this]() { m_asyncUsers.fetch_sub(1, std::memory_order_release); };
+
+		if (AsyncLogWriter* pWriter = m_asyncWriter.load())
+		{
+			f(*pWriter);
+			return true;
+		}
+
+		return false;
+	}
+
+	void CLogger::releaseAsyncWriter()
+	{
+		if (not m_asyncWriter.exchange(nullptr))
+		{
+			return;
+		}
+
+		// 以降の呼び出しは同期的に書き込む。古い AsyncLogWriter に書き込んでいる呼び出しが終わるのを待つ
+		while (m_asyncUsers.load(std::memory_order_acquire) != 0)
+		{
+			std::this_thread::yield();
+		}
+
+		// キューに残っているメッセージを書き出してから、書き出しスレッドを終了する
+		m_asyncWriterStorage.reset();
+	}
+
+	void CLogger::writeImpl(const wchar_t* s, const size_t length)
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+
+			::OutputDebugStringW(s);
+		}
+
+		m_counters.messageCount.fetch_add(1, std::memory_order_relaxed);
+		m_counters.byteCount.fetch_add((length * sizeof(wchar_t)), std::memory_order_relaxed);
+		m_counters.writeCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	size_t CLogger::writeBatch(const std::span<const AsyncLogWriter::Entry> entries)
+	{
+		std::wstring output;
+
+		for (const auto& entry : entries)
+		{
+			if (entry.type)
+			{
+				AppendPrefix(output, *entry.type, entry.timeMillisec);
+			}
+
+			if (const std::string* s = std::get_if<std::string>(&entry.text))
+			{
+				output.append(Unicode::ToWstring(*s));
+			}
+			else
+			{
+				output.append(Unicode::ToWstring(std::get<String>(entry.text)));
+			}
+
+			output.push_back(L'\n');
+		}
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			::OutputDebugStringW(output.c_str());
+		}
 
-		::OutputDebugStringW(s);
+		return (output.size() * sizeof(wchar_t));
 	}
 }
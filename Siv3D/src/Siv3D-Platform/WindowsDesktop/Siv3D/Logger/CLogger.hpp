@@ -12,7 +12,9 @@
 # pragma once
 # include <mutex>
 # include <Siv3D/Logger/ILogger.hpp>
+# include <Siv3D/Logger/AsyncLogWriter.hpp>
 # include <Siv3D/LogType.hpp>
+# include <Siv3D/Array.hpp>
 
 namespace s3d
 {
@@ -34,12 +36,49 @@ namespace s3d
 
 		LogType getOutputLevel() const noexcept override;
 
+		void enableAsync(size_t capacity, LogOverflowPolicy overflowPolicy) override;
+
+		void disableAsync() override;
+
+		bool isAsync() const noexcept override;
+
+		void flush() override;
+
+		LoggerStat getStat() const override;
+
 	private:
 
 		std::atomic<LogType> m_outputLevel = LogType::Info;
 
 		std::mutex m_mutex;
 
-		void writeImpl(const wchar_t* s);
+		AsyncLogWriter::Counters m_counters;
+
+		int64 m_startMicrosec = 0;
+
+		/// @brief enableAsync() と disableAsync() を保護する
+		std::mutex m_asyncMutex;
+
+		std::atomic<AsyncLogWriter*> m_asyncWriter{ nullptr };
+
+		/// @brief m_asyncWriter を使用中の呼び出しの数
+		/// @remark 0 になるまで、切り替え前の AsyncLogWriter を破棄しない
+		mutable std::atomic<uint32> m_asyncUsers{ 0 };
+
+		/// @brief 現在の AsyncLogWriter
+		/// @remark 書き出しスレッドがメンバを使うので、最初に破棄されるよう末尾に置く
+		std::unique_ptr<AsyncLogWriter> m_asyncWriterStorage;
+
+		/// @brief 非同期の書き出しが有効であれば、AsyncLogWriter を使用中として f を呼びます。
+		/// @return f を呼んだ場合 true
+		template <class Fty>
+		bool withAsyncWriter(Fty f) const;
+
+		/// @brief 非同期の書き出しを無効にし、使用中の呼び出しが終わるのを待ってから AsyncLogWriter を破棄します。
+		void releaseAsyncWriter();
+
+		void writeImpl(const wchar_t* s, size_t length);
+
+		size_t writeBatch(std::span<const AsyncLogWriter::Entry> entries);
 	};
 }
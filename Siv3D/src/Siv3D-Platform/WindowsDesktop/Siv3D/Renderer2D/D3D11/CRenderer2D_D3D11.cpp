@@ -18,6 +18,7 @@
 # include <Siv3D/FloatQuad.hpp>
 # include <Siv3D/Pattern/PatternParameters.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include <Siv3D/Renderer2DCommandList.hpp>
 # include <Siv3D/Error/InternalEngineError.hpp>
 # include <Siv3D/EngineShader/IEngineShader.hpp>
 # include <Siv3D/Texture/D3D11/CTexture_D3D11.hpp>
@@ -340,6 +341,41 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRects
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_D3D11::addRects(const std::span<const FloatRect> rects, const std::span<const Float4> colors)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_D3D11::createBuffer, this);
+
+		// 1 回のバッファ確保に収まるだけの長方形をまとめて構築し、1 つの描画コマンドにする
+		for (size_t i = 0; i < rects.size();)
+		{
+			const auto [indexCount, count] = Vertex2DBuilder::BuildRects(bufferCreator, rects, colors, i);
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			if (not m_currentCustomShader.vs)
+			{
+				m_commandManager.pushEngineVS(m_engineShader.vsShape);
+			}
+
+			if (not m_currentCustomShader.ps)
+			{
+				m_commandManager.pushEnginePS(m_engineShader.psShape);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			i += count;
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addRectFrame
@@ -428,6 +464,42 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircles
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_D3D11::addCircles(const std::span<const Float2> centers, const std::span<const float> rs, const std::span<const Float4> colors)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_D3D11::createBuffer, this);
+		const float scale = getMaxScaling();
+
+		// 1 回のバッファ確保に収まるだけの円をまとめて構築し、1 つの描画コマンドにする
+		for (size_t i = 0; i < centers.size();)
+		{
+			const auto [indexCount, count] = Vertex2DBuilder::BuildCircles(bufferCreator, centers, rs, colors, scale, i);
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			if (not m_currentCustomShader.vs)
+			{
+				m_commandManager.pushEngineVS(m_engineShader.vsShape);
+			}
+
+			if (not m_currentCustomShader.ps)
+			{
+				m_commandManager.pushEnginePS(m_engineShader.psShape);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			i += count;
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addCircleFrame
@@ -1197,6 +1269,43 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCommandList
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_D3D11::addCommandList(const Renderer2DCommandList& commandList)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_D3D11::createBuffer, this);
+		const std::span<const Vertex2D> vertices = commandList.getVertices();
+		const std::span<const Vertex2D::IndexType> indices = commandList.getIndices();
+
+		// 記録されたバッチを、記録順にそのまま描画コマンドに追加する
+		for (const auto& batch : commandList.getBatches())
+		{
+			const auto indexCount = Vertex2DBuilder::BuildVertices(bufferCreator,
+				vertices.subspan(batch.vertexOffset, batch.vertexCount), indices.subspan(batch.indexOffset, batch.indexCount));
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			if (not m_currentCustomShader.vs)
+			{
+				m_commandManager.pushEngineVS(m_engineShader.vsShape);
+			}
+
+			if (not m_currentCustomShader.ps)
+			{
+				m_commandManager.pushEnginePS(m_engineShader.psShape);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	flush
@@ -1214,6 +1323,12 @@ namespace s3d
 		};
 
 		m_commandManager.flush();
+
+		if (m_drawCallReordering)
+		{
+			m_stat.drawCallsSaved += m_commandManager.reorderDraws(m_vertexBufferManager2D.getBufferView());
+		}
+
 		m_context->IASetInputLayout(m_inputLayout.Get());
 		m_pShader->setConstantBufferVS(0, m_vsConstants._base());
 		m_pShader->setConstantBufferPS(0, m_psConstants._base());
@@ -1237,31 +1352,31 @@ namespace s3d
 		{
 			switch (command.type)
 			{
-			case D3D11Renderer2DCommandType::Null:
+			case Renderer2DCommandType::Null:
 				{
 					LOG_COMMAND("Null");
 					break;
 				}
-			case D3D11Renderer2DCommandType::SetBuffers:
+			case Renderer2DCommandType::SetBuffers:
 				{
 					m_vertexBufferManager2D.setBuffers();
 					LOG_COMMAND(fmt::format("SetBuffers[{}]", command.index));
 					break;
 				}
-			case D3D11Renderer2DCommandType::UpdateBuffers:
+			case Renderer2DCommandType::UpdateBuffers:
 				{
 					commandState.batchInfo = m_vertexBufferManager2D.commitBuffers(command.index);
 					LOG_COMMAND(fmt::format("UpdateBuffers[{}] BatchInfo(indexCount = {}, startIndexLocation = {}, baseVertexLocation = {})",
 						command.index, commandState.batchInfo.indexCount, commandState.batchInfo.startIndexLocation, commandState.batchInfo.baseVertexLocation));
 					break;
 				}
-			case D3D11Renderer2DCommandType::Draw:
+			case Renderer2DCommandType::Draw:
 				{
 					m_vsConstants._update_if_dirty();
 					m_psConstants._update_if_dirty();
 					m_psEffectConstants._update_if_dirty();
 
-					const D3D11DrawCommand& draw = m_commandManager.getDraw(command.index);
+					const Renderer2DDrawCommand& draw = m_commandManager.getDraw(command.index);
 					const uint32 indexCount = draw.indexCount;
 					const uint32 startIndexLocation = commandState.batchInfo.startIndexLocation;
 					const uint32 baseVertexLocation = commandState.batchInfo.baseVertexLocation;
@@ -1269,12 +1384,12 @@ namespace s3d
 					m_context->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
 					commandState.batchInfo.startIndexLocation += indexCount;
 					
-					//++m_stat.drawCalls;
-					//m_stat.triangleCount += (indexCount / 3);
+					++m_stat.drawCalls;
+					m_stat.triangleCount += (indexCount / 3);
 					LOG_COMMAND(fmt::format("Draw[{}] indexCount = {}, startIndexLocation = {}", command.index, indexCount, startIndexLocation));
 					break;
 				}
-			case D3D11Renderer2DCommandType::ColorMul:
+			case Renderer2DCommandType::ColorMul:
 				{
 					const Float4 colorMul = m_commandManager.getColorMul(command.index);
 					m_vsConstants->colorMul = colorMul;
@@ -1282,14 +1397,14 @@ namespace s3d
 					LOG_COMMAND(fmt::format("ColorMul[{}] {}", command.index, colorMul));
 					break;
 				}
-			case D3D11Renderer2DCommandType::ColorAdd:
+			case Renderer2DCommandType::ColorAdd:
 				{
 					const Float3 colorAdd = m_commandManager.getColorAdd(command.index);
 					m_psConstants->colorAdd.set(colorAdd, 0.0f);
 					LOG_COMMAND(fmt::format("ColorAdd[{}] {}", command.index, colorAdd));
 					break;
 				}
-			case D3D11Renderer2DCommandType::QuadWarpParameters:
+			case Renderer2DCommandType::QuadWarpParameters:
 				{
 					const auto& quadWarpParameter = m_commandManager.getQuadWarpParameter(command.index);
 					const Quad quad{ quadWarpParameter[0].xy(), quadWarpParameter[0].zw(), quadWarpParameter[1].xy(), quadWarpParameter[1].zw() };
@@ -1298,21 +1413,21 @@ namespace s3d
 					LOG_COMMAND(fmt::format("QuadWarpParameters[{}]", command.index));
 					break;
 				}
-			case D3D11Renderer2DCommandType::PatternParameters:
+			case Renderer2DCommandType::PatternParameters:
 				{
 					const auto& patternParameter = m_commandManager.getPatternParameter(command.index);
 					m_psEffectConstants->setPattern(patternParameter);
 					LOG_COMMAND(fmt::format("PatternParameters[{}]", command.index));
 					break;
 				}
-			case D3D11Renderer2DCommandType::BlendState:
+			case Renderer2DCommandType::BlendState:
 				{
 					const auto& blendState = m_commandManager.getBlendState(command.index);
 					m_pRenderer->getBlendState().set(blendState);
 					LOG_COMMAND(fmt::format("BlendState[{}]", command.index));
 					break;
 				}
-			case D3D11Renderer2DCommandType::RasterizerState:
+			case Renderer2DCommandType::RasterizerState:
 				{
 					const auto& rasterizerState = m_commandManager.getRasterizerState(command.index);
 					commandState.rasterizerState = rasterizerState;
@@ -1329,37 +1444,37 @@ namespace s3d
 					LOG_COMMAND(fmt::format("RasterizerState[{}]", command.index));
 					break;
 				}
-			case D3D11Renderer2DCommandType::VSSamplerState0:
-			case D3D11Renderer2DCommandType::VSSamplerState1:
-			case D3D11Renderer2DCommandType::VSSamplerState2:
-			case D3D11Renderer2DCommandType::VSSamplerState3:
-			case D3D11Renderer2DCommandType::VSSamplerState4:
-			case D3D11Renderer2DCommandType::VSSamplerState5:
-			case D3D11Renderer2DCommandType::VSSamplerState6:
-			case D3D11Renderer2DCommandType::VSSamplerState7:
+			case Renderer2DCommandType::VSSamplerState0:
+			case Renderer2DCommandType::VSSamplerState1:
+			case Renderer2DCommandType::VSSamplerState2:
+			case Renderer2DCommandType::VSSamplerState3:
+			case Renderer2DCommandType::VSSamplerState4:
+			case Renderer2DCommandType::VSSamplerState5:
+			case Renderer2DCommandType::VSSamplerState6:
+			case Renderer2DCommandType::VSSamplerState7:
 				{
-					const uint32 slot = FromEnum(command.type) - FromEnum(D3D11Renderer2DCommandType::VSSamplerState0);
+					const uint32 slot = FromEnum(command.type) - FromEnum(Renderer2DCommandType::VSSamplerState0);
 					const auto& samplerState = m_commandManager.getVSSamplerState(slot, command.index);
 					m_pRenderer->getSamplerState().setVS(slot, samplerState);
 					LOG_COMMAND(fmt::format("VSSamplerState{}[{}] ", slot, command.index));
 					break;
 				}
-			case D3D11Renderer2DCommandType::PSSamplerState0:
-			case D3D11Renderer2DCommandType::PSSamplerState1:
-			case D3D11Renderer2DCommandType::PSSamplerState2:
-			case D3D11Renderer2DCommandType::PSSamplerState3:
-			case D3D11Renderer2DCommandType::PSSamplerState4:
-			case D3D11Renderer2DCommandType::PSSamplerState5:
-			case D3D11Renderer2DCommandType::PSSamplerState6:
-			case D3D11Renderer2DCommandType::PSSamplerState7:
+			case Renderer2DCommandType::PSSamplerState0:
+			case Renderer2DCommandType::PSSamplerState1:
+			case Renderer2DCommandType::PSSamplerState2:
+			case Renderer2DCommandType::PSSamplerState3:
+			case Renderer2DCommandType::PSSamplerState4:
+			case Renderer2DCommandType::PSSamplerState5:
+			case Renderer2DCommandType::PSSamplerState6:
+			case Renderer2DCommandType::PSSamplerState7:
 				{
-					const uint32 slot = FromEnum(command.type) - FromEnum(D3D11Renderer2DCommandType::PSSamplerState0);
+					const uint32 slot = FromEnum(command.type) - FromEnum(Renderer2DCommandType::PSSamplerState0);
 					const auto& samplerState = m_commandManager.getPSSamplerState(slot, command.index);
 					m_pRenderer->getSamplerState().setPS(slot, samplerState);
 					LOG_COMMAND(fmt::format("PSSamplerState{}[{}] ", slot, command.index));
 					break;
 				}
-			case D3D11Renderer2DCommandType::ScissorRect:
+			case Renderer2DCommandType::ScissorRect:
 				{
 					const auto& scissorRect = m_commandManager.getScissorRect(command.index);
 					commandState.scissorRect = scissorRect;
@@ -1377,7 +1492,7 @@ namespace s3d
 					LOG_COMMAND(fmt::format("ScissorRect[{}] {}", command.index, scissorRect));
 					break;
 				}
-			case D3D11Renderer2DCommandType::Viewport:
+			case Renderer2DCommandType::Viewport:
 				{
 					const auto& viewport = m_commandManager.getViewport(command.index);
 					
@@ -1392,7 +1507,7 @@ namespace s3d
 					LOG_COMMAND(fmt::format("Viewport[{}] ({}, {}, {}, {})", command.index, vp.TopLeftX, vp.TopLeftY, vp.Width, vp.Height));
 					break;
 				}
-			case D3D11Renderer2DCommandType::SetVS:
+			case Renderer2DCommandType::SetVS:
 				{
 					const auto vsID = m_commandManager.getVS(command.index);
 
@@ -1409,7 +1524,7 @@ namespace s3d
 
 					break;
 				}
-			case D3D11Renderer2DCommandType::SetPS:
+			case Renderer2DCommandType::SetPS:
 				{
 					const auto psID = m_commandManager.getPS(command.index);
 
@@ -1426,7 +1541,7 @@ namespace s3d
 
 					break;
 				}
-			case D3D11Renderer2DCommandType::Transform:
+			case Renderer2DCommandType::Transform:
 				{
 					commandState.transform = m_commandManager.getCombinedTransform(command.index);
 					const Mat3x2 matrix = (commandState.transform * commandState.screenMat);
@@ -1436,16 +1551,16 @@ namespace s3d
 					LOG_COMMAND(fmt::format("Transform[{}] {}", command.index, matrix));
 					break;
 				}
-			case D3D11Renderer2DCommandType::VSTexture0:
-			case D3D11Renderer2DCommandType::VSTexture1:
-			case D3D11Renderer2DCommandType::VSTexture2:
-			case D3D11Renderer2DCommandType::VSTexture3:
-			case D3D11Renderer2DCommandType::VSTexture4:
-			case D3D11Renderer2DCommandType::VSTexture5:
-			case D3D11Renderer2DCommandType::VSTexture6:
-			case D3D11Renderer2DCommandType::VSTexture7:
+			case Renderer2DCommandType::VSTexture0:
+			case Renderer2DCommandType::VSTexture1:
+			case Renderer2DCommandType::VSTexture2:
+			case Renderer2DCommandType::VSTexture3:
+			case Renderer2DCommandType::VSTexture4:
+			case Renderer2DCommandType::VSTexture5:
+			case Renderer2DCommandType::VSTexture6:
+			case Renderer2DCommandType::VSTexture7:
 				{
-					const uint32 slot = (FromEnum(command.type) - FromEnum(D3D11Renderer2DCommandType::VSTexture0));
+					const uint32 slot = (FromEnum(command.type) - FromEnum(Renderer2DCommandType::VSTexture0));
 					const auto& textureID = m_commandManager.getVSTexture(slot, command.index);
 
 					if (textureID.isInvalid())
@@ -1462,16 +1577,16 @@ namespace s3d
 					
 					break;
 				}
-			case D3D11Renderer2DCommandType::PSTexture0:
-			case D3D11Renderer2DCommandType::PSTexture1:
-			case D3D11Renderer2DCommandType::PSTexture2:
-			case D3D11Renderer2DCommandType::PSTexture3:
-			case D3D11Renderer2DCommandType::PSTexture4:
-			case D3D11Renderer2DCommandType::PSTexture5:
-			case D3D11Renderer2DCommandType::PSTexture6:
-			case D3D11Renderer2DCommandType::PSTexture7:
+			case Renderer2DCommandType::PSTexture0:
+			case Renderer2DCommandType::PSTexture1:
+			case Renderer2DCommandType::PSTexture2:
+			case Renderer2DCommandType::PSTexture3:
+			case Renderer2DCommandType::PSTexture4:
+			case Renderer2DCommandType::PSTexture5:
+			case Renderer2DCommandType::PSTexture6:
+			case Renderer2DCommandType::PSTexture7:
 				{
-					const uint32 slot = (FromEnum(command.type) - FromEnum(D3D11Renderer2DCommandType::PSTexture0));
+					const uint32 slot = (FromEnum(command.type) - FromEnum(Renderer2DCommandType::PSTexture0));
 					const auto& textureID = m_commandManager.getPSTexture(slot, command.index);
 
 					if (textureID.isInvalid())
@@ -1663,6 +1778,33 @@ namespace s3d
 		return m_commandManager.getCurrentMaxScaling();
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	getStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Renderer2DStat& CRenderer2D_D3D11::getStat() const noexcept
+	{
+		return m_stat;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setDrawCallReorderingEnabled, isDrawCallReorderingEnabled
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_D3D11::setDrawCallReorderingEnabled(const bool enabled)
+	{
+		m_drawCallReordering = enabled;
+	}
+
+	bool CRenderer2D_D3D11::isDrawCallReorderingEnabled() const noexcept
+	{
+		return m_drawCallReordering;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	beginFrame
@@ -1671,7 +1813,7 @@ namespace s3d
 
 	void CRenderer2D_D3D11::beginFrame()
 	{
-
+		m_stat = {};
 	}
 
 	////////////////////////////////////////////////////////////////
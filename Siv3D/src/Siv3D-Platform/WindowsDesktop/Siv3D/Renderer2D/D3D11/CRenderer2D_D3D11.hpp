@@ -16,7 +16,7 @@
 # include <Siv3D/Shader/D3D11/CShader_D3D11.hpp>
 # include <Siv3D/Renderer2D/Renderer2DCommon.hpp>
 # include "D3D11VertexBufferManager2D.hpp"
-# include "D3D11Renderer2DCommandManager.hpp"
+# include <Siv3D/Renderer2D/Renderer2DCommandManager.hpp>
 
 namespace s3d
 {
@@ -76,6 +76,14 @@ namespace s3d
 
 		void addRect(const FloatRect& rect, const PatternParameters& pattern) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addRects(std::span<const FloatRect> rects, std::span<const Float4> colors) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	addRectFrame
@@ -96,6 +104,14 @@ namespace s3d
 
 		void addCircle(const Float2& center, float r, const PatternParameters& pattern) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addCircles(std::span<const Float2> centers, std::span<const float> rs, std::span<const Float4> colors) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	addCircleFrame
@@ -264,6 +280,14 @@ namespace s3d
 
 		void addQuadWarp(const Texture& texture, const FloatRect& uv, const FloatQuad& quad, const Float4(&colors)[4]) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCommandList
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addCommandList(const Renderer2DCommandList& commandList) override;
+
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -381,6 +405,24 @@ namespace s3d
 
 		float getMaxScaling() const noexcept override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	getStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		const Renderer2DStat& getStat() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setDrawCallReorderingEnabled, isDrawCallReorderingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		void setDrawCallReorderingEnabled(bool enabled) override;
+
+		bool isDrawCallReorderingEnabled() const noexcept override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	beginFrame
@@ -405,7 +447,7 @@ namespace s3d
 
 		D3D11VertexBufferManager2D m_vertexBufferManager2D;
 
-		D3D11Renderer2DCommandManager m_commandManager;
+		Renderer2DCommandManager m_commandManager;
 
 		struct EngineShader
 		{
@@ -454,6 +496,10 @@ namespace s3d
 
 		} m_currentCustomShader;
 
+		Renderer2DStat m_stat;
+
+		bool m_drawCallReordering = false;
+
 		ConstantBuffer<VSConstants2D> m_vsConstants;
 
 		ConstantBuffer<PSConstants2D> m_psConstants;
@@ -10,7 +10,7 @@
 //-----------------------------------------------
 
 # include "D3D11VertexBufferManager2D.hpp"
-# include "D3D11Renderer2DCommandManager.hpp"
+# include <Siv3D/Renderer2D/Renderer2DCommandManager.hpp>
 # include <Siv3D/EngineLog.hpp>
 
 namespace s3d
@@ -103,7 +103,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	Vertex2DBufferPointer D3D11VertexBufferManager2D::requestBuffer(const uint16 vertexCount, const uint32 indexCount, D3D11Renderer2DCommandManager& commandManager)
+	Vertex2DBufferPointer D3D11VertexBufferManager2D::requestBuffer(const uint16 vertexCount, const uint32 indexCount, Renderer2DCommandManager& commandManager)
 	{
 		// VB
 		{
@@ -289,4 +289,33 @@ namespace s3d
 
 		return batchInfo;
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getBufferView
+	//
+	////////////////////////////////////////////////////////////////
+
+	Renderer2DBufferView D3D11VertexBufferManager2D::getBufferView()
+	{
+		Renderer2DBufferView view{
+			.vertices	= std::span{ m_vertexArray.data(), m_vertexArrayWritePos },
+			.indices	= std::span{ m_indexArray.data(), m_indexArrayWritePos },
+			.batches	= {},
+		};
+
+		view.batches.reserve(m_batches.size());
+
+		uint32 vertexOffset	= 0;
+		uint32 indexOffset	= 0;
+
+		for (const auto& batch : m_batches)
+		{
+			view.batches.push_back({ vertexOffset, indexOffset });
+			vertexOffset	+= batch.vertexPos;
+			indexOffset		+= batch.indexPos;
+		}
+
+		return view;
+	}
 }
@@ -18,7 +18,7 @@
 
 namespace s3d
 {
-	class D3D11Renderer2DCommandManager;
+	class Renderer2DCommandManager;
 
 	class D3D11VertexBufferManager2D
 	{
@@ -29,7 +29,7 @@ namespace s3d
 		bool init(ID3D11Device* device, ID3D11DeviceContext* context);
 
 		[[nodiscard]]
-		Vertex2DBufferPointer requestBuffer(uint16 vertexCount, uint32 indexCount, D3D11Renderer2DCommandManager& commandManager);
+		Vertex2DBufferPointer requestBuffer(uint16 vertexCount, uint32 indexCount, Renderer2DCommandManager& commandManager);
 
 		[[nodiscard]]
 		size_t num_batches() const noexcept;
@@ -41,6 +41,9 @@ namespace s3d
 		[[nodiscard]]
 		BatchInfo2D commitBuffers(size_t batchIndex);
 
+		[[nodiscard]]
+		Renderer2DBufferView getBufferView();
+
 	private:
 
 		static constexpr uint32 InitialVertexArraySize	= (1 << 12);	// 4,096
@@ -58,7 +58,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions)
+	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& coalescingWindow)
 	{
 		if (directory.isEmpty()
 			|| (not FileSystem::IsDirectory(directory)))
@@ -88,7 +88,7 @@ namespace s3d
 											&context,
 											pathToWatch,
 											kFSEventStreamEventIdSinceNow,
-											LatencySec,
+											coalescingWindow.count(),
 											(kFSEventStreamCreateFlagUseCFTypes | kFSEventStreamCreateFlagNoDefer | kFSEventStreamCreateFlagFileEvents)
 											);
 		
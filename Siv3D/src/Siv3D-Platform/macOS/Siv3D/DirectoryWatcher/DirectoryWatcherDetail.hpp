@@ -42,7 +42,7 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool start(const FilePathView directory, const Array<String>& applicableExtensions);
+		bool start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& coalescingWindow);
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -87,8 +87,6 @@ namespace s3d
 
 	private:
 		
-		static constexpr double LatencySec = 0.25;
-
 		FilePath m_directory;
 
 		ExtensionFilter m_extensionFilter;
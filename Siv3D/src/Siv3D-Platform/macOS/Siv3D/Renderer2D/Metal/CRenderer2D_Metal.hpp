@@ -15,7 +15,7 @@
 # include <Siv3D/Renderer2D/IRenderer2D.hpp>
 # include <Siv3D/Renderer2D/Renderer2DCommon.hpp>
 # include "MetalVertexBufferManager2D.hpp"
-# include "MetalRenderer2DCommandManager.hpp"
+# include <Siv3D/Renderer2D/Renderer2DCommandManager.hpp>
 
 namespace s3d
 {
@@ -78,6 +78,14 @@ namespace s3d
 
 		void addRect(const FloatRect& rect, const PatternParameters& pattern) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addRects(std::span<const FloatRect> rects, std::span<const Float4> colors) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	addRectFrame
@@ -98,6 +106,14 @@ namespace s3d
 
 		void addCircle(const Float2& center, float r, const PatternParameters& pattern) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addCircles(std::span<const Float2> centers, std::span<const float> rs, std::span<const Float4> colors) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	addCircleFrame
@@ -257,6 +273,14 @@ namespace s3d
 		void addQuadWarp(const Texture& texture, const FloatRect& uv, const FloatQuad& quad, const Float4& color) override;
 
 		void addQuadWarp(const Texture& texture, const FloatRect& uv, const FloatQuad& quad, const Float4(&colors)[4]) override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCommandList
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addCommandList(const Renderer2DCommandList& commandList) override;
 		
 		////////////////////////////////////////////////////////////////
 		//
@@ -374,6 +398,24 @@ namespace s3d
 
 		float getMaxScaling() const noexcept override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	getStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		const Renderer2DStat& getStat() const noexcept override;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setDrawCallReorderingEnabled, isDrawCallReorderingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		void setDrawCallReorderingEnabled(bool enabled) override;
+
+		bool isDrawCallReorderingEnabled() const noexcept override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	beginFrame
@@ -402,7 +444,7 @@ namespace s3d
 
 		MetalVertexBufferManager2D m_vertexBufferManager;
 
-		MetalRenderer2DCommandManager m_commandManager;
+		Renderer2DCommandManager m_commandManager;
 
 		MTL::CommandBuffer* m_commandBuffer = nullptr;
 
@@ -453,6 +495,10 @@ namespace s3d
 		
 		} m_currentCustomShader;
 		
+		Renderer2DStat m_stat;
+
+		bool m_drawCallReordering = false;
+
 		ConstantBuffer<VSConstants2D> m_vsConstants;
 
 		ConstantBuffer<PSConstants2D> m_psConstants;
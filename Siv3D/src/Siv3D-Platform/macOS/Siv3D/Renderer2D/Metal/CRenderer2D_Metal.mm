@@ -18,6 +18,7 @@
 # include <Siv3D/FloatQuad.hpp>
 # include <Siv3D/Pattern/PatternParameters.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include <Siv3D/Renderer2DCommandList.hpp>
 # include <Siv3D/Error/InternalEngineError.hpp>
 # include <Siv3D/EngineShader/IEngineShader.hpp>
 # include <Siv3D/Renderer/Metal/CRenderer_Metal.hpp>
@@ -327,6 +328,41 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRects
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Metal::addRects(const std::span<const FloatRect> rects, const std::span<const Float4> colors)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_Metal::createBuffer, this);
+
+		// 1 回のバッファ確保に収まるだけの長方形をまとめて構築し、1 つの描画コマンドにする
+		for (size_t i = 0; i < rects.size();)
+		{
+			const auto [indexCount, count] = Vertex2DBuilder::BuildRects(bufferCreator, rects, colors, i);
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			if (not m_currentCustomShader.vs)
+			{
+				m_commandManager.pushEngineVS(m_engineShader.vsShape);
+			}
+
+			if (not m_currentCustomShader.ps)
+			{
+				m_commandManager.pushEnginePS(m_engineShader.psShape);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			i += count;
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addRectFrame
@@ -415,6 +451,42 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircles
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Metal::addCircles(const std::span<const Float2> centers, const std::span<const float> rs, const std::span<const Float4> colors)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_Metal::createBuffer, this);
+		const float scale = getMaxScaling();
+
+		// 1 回のバッファ確保に収まるだけの円をまとめて構築し、1 つの描画コマンドにする
+		for (size_t i = 0; i < centers.size();)
+		{
+			const auto [indexCount, count] = Vertex2DBuilder::BuildCircles(bufferCreator, centers, rs, colors, scale, i);
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			if (not m_currentCustomShader.vs)
+			{
+				m_commandManager.pushEngineVS(m_engineShader.vsShape);
+			}
+
+			if (not m_currentCustomShader.ps)
+			{
+				m_commandManager.pushEnginePS(m_engineShader.psShape);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			i += count;
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addCircleFrame
@@ -1182,6 +1254,43 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCommandList
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Metal::addCommandList(const Renderer2DCommandList& commandList)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_Metal::createBuffer, this);
+		const std::span<const Vertex2D> vertices = commandList.getVertices();
+		const std::span<const Vertex2D::IndexType> indices = commandList.getIndices();
+
+		// 記録されたバッチを、記録順にそのまま描画コマンドに追加する
+		for (const auto& batch : commandList.getBatches())
+		{
+			const auto indexCount = Vertex2DBuilder::BuildVertices(bufferCreator,
+				vertices.subspan(batch.vertexOffset, batch.vertexCount), indices.subspan(batch.indexOffset, batch.indexCount));
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			if (not m_currentCustomShader.vs)
+			{
+				m_commandManager.pushEngineVS(m_engineShader.vsShape);
+			}
+
+			if (not m_currentCustomShader.ps)
+			{
+				m_commandManager.pushEnginePS(m_engineShader.psShape);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	flush
@@ -1198,7 +1307,12 @@ namespace s3d
 		};
 		
 		m_commandManager.flush();
-		
+
+		if (m_drawCallReordering)
+		{
+			m_stat.drawCallsSaved += m_commandManager.reorderDraws(m_vertexBufferManager.getBufferView());
+		}
+
 		const Size currentRenderTargetSize = SIV3D_ENGINE(Renderer)->getSceneBufferSize();
 
 		// Draw2D
@@ -1246,12 +1360,19 @@ namespace s3d
 			{
 				switch (command.type)
 				{
-				case MetalRenderer2DCommandType::Null:
+				case Renderer2DCommandType::Null:
 					{
 						LOG_COMMAND("Null");
 						break;
 					}
-				case MetalRenderer2DCommandType::Draw:
+				case Renderer2DCommandType::SetBuffers:
+				case Renderer2DCommandType::UpdateBuffers:
+					{
+						// Metal では頂点バッファをパスの先頭で一度だけ設定するため、何もしない
+						LOG_COMMAND("SetBuffers / UpdateBuffers (ignored)");
+						break;
+					}
+				case Renderer2DCommandType::Draw:
 					{
 						const auto pipeline = m_pRenderer->getRenderPipelineState().get(pipelineStateDesc);
 						renderCommandEncoder->setRenderPipelineState(pipeline);
@@ -1274,7 +1395,7 @@ namespace s3d
 							renderCommandEncoder->setFragmentBytes(m_psEffectConstants.data(), m_psEffectConstants.size(), 1);
 						}
 
-						const MetalDrawCommand& draw = m_commandManager.getDraw(command.index);
+						const Renderer2DDrawCommand& draw = m_commandManager.getDraw(command.index);
 						const uint32 indexCount = draw.indexCount;
 						
 						LOG_COMMAND(fmt::format("Draw[{}] indexCount = {}, startIndexLocation = {}", command.index, indexCount, commandState.startIndexLocation));
@@ -1283,12 +1404,12 @@ namespace s3d
 						renderCommandEncoder->drawIndexedPrimitives(MTL::PrimitiveType::PrimitiveTypeTriangle, indexCount, MTL::IndexTypeUInt16, m_vertexBufferManager.getIndexBuffer(), (sizeof(Vertex2D::IndexType) * commandState.startIndexLocation));
 						commandState.startIndexLocation += indexCount;
 						
-						//++m_stat.drawCalls;
-						//m_stat.triangleCount += (indexCount / 3);
+						++m_stat.drawCalls;
+						m_stat.triangleCount += (indexCount / 3);
 
 						break;
 					}
-				case MetalRenderer2DCommandType::ColorMul:
+				case Renderer2DCommandType::ColorMul:
 					{
 						const Float4 colorMul = m_commandManager.getColorMul(command.index);
 						m_vsConstants->colorMul = colorMul;
@@ -1296,14 +1417,14 @@ namespace s3d
 						LOG_COMMAND(fmt::format("ColorMul[{}] {}", command.index, colorMul));
 						break;
 					}
-				case MetalRenderer2DCommandType::ColorAdd:
+				case Renderer2DCommandType::ColorAdd:
 					{
 						const Float3 colorAdd = m_commandManager.getColorAdd(command.index);
 						m_psConstants->colorAdd.set(colorAdd, 0.0f);
 						LOG_COMMAND(fmt::format("ColorAdd[{}] {}", command.index, colorAdd));
 						break;
 					}
-				case MetalRenderer2DCommandType::QuadWarpParameters:
+				case Renderer2DCommandType::QuadWarpParameters:
 					{
 						const auto& quadWarpParameter = m_commandManager.getQuadWarpParameter(command.index);
 						const Quad quad{ quadWarpParameter[0].xy(), quadWarpParameter[0].zw(), quadWarpParameter[1].xy(), quadWarpParameter[1].zw() };
@@ -1312,20 +1433,20 @@ namespace s3d
 						LOG_COMMAND(fmt::format("QuadWarpParameters[{}]", command.index));
 						break;
 					}
-				case MetalRenderer2DCommandType::PatternParameters:
+				case Renderer2DCommandType::PatternParameters:
 					{
 						const auto& patternParameter = m_commandManager.getPatternParameter(command.index);
 						m_psEffectConstants->setPattern(patternParameter);
 						LOG_COMMAND(fmt::format("PatternParameters[{}]", command.index));
 						break;
 					}
-				case MetalRenderer2DCommandType::BlendState:
+				case Renderer2DCommandType::BlendState:
 					{
 						pipelineStateDesc.blendState = m_commandManager.getBlendState(command.index);
 						LOG_COMMAND(fmt::format("BlendState[{}]", command.index));
 						break;
 					}
-				case MetalRenderer2DCommandType::RasterizerState:
+				case Renderer2DCommandType::RasterizerState:
 					{
 						const auto& rasterizerState = m_commandManager.getRasterizerState(command.index);
 						
@@ -1354,37 +1475,37 @@ namespace s3d
 						LOG_COMMAND(fmt::format("RasterizerState[{}]", command.index));
 						break;
 					}
-				case MetalRenderer2DCommandType::VSSamplerState0:
-				case MetalRenderer2DCommandType::VSSamplerState1:
-				case MetalRenderer2DCommandType::VSSamplerState2:
-				case MetalRenderer2DCommandType::VSSamplerState3:
-				case MetalRenderer2DCommandType::VSSamplerState4:
-				case MetalRenderer2DCommandType::VSSamplerState5:
-				case MetalRenderer2DCommandType::VSSamplerState6:
-				case MetalRenderer2DCommandType::VSSamplerState7:
+				case Renderer2DCommandType::VSSamplerState0:
+				case Renderer2DCommandType::VSSamplerState1:
+				case Renderer2DCommandType::VSSamplerState2:
+				case Renderer2DCommandType::VSSamplerState3:
+				case Renderer2DCommandType::VSSamplerState4:
+				case Renderer2DCommandType::VSSamplerState5:
+				case Renderer2DCommandType::VSSamplerState6:
+				case Renderer2DCommandType::VSSamplerState7:
 					{
-						const uint32 slot = FromEnum(command.type) - FromEnum(MetalRenderer2DCommandType::VSSamplerState0);
+						const uint32 slot = FromEnum(command.type) - FromEnum(Renderer2DCommandType::VSSamplerState0);
 						const auto& samplerState = m_commandManager.getVSSamplerState(slot, command.index);
 						m_pRenderer->getSamplerState().setVS(renderCommandEncoder, slot, samplerState);
 						LOG_COMMAND(fmt::format("VSSamplerState{}[{}] ", slot, command.index));
 						break;
 					}
-				case MetalRenderer2DCommandType::PSSamplerState0:
-				case MetalRenderer2DCommandType::PSSamplerState1:
-				case MetalRenderer2DCommandType::PSSamplerState2:
-				case MetalRenderer2DCommandType::PSSamplerState3:
-				case MetalRenderer2DCommandType::PSSamplerState4:
-				case MetalRenderer2DCommandType::PSSamplerState5:
-				case MetalRenderer2DCommandType::PSSamplerState6:
-				case MetalRenderer2DCommandType::PSSamplerState7:
+				case Renderer2DCommandType::PSSamplerState0:
+				case Renderer2DCommandType::PSSamplerState1:
+				case Renderer2DCommandType::PSSamplerState2:
+				case Renderer2DCommandType::PSSamplerState3:
+				case Renderer2DCommandType::PSSamplerState4:
+				case Renderer2DCommandType::PSSamplerState5:
+				case Renderer2DCommandType::PSSamplerState6:
+				case Renderer2DCommandType::PSSamplerState7:
 					{
-						const uint32 slot = FromEnum(command.type) - FromEnum(MetalRenderer2DCommandType::PSSamplerState0);
+						const uint32 slot = FromEnum(command.type) - FromEnum(Renderer2DCommandType::PSSamplerState0);
 						const auto& samplerState = m_commandManager.getPSSamplerState(slot, command.index);
 						m_pRenderer->getSamplerState().setPS(renderCommandEncoder, slot, samplerState);
 						LOG_COMMAND(fmt::format("PSSamplerState{}[{}] ", slot, command.index));
 						break;
 					}
-				case MetalRenderer2DCommandType::ScissorRect:
+				case Renderer2DCommandType::ScissorRect:
 					{
 						const auto& scissorRect = m_commandManager.getScissorRect(command.index);
 						const Rect rect = (scissorRect ? scissorRect->clamped(Rect{ 0, 0, currentRenderTargetSize }) : Rect{ currentRenderTargetSize });
@@ -1393,7 +1514,7 @@ namespace s3d
 						LOG_COMMAND(fmt::format("ScissorRect[{}] {}", command.index, rect));
 						break;
 					}
-				case MetalRenderer2DCommandType::Viewport:
+				case Renderer2DCommandType::Viewport:
 					{
 						const auto& viewport = m_commandManager.getViewport(command.index);
 						
@@ -1408,7 +1529,7 @@ namespace s3d
 						LOG_COMMAND(fmt::format("Viewport[{}] ({}, {}, {}, {})", command.index, vp.originX, vp.originY, vp.width, vp.height));
 						break;
 					}
-				case MetalRenderer2DCommandType::SetVS:
+				case Renderer2DCommandType::SetVS:
 					{
 						const auto vsID = m_commandManager.getVS(command.index);
 
@@ -1425,7 +1546,7 @@ namespace s3d
 
 						break;
 					}
-				case MetalRenderer2DCommandType::SetPS:
+				case Renderer2DCommandType::SetPS:
 					{
 						const auto psID = m_commandManager.getPS(command.index);
 
@@ -1442,7 +1563,7 @@ namespace s3d
 
 						break;
 					}
-				case MetalRenderer2DCommandType::Transform:
+				case Renderer2DCommandType::Transform:
 					{
 						commandState.transform = m_commandManager.getCombinedTransform(command.index);
 						const Mat3x2 matrix = (commandState.transform * commandState.screenMat);
@@ -1452,16 +1573,16 @@ namespace s3d
 						LOG_COMMAND(U"Transform[{}] {}"_fmt(command.index, matrix));
 						break;
 					}
-				case MetalRenderer2DCommandType::VSTexture0:
-				case MetalRenderer2DCommandType::VSTexture1:
-				case MetalRenderer2DCommandType::VSTexture2:
-				case MetalRenderer2DCommandType::VSTexture3:
-				case MetalRenderer2DCommandType::VSTexture4:
-				case MetalRenderer2DCommandType::VSTexture5:
-				case MetalRenderer2DCommandType::VSTexture6:
-				case MetalRenderer2DCommandType::VSTexture7:
+				case Renderer2DCommandType::VSTexture0:
+				case Renderer2DCommandType::VSTexture1:
+				case Renderer2DCommandType::VSTexture2:
+				case Renderer2DCommandType::VSTexture3:
+				case Renderer2DCommandType::VSTexture4:
+				case Renderer2DCommandType::VSTexture5:
+				case Renderer2DCommandType::VSTexture6:
+				case Renderer2DCommandType::VSTexture7:
 					{
-						const uint32 slot = (FromEnum(command.type) - FromEnum(MetalRenderer2DCommandType::VSTexture0));
+						const uint32 slot = (FromEnum(command.type) - FromEnum(Renderer2DCommandType::VSTexture0));
 						const auto& textureID = m_commandManager.getVSTexture(slot, command.index);
 
 						if (textureID.isInvalid())
@@ -1478,16 +1599,16 @@ namespace s3d
 						
 						break;
 					}
-				case MetalRenderer2DCommandType::PSTexture0:
-				case MetalRenderer2DCommandType::PSTexture1:
-				case MetalRenderer2DCommandType::PSTexture2:
-				case MetalRenderer2DCommandType::PSTexture3:
-				case MetalRenderer2DCommandType::PSTexture4:
-				case MetalRenderer2DCommandType::PSTexture5:
-				case MetalRenderer2DCommandType::PSTexture6:
-				case MetalRenderer2DCommandType::PSTexture7:
+				case Renderer2DCommandType::PSTexture0:
+				case Renderer2DCommandType::PSTexture1:
+				case Renderer2DCommandType::PSTexture2:
+				case Renderer2DCommandType::PSTexture3:
+				case Renderer2DCommandType::PSTexture4:
+				case Renderer2DCommandType::PSTexture5:
+				case Renderer2DCommandType::PSTexture6:
+				case Renderer2DCommandType::PSTexture7:
 					{
-						const uint32 slot = (FromEnum(command.type) - FromEnum(MetalRenderer2DCommandType::PSTexture0));
+						const uint32 slot = (FromEnum(command.type) - FromEnum(Renderer2DCommandType::PSTexture0));
 						const auto& textureID = m_commandManager.getPSTexture(slot, command.index);
 
 						if (textureID.isInvalid())
@@ -1682,6 +1803,33 @@ namespace s3d
 		return m_commandManager.getCurrentMaxScaling();
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	getStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Renderer2DStat& CRenderer2D_Metal::getStat() const noexcept
+	{
+		return m_stat;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setDrawCallReorderingEnabled, isDrawCallReorderingEnabled
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Metal::setDrawCallReorderingEnabled(const bool enabled)
+	{
+		m_drawCallReordering = enabled;
+	}
+
+	bool CRenderer2D_Metal::isDrawCallReorderingEnabled() const noexcept
+	{
+		return m_drawCallReordering;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	beginFrame
@@ -1693,6 +1841,8 @@ namespace s3d
 		m_commandBuffer = commandBuffer;
 
 		m_vertexBufferManager.updateContent();
+
+		m_stat = {};
 	}
 
 	////////////////////////////////////////////////////////////////
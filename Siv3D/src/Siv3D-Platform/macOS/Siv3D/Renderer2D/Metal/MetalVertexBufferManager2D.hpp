@@ -14,6 +14,7 @@
 # include <Siv3D/Vertex2D.hpp>
 # include <Siv3D/Renderer/Metal/Metal.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include <Siv3D/Renderer2D/Renderer2DCommandReorder.hpp>
 
 namespace s3d
 {
@@ -50,6 +51,8 @@ namespace s3d
 		
 		uint32 indexCount() const noexcept;
 
+		Renderer2DBufferView getBufferView();
+
 	private:
 
 		static constexpr uint32 InitialVertexBufferSize	= (1 << 16);	// 65,536
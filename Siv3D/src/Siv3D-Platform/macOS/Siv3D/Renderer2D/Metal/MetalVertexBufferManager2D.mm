@@ -65,6 +65,18 @@ namespace s3d
 		return m_buffers[m_bufferIndex].indexBuffer.writePos;
 	}
 
+	Renderer2DBufferView MetalVertexBufferManager2D::getBufferView()
+	{
+		const Buffer& buffer = m_buffers[m_bufferIndex];
+
+		// Metal は 1 フレームを 1 つのバッチで描く
+		return{
+			.vertices	= std::span{ buffer.vertexBuffer.pointer, buffer.vertexBuffer.writePos },
+			.indices	= std::span{ buffer.indexBuffer.pointer, buffer.indexBuffer.writePos },
+			.batches	= { Renderer2DBufferView::BatchOffset{} },
+		};
+	}
+
 	Vertex2DBufferPointer MetalVertexBufferManager2D::Buffer::requestBuffer(MTL::Device* device, const uint16 vertexCount, const uint32 indexCount)
 	{
 		// VB
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include "CSystem.hpp"
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/LicenseManager/ILicenseManager.hpp>
 # include <Siv3D/RegExp/IRegExp.hpp>
 # include <Siv3D/EngineResource/IEngineResource.hpp>
@@ -105,6 +106,8 @@ namespace s3d
 		SIV3D_ENGINE(Mouse)->update();
 		SIV3D_ENGINE(LicenseManager)->update();
 
+		Threading::ProcessMainThreadTasks();
+
 		return true;
 	}
 }
@@ -9,13 +9,86 @@
 //
 //-----------------------------------------------
 
+
+# include <cerrno>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/stat.h>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/FormatUtility.hpp>
+# include <Siv3D/Blob.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/BinaryReader/AsyncReadWorkers.hpp>
 # include "BinaryReaderDetail.hpp"
 
+# if SIV3D_PLATFORM(LINUX)
+#	include <Siv3D/BinaryReader/IOUringReader.hpp>
+# endif
+
 namespace s3d
 {
+	namespace
+	{
+		/// @brief 連続しない位置への移動がこの回数に達したら、ランダムアクセスとみなして先読みを止める
+		static constexpr int32 RandomAccessSeekThreshold = 8;
+
+		/// @brief 先頭から順に読み込むことを OS に伝え、先読みを大きくします。
+		static void AdviseSequentialAccess(const int fd) noexcept
+		{
+		# if SIV3D_PLATFORM(LINUX)
+
+			::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+		# elif SIV3D_PLATFORM(MACOS)
+
+			::fcntl(fd, F_RDAHEAD, 1);
+
+		# endif
+		}
+
+		/// @brief ランダムアクセスであることを OS に伝え、不要な先読みを止めます。
+		static void AdviseRandomAccess(const int fd) noexcept
+		{
+		# if SIV3D_PLATFORM(LINUX)
+
+			::posix_fadvise(fd, 0, 0, POSIX_FADV_RANDOM);
+
+		# elif SIV3D_PLATFORM(MACOS)
+
+			::fcntl(fd, F_RDAHEAD, 0);
+
+		# endif
+		}
+
+		/// @brief ファイルの読み込み位置を変えずに、指定した位置から読み込みます。
+		/// @return 読み込んだサイズ（バイト）
+		[[nodiscard]]
+		static int64 ReadAt(const int fd, void* const dst, const int64 pos, const int64 size) noexcept
+		{
+			int64 totalReadBytes = 0;
+
+			while (totalReadBytes < size)
+			{
+				const ssize_t result = ::pread(fd, (static_cast<Byte*>(dst) + totalReadBytes), static_cast<size_t>(size - totalReadBytes), static_cast<off_t>(pos + totalReadBytes));
+
+				if (0 < result)
+				{
+					totalReadBytes += result;
+				}
+				else if ((result < 0) && (errno == EINTR))
+				{
+					continue;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			return totalReadBytes;
+		}
+	}
+
 	BinaryReader::BinaryReaderDetail::~BinaryReaderDetail()
 	{
 		close();
@@ -28,22 +101,39 @@ namespace s3d
 		close();
 
 		{
+			struct stat status{};
+
 			// ファイルのオープン
 			{
-				m_file.file.open(path.toWstr(), std::ios_base::binary);
-				m_file.readPos = 0;
+				const int fd = ::open(path.toUTF8().c_str(), (O_RDONLY | O_CLOEXEC));
 
-				if (not m_file.file) [[unlikely]]
+				if (fd == -1) [[unlikely]]
 					{
 						LOG_FAIL(fmt::format("❌ BinaryReader: Failed to open file `{0}`", path));
 						return false;
 					}
+
+				m_file =
+				{
+					.descriptor = std::make_shared<const FileDescriptor>(fd),
+					.readPos = 0,
+					.seekCount = 0,
+				};
+
+				if ((::fstat(fd, &status) != 0) || S_ISDIR(status.st_mode)) [[unlikely]]
+					{
+						m_file = {};
+						LOG_FAIL(fmt::format("❌ BinaryReader: Failed to open file `{0}`", path));
+						return false;
+					}
+
+				AdviseSequentialAccess(fd);
 			}
 
 			m_info =
 			{
 				.fullPath = FileSystem::FullPath(path),
-				.fileSize = static_cast<int64>(FileSystem::FileSize(path)),
+				.fileSize = static_cast<int64>(status.st_size),
 				.isOpen = true,
 			};
 
@@ -62,8 +152,8 @@ namespace s3d
 		}
 
 		{
-			m_file.file.close();
-			m_file.readPos = 0;
+			// 非同期読み込みが残っている場合、ファイルはそれらが終わったときに閉じられる
+			m_file = {};
 			LOG_INFO(fmt::format("📥 BinaryReader: File `{0}` closed", m_info.fullPath));
 		}
 
@@ -88,8 +178,8 @@ namespace s3d
 		}
 
 		const int64 clampedPos = Clamp<int64>(pos, 0, m_info.fileSize);
-		m_file.file.seekg(clampedPos);
-		return (m_file.readPos = clampedPos);
+		m_file.seek(clampedPos);
+		return clampedPos;
 	}
 
 	int64 BinaryReader::BinaryReaderDetail::skip(const int64 offset)
@@ -100,8 +190,8 @@ namespace s3d
 		}
 
 		const int64 clampedPos = Clamp<int64>((getPos() + offset), 0, m_info.fileSize);
-		m_file.file.seekg(clampedPos);
-		return (m_file.readPos = clampedPos);
+		m_file.seek(clampedPos);
+		return clampedPos;
 	}
 
 	int64 BinaryReader::BinaryReaderDetail::getPos()
@@ -126,24 +216,38 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 readSize)
 	{
-		return m_file.lookahead(dst, readSize, m_info.fileSize, m_info.fullPath);
+		return m_file.lookahead(dst, m_file.readPos, readSize, m_info.fileSize, m_info.fullPath);
 	}
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 pos, const int64 readSize)
 	{
-		const auto previousPos = getPos();
-
-		if (pos != setPos(pos))
+		if (not InRange<int64>(pos, 0, m_info.fileSize))
 		{
-			setPos(previousPos);
 			return 0;
 		}
 
-		const int64 readBytes = m_file.lookahead(dst, readSize, m_info.fileSize, m_info.fullPath);
+		return m_file.lookahead(dst, pos, readSize, m_info.fileSize, m_info.fullPath);
+	}
+
+	void BinaryReader::BinaryReaderDetail::readAsync(Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete) const
+	{
+		std::shared_ptr<const FileDescriptor> descriptor = m_file.descriptor;
 
-		setPos(previousPos);
+	# if SIV3D_PLATFORM(LINUX)
 
-		return readBytes;
+		// io_uring が使えなくなっている場合は、I/O スレッドで読み込む
+		if (IOUringReader* ioUring = IOUringReader::Get();
+			ioUring && ioUring->submit(descriptor->fd, descriptor, std::move(requests), std::move(onComplete)))
+		{
+			return;
+		}
+
+	# endif
+
+		AsyncReadWorkers::Get().submit([descriptor = std::move(descriptor)](void* dst, const int64 pos, const int64 size)
+			{
+				return ReadAt(descriptor->fd, dst, pos, size);
+			}, std::move(requests), std::move(onComplete));
 	}
 
 	const FilePath& BinaryReader::BinaryReaderDetail::path() const noexcept
@@ -151,38 +255,52 @@ namespace s3d
 		return m_info.fullPath;
 	}
 
-	int64 BinaryReader::BinaryReaderDetail::File::read(const NonNull<void*> dst, const int64 readSize, const int64 fileSize, const FilePath& fullPath)
+	BinaryReader::BinaryReaderDetail::FileDescriptor::~FileDescriptor()
 	{
-		const int64 readBytes = Clamp<int64>(readSize, 0, (fileSize - readPos));
-
-		if (readBytes == 0)
+		if (fd != -1)
 		{
-			return 0;
+			::close(fd);
 		}
+	}
 
-		if (not file.read(static_cast<char*>(dst.get()), readBytes))
+	void BinaryReader::BinaryReaderDetail::File::seek(const int64 pos)
+	{
+		if (pos == readPos)
 		{
-			readPos = file.tellg();
-
-			if (file.eof())
-			{
-				return readBytes;
-			}
+			return;
+		}
 
-			LOG_FAIL(fmt::format("❌ BinaryReader `{0}`: read() failed", fullPath));
-			return 0;
+		if (++seekCount == RandomAccessSeekThreshold)
+		{
+			AdviseRandomAccess(descriptor->fd);
 		}
 
+		readPos = pos;
+	}
+
+	int64 BinaryReader::BinaryReaderDetail::File::read(const NonNull<void*> dst, const int64 readSize, const int64 fileSize, const FilePath& fullPath)
+	{
+		const int64 readBytes = lookahead(dst, readPos, readSize, fileSize, fullPath);
 		readPos += readBytes;
 		return readBytes;
 	}
 
-	int64 BinaryReader::BinaryReaderDetail::File::lookahead(const NonNull<void*> dst, const int64 readSize, const int64 fileSize, const FilePath& fullPath)
+	int64 BinaryReader::BinaryReaderDetail::File::lookahead(const NonNull<void*> dst, const int64 pos, const int64 readSize, const int64 fileSize, const FilePath& fullPath) const
 	{
-		const int64 previousReadPos = readPos;
-		const int64 readBytes = read(dst, readSize, fileSize, fullPath);
-		readPos = previousReadPos;
-		file.seekg(previousReadPos);
-		return readBytes;
+		const int64 readBytes = Clamp<int64>(readSize, 0, (fileSize - pos));
+
+		if (readBytes == 0)
+		{
+			return 0;
+		}
+
+		const int64 actualReadBytes = ReadAt(descriptor->fd, dst.get(), pos, readBytes);
+
+		if (actualReadBytes != readBytes)
+		{
+			LOG_FAIL(fmt::format("❌ BinaryReader `{0}`: read() failed", fullPath));
+		}
+
+		return actualReadBytes;
 	}
 }
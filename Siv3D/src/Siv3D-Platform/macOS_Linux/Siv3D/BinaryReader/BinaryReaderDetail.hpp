@@ -9,9 +9,10 @@
 //
 //-----------------------------------------------
 
-# include <fstream>
 # include <Siv3D/Windows/Windows.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/AsyncReadRequest.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/Byte.hpp>
 # include <Siv3D/NonNull.hpp>
@@ -57,20 +58,44 @@ namespace s3d
 		[[nodiscard]]
 		int64 lookahead(NonNull<void*> dst, int64 pos, int64 readSize);
 
+		void readAsync(Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete) const;
+
 		[[nodiscard]]
 		const FilePath& path() const noexcept;
 
 	private:
 
+		/// @brief 非同期読み込みが終わるまでファイルを開いたままにするため、共有して保持する
+		struct FileDescriptor
+		{
+			int fd = -1;
+
+			FileDescriptor() = default;
+
+			explicit FileDescriptor(int _fd) noexcept
+				: fd{ _fd } {}
+
+			FileDescriptor(const FileDescriptor&) = delete;
+
+			FileDescriptor& operator =(const FileDescriptor&) = delete;
+
+			~FileDescriptor();
+		};
+
 		struct File
 		{
-			std::ifstream file;
+			std::shared_ptr<const FileDescriptor> descriptor;
 
 			int64 readPos = 0;
 
+			/// @brief 連続しない位置へ移動した回数
+			int32 seekCount = 0;
+
+			void seek(int64 pos);
+
 			int64 read(NonNull<void*> dst, int64 readSize, int64 fileSize, const FilePath& fullPath);
 
-			int64 lookahead(NonNull<void*> dst, int64 readSize, int64 fileSize, const FilePath& fullPath);
+			int64 lookahead(NonNull<void*> dst, int64 pos, int64 readSize, int64 fileSize, const FilePath& fullPath) const;
 
 		} m_file;
 
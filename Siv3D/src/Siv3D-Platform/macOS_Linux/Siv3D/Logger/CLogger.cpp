@@ -10,8 +10,10 @@
 //-----------------------------------------------
 
 # include <iostream>
+# include <thread>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/Time.hpp>
+# include <Siv3D/ScopeExit.hpp>
 # include "CLogger.hpp"
 
 namespace s3d
@@ -28,13 +30,25 @@ namespace s3d
 			": [debug] ",
 			": [trace] ",
 		};
+
+		static void AppendPrefix(std::string& output, const LogType type, const int64 timeMillisec)
+		{
+			output.append(std::to_string(timeMillisec));
+			output.append(LogTypeStrings[FromEnum(type)]);
+		}
 	}
 
 	CLogger::CLogger()
-		: m_outputLevel{ SIV3D_BUILD(DEBUG) ? LogType::Trace : LogType::Info } {}
+		: m_outputLevel{ SIV3D_BUILD(DEBUG) ? LogType::Trace : LogType::Info }
+		, m_startMicrosec{ Time::GetMicrosec() } {}
 
 	void CLogger::writeln(const std::string_view s)
 	{
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ none, 0, std::string{ s } }); }))
+		{
+			return;
+		}
+
 		std::string output;
 		output.reserve(s.size() + 1);
 		output.append(s);
@@ -44,6 +58,11 @@ namespace s3d
 
 	void CLogger::writeln(const StringView s)
 	{
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ none, 0, String{ s } }); }))
+		{
+			return;
+		}
+
 		writeImpl(Unicode::ToUTF8(s));
 	}
 
@@ -54,9 +73,13 @@ namespace s3d
 			return;
 		}
 
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ type, Time::GetMillisec(), std::string{ s } }); }))
+		{
+			return;
+		}
+
 		std::string output;
-		output.append(std::to_string(Time::GetMillisec()));
-		output.append(detail::LogTypeStrings[FromEnum(type)]);
+		detail::AppendPrefix(output, type, Time::GetMillisec());
 		output.append(s);
 
 		writeImpl(output);
@@ -68,10 +91,14 @@ namespace s3d
 		{
 			return;
 		}
+
+		if (withAsyncWriter([&](AsyncLogWriter& writer) { writer.push({ type, Time::GetMillisec(), String{ s } }); }))
+		{
+			return;
+		}
 			
 		std::string output;
-		output.append(std::to_string(Time::GetMillisec()));
-		output.append(detail::LogTypeStrings[FromEnum(type)]);
+		detail::AppendPrefix(output, type, Time::GetMillisec());
 		output.append(Unicode::ToUTF8(s));
 
 		writeImpl(output);
@@ -87,6 +114,92 @@ namespace s3d
 		return m_outputLevel.load();
 	}
 
+	void CLogger::enableAsync(const size_t capacity, const LogOverflowPolicy overflowPolicy)
+	{
+		std::lock_guard lock{ m_asyncMutex };
+
+		releaseAsyncWriter();
+
+		m_asyncWriterStorage = std::make_unique<AsyncLogWriter>(capacity, overflowPolicy,
+			[this](const std::span<const AsyncLogWriter::Entry> entries) { return writeBatch(entries); }, m_counters);
+		m_asyncWriter.store(m_asyncWriterStorage.get());
+	}
+
+	void CLogger::disableAsync()
+	{
+		std::lock_guard lock{ m_asyncMutex };
+
+		releaseAsyncWriter();
+	}
+
+	bool CLogger::isAsync() const noexcept
+	{
+		return (m_asyncWriter.load(std::memory_order_acquire) != nullptr);
+	}
+
+	void CLogger::flush()
+	{
+		withAsyncWriter([](AsyncLogWriter& writer) { writer.flush(); });
+	}
+
+	LoggerStat CLogger::getStat() const
+	{
+		LoggerStat stat;
+		stat.messageCount			= m_counters.messageCount.load(std::memory_order_relaxed);
+		stat.byteCount				= m_counters.byteCount.load(std::memory_order_relaxed);
+		stat.writeCount				= m_counters.writeCount.load(std::memory_order_relaxed);
+		stat.droppedMessageCount	= m_counters.droppedMessageCount.load(std::memory_order_relaxed);
+
+		withAsyncWriter([&](const AsyncLogWriter& writer) { stat.queuedMessageCount = writer.getQueuedCount(); });
+
+		if (const double elapsedSec = ((Time::GetMicrosec() - m_startMicrosec) / 1'000'000.0);
+			0.0 < elapsedSec)
+		{
+			stat.messagesPerSecond	= (stat.messageCount / elapsedSec);
+			stat.bytesPerSecond		= (stat.byteCount / elapsedSec);
+		}
+
+		return stat;
+	}
+
+	template <class Fty>
+	bool CLogger::withAsyncWriter(Fty f) const
+	{
+		if (not m_asyncWriter.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		// 先に使用中として数えてから読む。releaseAsyncWriter() が m_asyncWriter を入れ替えた後に数えた場合は、新しい値が読まれる
+		m_asyncUsers.fetch_add(1);
+		const ScopeExit release = [this]() { m_asyncUsers.fetch_sub(1, std::memory_order_release); };
+
+		if (AsyncLogWriter* pWriter = m_asyncWriter.load())
+		{
+			f(*pWriter);
+			return true;
+		}
+
+		return false;
+	}
+
+	void CLogger::releaseAsyncWriter()
+	{
+		if (not m_asyncWriter.exchange(nullptr))
+		{
+			return;
+		}
+
+		// 以降の呼び出しは同期的に書き込む。古い AsyncLogWriter に書き込んでいる呼び出しが終わるのを待つ
+		while (m_asyncUsers.load(std::memory_order_acquire) != 0)
+		{
+			std::this_thread::yield();
+		}
+
+		// キューに残っているメッセージを書き出してから、書き出しスレッドを終了する
+		m_asyncWriterStorage.reset();
+	}
+
 	void CLogger::writeImpl(const std::string& s)
 	{
 		std::lock_guard lock{ m_mutex };
@@ -101,5 +214,50 @@ namespace s3d
 		
 		# endif
 		}
+
+		m_counters.messageCount.fetch_add(1, std::memory_order_relaxed);
+		m_counters.byteCount.fetch_add((s.size() + 1), std::memory_order_relaxed);
+		m_counters.writeCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	size_t CLogger::writeBatch(const std::span<const AsyncLogWriter::Entry> entries)
+	{
+		std::string output;
+
+		for (const auto& entry : entries)
+		{
+			if (entry.type)
+			{
+				detail::AppendPrefix(output, *entry.type, entry.timeMillisec);
+			}
+
+			if (const std::string* s = std::get_if<std::string>(&entry.text))
+			{
+				output.append(*s);
+			}
+			else
+			{
+				output.append(Unicode::ToUTF8(std::get<String>(entry.text)));
+			}
+
+			output.push_back('\n');
+		}
+
+		std::lock_guard lock{ m_mutex };
+		{
+		# if SIV3D_PLATFORM(WEB)
+		
+			std::cout.write(output.data(), output.size());
+			std::cout.flush();
+		
+		# else
+		
+			std::clog.write(output.data(), output.size());
+			std::clog.flush();
+		
+		# endif
+		}
+
+		return output.size();
 	}
 }
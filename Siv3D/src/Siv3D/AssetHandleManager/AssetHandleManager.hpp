@@ -10,31 +10,48 @@
 //-----------------------------------------------
 
 # pragma once
+# include <array>
+# include <atomic>
 # include <memory>
 # include <mutex>
 # include <Siv3D/Common.hpp>
-# include <Siv3D/HashMap.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/EngineLog.hpp>
 
 namespace s3d
 {
+	/// @brief アセットの ID とデータを管理するクラス
+	/// @remark 世代付きスロットマップで実装されています。ID の下位ビットがスロットのインデックス、上位ビットがスロットの世代です。
+	/// @remark operator [] はロックを取らず、他のスレッドが add() している間も安全に呼べます。
+	/// @remark 解放済みの ID（世代が一致しない ID）を参照した場合は Null データを返します。
 	template <class IDType, class Data>
 	class AssetHandleManager
 	{
 	public:
 
-		using container_type	= HashMap<IDType, std::unique_ptr<Data>>;
-		using iterator			= typename container_type::iterator;
-		using const_iterator	= typename container_type::const_iterator;
+		using value_type = typename IDType::value_type;
+
+		/// @brief スロットのインデックスに使うビット数
+		static constexpr uint32 IndexBits = 20;
+
+		static constexpr value_type IndexMask = ((value_type{ 1 } << IndexBits) - 1);
+
+		/// @brief スロットの世代の最大値。これを超えたスロットは再利用されません。
+		static constexpr value_type MaxGeneration = (IDType::InvalidID >> IndexBits);
+
+		/// @brief スロットの最大数（ID が InvalidID と一致しないよう、最後のインデックスは使いません）
+		static constexpr uint32 MaxSlots = IndexMask;
 
 		[[nodiscard]]
 		explicit AssetHandleManager(const std::string& name);
 
+		~AssetHandleManager();
+
 		void setNullData(std::unique_ptr<Data>&& data);
 
 		[[nodiscard]]
-		Data* operator [](const IDType id);
+		Data* operator [](const IDType id) noexcept;
 
 		[[nodiscard]]
 		IDType add(std::unique_ptr<Data>&& data, const String& info = U"");
@@ -43,32 +60,63 @@ namespace s3d
 
 		void destroy();
 
+		/// @brief ID が現在有効なアセットを指しているかを返します。
+		/// @param id ID
+		/// @return 有効なアセットを指している場合 true, それ以外の場合は false
 		[[nodiscard]]
-		iterator begin();
+		bool isValid(const IDType id) const noexcept;
 
 		[[nodiscard]]
-		iterator end();
+		size_t size() const noexcept;
 
-		[[nodiscard]]
-		const_iterator begin() const;
+	private:
 
-		[[nodiscard]]
-		const_iterator end() const;
+		static constexpr uint32 ChunkBits = 10;
 
-		[[nodiscard]]
-		size_t size() const noexcept;
+		/// @brief 1 つのチャンクに含まれるスロットの数
+		static constexpr uint32 ChunkSize = (1u << ChunkBits);
 
-	private:
+		static constexpr uint32 MaxChunks = (1u << (IndexBits - ChunkBits));
+
+		struct Slot
+		{
+			/// @brief このスロットが保持しているアセットの ID（空きスロットの場合は NullID）
+			std::atomic<value_type> id{ IDType::NullID };
+
+			std::atomic<Data*> data{ nullptr };
+
+			/// @brief 次に割り当てるときの世代
+			value_type generation = 1;
+
+			std::unique_ptr<Data> owner;
+		};
 
 		std::string m_assetTypeName;
 
+		/// @brief add(), erase(), destroy() の排他制御
 		std::mutex m_mutex;
 
-		container_type m_data;
+		/// @brief チャンクの配列。一度確保したチャンクは移動しないため、ロックなしで読み取れます。
+		std::array<std::atomic<Slot*>, MaxChunks> m_chunks{};
+
+		/// @brief 使用したことのあるスロットの数
+		uint32 m_numSlots = 0;
+
+		/// @brief 再利用できるスロットのインデックス
+		Array<uint32> m_freeIndices;
 
-		typename IDType::value_type m_idCount = 0;
+		std::atomic<size_t> m_size{ 0 };
+
+		[[nodiscard]]
+		const Slot* findSlot(value_type value) const noexcept;
+
+		[[nodiscard]]
+		Slot& getSlot(uint32 index) noexcept;
+
+		[[nodiscard]]
+		Data* getNullData() noexcept;
 
-		bool m_idFilled = false;
+		void releaseSlot(uint32 index);
 	};
 }
 
@@ -17,22 +17,53 @@ namespace s3d
 {
 	template <class IDType, class Data>
 	AssetHandleManager<IDType, Data>::AssetHandleManager(const std::string& name)
-		: m_assetTypeName{ name } {}
+		: m_assetTypeName{ name }
+	{
+		// スロット 0 は Null データ用
+		m_chunks[0].store(new Slot[ChunkSize], std::memory_order_release);
+		m_numSlots = 1;
+	}
+
+	template <class IDType, class Data>
+	AssetHandleManager<IDType, Data>::~AssetHandleManager()
+	{
+		for (auto& chunk : m_chunks)
+		{
+			delete[] chunk.load(std::memory_order_relaxed);
+		}
+	}
 
 	template <class IDType, class Data>
 	void AssetHandleManager<IDType, Data>::setNullData(std::unique_ptr<Data>&& data)
 	{
-		m_data.emplace(IDType::Null(), std::move(data));
+		std::lock_guard lock{ m_mutex };
+
+		Slot& slot = getSlot(0);
+		slot.owner = std::move(data);
+		slot.data.store(slot.owner.get(), std::memory_order_release);
+
+		m_size.store((m_size.load(std::memory_order_relaxed) + 1), std::memory_order_relaxed);
 
 		LOG_DEBUG(fmt::format("💠 Created {0}[0(null)]", m_assetTypeName));
 	}
 
 	template <class IDType, class Data>
-	Data* AssetHandleManager<IDType, Data>::operator [](const IDType id)
+	Data* AssetHandleManager<IDType, Data>::operator [](const IDType id) noexcept
 	{
-		std::lock_guard lock{ m_mutex };
+		if (const Slot* slot = findSlot(id.value()))
+		{
+			if (Data* data = slot->data.load(std::memory_order_relaxed))
+			{
+				return data;
+			}
 
-		return m_data[id].get();
+			// findSlot() の後に別のスレッドで解放された
+			return getNullData();
+		}
+
+		// 解放済み、または存在しない ID
+		assert(false);
+		return getNullData();
 	}
 
 	template <class IDType, class Data>
@@ -40,43 +71,45 @@ namespace s3d
 	{
 		std::lock_guard lock{ m_mutex };
 
-		if (++m_idCount == IDType::InvalidID)
-		{
-			m_idFilled = true;
-			m_idCount = 0;
-		}
+		uint32 index;
 
-		if (not m_idFilled)
+		if (m_freeIndices)
 		{
-			m_data.emplace(m_idCount, std::move(data));
-
-			LOG_DEBUG(fmt::format("💠 Created {0}[{1}] {2}", m_assetTypeName, m_idCount, info));
-
-			return IDType(m_idCount);
+			index = m_freeIndices.back();
+			m_freeIndices.pop_back();
 		}
 		else
 		{
-			if (m_data.size() == (IDType::InvalidID - 1))
+			if (m_numSlots == MaxSlots)
 			{
 				LOG_FAIL(fmt::format("❌ No more {0}s can be created", m_assetTypeName));
 
 				return IDType::Null();
 			}
 
-			while (++m_idCount < IDType::InvalidID)
+			index = m_numSlots++;
+
+			if (auto& chunk = m_chunks[index >> ChunkBits];
+				chunk.load(std::memory_order_relaxed) == nullptr)
 			{
-				if (m_data.find(IDType(++m_idCount)) == m_data.end())
-				{
-					m_data.emplace(m_idCount, std::move(data));
+				chunk.store(new Slot[ChunkSize], std::memory_order_release);
+			}
+		}
 
-					LOG_DEBUG(fmt::format("💠 Created {0}[{1}] {2}", m_assetTypeName, m_idCount, info));
+		Slot& slot = getSlot(index);
+		const value_type value = ((slot.generation << IndexBits) | index);
 
-					return IDType(m_idCount);
-				}
-			}
+		slot.owner = std::move(data);
+		slot.data.store(slot.owner.get(), std::memory_order_relaxed);
 
-			return IDType::Null();
-		}
+		// id を最後に公開することで、id が一致したスロットの data は必ず設定済みになる
+		slot.id.store(value, std::memory_order_release);
+
+		m_size.store((m_size.load(std::memory_order_relaxed) + 1), std::memory_order_relaxed);
+
+		LOG_DEBUG(fmt::format("💠 Created {0}[{1}] {2}", m_assetTypeName, value, info));
+
+		return IDType(value);
 	}
 
 	template <class IDType, class Data>
@@ -89,13 +122,15 @@ namespace s3d
 
 		std::lock_guard lock{ m_mutex };
 
-		const auto it = m_data.find(id);
-
-		assert(it != m_data.end());
+		if (not findSlot(id.value()))
+		{
+			assert(false);
+			return;
+		}
 
 		LOG_DEBUG(fmt::format("♻️ Released {0}[{1}]", m_assetTypeName, id.value()));
 
-		m_data.erase(it);
+		releaseSlot(id.value() & IndexMask);
 
 		SIV3D_ENGINE(AssetMonitor)->reportAssetRelease();
 	}
@@ -105,48 +140,91 @@ namespace s3d
 	{
 		std::lock_guard lock{ m_mutex };
 
-		for (const auto& data : m_data)
+		for (uint32 index = 1; index < m_numSlots; ++index)
 		{
-			if (const auto id = data.first; (not id.isNull()))
-			{
-				LOG_DEBUG(fmt::format("♻️ Released {0}[{1}]", m_assetTypeName, id.value()));
-			}
-			else
+			if (const value_type value = getSlot(index).id.load(std::memory_order_relaxed);
+				value != IDType::NullID)
 			{
-				LOG_DEBUG(fmt::format("♻️ Released {0}[0(null)]", m_assetTypeName));
+				LOG_DEBUG(fmt::format("♻️ Released {0}[{1}]", m_assetTypeName, value));
+
+				releaseSlot(index);
 			}
 		}
 
-		m_data.clear();
+		if (Slot& nullSlot = getSlot(0);
+			nullSlot.owner)
+		{
+			LOG_DEBUG(fmt::format("♻️ Released {0}[0(null)]", m_assetTypeName));
+
+			nullSlot.data.store(nullptr, std::memory_order_relaxed);
+			nullSlot.owner.reset();
+			m_size.store((m_size.load(std::memory_order_relaxed) - 1), std::memory_order_relaxed);
+		}
 	}
 
 	template <class IDType, class Data>
-	typename AssetHandleManager<IDType, Data>::iterator AssetHandleManager<IDType, Data>::begin()
+	bool AssetHandleManager<IDType, Data>::isValid(const IDType id) const noexcept
 	{
-		return m_data.begin();
+		return (findSlot(id.value()) != nullptr);
 	}
 
 	template <class IDType, class Data>
-	typename AssetHandleManager<IDType, Data>::iterator AssetHandleManager<IDType, Data>::end()
+	size_t AssetHandleManager<IDType, Data>::size() const noexcept
 	{
-		return m_data.end();
+		return m_size.load(std::memory_order_relaxed);
 	}
 
 	template <class IDType, class Data>
-	typename AssetHandleManager<IDType, Data>::const_iterator AssetHandleManager<IDType, Data>::begin() const
+	const typename AssetHandleManager<IDType, Data>::Slot* AssetHandleManager<IDType, Data>::findSlot(const value_type value) const noexcept
 	{
-		return m_data.cbegin();
+		const uint32 index = static_cast<uint32>(value & IndexMask);
+
+		const Slot* chunk = m_chunks[index >> ChunkBits].load(std::memory_order_acquire);
+
+		if (chunk == nullptr)
+		{
+			return nullptr;
+		}
+
+		const Slot& slot = chunk[index & (ChunkSize - 1)];
+
+		// 空きスロットの id は NullID なので、インデックス 0 以外の ID とは一致しない
+		if (slot.id.load(std::memory_order_acquire) != value)
+		{
+			return nullptr;
+		}
+
+		return &slot;
 	}
 
 	template <class IDType, class Data>
-	typename AssetHandleManager<IDType, Data>::const_iterator AssetHandleManager<IDType, Data>::end() const
+	typename AssetHandleManager<IDType, Data>::Slot& AssetHandleManager<IDType, Data>::getSlot(const uint32 index) noexcept
 	{
-		return m_data.cend();
+		return m_chunks[index >> ChunkBits].load(std::memory_order_relaxed)[index & (ChunkSize - 1)];
 	}
 
 	template <class IDType, class Data>
-	size_t AssetHandleManager<IDType, Data>::size() const noexcept
+	Data* AssetHandleManager<IDType, Data>::getNullData() noexcept
+	{
+		return getSlot(0).data.load(std::memory_order_acquire);
+	}
+
+	template <class IDType, class Data>
+	void AssetHandleManager<IDType, Data>::releaseSlot(const uint32 index)
 	{
-		return m_data.size();
+		Slot& slot = getSlot(index);
+
+		// 先に id を無効にして、以降の参照を Null データに向ける
+		slot.id.store(IDType::NullID, std::memory_order_release);
+		slot.data.store(nullptr, std::memory_order_relaxed);
+		slot.owner.reset();
+
+		m_size.store((m_size.load(std::memory_order_relaxed) - 1), std::memory_order_relaxed);
+
+		// 世代を使い切ったスロットは、古い ID と区別できなくなるため再利用しない
+		if (++slot.generation <= MaxGeneration)
+		{
+			m_freeIndices.push_back(index);
+		}
 	}
 }
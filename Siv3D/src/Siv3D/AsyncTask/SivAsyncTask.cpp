@@ -0,0 +1,82 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <thread>
+# include <Siv3D/AsyncTask.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	TaskCompletion
+		//
+		////////////////////////////////////////////////////////////////
+
+		void TaskCompletion::complete()
+		{
+			Array<std::function<void()>> callbacks;
+			{
+				std::lock_guard lock{ m_mutex };
+
+				m_completed = true;
+
+				callbacks.swap(m_callbacks);
+			}
+
+			// 継続が新しい継続を登録できるよう、ロックの外で呼ぶ
+			for (auto& callback : callbacks)
+			{
+				callback();
+			}
+		}
+
+		void TaskCompletion::onComplete(std::function<void()> f)
+		{
+			{
+				std::lock_guard lock{ m_mutex };
+
+				if (not m_completed)
+				{
+					m_callbacks.push_back(std::move(f));
+					return;
+				}
+			}
+
+			f();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	WhenReady
+		//
+		////////////////////////////////////////////////////////////////
+
+		void WhenReady(std::shared_ptr<TaskCompletion> completion, std::function<void()> wait, std::function<void()> callback)
+		{
+			if (completion)
+			{
+				completion->onComplete(std::move(callback));
+				return;
+			}
+
+			// 完了通知を持たないタスクは、専用のスレッドで完了を待つ。
+			// スレッドプールのワーカーで待つと、継続を多く連ねたときにワーカーが埋まり、ParallelFor などが進まなくなる
+			std::thread{ [wait = std::move(wait), callback = std::move(callback)]()
+				{
+					wait();
+					callback();
+				} }.detach();
+		}
+	}
+}
@@ -0,0 +1,129 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "AsyncReadWorkers.hpp"
+# include <Siv3D/Blob.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	AsyncReadWorkers::~AsyncReadWorkers()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stop = true;
+		}
+
+		m_condition.notify_all();
+
+		for (auto& thread : m_threads)
+		{
+			thread.join();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	submit
+	//
+	////////////////////////////////////////////////////////////////
+
+	void AsyncReadWorkers::submit(ReadFunction readAt, Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete)
+	{
+		const size_t requestCount = requests.size();
+
+		if (requestCount == 0)
+		{
+			return;
+		}
+
+		const auto batch = std::make_shared<const Batch>(Batch{ std::move(readAt), std::move(requests), std::move(onComplete) });
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			if (m_threads.isEmpty())
+			{
+				for (size_t i = 0; i < ThreadCount; ++i)
+				{
+					m_threads.emplace_back([this]() { run(); });
+				}
+			}
+
+			for (size_t beginIndex = 0; beginIndex < requestCount; beginIndex += MaxRequestsPerJob)
+			{
+				m_jobs.push_back(Job{ batch, beginIndex, Min((beginIndex + MaxRequestsPerJob), requestCount) });
+			}
+		}
+
+		m_condition.notify_all();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Get
+	//
+	////////////////////////////////////////////////////////////////
+
+	AsyncReadWorkers& AsyncReadWorkers::Get()
+	{
+		static AsyncReadWorkers workers;
+		return workers;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	run
+	//
+	////////////////////////////////////////////////////////////////
+
+	void AsyncReadWorkers::run()
+	{
+		for (;;)
+		{
+			Job job;
+			{
+				std::unique_lock lock{ m_mutex };
+
+				m_condition.wait(lock, [this]() { return (m_stop || (not m_jobs.empty())); });
+
+				if (m_jobs.empty())
+				{
+					return;
+				}
+
+				job = std::move(m_jobs.front());
+				m_jobs.pop_front();
+			}
+
+			const Batch& batch = *job.batch;
+
+			for (size_t i = job.beginIndex; i < job.endIndex; ++i)
+			{
+				const AsyncReadRequest& request = batch.requests[i];
+				Blob blob(static_cast<size_t>(request.size));
+
+				if (0 < request.size)
+				{
+					blob.resize(static_cast<size_t>(Max<int64>(batch.readAt(blob.data(), request.pos, request.size), 0)));
+				}
+
+				batch.onComplete(i, std::move(blob));
+			}
+		}
+	}
+}
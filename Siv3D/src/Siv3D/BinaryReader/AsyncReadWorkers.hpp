@@ -0,0 +1,92 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <mutex>
+# include <condition_variable>
+# include <thread>
+# include <deque>
+# include <functional>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/AsyncReadRequest.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	AsyncReadWorkers
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 非同期読み込みを、I/O 専用のスレッドで位置指定の読み込みを行って処理するクラス
+	/// @remark io_uring を使えない環境での非同期読み込みに使います。スレッドは最初の要求で起動します。
+	class AsyncReadWorkers
+	{
+	public:
+
+		/// @brief ファイルの指定した位置からデータを読み込み、読み込んだサイズを返す関数
+		/// @remark 複数の I/O スレッドから同時に呼ばれます。
+		using ReadFunction = std::function<int64(void* dst, int64 pos, int64 size)>;
+
+		/// @brief 残っている要求をすべて処理してから、I/O スレッドを終了します。
+		~AsyncReadWorkers();
+
+		/// @brief 読み込みを要求します。
+		/// @param readAt 読み込みに使う関数。要求がすべて終わるまで保持されます。
+		/// @param requests 読み込む範囲。ファイルの範囲に収まっている必要があります。
+		/// @param onComplete 1 つの範囲の読み込みが終わるたびに呼ばれる関数
+		void submit(ReadFunction readAt, Array<AsyncReadRequest>&& requests, AsyncReadCallback&& onComplete);
+
+		/// @brief 共有のインスタンスを返します。
+		[[nodiscard]]
+		static AsyncReadWorkers& Get();
+
+	private:
+
+		/// @brief I/O スレッドの数
+		static constexpr size_t ThreadCount = 4;
+
+		/// @brief 1 つのジョブでまとめて読み込む最大の要求数
+		static constexpr size_t MaxRequestsPerJob = 16;
+
+		struct Batch
+		{
+			ReadFunction readAt;
+
+			Array<AsyncReadRequest> requests;
+
+			AsyncReadCallback onComplete;
+		};
+
+		struct Job
+		{
+			std::shared_ptr<const Batch> batch;
+
+			size_t beginIndex = 0;
+
+			size_t endIndex = 0;
+		};
+
+		std::mutex m_mutex;
+
+		std::condition_variable m_condition;
+
+		std::deque<Job> m_jobs;
+
+		bool m_stop = false;
+
+		Array<std::thread> m_threads;
+
+		void run();
+	};
+}
@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <atomic>
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/Error.hpp>
 # include <Siv3D/Blob.hpp>
@@ -31,6 +32,12 @@ namespace s3d
 			throw Error{ fmt::format("BinaryReader::read(): Position ({0}) is out of the valid range. The file size is {1} bytes.", pos, fileSize) };
 		}
 
+		[[noreturn]]
+		static void ThrowReadAsyncRangeError(const int64 pos, const int64 fileSize)
+		{
+			throw Error{ fmt::format("BinaryReader::readAsync(): Position ({0}) is out of the valid range. The file size is {1} bytes.", pos, fileSize) };
+		}
+
 		[[noreturn]]
 		static void ThrowLookaheadDstError()
 		{
@@ -312,6 +319,94 @@ namespace s3d
 		return blob;
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	readBlobAsync
+	//
+	////////////////////////////////////////////////////////////////
+
+	AsyncTask<Blob> BinaryReader::readBlobAsync(const int64 pos, const int64 _size) const
+	{
+		auto promise = std::make_shared<std::promise<Blob>>();
+		AsyncTask<Blob> task{ promise->get_future() };
+
+		readAsync({ AsyncReadRequest{ pos, _size } }, [promise](size_t, Blob&& blob)
+			{
+				promise->set_value(std::move(blob));
+			});
+
+		return task;
+	}
+
+	AsyncTask<Array<Blob>> BinaryReader::readBlobAsync(Array<AsyncReadRequest> requests) const
+	{
+		struct State
+		{
+			std::promise<Array<Blob>> promise;
+
+			Array<Blob> blobs;
+
+			std::atomic<size_t> remainingCount{ 0 };
+		};
+
+		auto state = std::make_shared<State>();
+		state->blobs.resize(requests.size());
+		state->remainingCount = requests.size();
+
+		AsyncTask<Array<Blob>> task{ state->promise.get_future() };
+
+		if (requests.isEmpty())
+		{
+			state->promise.set_value({});
+			return task;
+		}
+
+		readAsync(std::move(requests), [state](const size_t index, Blob&& blob)
+			{
+				state->blobs[index] = std::move(blob);
+
+				if (state->remainingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					state->promise.set_value(std::move(state->blobs));
+				}
+			});
+
+		return task;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	readAsync
+	//
+	////////////////////////////////////////////////////////////////
+
+	void BinaryReader::readAsync(Array<AsyncReadRequest> requests, AsyncReadCallback onComplete) const
+	{
+		const int64 fileSize = pImpl->size();
+
+		for (auto& request : requests)
+		{
+			if (not InRange<int64>(request.pos, 0, fileSize))
+			{
+				ThrowReadAsyncRangeError(request.pos, fileSize);
+			}
+
+			request.size = Clamp<int64>(request.size, 0, (fileSize - request.pos));
+		}
+
+		if (not pImpl->isOpen())
+		{
+			for (size_t i = 0; i < requests.size(); ++i)
+			{
+				onComplete(i, Blob{});
+			}
+
+			return;
+		}
+
+		pImpl->readAsync(std::move(requests), std::move(onComplete));
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	path
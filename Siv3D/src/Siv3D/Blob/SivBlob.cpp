@@ -29,9 +29,38 @@ namespace s3d
 	}
 
 	Blob::Blob(IReader& reader)
-		: m_data(reader.size())
 	{
-		reader.read(m_data.data(), m_data.size_bytes());
+		const int64 size = reader.size();
+
+		if (0 <= size)
+		{
+			m_data.resize(static_cast<size_t>(size));
+
+			reader.read(m_data.data(), m_data.size_bytes());
+
+			return;
+		}
+
+		// サイズが不明な場合は、read() が 0 を返すまで読み込む
+		constexpr size_t ChunkSize = (64 * 1024);
+
+		size_t end = 0;
+
+		for (;;)
+		{
+			m_data.resize(end + ChunkSize);
+
+			const int64 readBytes = reader.read((m_data.data() + end), static_cast<int64>(ChunkSize));
+
+			if (readBytes <= 0)
+			{
+				break;
+			}
+
+			end += static_cast<size_t>(readBytes);
+		}
+
+		m_data.resize(end);
 	}
 		
 	////////////////////////////////////////////////////////////////
@@ -0,0 +1,999 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <algorithm>
+# include <Siv3D/Threading.hpp>
+# include "BroadPhase2DDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief findPairs() の Sort and Sweep で 1 つのタスクが担当する図形の最小数
+		constexpr size_t PairGrainSize = 256;
+
+		/// @brief intersects() で 1 つのタスクが担当する図形の最小数
+		constexpr size_t QueryGrainSize = 32;
+
+		/// @brief findPairs() で、ツリーの走査をスレッドあたりいくつのタスクに分割するか
+		constexpr size_t TasksPerThread = 8;
+
+		/// @brief findPairs() で、タスクに分割するときにたどるツリーの最大の深さ
+		constexpr size_t MaxTaskSplitDepth = 16;
+
+		/// @brief Sort and Sweep の挿入ソートで許容する要素の移動回数（要素数に対する倍率）。これを超えた場合は std::sort で並べ直します。
+		constexpr size_t MaxInsertionShiftFactor = 8;
+
+		template <class Box>
+		[[nodiscard]]
+		static Box GetBox(const BroadPhaseShape& shape)
+		{
+			return std::visit([](const auto& s)
+				{
+					if constexpr (std::is_same_v<std::decay_t<decltype(s)>, RectF>)
+					{
+						return Box{ s.pos, s.br() };
+					}
+					else
+					{
+						const RectF rect = s.boundingRect();
+						return Box{ rect.pos, rect.br() };
+					}
+				}, shape);
+		}
+
+		template <class Box>
+		[[nodiscard]]
+		static constexpr Box Expand(const Box& box, const double margin) noexcept
+		{
+			return{ box.min.movedBy(-margin, -margin), box.max.movedBy(margin, margin) };
+		}
+
+		template <class Box>
+		[[nodiscard]]
+		static constexpr Box Union(const Box& a, const Box& b) noexcept
+		{
+			return{ { Min(a.min.x, b.min.x), Min(a.min.y, b.min.y) }, { Max(a.max.x, b.max.x), Max(a.max.y, b.max.y) } };
+		}
+
+		template <class Box>
+		[[nodiscard]]
+		static constexpr double Perimeter(const Box& box) noexcept
+		{
+			return (2.0 * ((box.max.x - box.min.x) + (box.max.y - box.min.y)));
+		}
+
+		template <class Box>
+		[[nodiscard]]
+		static constexpr bool Overlaps(const Box& a, const Box& b) noexcept
+		{
+			return ((a.min.x <= b.max.x) && (b.min.x <= a.max.x)
+				&& (a.min.y <= b.max.y) && (b.min.y <= a.max.y));
+		}
+
+		template <class Box>
+		[[nodiscard]]
+		static constexpr bool Contains(const Box& outer, const Box& inner) noexcept
+		{
+			return ((outer.min.x <= inner.min.x) && (inner.max.x <= outer.max.x)
+				&& (outer.min.y <= inner.min.y) && (inner.max.y <= outer.max.y));
+		}
+
+		[[nodiscard]]
+		static bool IntersectShapes(const BroadPhaseShape& a, const BroadPhaseShape& b)
+		{
+			return std::visit([](const auto& x, const auto& y) { return Geometry2D::Intersect(x, y); }, a, b);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhase2D::BroadPhase2DDetail::BroadPhase2DDetail(const BroadPhaseAlgorithm algorithm, const double margin)
+		: m_algorithm{ algorithm }
+		, m_margin{ Max(margin, 0.0) } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhase2D::IDType BroadPhase2D::BroadPhase2DDetail::add(BroadPhaseShape&& shape)
+	{
+		const Box box = GetBox<Box>(shape);
+
+		IDType id;
+
+		if (m_freeIDs)
+		{
+			id = m_freeIDs.back();
+			m_freeIDs.pop_back();
+		}
+		else
+		{
+			id = static_cast<IDType>(m_proxies.size());
+			m_proxies.emplace_back();
+		}
+
+		Proxy& proxy = m_proxies[id];
+		proxy.shape		= std::move(shape);
+		proxy.box		= box;
+		proxy.active	= true;
+		++m_size;
+
+		if (m_algorithm == BroadPhaseAlgorithm::AABBTree)
+		{
+			proxy.fatBox = Expand(box, m_margin);
+
+			const int32 node = allocateNode();
+			m_nodes[node].box		= proxy.fatBox;
+			m_nodes[node].id		= id;
+			m_nodes[node].height	= 0;
+			insertLeaf(node);
+
+			proxy.node = node;
+		}
+		else
+		{
+			proxy.fatBox = box;
+
+			m_sweepDirty = true;
+			m_sweepNeedsFullSort = true;
+		}
+
+		return id;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	update
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool BroadPhase2D::BroadPhase2DDetail::update(const IDType id, BroadPhaseShape&& shape)
+	{
+		if (not findProxy(id))
+		{
+			throw std::out_of_range{ "BroadPhase2D::update(): invalid id" };
+		}
+
+		Proxy& proxy = m_proxies[id];
+		const Box box = GetBox<Box>(shape);
+		const double previousMinX = proxy.box.min.x;
+
+		proxy.shape	= std::move(shape);
+		proxy.box	= box;
+
+		if (m_algorithm == BroadPhaseAlgorithm::AABBTree)
+		{
+			// 広げたバウンディングボックスの中で動いている間は、ツリーを更新しない
+			if (Contains(proxy.fatBox, box))
+			{
+				return false;
+			}
+
+			removeLeaf(proxy.node);
+
+			proxy.fatBox = Expand(box, m_margin);
+			m_nodes[proxy.node].box = proxy.fatBox;
+
+			insertLeaf(proxy.node);
+
+			return true;
+		}
+		else
+		{
+			proxy.fatBox = box;
+
+			if (box.min.x == previousMinX)
+			{
+				// 並び順は変わらないが、幅が広がった場合は探索の開始位置を左へずらす必要がある
+				m_sweepMaxWidth = Max(m_sweepMaxWidth, (box.max.x - box.min.x));
+				return false;
+			}
+
+			m_sweepDirty = true;
+
+			return true;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	remove
+	//
+	////////////////////////////////////////////////////////////////
+
+	void BroadPhase2D::BroadPhase2DDetail::remove(const IDType id)
+	{
+		if (not findProxy(id))
+		{
+			return;
+		}
+
+		Proxy& proxy = m_proxies[id];
+
+		if (m_algorithm == BroadPhaseAlgorithm::AABBTree)
+		{
+			removeLeaf(proxy.node);
+			freeNode(proxy.node);
+		}
+		else
+		{
+			m_sweepDirty = true;
+			m_sweepNeedsFullSort = true;
+		}
+
+		proxy = Proxy{};
+		m_freeIDs.push_back(id);
+		--m_size;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void BroadPhase2D::BroadPhase2DDetail::clear()
+	{
+		m_proxies.clear();
+		m_freeIDs.clear();
+		m_size = 0;
+
+		m_nodes.clear();
+		m_root = NullNode;
+		m_freeNode = NullNode;
+
+		m_sweepEntries.clear();
+		m_sweepMaxWidth = 0.0;
+		m_sweepDirty = false;
+		m_sweepNeedsFullSort = false;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	contains
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool BroadPhase2D::BroadPhase2DDetail::contains(const IDType id) const noexcept
+	{
+		return (findProxy(id) != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t BroadPhase2D::BroadPhase2DDetail::size() const noexcept
+	{
+		return m_size;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getAlgorithm
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhaseAlgorithm BroadPhase2D::BroadPhase2DDetail::getAlgorithm() const noexcept
+	{
+		return m_algorithm;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getShape
+	//
+	////////////////////////////////////////////////////////////////
+
+	const BroadPhaseShape& BroadPhase2D::BroadPhase2DDetail::getShape(const IDType id) const
+	{
+		if (const Proxy* proxy = findProxy(id))
+		{
+			return proxy->shape;
+		}
+
+		throw std::out_of_range{ "BroadPhase2D::getShape(): invalid id" };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	query
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<BroadPhase2D::IDType> BroadPhase2D::BroadPhase2DDetail::query(const RectF& region) const
+	{
+		prepareSweep();
+
+		const Box box{ region.pos, region.br() };
+
+		Array<IDType> results;
+		Array<int32> stack;
+
+		queryCandidates(box, stack, [&](const IDType id) { results.push_back(id); });
+
+		std::sort(results.begin(), results.end());
+
+		return results;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	intersects
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<BroadPhase2D::IDType> BroadPhase2D::BroadPhase2DDetail::intersects(const BroadPhaseShape& shape) const
+	{
+		prepareSweep();
+
+		Array<int32> stack;
+
+		return intersects(shape, stack);
+	}
+
+	Array<Array<BroadPhase2D::IDType>> BroadPhase2D::BroadPhase2DDetail::intersects(const std::span<const BroadPhaseShape> shapes) const
+	{
+		prepareSweep();
+
+		Array<Array<IDType>> results(shapes.size());
+
+		Threading::ParallelFor(0, shapes.size(), [&](const size_t begin, const size_t end)
+			{
+				Array<int32> stack;
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					results[i] = intersects(shapes[i], stack);
+				}
+			}, QueryGrainSize);
+
+		return results;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	findPairs
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<BroadPhase2D::IDPair> BroadPhase2D::BroadPhase2DDetail::findPairs(const bool narrowPhase) const
+	{
+		prepareSweep();
+
+		Array<IDPair> pairs;
+		std::mutex pairsMutex;
+
+		const auto report = [&](Array<IDPair>& localPairs, const Proxy& a, const Proxy& b, const IDType idA, const IDType idB)
+			{
+				if (not Overlaps(a.box, b.box))
+				{
+					return;
+				}
+
+				if (narrowPhase && (not IntersectShapes(a.shape, b.shape)))
+				{
+					return;
+				}
+
+				localPairs.emplace_back(Min(idA, idB), Max(idA, idB));
+			};
+
+		const auto merge = [&](Array<IDPair>& localPairs)
+			{
+				if (localPairs)
+				{
+					std::lock_guard lock{ pairsMutex };
+					pairs.append(localPairs);
+				}
+			};
+
+		if (m_algorithm == BroadPhaseAlgorithm::AABBTree)
+		{
+			// 2 つの部分木を同時にたどり、バウンディングボックスが重なる葉の組を列挙する。
+			// 根に近い部分をタスクに分割してから、各タスクを並列に処理する
+			const Array<NodePair> tasks = makeTraversalTasks(Threading::GetConcurrency() * TasksPerThread);
+
+			Threading::ParallelFor(0, tasks.size(), [&](const size_t begin, const size_t end)
+				{
+					Array<IDPair> localPairs;
+					Array<NodePair> stack;
+
+					for (size_t i = begin; i < end; ++i)
+					{
+						traverseTree(tasks[i], stack, [&](const IDType a, const IDType b)
+							{
+								report(localPairs, m_proxies[a], m_proxies[b], a, b);
+							});
+					}
+
+					merge(localPairs);
+				}, 1);
+		}
+		else
+		{
+			const SweepEntry* entries = m_sweepEntries.data();
+			const size_t count = m_sweepEntries.size();
+
+			Threading::ParallelFor(0, count, [&](const size_t begin, const size_t end)
+				{
+					Array<IDPair> localPairs;
+
+					for (size_t i = begin; i < end; ++i)
+					{
+						const IDType id = entries[i].id;
+						const Proxy& proxy = m_proxies[id];
+
+						for (size_t k = (i + 1); (k < count) && (entries[k].minX <= proxy.box.max.x); ++k)
+						{
+							report(localPairs, proxy, m_proxies[entries[k].id], id, entries[k].id);
+						}
+					}
+
+					merge(localPairs);
+				}, PairGrainSize);
+		}
+
+		std::sort(pairs.begin(), pairs.end());
+
+		return pairs;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	const BroadPhase2D::BroadPhase2DDetail::Proxy* BroadPhase2D::BroadPhase2DDetail::findProxy(const IDType id) const noexcept
+	{
+		if ((m_proxies.size() <= id) || (not m_proxies[id].active))
+		{
+			return nullptr;
+		}
+
+		return &m_proxies[id];
+	}
+
+	Array<BroadPhase2D::IDType> BroadPhase2D::BroadPhase2DDetail::intersects(const BroadPhaseShape& shape, Array<int32>& stack) const
+	{
+		const Box box = GetBox<Box>(shape);
+
+		Array<IDType> results;
+
+		queryCandidates(box, stack, [&](const IDType id)
+			{
+				if (IntersectShapes(shape, m_proxies[id].shape))
+				{
+					results.push_back(id);
+				}
+			});
+
+		std::sort(results.begin(), results.end());
+
+		return results;
+	}
+
+	int32 BroadPhase2D::BroadPhase2DDetail::allocateNode()
+	{
+		if (m_freeNode == NullNode)
+		{
+			m_nodes.emplace_back();
+			return static_cast<int32>(m_nodes.size() - 1);
+		}
+
+		const int32 node = m_freeNode;
+		m_freeNode = m_nodes[node].parent;
+		m_nodes[node] = Node{};
+
+		return node;
+	}
+
+	void BroadPhase2D::BroadPhase2DDetail::freeNode(const int32 node) noexcept
+	{
+		m_nodes[node].parent = m_freeNode;
+		m_nodes[node].height = -1;
+		m_freeNode = node;
+	}
+
+	void BroadPhase2D::BroadPhase2DDetail::insertLeaf(const int32 leaf)
+	{
+		if (m_root == NullNode)
+		{
+			m_root = leaf;
+			m_nodes[leaf].parent = NullNode;
+			return;
+		}
+
+		// 表面積ヒューリスティックで、追加先の兄弟ノードを選ぶ
+		const Box leafBox = m_nodes[leaf].box;
+		int32 index = m_root;
+
+		while (not m_nodes[index].isLeaf())
+		{
+			const Node& node = m_nodes[index];
+			const double area = Perimeter(node.box);
+			const double combinedArea = Perimeter(Union(node.box, leafBox));
+
+			// このノードと葉をまとめた新しい親を作るコスト
+			const double cost = (2.0 * combinedArea);
+
+			// 葉をさらに下に追加する場合に、このノードの大きさが増えるコスト
+			const double inheritanceCost = (2.0 * (combinedArea - area));
+
+			const auto descendCost = [&](const int32 child)
+				{
+					const Node& childNode = m_nodes[child];
+					const double newArea = Perimeter(Union(childNode.box, leafBox));
+					return ((childNode.isLeaf() ? newArea : (newArea - Perimeter(childNode.box))) + inheritanceCost);
+				};
+
+			const double cost1 = descendCost(node.child1);
+			const double cost2 = descendCost(node.child2);
+
+			if ((cost < cost1) && (cost < cost2))
+			{
+				break;
+			}
+
+			index = ((cost1 < cost2) ? node.child1 : node.child2);
+		}
+
+		const int32 sibling = index;
+		const int32 oldParent = m_nodes[sibling].parent;
+		const int32 newParent = allocateNode();
+
+		{
+			Node& parentNode = m_nodes[newParent];
+			parentNode.parent	= oldParent;
+			parentNode.box		= Union(leafBox, m_nodes[sibling].box);
+			parentNode.height	= (m_nodes[sibling].height + 1);
+			parentNode.child1	= sibling;
+			parentNode.child2	= leaf;
+		}
+
+		if (oldParent != NullNode)
+		{
+			if (m_nodes[oldParent].child1 == sibling)
+			{
+				m_nodes[oldParent].child1 = newParent;
+			}
+			else
+			{
+				m_nodes[oldParent].child2 = newParent;
+			}
+		}
+		else
+		{
+			m_root = newParent;
+		}
+
+		m_nodes[sibling].parent = newParent;
+		m_nodes[leaf].parent = newParent;
+
+		// 祖先のバウンディングボックスと高さを更新する
+		for (index = m_nodes[leaf].parent; index != NullNode; index = m_nodes[index].parent)
+		{
+			index = balance(index);
+
+			Node& node = m_nodes[index];
+			node.height	= (1 + Max(m_nodes[node.child1].height, m_nodes[node.child2].height));
+			node.box	= Union(m_nodes[node.child1].box, m_nodes[node.child2].box);
+		}
+	}
+
+	void BroadPhase2D::BroadPhase2DDetail::removeLeaf(const int32 leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = NullNode;
+			return;
+		}
+
+		const int32 parent = m_nodes[leaf].parent;
+		const int32 grandParent = m_nodes[parent].parent;
+		const int32 sibling = ((m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1);
+
+		if (grandParent == NullNode)
+		{
+			m_root = sibling;
+			m_nodes[sibling].parent = NullNode;
+			freeNode(parent);
+			return;
+		}
+
+		if (m_nodes[grandParent].child1 == parent)
+		{
+			m_nodes[grandParent].child1 = sibling;
+		}
+		else
+		{
+			m_nodes[grandParent].child2 = sibling;
+		}
+
+		m_nodes[sibling].parent = grandParent;
+		freeNode(parent);
+
+		for (int32 index = grandParent; index != NullNode; index = m_nodes[index].parent)
+		{
+			index = balance(index);
+
+			Node& node = m_nodes[index];
+			node.height	= (1 + Max(m_nodes[node.child1].height, m_nodes[node.child2].height));
+			node.box	= Union(m_nodes[node.child1].box, m_nodes[node.child2].box);
+		}
+	}
+
+	int32 BroadPhase2D::BroadPhase2DDetail::balance(const int32 a)
+	{
+		Node& nodeA = m_nodes[a];
+
+		if (nodeA.isLeaf() || (nodeA.height < 2))
+		{
+			return a;
+		}
+
+		const int32 b = nodeA.child1;
+		const int32 c = nodeA.child2;
+		Node& nodeB = m_nodes[b];
+		Node& nodeC = m_nodes[c];
+
+		const auto replaceChild = [&](const int32 parent, const int32 from, const int32 to)
+			{
+				if (parent == NullNode)
+				{
+					m_root = to;
+				}
+				else if (m_nodes[parent].child1 == from)
+				{
+					m_nodes[parent].child1 = to;
+				}
+				else
+				{
+					m_nodes[parent].child2 = to;
+				}
+			};
+
+		const int32 balanceFactor = (nodeC.height - nodeB.height);
+
+		// C を持ち上げる
+		if (1 < balanceFactor)
+		{
+			const int32 f = nodeC.child1;
+			const int32 g = nodeC.child2;
+			Node& nodeF = m_nodes[f];
+			Node& nodeG = m_nodes[g];
+
+			nodeC.child1 = a;
+			nodeC.parent = nodeA.parent;
+			nodeA.parent = c;
+			replaceChild(nodeC.parent, a, c);
+
+			if (nodeG.height < nodeF.height)
+			{
+				nodeC.child2 = f;
+				nodeA.child2 = g;
+				nodeG.parent = a;
+				nodeA.box = Union(nodeB.box, nodeG.box);
+				nodeC.box = Union(nodeA.box, nodeF.box);
+				nodeA.height = (1 + Max(nodeB.height, nodeG.height));
+				nodeC.height = (1 + Max(nodeA.height, nodeF.height));
+			}
+			else
+			{
+				nodeC.child2 = g;
+				nodeA.child2 = f;
+				nodeF.parent = a;
+				nodeA.box = Union(nodeB.box, nodeF.box);
+				nodeC.box = Union(nodeA.box, nodeG.box);
+				nodeA.height = (1 + Max(nodeB.height, nodeF.height));
+				nodeC.height = (1 + Max(nodeA.height, nodeG.height));
+			}
+
+			return c;
+		}
+
+		// B を持ち上げる
+		if (balanceFactor < -1)
+		{
+			const int32 d = nodeB.child1;
+			const int32 e = nodeB.child2;
+			Node& nodeD = m_nodes[d];
+			Node& nodeE = m_nodes[e];
+
+			nodeB.child1 = a;
+			nodeB.parent = nodeA.parent;
+			nodeA.parent = b;
+			replaceChild(nodeB.parent, a, b);
+
+			if (nodeE.height < nodeD.height)
+			{
+				nodeB.child2 = d;
+				nodeA.child1 = e;
+				nodeE.parent = a;
+				nodeA.box = Union(nodeC.box, nodeE.box);
+				nodeB.box = Union(nodeA.box, nodeD.box);
+				nodeA.height = (1 + Max(nodeC.height, nodeE.height));
+				nodeB.height = (1 + Max(nodeA.height, nodeD.height));
+			}
+			else
+			{
+				nodeB.child2 = e;
+				nodeA.child1 = d;
+				nodeD.parent = a;
+				nodeA.box = Union(nodeC.box, nodeD.box);
+				nodeB.box = Union(nodeA.box, nodeE.box);
+				nodeA.height = (1 + Max(nodeC.height, nodeD.height));
+				nodeB.height = (1 + Max(nodeA.height, nodeE.height));
+			}
+
+			return b;
+		}
+
+		return a;
+	}
+
+	bool BroadPhase2D::BroadPhase2DDetail::splitNodePair(const NodePair& pair, Array<NodePair>& out) const
+	{
+		const auto [a, b] = pair;
+		const Node& nodeA = m_nodes[a];
+
+		// 同じ部分木の中どうし
+		if (a == b)
+		{
+			if (not nodeA.isLeaf())
+			{
+				out.emplace_back(nodeA.child1, nodeA.child1);
+				out.emplace_back(nodeA.child2, nodeA.child2);
+				out.emplace_back(nodeA.child1, nodeA.child2);
+			}
+
+			return false;
+		}
+
+		const Node& nodeB = m_nodes[b];
+
+		if (not Overlaps(nodeA.box, nodeB.box))
+		{
+			return false;
+		}
+
+		if (nodeA.isLeaf() && nodeB.isLeaf())
+		{
+			return true;
+		}
+
+		// 大きいほうのノードを分割する
+		if (nodeB.isLeaf() || ((not nodeA.isLeaf()) && (Perimeter(nodeB.box) <= Perimeter(nodeA.box))))
+		{
+			out.emplace_back(nodeA.child1, b);
+			out.emplace_back(nodeA.child2, b);
+		}
+		else
+		{
+			out.emplace_back(a, nodeB.child1);
+			out.emplace_back(a, nodeB.child2);
+		}
+
+		return false;
+	}
+
+	Array<BroadPhase2D::BroadPhase2DDetail::NodePair> BroadPhase2D::BroadPhase2DDetail::makeTraversalTasks(const size_t minTasks) const
+	{
+		Array<NodePair> tasks;
+
+		if (m_root == NullNode)
+		{
+			return tasks;
+		}
+
+		tasks.emplace_back(m_root, m_root);
+
+		Array<NodePair> next;
+
+		for (size_t i = 0; (i < MaxTaskSplitDepth) && (tasks.size() < minTasks); ++i)
+		{
+			next.clear();
+
+			for (const auto& task : tasks)
+			{
+				if (splitNodePair(task, next))
+				{
+					next.push_back(task);
+				}
+			}
+
+			tasks.swap(next);
+		}
+
+		return tasks;
+	}
+
+	template <class Callback>
+	void BroadPhase2D::BroadPhase2DDetail::traverseTree(const NodePair& task, Array<NodePair>& stack, Callback callback) const
+	{
+		stack.clear();
+		stack.push_back(task);
+
+		while (stack)
+		{
+			const NodePair pair = stack.back();
+			stack.pop_back();
+
+			if (splitNodePair(pair, stack))
+			{
+				callback(m_nodes[pair.first].id, m_nodes[pair.second].id);
+			}
+		}
+	}
+
+	template <class Callback>
+	void BroadPhase2D::BroadPhase2DDetail::queryTree(const Box& box, Array<int32>& stack, Callback callback) const
+	{
+		if (m_root == NullNode)
+		{
+			return;
+		}
+
+		stack.clear();
+		stack.push_back(m_root);
+
+		while (stack)
+		{
+			const Node& node = m_nodes[stack.back()];
+			stack.pop_back();
+
+			if (not Overlaps(node.box, box))
+			{
+				continue;
+			}
+
+			if (node.isLeaf())
+			{
+				callback(node.id);
+			}
+			else
+			{
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+		}
+	}
+
+	void BroadPhase2D::BroadPhase2DDetail::prepareSweep() const
+	{
+		if (m_algorithm != BroadPhaseAlgorithm::SortAndSweep)
+		{
+			return;
+		}
+
+		std::lock_guard lock{ m_sweepMutex };
+
+		if (not m_sweepDirty)
+		{
+			return;
+		}
+
+		m_sweepDirty = false;
+
+		const auto byMinX = [](const SweepEntry& a, const SweepEntry& b)
+			{
+				return ((a.minX < b.minX) || ((a.minX == b.minX) && (a.id < b.id)));
+			};
+
+		if (m_sweepNeedsFullSort)
+		{
+			m_sweepNeedsFullSort = false;
+
+			m_sweepEntries.clear();
+			m_sweepEntries.reserve(m_size);
+			m_sweepMaxWidth = 0.0;
+
+			for (size_t i = 0; i < m_proxies.size(); ++i)
+			{
+				if (m_proxies[i].active)
+				{
+					const Box& box = m_proxies[i].box;
+					m_sweepEntries.push_back({ box.min.x, static_cast<IDType>(i) });
+					m_sweepMaxWidth = Max(m_sweepMaxWidth, (box.max.x - box.min.x));
+				}
+			}
+
+			std::sort(m_sweepEntries.begin(), m_sweepEntries.end(), byMinX);
+
+			return;
+		}
+
+		m_sweepMaxWidth = 0.0;
+
+		for (auto& entry : m_sweepEntries)
+		{
+			const Box& box = m_proxies[entry.id].box;
+			entry.minX = box.min.x;
+			m_sweepMaxWidth = Max(m_sweepMaxWidth, (box.max.x - box.min.x));
+		}
+
+		// 前回の並び順からの変化は小さいことが多いため、挿入ソートで並べ直す
+		const size_t maxShifts = (m_sweepEntries.size() * MaxInsertionShiftFactor);
+		size_t shifts = 0;
+
+		for (size_t i = 1; i < m_sweepEntries.size(); ++i)
+		{
+			const SweepEntry entry = m_sweepEntries[i];
+			size_t k = i;
+
+			while ((0 < k) && byMinX(entry, m_sweepEntries[k - 1]))
+			{
+				m_sweepEntries[k] = m_sweepEntries[k - 1];
+				--k;
+			}
+
+			m_sweepEntries[k] = entry;
+
+			if (maxShifts < (shifts += (i - k)))
+			{
+				std::sort(m_sweepEntries.begin(), m_sweepEntries.end(), byMinX);
+				break;
+			}
+		}
+	}
+
+	template <class Callback>
+	void BroadPhase2D::BroadPhase2DDetail::querySweep(const Box& box, Callback callback) const
+	{
+		// 最も幅の広い図形でも box に届かない位置より左にある図形は重ならないため、二分探索で読み飛ばす
+		const double firstMinX = (box.min.x - m_sweepMaxWidth);
+
+		const auto first = std::lower_bound(m_sweepEntries.begin(), m_sweepEntries.end(), firstMinX,
+			[](const SweepEntry& entry, const double x) { return (entry.minX < x); });
+
+		for (auto it = first; it != m_sweepEntries.end(); ++it)
+		{
+			if (box.max.x < it->minX)
+			{
+				break;
+			}
+
+			if (Overlaps(m_proxies[it->id].box, box))
+			{
+				callback(it->id);
+			}
+		}
+	}
+
+	template <class Callback>
+	void BroadPhase2D::BroadPhase2DDetail::queryCandidates(const Box& box, Array<int32>& stack, Callback callback) const
+	{
+		if (m_algorithm == BroadPhaseAlgorithm::AABBTree)
+		{
+			queryTree(box, stack, [&](const IDType id)
+				{
+					if (Overlaps(m_proxies[id].box, box))
+					{
+						callback(id);
+					}
+				});
+		}
+		else
+		{
+			querySweep(box, callback);
+		}
+	}
+}
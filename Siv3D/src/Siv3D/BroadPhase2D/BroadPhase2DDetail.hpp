@@ -0,0 +1,201 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <mutex>
+# include <Siv3D/BroadPhase2D.hpp>
+
+namespace s3d
+{
+	class BroadPhase2D::BroadPhase2DDetail
+	{
+	public:
+
+		[[nodiscard]]
+		BroadPhase2DDetail(BroadPhaseAlgorithm algorithm, double margin);
+
+		IDType add(BroadPhaseShape&& shape);
+
+		bool update(IDType id, BroadPhaseShape&& shape);
+
+		void remove(IDType id);
+
+		void clear();
+
+		[[nodiscard]]
+		bool contains(IDType id) const noexcept;
+
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		[[nodiscard]]
+		BroadPhaseAlgorithm getAlgorithm() const noexcept;
+
+		[[nodiscard]]
+		const BroadPhaseShape& getShape(IDType id) const;
+
+		[[nodiscard]]
+		Array<IDType> query(const RectF& region) const;
+
+		[[nodiscard]]
+		Array<IDType> intersects(const BroadPhaseShape& shape) const;
+
+		[[nodiscard]]
+		Array<Array<IDType>> intersects(std::span<const BroadPhaseShape> shapes) const;
+
+		[[nodiscard]]
+		Array<IDPair> findPairs(bool narrowPhase) const;
+
+	private:
+
+		static constexpr int32 NullNode = -1;
+
+		/// @brief 軸に平行なバウンディングボックス
+		struct Box
+		{
+			Vec2 min;
+
+			Vec2 max;
+		};
+
+		struct Proxy
+		{
+			BroadPhaseShape shape;
+
+			/// @brief 図形のバウンディングボックス
+			Box box;
+
+			/// @brief ツリーに登録したバウンディングボックス（AABBTree の場合は margin だけ広げたもの）
+			Box fatBox;
+
+			/// @brief ツリーの葉ノードのインデックス
+			int32 node = NullNode;
+
+			bool active = false;
+		};
+
+		/// @brief AABB ツリーのノード
+		struct Node
+		{
+			Box box;
+
+			/// @brief 親ノード（未使用ノードの場合は、次の未使用ノード）
+			int32 parent = NullNode;
+
+			int32 child1 = NullNode;
+
+			int32 child2 = NullNode;
+
+			/// @brief 葉ノードの場合 0, 未使用ノードの場合 -1
+			int32 height = 0;
+
+			/// @brief 葉ノードの図形の ID
+			IDType id = 0;
+
+			[[nodiscard]]
+			bool isLeaf() const noexcept
+			{
+				return (child1 == NullNode);
+			}
+		};
+
+		/// @brief 同時にたどるノードの組
+		using NodePair = std::pair<int32, int32>;
+
+		/// @brief Sort and Sweep 用の要素
+		struct SweepEntry
+		{
+			double minX;
+
+			IDType id;
+		};
+
+		BroadPhaseAlgorithm m_algorithm = BroadPhaseAlgorithm::AABBTree;
+
+		double m_margin = 0.0;
+
+		Array<Proxy> m_proxies;
+
+		Array<IDType> m_freeIDs;
+
+		size_t m_size = 0;
+
+		// AABBTree
+
+		Array<Node> m_nodes;
+
+		int32 m_root = NullNode;
+
+		int32 m_freeNode = NullNode;
+
+		// SortAndSweep
+
+		/// @brief X 座標の最小値の順に並べた図形（クエリ時に並べ直す）
+		mutable Array<SweepEntry> m_sweepEntries;
+
+		/// @brief m_sweepEntries の図形のバウンディングボックスの幅の最大値
+		mutable double m_sweepMaxWidth = 0.0;
+
+		/// @brief m_sweepEntries を並べ直す必要があるか
+		mutable bool m_sweepDirty = false;
+
+		/// @brief 前回並べ直してから、削除や大きな移動によって並び順が大きく崩れたか
+		mutable bool m_sweepNeedsFullSort = false;
+
+		mutable std::mutex m_sweepMutex;
+
+		[[nodiscard]]
+		const Proxy* findProxy(IDType id) const noexcept;
+
+		[[nodiscard]]
+		Array<IDType> intersects(const BroadPhaseShape& shape, Array<int32>& stack) const;
+
+		// AABBTree
+
+		[[nodiscard]]
+		int32 allocateNode();
+
+		void freeNode(int32 node) noexcept;
+
+		void insertLeaf(int32 leaf);
+
+		void removeLeaf(int32 leaf);
+
+		[[nodiscard]]
+		int32 balance(int32 a);
+
+		template <class Callback>
+		void queryTree(const Box& box, Array<int32>& stack, Callback callback) const;
+
+		/// @brief 走査するノードの組を 1 段階分割します。
+		/// @param pair ノードの組。同じノードの組は、その部分木の中どうしを表します。
+		/// @param out 分割した組の追加先
+		/// @return 葉どうしの組で、バウンディングボックスが重なる場合 true
+		[[nodiscard]]
+		bool splitNodePair(const NodePair& pair, Array<NodePair>& out) const;
+
+		[[nodiscard]]
+		Array<NodePair> makeTraversalTasks(size_t minTasks) const;
+
+		template <class Callback>
+		void traverseTree(const NodePair& task, Array<NodePair>& stack, Callback callback) const;
+
+		// SortAndSweep
+
+		void prepareSweep() const;
+
+		template <class Callback>
+		void querySweep(const Box& box, Callback callback) const;
+
+		template <class Callback>
+		void queryCandidates(const Box& box, Array<int32>& stack, Callback callback) const;
+	};
+}
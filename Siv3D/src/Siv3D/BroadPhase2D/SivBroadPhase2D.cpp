@@ -0,0 +1,188 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/BroadPhase2D.hpp>
+# include "BroadPhase2DDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhase2D::BroadPhase2D()
+		: pImpl{ std::make_unique<BroadPhase2DDetail>(BroadPhaseAlgorithm::AABBTree, 4.0) } {}
+
+	BroadPhase2D::BroadPhase2D(const BroadPhaseAlgorithm algorithm, const double margin)
+		: pImpl{ std::make_unique<BroadPhase2DDetail>(algorithm, margin) } {}
+
+	BroadPhase2D::BroadPhase2D(BroadPhase2D&& other) noexcept
+		: pImpl{ std::exchange(other.pImpl, std::make_unique<BroadPhase2DDetail>(other.pImpl->getAlgorithm(), 4.0)) } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhase2D::~BroadPhase2D() {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator =
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhase2D& BroadPhase2D::operator =(BroadPhase2D&& other) noexcept
+	{
+		pImpl.swap(other.pImpl);
+		other.pImpl->clear();
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhase2D::IDType BroadPhase2D::add(BroadPhaseShape shape)
+	{
+		return pImpl->add(std::move(shape));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	update
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool BroadPhase2D::update(const IDType id, BroadPhaseShape shape)
+	{
+		return pImpl->update(id, std::move(shape));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	remove
+	//
+	////////////////////////////////////////////////////////////////
+
+	void BroadPhase2D::remove(const IDType id)
+	{
+		pImpl->remove(id);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void BroadPhase2D::clear()
+	{
+		pImpl->clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	contains
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool BroadPhase2D::contains(const IDType id) const noexcept
+	{
+		return pImpl->contains(id);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size, isEmpty
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t BroadPhase2D::size() const noexcept
+	{
+		return pImpl->size();
+	}
+
+	bool BroadPhase2D::isEmpty() const noexcept
+	{
+		return (pImpl->size() == 0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getAlgorithm
+	//
+	////////////////////////////////////////////////////////////////
+
+	BroadPhaseAlgorithm BroadPhase2D::getAlgorithm() const noexcept
+	{
+		return pImpl->getAlgorithm();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getShape
+	//
+	////////////////////////////////////////////////////////////////
+
+	const BroadPhaseShape& BroadPhase2D::getShape(const IDType id) const
+	{
+		return pImpl->getShape(id);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	query
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<BroadPhase2D::IDType> BroadPhase2D::query(const RectF& region) const
+	{
+		return pImpl->query(region);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	intersects
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<BroadPhase2D::IDType> BroadPhase2D::intersects(const BroadPhaseShape& shape) const
+	{
+		return pImpl->intersects(shape);
+	}
+
+	Array<Array<BroadPhase2D::IDType>> BroadPhase2D::intersects(const std::span<const BroadPhaseShape> shapes) const
+	{
+		return pImpl->intersects(shapes);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	findPairs
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<BroadPhase2D::IDPair> BroadPhase2D::findPairs() const
+	{
+		return pImpl->findPairs(true);
+	}
+
+	Array<BroadPhase2D::IDPair> BroadPhase2D::findCandidatePairs() const
+	{
+		return pImpl->findPairs(false);
+	}
+}
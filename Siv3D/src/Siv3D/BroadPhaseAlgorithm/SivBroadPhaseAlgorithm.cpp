@@ -0,0 +1,38 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <array>
+# include <Siv3D/BroadPhaseAlgorithm.hpp>
+# include <Siv3D/StringView.hpp>
+# include <Siv3D/FormatData.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		static constexpr std::array BroadPhaseAlgorithmStrings =
+		{
+			U"AABBTree"_sv,
+			U"SortAndSweep"_sv,
+		};
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, const BroadPhaseAlgorithm value)
+	{
+		formatData.string.append(BroadPhaseAlgorithmStrings[FromEnum(value)]);
+	}
+}
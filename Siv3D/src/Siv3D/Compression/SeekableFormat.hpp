@@ -0,0 +1,62 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	/// @brief Zstandard seekable format の定数
+	/// @remark 圧縮されたフレームの後に、各フレームのサイズを記録したスキップ可能フレーム（シークテーブル）が続きます。
+	/// [Skippable Magic (4)][Frame Size (4)][Entry (8 or 12) * numFrames][Number of Frames (4)][Descriptor (1)][Seekable Magic (4)]
+	namespace SeekableFormat
+	{
+		/// @brief スキップ可能フレームのマジックナンバー
+		inline constexpr uint32 SkippableMagicNumber = 0x184D2A5E;
+
+		/// @brief シークテーブルのフッタのマジックナンバー
+		inline constexpr uint32 SeekableMagicNumber = 0x8F92EAB1;
+
+		/// @brief スキップ可能フレームのヘッダのサイズ（バイト）
+		inline constexpr size_t SkippableHeaderSize = 8;
+
+		/// @brief シークテーブルのフッタのサイズ（バイト）
+		inline constexpr size_t FooterSize = 9;
+
+		/// @brief チェックサムを持たないエントリのサイズ（バイト）
+		inline constexpr size_t EntrySize = 8;
+
+		/// @brief チェックサムを持つエントリのサイズ（バイト）
+		inline constexpr size_t EntrySizeWithChecksum = 12;
+
+		/// @brief Descriptor のうち、チェックサムの有無を表すビット
+		inline constexpr uint8 ChecksumFlag = 0x80;
+
+		/// @brief Descriptor のうち、予約済みのビット
+		inline constexpr uint8 ReservedBits = 0x7C;
+
+		/// @brief 1 フレームの展開後の最大サイズ（バイト）
+		inline constexpr size_t MaxFrameSize = (1024 * 1024 * 1024);
+
+		/// @brief 最大のフレーム数
+		inline constexpr size_t MaxFrames = 0x8000000;
+
+		/// @brief シークテーブル全体（スキップ可能フレームのヘッダを含む）のサイズを返します。
+		/// @param numFrames フレーム数
+		/// @param entrySize エントリのサイズ（バイト）
+		/// @return シークテーブルのサイズ（バイト）
+		[[nodiscard]]
+		constexpr size_t GetSeekTableSize(const size_t numFrames, const size_t entrySize = EntrySize) noexcept
+		{
+			return (SkippableHeaderSize + (numFrames * entrySize) + FooterSize);
+		}
+	}
+}
@@ -9,10 +9,17 @@
 //
 //-----------------------------------------------
 
+# include <atomic>
 # include <Siv3D/Compression.hpp>
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/Decompressor.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/Compression/SeekableFormat.hpp>
 # include <ThirdParty/zstd/zstd.h>
+# include <ThirdParty/zstd/zdict.h>
 
 namespace s3d
 {
@@ -49,6 +56,49 @@ namespace s3d
 
 			return context;
 		}
+
+		/// @brief スレッドごとに再利用される圧縮コンテキスト
+		class ThreadLocalCompressionContext
+		{
+		public:
+
+			ThreadLocalCompressionContext()
+				: m_context{ ZSTD_createCCtx() } {}
+
+			~ThreadLocalCompressionContext()
+			{
+				ZSTD_freeCCtx(m_context);
+			}
+
+			[[nodiscard]]
+			ZSTD_CCtx* get() const noexcept
+			{
+				return m_context;
+			}
+
+		private:
+
+			ZSTD_CCtx* m_context = nullptr;
+		};
+
+		[[nodiscard]]
+		static ZSTD_CCtx* GetThreadLocalCompressionContext()
+		{
+			thread_local ThreadLocalCompressionContext context;
+			return context.get();
+		}
+
+		[[nodiscard]]
+		static Decompressor& GetThreadLocalDecompressor()
+		{
+			thread_local Decompressor decompressor;
+			return decompressor;
+		}
+
+		static void AppendUInt32(Blob& blob, const uint32 value)
+		{
+			blob.append(&value, sizeof(value));
+		}
 	}
 
 	namespace Compression
@@ -79,8 +129,16 @@ namespace s3d
 				dst.resize(bufferSize);
 			}
 
-			// 圧縮し、結果をバッファに書き込む
-			const size_t result = ZSTD_compress(dst.data(), dst.size(), data, size, compressionLevel);
+			// 圧縮し、結果をバッファに書き込む（コンテキストはスレッドごとに再利用する）
+			const size_t result = [&]()
+			{
+				if (ZSTD_CCtx* const context = GetThreadLocalCompressionContext())
+				{
+					return ZSTD_compressCCtx(context, dst.data(), dst.size(), data, size, compressionLevel);
+				}
+
+				return ZSTD_compress(dst.data(), dst.size(), data, size, compressionLevel);
+			}();
 
 			// エラーが発生した場合、バッファをクリアして false を返す
 			if (ZSTD_isError(result))
@@ -373,47 +431,8 @@ namespace s3d
 
 		bool Decompress(const void* data, const size_t size, Blob& dst)
 		{
-			// バッファの作成
-			const size_t InputBufferSize = ZSTD_CStreamInSize();
-			const size_t OutputBufferSize = ZSTD_CStreamOutSize();
-			const auto outputBuffer = std::make_unique_for_overwrite<Byte[]>(OutputBufferSize);
-
-			// コンテキストの作成
-			ZSTD_DCtx* const context = ZSTD_createDCtx();
-			{
-				if (not context)
-				{
-					return false;
-				}
-			}
-
-			size_t readPos = 0;
-
-			while (size_t read = Min(InputBufferSize, (size - readPos)))
-			{
-				ZSTD_inBuffer input = { (static_cast<const Byte*>(data) + readPos), read, 0 };
-
-				readPos += read;
-
-				while (input.pos < input.size)
-				{
-					ZSTD_outBuffer output = { outputBuffer.get(), OutputBufferSize, 0};
-					size_t const result = ZSTD_decompressStream(context, &output, &input);
-					
-					if (ZSTD_isError(result))
-					{
-						ZSTD_freeDCtx(context);
-						dst.clear();
-						return false;
-					}
-
-					dst.append(outputBuffer.get(), output.pos);
-				}
-			}
-
-			ZSTD_freeDCtx(context);
-
-			return true;
+			// 展開コンテキストはスレッドごとに再利用する
+			return GetThreadLocalDecompressor().decompress(data, size, dst);
 		}
 
 		Blob Decompress(const Blob& blob)
@@ -625,5 +644,179 @@ namespace s3d
 
 			return true;
 		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	TrainDictionary
+		//
+		////////////////////////////////////////////////////////////////
+
+		Blob TrainDictionary(const Array<Blob>& samples, const size_t dictionaryCapacity)
+		{
+			Array<size_t> sampleSizes(Arg::reserve = samples.size());
+			size_t totalSize = 0;
+
+			for (const auto& sample : samples)
+			{
+				sampleSizes << sample.size();
+				totalSize += sample.size();
+			}
+
+			// サンプルを 1 つのバッファに連結する
+			Blob buffer(Arg::reserve = totalSize);
+
+			for (const auto& sample : samples)
+			{
+				buffer.append(sample);
+			}
+
+			return TrainDictionary(buffer.data(), sampleSizes, dictionaryCapacity);
+		}
+
+		Blob TrainDictionary(const void* samples, const Array<size_t>& sampleSizes, const size_t dictionaryCapacity)
+		{
+			if (sampleSizes.isEmpty() || (dictionaryCapacity == 0))
+			{
+				return{};
+			}
+
+			Blob dictionary;
+			dictionary.resize(dictionaryCapacity);
+
+			const size_t result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+				samples, sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+
+			if (ZDICT_isError(result))
+			{
+				LOG_FAIL(fmt::format("❌ Compression::TrainDictionary(): {}", ZDICT_getErrorName(result)));
+				return{};
+			}
+
+			dictionary.resize(result);
+
+			return dictionary;
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	CompressSeekable
+		//
+		////////////////////////////////////////////////////////////////
+
+		Blob CompressSeekable(const void* data, const size_t size, const int32 compressionLevel, const size_t frameSize)
+		{
+			Blob blob;
+
+			if (not CompressSeekable(data, size, blob, compressionLevel, frameSize))
+			{
+				return{};
+			}
+
+			return blob;
+		}
+
+		bool CompressSeekable(const void* data, const size_t size, Blob& dst, const int32 compressionLevel, size_t frameSize)
+		{
+			dst.clear();
+
+			frameSize = Clamp<size_t>(frameSize, 1, SeekableFormat::MaxFrameSize);
+
+			const size_t numFrames = ((size + frameSize - 1) / frameSize);
+
+			if (SeekableFormat::MaxFrames < numFrames)
+			{
+				return false;
+			}
+
+			// 各フレームを独立に並列で圧縮する（圧縮コンテキストはワーカースレッドごとに再利用される）
+			Array<Blob> frames(numFrames);
+			std::atomic<bool> failed{ false };
+
+			Threading::ParallelFor(0, numFrames, [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					const size_t offset = (i * frameSize);
+
+					if (not Compress((static_cast<const Byte*>(data) + offset), Min(frameSize, (size - offset)), frames[i], compressionLevel))
+					{
+						failed = true;
+					}
+				}
+			}, 1);
+
+			if (failed)
+			{
+				return false;
+			}
+
+			// フレームを連結する
+			{
+				size_t totalSize = SeekableFormat::GetSeekTableSize(numFrames);
+
+				for (const auto& frame : frames)
+				{
+					totalSize += frame.size();
+				}
+
+				dst.reserve(totalSize);
+
+				for (const auto& frame : frames)
+				{
+					dst.append(frame);
+				}
+			}
+
+			// シークテーブルを付加する
+			{
+				AppendUInt32(dst, SeekableFormat::SkippableMagicNumber);
+				AppendUInt32(dst, static_cast<uint32>(SeekableFormat::GetSeekTableSize(numFrames) - SeekableFormat::SkippableHeaderSize));
+
+				for (size_t i = 0; i < numFrames; ++i)
+				{
+					AppendUInt32(dst, static_cast<uint32>(frames[i].size()));
+					AppendUInt32(dst, static_cast<uint32>(Min(frameSize, (size - i * frameSize))));
+				}
+
+				AppendUInt32(dst, static_cast<uint32>(numFrames));
+				dst.push_back(Byte{ 0 }); // チェックサム無し
+				AppendUInt32(dst, SeekableFormat::SeekableMagicNumber);
+			}
+
+			return true;
+		}
+
+		Blob CompressSeekable(const Blob& blob, const int32 compressionLevel, const size_t frameSize)
+		{
+			return CompressSeekable(blob.data(), blob.size(), compressionLevel, frameSize);
+		}
+
+		bool CompressSeekable(const Blob& blob, Blob& dst, const int32 compressionLevel, const size_t frameSize)
+		{
+			return CompressSeekable(blob.data(), blob.size(), dst, compressionLevel, frameSize);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	CompressSeekableToFile
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool CompressSeekableToFile(const void* data, const size_t size, const FilePathView outputPath, const int32 compressionLevel, const size_t frameSize)
+		{
+			Blob blob;
+
+			if (not CompressSeekable(data, size, blob, compressionLevel, frameSize))
+			{
+				return false;
+			}
+
+			return blob.save(outputPath);
+		}
+
+		bool CompressSeekableToFile(const Blob& blob, const FilePathView outputPath, const int32 compressionLevel, const size_t frameSize)
+		{
+			return CompressSeekableToFile(blob.data(), blob.size(), outputPath, compressionLevel, frameSize);
+		}
 	}
 }
@@ -0,0 +1,263 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "CompressionWriterDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompressionWriter::CompressionWriterDetail::~CompressionWriterDetail()
+	{
+		close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::CompressionWriterDetail::open(std::unique_ptr<IWriter>&& writer, const Blob* dictionary, const int32 compressionLevel)
+	{
+		close();
+
+		if ((not writer) || (not writer->isOpen()))
+		{
+			return false;
+		}
+
+		m_context = ZSTD_createCCtx();
+
+		if (not m_context)
+		{
+			return false;
+		}
+
+		if (ZSTD_isError(ZSTD_CCtx_setParameter(m_context, ZSTD_c_compressionLevel, compressionLevel))
+			|| (dictionary && ZSTD_isError(ZSTD_CCtx_loadDictionary(m_context, dictionary->data(), dictionary->size()))))
+		{
+			ZSTD_freeCCtx(m_context);
+			m_context = nullptr;
+			return false;
+		}
+
+		m_outputBufferSize = ZSTD_CStreamOutSize();
+		m_outputBuffer = std::make_unique_for_overwrite<Byte[]>(m_outputBufferSize);
+		m_writer = std::move(writer);
+		m_size = 0;
+		m_frameOpen = false;
+		m_hasFrame = false;
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::CompressionWriterDetail::close()
+	{
+		if (not m_context)
+		{
+			return false;
+		}
+
+		const bool result = finish();
+
+		reset();
+
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	release
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::unique_ptr<IWriter> CompressionWriter::CompressionWriterDetail::release()
+	{
+		if (not m_context)
+		{
+			return nullptr;
+		}
+
+		finish();
+
+		std::unique_ptr<IWriter> writer = std::move(m_writer);
+
+		reset();
+
+		return writer;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::CompressionWriterDetail::isOpen() const noexcept
+	{
+		return (m_context != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 CompressionWriter::CompressionWriterDetail::size() const noexcept
+	{
+		return m_size;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	write
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 CompressionWriter::CompressionWriterDetail::write(const void* src, const int64 sizeBytes)
+	{
+		if ((not m_context) || (sizeBytes <= 0))
+		{
+			return 0;
+		}
+
+		ZSTD_inBuffer input = { src, static_cast<size_t>(sizeBytes), 0 };
+
+		m_frameOpen = true;
+
+		if (not compressStream(input, ZSTD_e_continue))
+		{
+			return 0;
+		}
+
+		m_size += sizeBytes;
+
+		return sizeBytes;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::CompressionWriterDetail::flush()
+	{
+		if (not m_context)
+		{
+			return false;
+		}
+
+		ZSTD_inBuffer input = { nullptr, 0, 0 };
+
+		return compressStream(input, ZSTD_e_flush);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	finish
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::CompressionWriterDetail::finish()
+	{
+		if (not m_context)
+		{
+			return false;
+		}
+
+		// 何も書き込まれていない場合でも、展開できるように空のフレームを 1 つ書き出す
+		if ((not m_frameOpen) && m_hasFrame)
+		{
+			return true;
+		}
+
+		ZSTD_inBuffer input = { nullptr, 0, 0 };
+
+		if (not compressStream(input, ZSTD_e_end))
+		{
+			return false;
+		}
+
+		m_frameOpen = false;
+		m_hasFrame = true;
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	reset
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CompressionWriter::CompressionWriterDetail::reset()
+	{
+		ZSTD_freeCCtx(m_context);
+		m_context = nullptr;
+		m_outputBuffer.reset();
+		m_outputBufferSize = 0;
+		m_writer.reset();
+		m_frameOpen = false;
+		m_hasFrame = false;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	compressStream
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::CompressionWriterDetail::compressStream(ZSTD_inBuffer& input, const ZSTD_EndDirective mode)
+	{
+		for (;;)
+		{
+			ZSTD_outBuffer output = { m_outputBuffer.get(), m_outputBufferSize, 0 };
+
+			const size_t remaining = ZSTD_compressStream2(m_context, &output, &input, mode);
+
+			if (ZSTD_isError(remaining))
+			{
+				ZSTD_CCtx_reset(m_context, ZSTD_reset_session_only);
+				m_frameOpen = false;
+				return false;
+			}
+
+			if (output.pos)
+			{
+				if (m_writer->write(output.dst, static_cast<int64>(output.pos)) != static_cast<int64>(output.pos))
+				{
+					return false;
+				}
+			}
+
+			// ZSTD_e_continue では入力を消費し終えたら、それ以外では内部バッファが空になったら完了
+			const bool finished = ((mode == ZSTD_e_continue) ? (input.pos == input.size) : (remaining == 0));
+
+			if (finished)
+			{
+				return true;
+			}
+		}
+	}
+}
@@ -0,0 +1,70 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/CompressionWriter.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class CompressionWriter::CompressionWriterDetail
+	{
+	public:
+
+		CompressionWriterDetail() = default;
+
+		~CompressionWriterDetail();
+
+		bool open(std::unique_ptr<IWriter>&& writer, const Blob* dictionary, int32 compressionLevel);
+
+		bool close();
+
+		[[nodiscard]]
+		std::unique_ptr<IWriter> release();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		int64 size() const noexcept;
+
+		int64 write(const void* src, int64 sizeBytes);
+
+		bool flush();
+
+		bool finish();
+
+	private:
+
+		std::unique_ptr<IWriter> m_writer;
+
+		ZSTD_CCtx* m_context = nullptr;
+
+		std::unique_ptr<Byte[]> m_outputBuffer;
+
+		size_t m_outputBufferSize = 0;
+
+		/// @brief 書き込まれた圧縮前のデータのサイズ（バイト）
+		int64 m_size = 0;
+
+		/// @brief 終了していないフレームがあるか
+		bool m_frameOpen = false;
+
+		/// @brief 1 つ以上のフレームを書き出したか
+		bool m_hasFrame = false;
+
+		/// @brief フレームを終了せずにすべてのリソースを解放する
+		void reset();
+
+		/// @brief 入力を消費し終え、指定した方法でのフラッシュが完了するまで圧縮する
+		bool compressStream(ZSTD_inBuffer& input, ZSTD_EndDirective mode);
+	};
+}
@@ -0,0 +1,171 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/CompressionWriter.hpp>
+# include "CompressionWriterDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompressionWriter::CompressionWriter()
+		: pImpl{ std::make_shared<CompressionWriterDetail>() } {}
+
+	CompressionWriter::CompressionWriter(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel)
+		: CompressionWriter{}
+	{
+		open(std::move(writer), compressionLevel);
+	}
+
+	CompressionWriter::CompressionWriter(std::unique_ptr<IWriter>&& writer, const Blob& dictionary, const int32 compressionLevel)
+		: CompressionWriter{}
+	{
+		open(std::move(writer), dictionary, compressionLevel);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompressionWriter::~CompressionWriter() = default;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::open(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel)
+	{
+		return pImpl->open(std::move(writer), nullptr, compressionLevel);
+	}
+
+	bool CompressionWriter::open(std::unique_ptr<IWriter>&& writer, const Blob& dictionary, const int32 compressionLevel)
+	{
+		return pImpl->open(std::move(writer), &dictionary, compressionLevel);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::close()
+	{
+		return pImpl->close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	release
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::unique_ptr<IWriter> CompressionWriter::release()
+	{
+		return pImpl->release();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompressionWriter::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 CompressionWriter::size() const
+	{
+		return pImpl->size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 CompressionWriter::getPos() const
+	{
+		return pImpl->size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::setPos(const int64)
+	{
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	write
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 CompressionWriter::write(const void* src, const int64 sizeBytes)
+	{
+		return pImpl->write(src, sizeBytes);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::flush()
+	{
+		return pImpl->flush();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	finish
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompressionWriter::finish()
+	{
+		return pImpl->finish();
+	}
+}
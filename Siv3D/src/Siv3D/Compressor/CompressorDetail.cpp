@@ -0,0 +1,136 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "CompressorDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Compressor::CompressorDetail::CompressorDetail(const int32 compressionLevel)
+		: m_context{ ZSTD_createCCtx() }
+		, m_compressionLevel{ compressionLevel }
+	{
+		if (not m_context)
+		{
+			return;
+		}
+
+		if (ZSTD_isError(ZSTD_CCtx_setParameter(m_context, ZSTD_c_compressionLevel, compressionLevel)))
+		{
+			ZSTD_freeCCtx(m_context);
+			m_context = nullptr;
+		}
+	}
+
+	Compressor::CompressorDetail::CompressorDetail(const Blob& dictionary, const int32 compressionLevel)
+		: CompressorDetail{ compressionLevel }
+	{
+		if (not m_context)
+		{
+			return;
+		}
+
+		// 辞書の解析は 1 回だけ行い、以降の圧縮では参照するだけにする
+		m_dictionary = ZSTD_createCDict(dictionary.data(), dictionary.size(), compressionLevel);
+
+		if ((not m_dictionary)
+			|| ZSTD_isError(ZSTD_CCtx_refCDict(m_context, m_dictionary)))
+		{
+			ZSTD_freeCDict(m_dictionary);
+			m_dictionary = nullptr;
+			ZSTD_freeCCtx(m_context);
+			m_context = nullptr;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Compressor::CompressorDetail::~CompressorDetail()
+	{
+		// コンテキストが辞書を参照しているため、先にコンテキストを解放する
+		ZSTD_freeCCtx(m_context);
+		ZSTD_freeCDict(m_dictionary);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isValid
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Compressor::CompressorDetail::isValid() const noexcept
+	{
+		return (m_context != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	compressionLevel
+	//
+	////////////////////////////////////////////////////////////////
+
+	int32 Compressor::CompressorDetail::compressionLevel() const noexcept
+	{
+		return m_compressionLevel;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasDictionary
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Compressor::CompressorDetail::hasDictionary() const noexcept
+	{
+		return (m_dictionary != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	compress
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Compressor::CompressorDetail::compress(const void* data, const size_t size, Blob& dst)
+	{
+		if (not m_context)
+		{
+			dst.clear();
+			return false;
+		}
+
+		// バッファを圧縮後の最大サイズにリサイズする（容量は再利用される）
+		dst.resize(ZSTD_compressBound(size));
+
+		// 圧縮パラメータと辞書は保持したまま、新しいフレームとして圧縮する
+		const size_t result = ZSTD_compress2(m_context, dst.data(), dst.size(), data, size);
+
+		if (ZSTD_isError(result))
+		{
+			ZSTD_CCtx_reset(m_context, ZSTD_reset_session_only);
+			dst.clear();
+			return false;
+		}
+
+		dst.resize(result);
+
+		return true;
+	}
+}
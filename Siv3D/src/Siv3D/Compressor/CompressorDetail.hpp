@@ -0,0 +1,49 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Compressor.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class Compressor::CompressorDetail
+	{
+	public:
+
+		[[nodiscard]]
+		explicit CompressorDetail(int32 compressionLevel);
+
+		[[nodiscard]]
+		CompressorDetail(const Blob& dictionary, int32 compressionLevel);
+
+		~CompressorDetail();
+
+		[[nodiscard]]
+		bool isValid() const noexcept;
+
+		[[nodiscard]]
+		int32 compressionLevel() const noexcept;
+
+		[[nodiscard]]
+		bool hasDictionary() const noexcept;
+
+		bool compress(const void* data, size_t size, Blob& dst);
+
+	private:
+
+		ZSTD_CCtx* m_context = nullptr;
+
+		ZSTD_CDict* m_dictionary = nullptr;
+
+		int32 m_compressionLevel = Compression::DefaultLevel;
+	};
+}
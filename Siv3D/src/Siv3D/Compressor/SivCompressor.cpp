@@ -0,0 +1,108 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Compressor.hpp>
+# include "CompressorDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Compressor::Compressor()
+		: Compressor{ Compression::DefaultLevel } {}
+
+	Compressor::Compressor(const int32 compressionLevel)
+		: pImpl{ std::make_shared<CompressorDetail>(compressionLevel) } {}
+
+	Compressor::Compressor(const Blob& dictionary, const int32 compressionLevel)
+		: pImpl{ std::make_shared<CompressorDetail>(dictionary, compressionLevel) } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isValid
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Compressor::isValid() const noexcept
+	{
+		return pImpl->isValid();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	Compressor::operator bool() const noexcept
+	{
+		return pImpl->isValid();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	compressionLevel
+	//
+	////////////////////////////////////////////////////////////////
+
+	int32 Compressor::compressionLevel() const noexcept
+	{
+		return pImpl->compressionLevel();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasDictionary
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Compressor::hasDictionary() const noexcept
+	{
+		return pImpl->hasDictionary();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	compress
+	//
+	////////////////////////////////////////////////////////////////
+
+	Blob Compressor::compress(const void* data, const size_t size)
+	{
+		Blob blob;
+
+		if (not pImpl->compress(data, size, blob))
+		{
+			return{};
+		}
+
+		return blob;
+	}
+
+	bool Compressor::compress(const void* data, const size_t size, Blob& dst)
+	{
+		return pImpl->compress(data, size, dst);
+	}
+
+	Blob Compressor::compress(const Blob& blob)
+	{
+		return compress(blob.data(), blob.size());
+	}
+
+	bool Compressor::compress(const Blob& blob, Blob& dst)
+	{
+		return pImpl->compress(blob.data(), blob.size(), dst);
+	}
+}
@@ -0,0 +1,397 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "DecompressionReaderDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 読み飛ばしに使う一時バッファのサイズ（バイト）
+		constexpr size_t SkipBufferSize = (64 * 1024);
+
+		/// @brief ブロックヘッダのサイズ（バイト）
+		constexpr int64 BlockHeaderSize = 3;
+
+		/// @brief フレーム末尾のチェックサムのサイズ（バイト）
+		constexpr int64 ChecksumSize = 4;
+
+		/// @brief ブロックヘッダを読み込み、ブロックヘッダを含むブロック全体の圧縮後のサイズを返します。
+		/// @param reader 読み込み元
+		/// @param pos ブロックヘッダの位置
+		/// @param isLastBlock フレームの最後のブロックであるかの格納先
+		/// @return ブロック全体の圧縮後のサイズ（バイト）。ブロックヘッダが不正な場合は -1
+		[[nodiscard]]
+		static int64 ReadBlockSize(IReader& reader, const int64 pos, bool& isLastBlock)
+		{
+			uint8 header[BlockHeaderSize];
+
+			if (reader.read(header, pos, BlockHeaderSize) != BlockHeaderSize)
+			{
+				return -1;
+			}
+
+			const uint32 value = (header[0] | (header[1] << 8) | (header[2] << 16));
+			const uint32 blockType = ((value >> 1) & 0b11);
+			const int64 blockSize = (value >> 3);
+
+			isLastBlock = (value & 1);
+
+			switch (blockType)
+			{
+			case 0: // Raw_Block
+			case 2: // Compressed_Block
+				return (BlockHeaderSize + blockSize);
+			case 1: // RLE_Block
+				return (BlockHeaderSize + 1);
+			default: // Reserved
+				return -1;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	DecompressionReader::DecompressionReaderDetail::~DecompressionReaderDetail()
+	{
+		close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::DecompressionReaderDetail::open(std::unique_ptr<IReader>&& reader, const Blob* dictionary)
+	{
+		close();
+
+		if ((not reader) || (not reader->isOpen()))
+		{
+			return false;
+		}
+
+		m_context = ZSTD_createDCtx();
+
+		if (not m_context)
+		{
+			return false;
+		}
+
+		if (dictionary && ZSTD_isError(ZSTD_DCtx_loadDictionary(m_context, dictionary->data(), dictionary->size())))
+		{
+			ZSTD_freeDCtx(m_context);
+			m_context = nullptr;
+			return false;
+		}
+
+		m_reader = std::move(reader);
+		m_inputBuffer = std::make_unique_for_overwrite<Byte[]>(ZSTD_DStreamInSize());
+		m_input = { m_inputBuffer.get(), 0, 0 };
+		m_startPos = m_reader->getPos();
+		m_pos = 0;
+		m_hasError = false;
+		m_contentSize = scanContentSize();
+
+		// 走査で移動した読み込み位置を元に戻す
+		if (m_reader->setPos(m_startPos) != m_startPos)
+		{
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecompressionReader::DecompressionReaderDetail::close()
+	{
+		ZSTD_freeDCtx(m_context);
+		m_context = nullptr;
+		m_reader.reset();
+		m_inputBuffer.reset();
+		m_input = {};
+		m_startPos = 0;
+		m_pos = 0;
+		m_contentSize = -1;
+		m_hasError = false;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::DecompressionReaderDetail::isOpen() const noexcept
+	{
+		return (m_context != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::DecompressionReaderDetail::size() const noexcept
+	{
+		return m_contentSize;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::DecompressionReaderDetail::getPos() const noexcept
+	{
+		return m_pos;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::DecompressionReaderDetail::setPos(const int64 pos)
+	{
+		if ((not m_context) || (pos < 0))
+		{
+			return m_pos;
+		}
+
+		if (pos < m_pos)
+		{
+			if (not rewind())
+			{
+				return m_pos;
+			}
+		}
+
+		return skip(pos - m_pos);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	skip
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::DecompressionReaderDetail::skip(int64 offset)
+	{
+		if (offset < 0)
+		{
+			return setPos(m_pos + offset);
+		}
+
+		if ((not m_context) || (offset == 0))
+		{
+			return m_pos;
+		}
+
+		const auto buffer = std::make_unique_for_overwrite<Byte[]>(SkipBufferSize);
+
+		while (0 < offset)
+		{
+			const int64 toRead = Min(offset, static_cast<int64>(SkipBufferSize));
+			const int64 readSize = read(buffer.get(), toRead);
+
+			if (readSize <= 0)
+			{
+				break;
+			}
+
+			offset -= readSize;
+		}
+
+		return m_pos;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	read
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::DecompressionReaderDetail::read(void* dst, const int64 size)
+	{
+		if ((not m_context) || m_hasError || (size <= 0))
+		{
+			return 0;
+		}
+
+		ZSTD_outBuffer output = { dst, static_cast<size_t>(size), 0 };
+
+		while (output.pos < output.size)
+		{
+			bool endOfInput = false;
+
+			if (m_input.pos == m_input.size)
+			{
+				endOfInput = (not fillInput());
+			}
+
+			const size_t previousPos = output.pos;
+
+			const size_t result = ZSTD_decompressStream(m_context, &output, &m_input);
+
+			if (ZSTD_isError(result))
+			{
+				m_hasError = true;
+				break;
+			}
+
+			// 入力が尽き、内部に残っていたデータも出力し終えた
+			if (endOfInput && (output.pos == previousPos))
+			{
+				break;
+			}
+		}
+
+		m_pos += static_cast<int64>(output.pos);
+
+		return static_cast<int64>(output.pos);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasError
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::DecompressionReaderDetail::hasError() const noexcept
+	{
+		return m_hasError;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	scanContentSize
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::DecompressionReaderDetail::scanContentSize()
+	{
+		const int64 endPos = m_reader->size();
+
+		if (endPos < m_startPos)
+		{
+			return -1;
+		}
+
+		int64 framePos = m_startPos;
+		int64 totalSize = 0;
+
+		// フレームヘッダとブロックヘッダだけを読み、圧縮されたデータ本体は読み飛ばす
+		while (framePos < endPos)
+		{
+			uint8 header[ZSTD_FRAMEHEADERSIZE_MAX];
+			const int64 headerSize = m_reader->read(header, framePos, Min<int64>(sizeof(header), (endPos - framePos)));
+
+			ZSTD_frameHeader frameHeader;
+
+			if ((headerSize <= 0) || (ZSTD_getFrameHeader(&frameHeader, header, static_cast<size_t>(headerSize)) != 0))
+			{
+				return -1;
+			}
+
+			if (frameHeader.frameType == ZSTD_skippableFrame)
+			{
+				framePos += (ZSTD_SKIPPABLEHEADERSIZE + static_cast<int64>(frameHeader.frameContentSize));
+				continue;
+			}
+
+			// CompressionWriter で書き出したフレームなど、展開後のサイズが記録されていない
+			if (frameHeader.frameContentSize == ZSTD_CONTENTSIZE_UNKNOWN)
+			{
+				return -1;
+			}
+
+			totalSize += static_cast<int64>(frameHeader.frameContentSize);
+			framePos += frameHeader.headerSize;
+
+			for (bool isLastBlock = false; not isLastBlock;)
+			{
+				const int64 blockSize = ReadBlockSize(*m_reader, framePos, isLastBlock);
+
+				if (blockSize < 0)
+				{
+					return -1;
+				}
+
+				framePos += blockSize;
+			}
+
+			if (frameHeader.checksumFlag)
+			{
+				framePos += ChecksumSize;
+			}
+		}
+
+		// 最後のフレームが途中で途切れている
+		if (framePos != endPos)
+		{
+			return -1;
+		}
+
+		return totalSize;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	fillInput
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::DecompressionReaderDetail::fillInput()
+	{
+		const int64 readSize = m_reader->read(m_inputBuffer.get(), static_cast<int64>(ZSTD_DStreamInSize()));
+
+		m_input = { m_inputBuffer.get(), static_cast<size_t>(Max<int64>(readSize, 0)), 0 };
+
+		return (0 < readSize);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	rewind
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::DecompressionReaderDetail::rewind()
+	{
+		if (m_reader->setPos(m_startPos) != m_startPos)
+		{
+			return false;
+		}
+
+		// 辞書は保持したまま、展開の状態だけをリセットする
+		ZSTD_DCtx_reset(m_context, ZSTD_reset_session_only);
+		m_input = { m_inputBuffer.get(), 0, 0 };
+		m_pos = 0;
+		m_hasError = false;
+
+		return true;
+	}
+}
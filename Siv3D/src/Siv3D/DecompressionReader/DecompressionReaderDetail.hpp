@@ -0,0 +1,82 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/DecompressionReader.hpp>
+# define ZSTD_STATIC_LINKING_ONLY
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class DecompressionReader::DecompressionReaderDetail
+	{
+	public:
+
+		DecompressionReaderDetail() = default;
+
+		~DecompressionReaderDetail();
+
+		bool open(std::unique_ptr<IReader>&& reader, const Blob* dictionary);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		int64 size() const noexcept;
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		int64 setPos(int64 pos);
+
+		int64 skip(int64 offset);
+
+		int64 read(void* dst, int64 size);
+
+		[[nodiscard]]
+		bool hasError() const noexcept;
+
+	private:
+
+		std::unique_ptr<IReader> m_reader;
+
+		ZSTD_DCtx* m_context = nullptr;
+
+		std::unique_ptr<Byte[]> m_inputBuffer;
+
+		ZSTD_inBuffer m_input{};
+
+		/// @brief 読み込み元での、圧縮されたデータの開始位置
+		int64 m_startPos = 0;
+
+		/// @brief 展開後のデータの読み込み位置
+		int64 m_pos = 0;
+
+		/// @brief すべてのフレームの展開後のサイズの合計。不明な場合は -1
+		int64 m_contentSize = -1;
+
+		bool m_hasError = false;
+
+		/// @brief 読み込み元のすべてのフレームヘッダを走査して、展開後のサイズの合計を求める
+		[[nodiscard]]
+		int64 scanContentSize();
+
+		/// @brief 読み込み元から次の入力を読み込む
+		[[nodiscard]]
+		bool fillInput();
+
+		/// @brief 展開をやり直すために、読み込み元の先頭に戻る
+		[[nodiscard]]
+		bool rewind();
+	};
+}
@@ -0,0 +1,189 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/DecompressionReader.hpp>
+# include "DecompressionReaderDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	DecompressionReader::DecompressionReader()
+		: pImpl{ std::make_shared<DecompressionReaderDetail>() } {}
+
+	DecompressionReader::DecompressionReader(std::unique_ptr<IReader>&& reader)
+		: DecompressionReader{}
+	{
+		open(std::move(reader));
+	}
+
+	DecompressionReader::DecompressionReader(std::unique_ptr<IReader>&& reader, const Blob& dictionary)
+		: DecompressionReader{}
+	{
+		open(std::move(reader), dictionary);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::open(std::unique_ptr<IReader>&& reader)
+	{
+		return pImpl->open(std::move(reader), nullptr);
+	}
+
+	bool DecompressionReader::open(std::unique_ptr<IReader>&& reader, const Blob& dictionary)
+	{
+		return pImpl->open(std::move(reader), &dictionary);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecompressionReader::close()
+	{
+		pImpl->close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	supportsLookahead
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::supportsLookahead() const noexcept
+	{
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	DecompressionReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::size() const
+	{
+		return pImpl->size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::setPos(const int64 pos)
+	{
+		return pImpl->setPos(pos);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	skip
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::skip(const int64 offset)
+	{
+		return pImpl->skip(offset);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	read
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::read(void* dst, const int64 size)
+	{
+		return pImpl->read(dst, size);
+	}
+
+	int64 DecompressionReader::read(void* dst, const int64 pos, const int64 size)
+	{
+		if (pImpl->setPos(pos) != pos)
+		{
+			return 0;
+		}
+
+		return pImpl->read(dst, size);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	lookahead
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 DecompressionReader::lookahead(void*, const int64) const
+	{
+		return 0;
+	}
+
+	int64 DecompressionReader::lookahead(void*, const int64, const int64) const
+	{
+		return 0;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasError
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DecompressionReader::hasError() const noexcept
+	{
+		return pImpl->hasError();
+	}
+}
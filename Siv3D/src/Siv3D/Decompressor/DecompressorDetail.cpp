@@ -0,0 +1,213 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "DecompressorDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief フレームヘッダのサイズを信用して一度に確保してよい、展開後のサイズの下限（バイト）
+		constexpr uint64 MinTrustedContentSize = (1 << 20);
+
+		/// @brief フレームヘッダのサイズを信用して一度に確保してよい、圧縮率の上限
+		constexpr uint64 MaxTrustedCompressionRatio = 256;
+
+		/// @brief フレームヘッダに記録された展開後のサイズを信用して、一度に確保してよいかを返します。
+		/// @param data 圧縮されたデータ
+		/// @param size 圧縮されたデータのサイズ（バイト）
+		/// @param contentSize フレームヘッダに記録された展開後のサイズ（バイト）
+		/// @return 一度に確保してよい場合 true, それ以外の場合は false
+		[[nodiscard]]
+		static bool IsTrustedContentSize(const void* data, const size_t size, const unsigned long long contentSize) noexcept
+		{
+			// 細工されたフレームヘッダによって巨大なメモリ確保が行われないよう、入力のサイズに応じた上限を設ける
+			const uint64 limit = Max(MinTrustedContentSize, (static_cast<uint64>(size) * MaxTrustedCompressionRatio));
+
+			if (limit < contentSize)
+			{
+				return false;
+			}
+
+			const unsigned long long bound = ZSTD_decompressBound(data, size);
+
+			return ((bound != ZSTD_CONTENTSIZE_ERROR) && (contentSize <= bound));
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Decompressor::DecompressorDetail::DecompressorDetail()
+		: m_context{ ZSTD_createDCtx() } {}
+
+	Decompressor::DecompressorDetail::DecompressorDetail(const Blob& dictionary)
+		: DecompressorDetail{}
+	{
+		if (not m_context)
+		{
+			return;
+		}
+
+		m_dictionary = ZSTD_createDDict(dictionary.data(), dictionary.size());
+
+		if ((not m_dictionary)
+			|| ZSTD_isError(ZSTD_DCtx_refDDict(m_context, m_dictionary)))
+		{
+			ZSTD_freeDDict(m_dictionary);
+			m_dictionary = nullptr;
+			ZSTD_freeDCtx(m_context);
+			m_context = nullptr;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Decompressor::DecompressorDetail::~DecompressorDetail()
+	{
+		// コンテキストが辞書を参照しているため、先にコンテキストを解放する
+		ZSTD_freeDCtx(m_context);
+		ZSTD_freeDDict(m_dictionary);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isValid
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Decompressor::DecompressorDetail::isValid() const noexcept
+	{
+		return (m_context != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasDictionary
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Decompressor::DecompressorDetail::hasDictionary() const noexcept
+	{
+		return (m_dictionary != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decompress
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Decompressor::DecompressorDetail::decompress(const void* data, const size_t size, Blob& dst)
+	{
+		if (not m_context)
+		{
+			dst.clear();
+			return false;
+		}
+
+		const unsigned long long contentSize = ZSTD_getFrameContentSize(data, size);
+
+		// 単一のフレームで、展開後のサイズがフレームヘッダに記録されていて、それが妥当な範囲にある場合は一度に展開する
+		if ((contentSize != ZSTD_CONTENTSIZE_UNKNOWN)
+			&& (contentSize != ZSTD_CONTENTSIZE_ERROR)
+			&& (ZSTD_findFrameCompressedSize(data, size) == size)
+			&& IsTrustedContentSize(data, size, contentSize))
+		{
+			dst.resize(static_cast<size_t>(contentSize));
+
+			const size_t result = ZSTD_decompressDCtx(m_context, dst.data(), dst.size(), data, size);
+
+			if (ZSTD_isError(result) || (result != contentSize))
+			{
+				ZSTD_DCtx_reset(m_context, ZSTD_reset_session_only);
+				dst.clear();
+				return false;
+			}
+
+			return true;
+		}
+
+		// それ以外の場合は、実際に展開されたサイズに合わせてバッファを拡張しながら展開する
+		return decompressStream(data, size, dst);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decompressStream
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Decompressor::DecompressorDetail::decompressStream(const void* data, const size_t size, Blob& dst)
+	{
+		ZSTD_DCtx_reset(m_context, ZSTD_reset_session_only);
+
+		const size_t OutputBufferSize = ZSTD_DStreamOutSize();
+
+		ZSTD_inBuffer input = { data, size, 0 };
+		size_t written = 0;
+		size_t result = 0;
+
+		dst.clear();
+
+		if (size == 0)
+		{
+			return true;
+		}
+
+		for (;;)
+		{
+			// 出力先の空きが少なくなったら、バッファを拡張する
+			if ((dst.size() - written) < OutputBufferSize)
+			{
+				dst.resize(Max((dst.size() * 2), (written + OutputBufferSize)));
+			}
+
+			ZSTD_outBuffer output = { dst.data(), dst.size(), written };
+
+			result = ZSTD_decompressStream(m_context, &output, &input);
+
+			if (ZSTD_isError(result))
+			{
+				ZSTD_DCtx_reset(m_context, ZSTD_reset_session_only);
+				dst.clear();
+				return false;
+			}
+
+			written = output.pos;
+
+			// 入力をすべて消費し、出力先に空きが残っている場合は、これ以上展開できるデータは無い
+			if ((input.pos == input.size) && (output.pos < output.size))
+			{
+				break;
+			}
+		}
+
+		// フレームの途中でデータが途切れている
+		if (result != 0)
+		{
+			ZSTD_DCtx_reset(m_context, ZSTD_reset_session_only);
+			dst.clear();
+			return false;
+		}
+
+		dst.resize(written);
+
+		return true;
+	}
+}
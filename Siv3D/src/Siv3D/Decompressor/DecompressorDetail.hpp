@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Decompressor.hpp>
+# define ZSTD_STATIC_LINKING_ONLY
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class Decompressor::DecompressorDetail
+	{
+	public:
+
+		[[nodiscard]]
+		DecompressorDetail();
+
+		[[nodiscard]]
+		explicit DecompressorDetail(const Blob& dictionary);
+
+		~DecompressorDetail();
+
+		[[nodiscard]]
+		bool isValid() const noexcept;
+
+		[[nodiscard]]
+		bool hasDictionary() const noexcept;
+
+		bool decompress(const void* data, size_t size, Blob& dst);
+
+	private:
+
+		ZSTD_DCtx* m_context = nullptr;
+
+		ZSTD_DDict* m_dictionary = nullptr;
+
+		bool decompressStream(const void* data, size_t size, Blob& dst);
+	};
+}
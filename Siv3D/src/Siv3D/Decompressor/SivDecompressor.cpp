@@ -0,0 +1,94 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Decompressor.hpp>
+# include "DecompressorDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Decompressor::Decompressor()
+		: pImpl{ std::make_shared<DecompressorDetail>() } {}
+
+	Decompressor::Decompressor(const Blob& dictionary)
+		: pImpl{ std::make_shared<DecompressorDetail>(dictionary) } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isValid
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Decompressor::isValid() const noexcept
+	{
+		return pImpl->isValid();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	Decompressor::operator bool() const noexcept
+	{
+		return pImpl->isValid();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasDictionary
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Decompressor::hasDictionary() const noexcept
+	{
+		return pImpl->hasDictionary();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decompress
+	//
+	////////////////////////////////////////////////////////////////
+
+	Blob Decompressor::decompress(const void* data, const size_t size)
+	{
+		Blob blob;
+
+		if (not pImpl->decompress(data, size, blob))
+		{
+			return{};
+		}
+
+		return blob;
+	}
+
+	bool Decompressor::decompress(const void* data, const size_t size, Blob& dst)
+	{
+		return pImpl->decompress(data, size, dst);
+	}
+
+	Blob Decompressor::decompress(const Blob& blob)
+	{
+		return decompress(blob.data(), blob.size());
+	}
+
+	bool Decompressor::decompress(const Blob& blob, Blob& dst)
+	{
+		return pImpl->decompress(blob.data(), blob.size(), dst);
+	}
+}
@@ -0,0 +1,155 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Optional.hpp>
+# include "FileChangeCoalescer.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 保留中の操作の後に、新しい操作が続いたときの操作を返します。
+		/// @return まとめた後の操作。操作が打ち消される場合は none
+		[[nodiscard]]
+		static constexpr Optional<FileAction> Merge(const FileAction previous, const FileAction next) noexcept
+		{
+			switch (previous)
+			{
+			case FileAction::Added:
+				// 作成後すぐに削除されたファイルは報告しない
+				if (next == FileAction::Removed)
+				{
+					return none;
+				}
+
+				return FileAction::Added;
+			case FileAction::Modified:
+				return ((next == FileAction::Removed) ? FileAction::Removed : FileAction::Modified);
+			case FileAction::Removed:
+				// 削除後に同じパスで作成されたファイルは、置き換えとみなす
+				return ((next == FileAction::Removed) ? FileAction::Removed : FileAction::Modified);
+			default:
+				return next;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	FileChangeCoalescer::FileChangeCoalescer(const Clock::duration window) noexcept
+		: m_window{ window } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::add(FilePath&& path, const FileAction action, const Clock::time_point now)
+	{
+		if (auto it = m_pending.find(path);
+			it != m_pending.end())
+		{
+			Entry& entry = m_entries[static_cast<size_t>(it->second - m_firstSequence)];
+
+			if (const auto merged = Merge(entry.action, action))
+			{
+				entry.action = *merged;
+			}
+			else
+			{
+				entry.canceled = true;
+				m_pending.erase(it);
+			}
+
+			return;
+		}
+
+		m_pending.emplace(path, (m_firstSequence + m_entries.size()));
+		m_entries.push_back(Entry{ std::move(path), action, (now + m_window) });
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::flush(Array<FileChange>& fileChanges, const Clock::time_point now)
+	{
+		while ((not m_entries.empty())
+			&& (m_entries.front().deadline <= now))
+		{
+			Entry& entry = m_entries.front();
+
+			if (not entry.canceled)
+			{
+				m_pending.erase(entry.path);
+				fileChanges.push_back(FileChange{ std::move(entry.path), entry.action });
+			}
+
+			m_entries.pop_front();
+			++m_firstSequence;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	timeoutMillisec
+	//
+	////////////////////////////////////////////////////////////////
+
+	int32 FileChangeCoalescer::timeoutMillisec(const Clock::time_point now) const
+	{
+		if (m_entries.empty())
+		{
+			return -1;
+		}
+
+		const Clock::time_point deadline = m_entries.front().deadline;
+
+		if (deadline <= now)
+		{
+			return 0;
+		}
+
+		// 期限より前に起きないよう切り上げる
+		return static_cast<int32>(std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isEmpty
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool FileChangeCoalescer::isEmpty() const noexcept
+	{
+		return m_entries.empty();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::clear()
+	{
+		m_firstSequence += m_entries.size();
+		m_entries.clear();
+		m_pending.clear();
+	}
+}
@@ -0,0 +1,82 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <chrono>
+# include <deque>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/FileChange.hpp>
+
+namespace s3d
+{
+	/// @brief 短い時間に同じファイルに対して発生した変更を 1 つにまとめます。
+	/// @remark スレッドセーフではありません。
+	class FileChangeCoalescer
+	{
+	public:
+
+		using Clock = std::chrono::steady_clock;
+
+		FileChangeCoalescer() = default;
+
+		explicit FileChangeCoalescer(Clock::duration window) noexcept;
+
+		/// @brief 変更を追加します。
+		/// @param path ファイルパス
+		/// @param action ファイルの操作
+		/// @param now 現在の時刻
+		/// @remark 同じパスの変更が保留中の場合は、その変更とまとめます。
+		void add(FilePath&& path, FileAction action, Clock::time_point now);
+
+		/// @brief 最初の変更から window 以上経過した変更を取り出します。
+		/// @param fileChanges 取り出した変更の追加先
+		/// @param now 現在の時刻
+		void flush(Array<FileChange>& fileChanges, Clock::time_point now);
+
+		/// @brief 次に flush() で変更が取り出せるようになるまでの時間（ミリ秒）を返します。
+		/// @param now 現在の時刻
+		/// @return 次に変更が取り出せるようになるまでの時間（ミリ秒）。保留中の変更が無い場合は -1
+		[[nodiscard]]
+		int32 timeoutMillisec(Clock::time_point now) const;
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		void clear();
+
+	private:
+
+		struct Entry
+		{
+			FilePath path;
+
+			FileAction action = FileAction::Unknown;
+
+			Clock::time_point deadline;
+
+			/// @brief 変更が打ち消された場合 true
+			bool canceled = false;
+		};
+
+		Clock::duration m_window{};
+
+		// window は一定なので、到着順が期限の順になる
+		std::deque<Entry> m_entries;
+
+		// m_entries の先頭の要素の通し番号
+		uint64 m_firstSequence = 0;
+
+		// 保留中のパス -> 通し番号
+		HashMap<FilePath, uint64> m_pending;
+	};
+}
@@ -22,10 +22,10 @@ namespace s3d
 
 	DirectoryWatcher::DirectoryWatcher() {}
 
-	DirectoryWatcher::DirectoryWatcher(const FilePathView directory, const Array<String>& applicableExtensions)
+	DirectoryWatcher::DirectoryWatcher(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& coalescingWindow)
 		: pImpl{ std::make_shared<DirectoryWatcherDetail>() }
 	{
-		if (not pImpl->start(directory, applicableExtensions))
+		if (not pImpl->start(directory, applicableExtensions, coalescingWindow))
 		{
 			pImpl.reset();
 		}
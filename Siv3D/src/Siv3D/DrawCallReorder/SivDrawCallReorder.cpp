@@ -0,0 +1,121 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/DrawCallReorder.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		inline constexpr uint32 InvalidIndex = UINT32_MAX;
+
+		/// @brief 統合中の描画コール
+		struct DrawCallGroup
+		{
+			uint32 stateID;
+
+			FloatRect bounds;
+
+			uint32 head;
+
+			uint32 tail;
+
+			uint32 count;
+
+			uint32 indexCount;
+		};
+
+		[[nodiscard]]
+		static constexpr bool Intersects(const FloatRect& a, const FloatRect& b) noexcept
+		{
+			// 辺が接しているだけの場合も、同じピクセルに描かれる可能性があるので重なりとみなす
+			return ((a.left <= b.right) && (b.left <= a.right)
+				&& (a.top <= b.bottom) && (b.top <= a.bottom));
+		}
+
+		[[nodiscard]]
+		static constexpr FloatRect Union(const FloatRect& a, const FloatRect& b) noexcept
+		{
+			return{ Min(a.left, b.left), Min(a.top, b.top), Max(a.right, b.right), Max(a.bottom, b.bottom) };
+		}
+	}
+
+	namespace DrawCallReorder
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	Reorder
+		//
+		////////////////////////////////////////////////////////////////
+
+		DrawCallReorderResult Reorder(const std::span<const DrawCallInfo> drawCalls, const size_t lookback)
+		{
+			Array<DrawCallGroup> groups;
+			Array<uint32> next(drawCalls.size(), InvalidIndex);
+
+			for (uint32 i = 0; i < drawCalls.size(); ++i)
+			{
+				const DrawCallInfo& drawCall = drawCalls[i];
+				DrawCallGroup* pTarget = nullptr;
+
+				// 後ろのグループからさかのぼり、同じステートのグループを探す。
+				// 重なるグループがあれば、それより前には移動できない。
+				const size_t end = groups.size();
+				const size_t begin = ((lookback < end) ? (end - lookback) : 0);
+
+				for (size_t g = end; begin < g; --g)
+				{
+					DrawCallGroup& group = groups[g - 1];
+
+					if (group.stateID == drawCall.stateID)
+					{
+						pTarget = &group;
+						break;
+					}
+
+					if (Intersects(group.bounds, drawCall.bounds))
+					{
+						break;
+					}
+				}
+
+				if (pTarget)
+				{
+					next[pTarget->tail] = i;
+					pTarget->tail = i;
+					pTarget->bounds = Union(pTarget->bounds, drawCall.bounds);
+					++pTarget->count;
+					pTarget->indexCount += drawCall.indexCount;
+				}
+				else
+				{
+					groups.push_back(DrawCallGroup{ drawCall.stateID, drawCall.bounds, i, i, 1, drawCall.indexCount });
+				}
+			}
+
+			DrawCallReorderResult result;
+			result.order.reserve(drawCalls.size());
+			result.drawCalls.reserve(groups.size());
+
+			for (const auto& group : groups)
+			{
+				result.drawCalls.push_back(MergedDrawCall{ group.stateID, static_cast<uint32>(result.order.size()), group.count, group.indexCount });
+
+				for (uint32 i = group.head; i != InvalidIndex; i = next[i])
+				{
+					result.order.push_back(i);
+				}
+			}
+
+			return result;
+		}
+	}
+}
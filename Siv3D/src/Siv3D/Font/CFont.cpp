@@ -243,4 +243,48 @@ namespace s3d
 	{
 		return m_fonts[handleID]->getXAdvanceFromGlyphIndex(glyphIndex);
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getResolvedGlyphs
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<ResolvedGlyph> CFont::getResolvedGlyphs(const Font::IDType handleID, const StringView s, const Ligature ligature)
+	{
+		return m_fonts[handleID]->getResolvedGlyphs(s, ligature);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	preload
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CFont::preload(const Font::IDType handleID, const StringView chars)
+	{
+		return m_fonts[handleID]->preload(chars);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getCacheStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	FontCacheStat CFont::getCacheStat(const Font::IDType handleID)
+	{
+		return m_fonts[handleID]->getCacheStat();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setShapingCacheCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CFont::setShapingCacheCapacity(const Font::IDType handleID, const size_t capacity)
+	{
+		m_fonts[handleID]->setShapingCacheCapacity(capacity);
+	}
 }
@@ -52,6 +52,16 @@ namespace s3d
 		[[nodiscard]]
 		double getXAdvanceFromGlyphIndex(Font::IDType handleID, GlyphIndex glyphIndex) override;
 
+		[[nodiscard]]
+		Array<ResolvedGlyph> getResolvedGlyphs(Font::IDType handleID, StringView s, Ligature ligature) override;
+
+		bool preload(Font::IDType handleID, StringView chars) override;
+
+		[[nodiscard]]
+		FontCacheStat getCacheStat(Font::IDType handleID) override;
+
+		void setShapingCacheCapacity(Font::IDType handleID, size_t capacity) override;
+
 	private:
 
 		FT_Library m_freeType = nullptr;
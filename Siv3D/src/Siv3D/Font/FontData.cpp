@@ -55,6 +55,8 @@ namespace s3d
 		}
 
 		m_renderingMethod = m_face->getInfo().renderingMethod;
+
+		m_glyphCache.init(m_face->getInfo().baseSize);
 		
 		m_initialized	= true;
 	}
@@ -141,4 +143,119 @@ namespace s3d
 	{
 		return m_face->getXAdvanceFromGlyphIndex(glyphIndex, getInfo().hinting).value_or(0.0);
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getResolvedGlyphs
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Array<ResolvedGlyph>& FontData::getResolvedGlyphs(const StringView s, const Ligature ligature)
+	{
+		if (const Array<ResolvedGlyph>* cached = m_shapingCache.find(s, ligature))
+		{
+			return *cached;
+		}
+
+		Array<ResolvedGlyph> glyphs;
+
+		if (m_face->hasFace() && s)
+		{
+			const HarfBuzzGlyphInfo glyphInfo = m_face->getHarfBuzzGlyphInfo(s, ligature);
+
+			glyphs.reserve(glyphInfo.count);
+
+			for (size_t i = 0; i < glyphInfo.count; ++i)
+			{
+				glyphs.push_back(ResolvedGlyph{ .fontIndex = 0, .glyphIndex = glyphInfo.info[i].codepoint, .pos = glyphInfo.info[i].cluster });
+			}
+		}
+
+		return m_shapingCache.add(s, ligature, std::move(glyphs));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getGlyph
+	//
+	////////////////////////////////////////////////////////////////
+
+	const GlyphCacheEntry* FontData::getGlyph(const GlyphIndex glyphIndex)
+	{
+		if (const GlyphCacheEntry* glyph = m_glyphCache.find(glyphIndex))
+		{
+			return glyph;
+		}
+
+		m_glyphCache.add(m_face->renderGlyphs({ glyphIndex }));
+
+		return m_glyphCache.get(glyphIndex);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	preload
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool FontData::preload(const StringView chars)
+	{
+		if (not m_face->hasFace())
+		{
+			return false;
+		}
+
+		// シェーピングキャッシュやヒット数・ミス数に影響しないよう、キャッシュを通さずにシェーピングする
+		const HarfBuzzGlyphInfo glyphInfo = m_face->getHarfBuzzGlyphInfo(chars, Ligature::Yes);
+
+		Array<GlyphIndex> missingGlyphs;
+
+		for (size_t i = 0; i < glyphInfo.count; ++i)
+		{
+			const GlyphIndex glyphIndex = glyphInfo.info[i].codepoint;
+
+			if (not m_glyphCache.get(glyphIndex))
+			{
+				missingGlyphs << glyphIndex;
+			}
+		}
+
+		if (not missingGlyphs)
+		{
+			return true;
+		}
+
+		missingGlyphs.sort_and_unique();
+
+		// キャッシュに無いグリフをまとめて並列にラスタライズする
+		Array<GlyphBitmap> glyphs = m_face->renderGlyphs(missingGlyphs);
+		const bool allRendered = (glyphs.size() == missingGlyphs.size());
+
+		return (m_glyphCache.add(std::move(glyphs)) && allRendered);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getCacheStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	FontCacheStat FontData::getCacheStat() const
+	{
+		FontCacheStat stat;
+		m_glyphCache.fillStat(stat);
+		m_shapingCache.fillStat(stat);
+		return stat;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setShapingCacheCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FontData::setShapingCacheCapacity(const size_t capacity)
+	{
+		m_shapingCache.setCapacity(capacity);
+	}
 }
@@ -14,6 +14,8 @@
 # include <Siv3D/MemoryMappedFileView.hpp>
 # include "IFont.hpp"
 # include "FontFace.hpp"
+# include "GlyphCache.hpp"
+# include "ShapingCache.hpp"
 
 namespace s3d
 {
@@ -52,12 +54,32 @@ namespace s3d
 		[[nodiscard]]
 		double getXAdvanceFromGlyphIndex(GlyphIndex glyphIndex);
 
+		[[nodiscard]]
+		const Array<ResolvedGlyph>& getResolvedGlyphs(StringView s, Ligature ligature);
+
+		/// @brief グリフを返します。キャッシュに無い場合はラスタライズしてキャッシュに追加します。
+		/// @param glyphIndex グリフインデックス
+		/// @return グリフ。ラスタライズに失敗した場合は nullptr
+		[[nodiscard]]
+		const GlyphCacheEntry* getGlyph(GlyphIndex glyphIndex);
+
+		bool preload(StringView chars);
+
+		[[nodiscard]]
+		FontCacheStat getCacheStat() const;
+
+		void setShapingCacheCapacity(size_t capacity);
+
 	private:
 
 		MemoryMappedFileView m_mappedFileView;
 
 		std::unique_ptr<FontFace> m_face;
 
+		GlyphCache m_glyphCache;
+
+		ShapingCache m_shapingCache;
+
 		FontMethod m_renderingMethod = FontMethod::Bitmap;
 
 		bool m_initialized = false;
@@ -13,6 +13,7 @@
 # include "FontUtility.hpp"
 # include <Siv3D/GlyphIndex.hpp>
 # include <Siv3D/ScopeExit.hpp>
+# include <Siv3D/Threading.hpp>
 
 namespace s3d
 {
@@ -45,6 +46,52 @@ namespace s3d
 			
 			return bestMatch;
 		}
+
+		[[nodiscard]]
+		static Image ToImage(const ::FT_Bitmap& bitmap, const bool isSDF)
+		{
+			const int32 width = static_cast<int32>(bitmap.width);
+			const int32 height = static_cast<int32>(bitmap.rows);
+			const int32 pitch = bitmap.pitch;
+
+			Image image{ Size{ width, height } };
+
+			for (int32 y = 0; y < height; ++y)
+			{
+				// pitch が負の場合、バッファの先頭は最下行
+				const uint8* pSrc = ((0 <= pitch) ? (bitmap.buffer + (y * pitch)) : (bitmap.buffer + ((height - 1 - y) * -pitch)));
+				Color* pDst = image[y];
+
+				switch (bitmap.pixel_mode)
+				{
+				case FT_PIXEL_MODE_GRAY:
+					for (int32 x = 0; x < width; ++x)
+					{
+						const uint8 value = pSrc[x];
+						pDst[x] = (isSDF ? Color{ value, value, value, 255 } : Color{ 255, 255, 255, value });
+					}
+					break;
+				case FT_PIXEL_MODE_MONO:
+					for (int32 x = 0; x < width; ++x)
+					{
+						const bool bit = ((pSrc[x >> 3] >> (7 - (x & 7))) & 1);
+						pDst[x] = Color{ 255, 255, 255, static_cast<uint8>(bit ? 255 : 0) };
+					}
+					break;
+				case FT_PIXEL_MODE_BGRA:
+					for (int32 x = 0; x < width; ++x)
+					{
+						const uint8* pPixel = (pSrc + (x * 4));
+						pDst[x] = Color{ pPixel[2], pPixel[1], pPixel[0], pPixel[3] };
+					}
+					break;
+				default:
+					return{};
+				}
+			}
+
+			return image;
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -55,6 +102,13 @@ namespace s3d
 
 	FontFace::~FontFace()
 	{
+		for (auto& face : m_rasterizerFaces)
+		{
+			::FT_Done_Face(face);
+		}
+
+		m_rasterizerFaces.clear();
+
 		m_hbObjects.reset();
 
 		if (m_face)
@@ -111,6 +165,7 @@ namespace s3d
 						if (properties.styleName == styleName)
 						{
 							m_info.properties = properties;
+							m_namedInstanceIndex = (1 + styleIndex);
 							found = true;
 							break;
 						}
@@ -135,6 +190,7 @@ namespace s3d
 					}
 
 					assert(0 < defaultStyleIndex);
+					m_namedInstanceIndex = defaultStyleIndex;
 					m_info.properties = GetFontFaceProperties(face, mmVar->namedstyle[defaultStyleIndex - 1].coords);
 				}
 			}
@@ -168,6 +224,7 @@ namespace s3d
 			}
 
 			baseSize = face->available_sizes[bestSizeIndex].height;
+			m_fixedSizeIndex = bestSizeIndex;
 		}
 
 		{
@@ -180,6 +237,7 @@ namespace s3d
 			}
 		}
 
+		m_library				= library;
 		m_face					= face;
 		m_info.baseSize			= static_cast<int16>(baseSize);
 		m_info.style			= style;
@@ -195,6 +253,17 @@ namespace s3d
 		return true;
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasFace
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool FontFace::hasFace() const noexcept
+	{
+		return (m_face != nullptr);
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	getInfo
@@ -438,6 +507,192 @@ namespace s3d
 		return Unicode::FromUTF8(glyphNameBuffer);
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	renderGlyphs
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<GlyphBitmap> FontFace::renderGlyphs(const Array<GlyphIndex>& glyphIndices)
+	{
+		if ((not m_face) || glyphIndices.isEmpty())
+		{
+			return{};
+		}
+
+		// 1 つのフェイスが担当するグリフの数の目安
+		constexpr size_t GlyphsPerFace = 8;
+
+		const size_t numFaces = Min(Threading::GetConcurrency(), ((glyphIndices.size() + GlyphsPerFace - 1) / GlyphsPerFace));
+
+		// FT_Library はスレッドセーフではないため、フェイスはこのスレッドで開く
+		while ((2 <= numFaces) && (m_rasterizerFaces.size() < numFaces))
+		{
+			if (::FT_Face face = openRasterizerFace())
+			{
+				m_rasterizerFaces << face;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		const size_t stride = Min(numFaces, m_rasterizerFaces.size());
+
+		Array<Optional<GlyphBitmap>> results(glyphIndices.size());
+
+		if (stride < 2)
+		{
+			for (size_t i = 0; i < glyphIndices.size(); ++i)
+			{
+				results[i] = renderGlyph(m_face, glyphIndices[i]);
+			}
+		}
+		else
+		{
+			// フェイス i はグリフ i, i + stride, i + 2 * stride, ... を担当する
+			Threading::ParallelFor(0, stride, [&](const size_t begin, const size_t end)
+			{
+				for (size_t faceIndex = begin; faceIndex < end; ++faceIndex)
+				{
+					const ::FT_Face face = m_rasterizerFaces[faceIndex];
+
+					for (size_t i = faceIndex; i < glyphIndices.size(); i += stride)
+					{
+						results[i] = renderGlyph(face, glyphIndices[i]);
+					}
+				}
+			}, 1);
+		}
+
+		Array<GlyphBitmap> glyphs(Arg::reserve = results.size());
+
+		for (auto& result : results)
+		{
+			if (result)
+			{
+				glyphs << std::move(*result);
+			}
+		}
+
+		return glyphs;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	openRasterizerFace
+	//
+	////////////////////////////////////////////////////////////////
+
+	::FT_Face FontFace::openRasterizerFace() const
+	{
+		const ::FT_Stream stream = m_face->stream;
+
+		// メモリから開いたフェイスのみ複製できる
+		if ((stream == nullptr) || (stream->base == nullptr))
+		{
+			return nullptr;
+		}
+
+		::FT_Face face = nullptr;
+
+		if (::FT_New_Memory_Face(m_library, stream->base, static_cast<::FT_Long>(stream->size), (m_face->face_index & 0xFFFF), &face))
+		{
+			return nullptr;
+		}
+
+		if (m_namedInstanceIndex
+			&& ::FT_Set_Named_Instance(face, m_namedInstanceIndex))
+		{
+			::FT_Done_Face(face);
+			return nullptr;
+		}
+
+		if (m_fixedSizeIndex)
+		{
+			if (::FT_Select_Size(face, *m_fixedSizeIndex))
+			{
+				::FT_Done_Face(face);
+				return nullptr;
+			}
+		}
+		else if (::FT_Set_Pixel_Sizes(face, 0, m_info.baseSize))
+		{
+			::FT_Done_Face(face);
+			return nullptr;
+		}
+
+		return face;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	renderGlyph
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<GlyphBitmap> FontFace::renderGlyph(const ::FT_Face face, const GlyphIndex glyphIndex) const
+	{
+		::FT_Int32 loadFlag = (m_info.hinting ? FT_LOAD_DEFAULT : FT_LOAD_NO_HINTING);
+
+		if (m_info.properties.hasColor)
+		{
+			loadFlag |= FT_LOAD_COLOR;
+		}
+		else if (not((m_info.renderingMethod == FontMethod::Bitmap)
+			&& (m_info.style & FontStyle::Bitmap)))
+		{
+			loadFlag |= FT_LOAD_NO_BITMAP;
+		}
+
+		if (::FT_Load_Glyph(face, glyphIndex, loadFlag))
+		{
+			return none;
+		}
+
+		const ::FT_GlyphSlot slot = face->glyph;
+
+		if (slot->format == FT_GLYPH_FORMAT_OUTLINE)
+		{
+			if (m_info.style & FontStyle::Bold)
+			{
+				::FT_GlyphSlot_Embolden(slot);
+			}
+
+			if (m_info.style & FontStyle::Italic)
+			{
+				::FT_GlyphSlot_Oblique(slot);
+			}
+		}
+
+		// MSDF は FreeType の SDF レンダラで生成した距離場を 3 チャンネルに複製して代用する
+		const bool isSDF = ((m_info.renderingMethod == FontMethod::MSDF) && (slot->format == FT_GLYPH_FORMAT_OUTLINE));
+
+		if (slot->format != FT_GLYPH_FORMAT_BITMAP)
+		{
+			if (::FT_Render_Glyph(slot, (isSDF ? FT_RENDER_MODE_SDF : FT_RENDER_MODE_NORMAL)))
+			{
+				return none;
+			}
+		}
+
+		GlyphBitmap glyph{
+			.glyphIndex	= glyphIndex,
+			.left		= static_cast<int16>(slot->bitmap_left),
+			.top		= static_cast<int16>(slot->bitmap_top),
+			.xAdvance	= (slot->metrics.horiAdvance / 64.0f),
+			.yAdvance	= ((m_info.properties.hasVertical ? slot->metrics.vertAdvance : slot->metrics.horiAdvance) / 64.0f),
+		};
+
+		if (slot->bitmap.width && slot->bitmap.rows)
+		{
+			glyph.image = ToImage(slot->bitmap, isSDF);
+		}
+
+		return glyph;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	(destructor)
@@ -16,6 +16,7 @@
 # include <Siv3D/FontMethod.hpp>
 # include <Siv3D/GlyphIndex.hpp>
 # include <Siv3D/FontFaceProperties.hpp>
+# include <Siv3D/Image.hpp>
 # include "FontCommon.hpp"
 
 namespace s3d
@@ -50,6 +51,25 @@ namespace s3d
 		float spaceYAdvance = 0.0f;
 	};
 
+	/// @brief ラスタライズされたグリフ
+	struct GlyphBitmap
+	{
+		GlyphIndex glyphIndex = 0;
+
+		/// @brief グリフの画像（空白文字の場合は空）
+		Image image;
+
+		/// @brief ペン位置からグリフ画像の左端までの距離（ピクセル）
+		int16 left = 0;
+
+		/// @brief ベースラインからグリフ画像の上端までの距離（ピクセル）
+		int16 top = 0;
+
+		float xAdvance = 0.0f;
+
+		float yAdvance = 0.0f;
+	};
+
 	class FontFace
 	{
 	public:
@@ -62,6 +82,11 @@ namespace s3d
 		[[nodiscard]]
 		bool init(::FT_Library library, ::FT_Face face, StringView styleName, FontMethod fontMethod, int32 baseSize, FontStyle style);
 
+		/// @brief FreeType のフェイスを持っているかを返します。
+		/// @return フェイスを持っている場合 true, Null フォントの場合は false
+		[[nodiscard]]
+		bool hasFace() const noexcept;
+
 		[[nodiscard]]
 		const FontFaceInfo& getInfo() const noexcept;
 
@@ -85,6 +110,13 @@ namespace s3d
 		[[nodiscard]]
 		String getGlyphNameByGlyphIndex(GlyphIndex glyphIndex);
 
+		/// @brief 複数のグリフを並列にラスタライズします。
+		/// @param glyphIndices グリフインデックスの配列
+		/// @return ラスタライズされたグリフの配列。ラスタライズに失敗したグリフは含まれません。
+		/// @remark FreeType のフェイスはスレッドセーフではないため、ワーカーごとに同じフォントのフェイスを追加で開いて使います。
+		[[nodiscard]]
+		Array<GlyphBitmap> renderGlyphs(const Array<GlyphIndex>& glyphIndices);
+
 	private:
 
 		struct HarfBuzzObjects
@@ -98,10 +130,27 @@ namespace s3d
 			bool init(::FT_Face face);
 		};
 
+		::FT_Library m_library = nullptr;
+
 		::FT_Face m_face = nullptr;
 
+		/// @brief バリアブルフォントの名前付きインスタンスのインデックス（1-origin, 使わない場合は 0）
+		::FT_UInt m_namedInstanceIndex = 0;
+
+		/// @brief スケーリングできないフォントで選択したサイズのインデックス
+		Optional<::FT_Int> m_fixedSizeIndex;
+
+		/// @brief ラスタライズ用に追加で開いたフェイス
+		Array<::FT_Face> m_rasterizerFaces;
+
 		std::unique_ptr<HarfBuzzObjects> m_hbObjects;
 
 		FontFaceInfo m_info;
+
+		[[nodiscard]]
+		::FT_Face openRasterizerFace() const;
+
+		[[nodiscard]]
+		Optional<GlyphBitmap> renderGlyph(::FT_Face face, GlyphIndex glyphIndex) const;
 	};
 }
@@ -0,0 +1,237 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <algorithm>
+# include <bit>
+# include <span>
+# include <Siv3D/RectanglePack.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "GlyphCache.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		static void CopyImage(const Image& src, Image& dst, const Point pos)
+		{
+			const size_t rowBytes = (src.width() * sizeof(Color));
+
+			for (int32 y = 0; y < src.height(); ++y)
+			{
+				std::memcpy((dst[pos.y + y] + pos.x), src[y], rowBytes);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	init
+	//
+	////////////////////////////////////////////////////////////////
+
+	void GlyphCache::init(const int32 baseSize)
+	{
+		// 基本サイズのグリフが 1 行に 32 個程度並ぶ幅
+		m_atlasWidth = Clamp(static_cast<int32>(std::bit_ceil(static_cast<uint32>(Max(baseSize, 1) * 32))), 512, 4096);
+
+		m_glyphs.clear();
+		m_atlas = Image{};
+		m_penPos.set(0, 0);
+		m_shelfHeight = 0;
+		m_usedArea = 0;
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	find
+	//
+	////////////////////////////////////////////////////////////////
+
+	const GlyphCacheEntry* GlyphCache::find(const GlyphIndex glyphIndex)
+	{
+		if (const auto it = m_glyphs.find(glyphIndex);
+			it != m_glyphs.end())
+		{
+			++m_hits;
+			return &it->second;
+		}
+
+		++m_misses;
+		return nullptr;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	get
+	//
+	////////////////////////////////////////////////////////////////
+
+	const GlyphCacheEntry* GlyphCache::get(const GlyphIndex glyphIndex) const
+	{
+		if (const auto it = m_glyphs.find(glyphIndex);
+			it != m_glyphs.end())
+		{
+			return &it->second;
+		}
+
+		return nullptr;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool GlyphCache::add(Array<GlyphBitmap>&& glyphs)
+	{
+		// 画像の無いグリフ（空白文字）はアトラスに置かない
+		const auto it = std::partition(glyphs.begin(), glyphs.end(), [](const GlyphBitmap& glyph) { return (not glyph.image.isEmpty()); });
+
+		for (auto blank = it; blank != glyphs.end(); ++blank)
+		{
+			m_glyphs.emplace(blank->glyphIndex, GlyphCacheEntry{ .left = blank->left, .top = blank->top, .xAdvance = blank->xAdvance, .yAdvance = blank->yAdvance });
+		}
+
+		return addBlock(std::span{ glyphs.begin(), it });
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getAtlas
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Image& GlyphCache::getAtlas() const noexcept
+	{
+		return m_atlas;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	fillStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	void GlyphCache::fillStat(FontCacheStat& stat) const noexcept
+	{
+		stat.glyphHits		= m_hits;
+		stat.glyphMisses	= m_misses;
+		stat.cachedGlyphs	= static_cast<uint32>(m_glyphs.size());
+		stat.atlasSize		= m_atlas.size();
+		stat.atlasUsedArea	= m_usedArea;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addBlock
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool GlyphCache::addBlock(const std::span<GlyphBitmap> glyphs)
+	{
+		if (glyphs.empty())
+		{
+			return true;
+		}
+
+		Array<Rect> rects(Arg::reserve = glyphs.size());
+
+		for (const auto& glyph : glyphs)
+		{
+			rects.emplace_back(0, 0, (glyph.image.width() + Padding), (glyph.image.height() + Padding));
+		}
+
+		const RectanglePack pack = RectanglePack::Pack(rects, m_atlasWidth);
+
+		if (not pack)
+		{
+			if (glyphs.size() == 1)
+			{
+				LOG_FAIL(fmt::format("❌ GlyphCache: Glyph {0} ({1}x{2}) is too large for the atlas", glyphs[0].glyphIndex, glyphs[0].image.width(), glyphs[0].image.height()));
+				return false;
+			}
+
+			// 1 つのブロックに収まらない場合は半分ずつ追加する
+			const size_t half = (glyphs.size() / 2);
+			const bool first = addBlock(glyphs.first(half));
+			const bool second = addBlock(glyphs.subspan(half));
+			return (first && second);
+		}
+
+		const Optional<Point> blockPos = allocateBlock(pack.size);
+
+		if (not blockPos)
+		{
+			LOG_FAIL("❌ GlyphCache: The glyph atlas is full");
+			return false;
+		}
+
+		for (size_t i = 0; i < glyphs.size(); ++i)
+		{
+			GlyphBitmap& glyph = glyphs[i];
+			const Point pos = (*blockPos + pack.rects[i].pos);
+
+			CopyImage(glyph.image, m_atlas, pos);
+
+			m_usedArea += (static_cast<int64>(glyph.image.width()) * glyph.image.height());
+
+			m_glyphs.emplace(glyph.glyphIndex, GlyphCacheEntry{
+				.region		= Rect{ pos, glyph.image.size() },
+				.left		= glyph.left,
+				.top		= glyph.top,
+				.xAdvance	= glyph.xAdvance,
+				.yAdvance	= glyph.yAdvance });
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	allocateBlock
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<Point> GlyphCache::allocateBlock(const Size blockSize)
+	{
+		// 現在の棚に収まらない場合は次の棚へ
+		if (m_atlasWidth < (m_penPos.x + blockSize.x))
+		{
+			m_penPos.set(0, (m_penPos.y + m_shelfHeight));
+			m_shelfHeight = 0;
+		}
+
+		const int32 requiredHeight = (m_penPos.y + blockSize.y);
+
+		if (MaxAtlasSize < requiredHeight)
+		{
+			return none;
+		}
+
+		if (m_atlas.isEmpty())
+		{
+			m_atlas = Image{ Size{ m_atlasWidth, Max(requiredHeight, (m_atlasWidth / 4)) }, Color::Zero() };
+		}
+		else if (m_atlas.height() < requiredHeight)
+		{
+			const int32 newHeight = Min(Max(requiredHeight, (m_atlas.height() * 2)), MaxAtlasSize);
+			m_atlas.resizeHeight(newHeight, Color::Zero());
+		}
+
+		const Point pos = m_penPos;
+		m_penPos.x += blockSize.x;
+		m_shelfHeight = Max(m_shelfHeight, blockSize.y);
+		return pos;
+	}
+}
@@ -0,0 +1,106 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/FontCacheStat.hpp>
+# include "FontFace.hpp"
+
+namespace s3d
+{
+	/// @brief キャッシュされたグリフ
+	struct GlyphCacheEntry
+	{
+		/// @brief グリフアトラス上の領域（空白文字の場合は空）
+		Rect region{ 0, 0, 0, 0 };
+
+		int16 left = 0;
+
+		int16 top = 0;
+
+		float xAdvance = 0.0f;
+
+		float yAdvance = 0.0f;
+	};
+
+	/// @brief ラスタライズしたグリフを伸長可能なアトラスに詰め込んで保持するキャッシュ
+	/// @remark 一度に追加されたグリフは RectanglePack で 1 つのブロックにまとめられ、ブロックはアトラスの棚（シェルフ）に左から順に置かれます。
+	/// @remark アトラスの幅は固定で、足りなくなると高さを伸ばします。配置済みのグリフが移動することはありません。
+	/// @remark スレッドセーフではありません。CFont を通してメインスレッドからのみ使われます。
+	class GlyphCache
+	{
+	public:
+
+		/// @brief アトラスの最大の幅と高さ（ピクセル）
+		static constexpr int32 MaxAtlasSize = 8192;
+
+		/// @brief グリフ同士の間隔（ピクセル）
+		static constexpr int32 Padding = 1;
+
+		/// @brief フォントの基本サイズに合わせてアトラスを初期化します。
+		/// @param baseSize フォントの基本サイズ
+		void init(int32 baseSize);
+
+		/// @brief キャッシュされたグリフを返します。
+		/// @param glyphIndex グリフインデックス
+		/// @return キャッシュされたグリフ。キャッシュに無い場合は nullptr
+		/// @remark 呼び出しごとにヒット数またはミス数を数えます。
+		[[nodiscard]]
+		const GlyphCacheEntry* find(GlyphIndex glyphIndex);
+
+		/// @brief キャッシュされたグリフを返します。ヒット数・ミス数は数えません。
+		/// @param glyphIndex グリフインデックス
+		/// @return キャッシュされたグリフ。キャッシュに無い場合は nullptr
+		[[nodiscard]]
+		const GlyphCacheEntry* get(GlyphIndex glyphIndex) const;
+
+		/// @brief ラスタライズしたグリフをアトラスに追加します。
+		/// @param glyphs ラスタライズしたグリフ
+		/// @return すべてのグリフを追加できた場合 true, アトラスがいっぱいになった場合は false
+		bool add(Array<GlyphBitmap>&& glyphs);
+
+		[[nodiscard]]
+		const Image& getAtlas() const noexcept;
+
+		/// @brief 統計情報のうち、グリフキャッシュに関する値を書き込みます。
+		/// @param stat 統計情報
+		void fillStat(FontCacheStat& stat) const noexcept;
+
+	private:
+
+		HashMap<GlyphIndex, GlyphCacheEntry> m_glyphs;
+
+		Image m_atlas;
+
+		/// @brief アトラスの幅（ピクセル）
+		int32 m_atlasWidth = 512;
+
+		/// @brief 現在の棚で、次にブロックを置く位置
+		Point m_penPos{ 0, 0 };
+
+		/// @brief 現在の棚の高さ
+		int32 m_shelfHeight = 0;
+
+		int64 m_usedArea = 0;
+
+		uint64 m_hits = 0;
+
+		uint64 m_misses = 0;
+
+		[[nodiscard]]
+		bool addBlock(std::span<GlyphBitmap> glyphs);
+
+		[[nodiscard]]
+		Optional<Point> allocateBlock(Size blockSize);
+	};
+}
@@ -14,6 +14,7 @@
 # include <Siv3D/Array.hpp>
 # include <Siv3D/Font.hpp>
 # include <Siv3D/FontFaceProperties.hpp>
+# include <Siv3D/FontCacheStat.hpp>
 
 namespace s3d
 {
@@ -54,5 +55,15 @@ namespace s3d
 		
 		[[nodiscard]]
 		virtual double getXAdvanceFromGlyphIndex(Font::IDType handleID, GlyphIndex glyphIndex) = 0;
+
+		[[nodiscard]]
+		virtual Array<ResolvedGlyph> getResolvedGlyphs(Font::IDType handleID, StringView s, Ligature ligature) = 0;
+
+		virtual bool preload(Font::IDType handleID, StringView chars) = 0;
+
+		[[nodiscard]]
+		virtual FontCacheStat getCacheStat(Font::IDType handleID) = 0;
+
+		virtual void setShapingCacheCapacity(Font::IDType handleID, size_t capacity) = 0;
 	};
 }
@@ -0,0 +1,128 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "ShapingCache.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	find
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Array<ResolvedGlyph>* ShapingCache::find(const StringView s, const Ligature ligature)
+	{
+		auto& index = m_indices[ligature.getBool()];
+
+		if (const auto it = index.find(s);
+			it != index.end())
+		{
+			++m_hits;
+
+			// 先頭へ移動しても、イテレータと文字列の位置は変わらない
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+			return &it->second->glyphs;
+		}
+
+		++m_misses;
+		return nullptr;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Array<ResolvedGlyph>& ShapingCache::add(const StringView s, const Ligature ligature, Array<ResolvedGlyph>&& glyphs)
+	{
+		if (m_capacity == 0)
+		{
+			m_uncached = std::move(glyphs);
+			return m_uncached;
+		}
+
+		auto& index = m_indices[ligature.getBool()];
+
+		if (const auto it = index.find(s);
+			it != index.end())
+		{
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+			it->second->glyphs = std::move(glyphs);
+			return it->second->glyphs;
+		}
+
+		evict(m_capacity - 1);
+
+		m_entries.push_front(Entry{ String{ s }, ligature, std::move(glyphs) });
+		index.emplace(StringView{ m_entries.front().text }, m_entries.begin());
+
+		return m_entries.front().glyphs;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ShapingCache::setCapacity(const size_t capacity)
+	{
+		m_capacity = capacity;
+
+		evict(capacity);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	capacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t ShapingCache::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	fillStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ShapingCache::fillStat(FontCacheStat& stat) const noexcept
+	{
+		stat.shapingHits			= m_hits;
+		stat.shapingMisses			= m_misses;
+		stat.cachedShapes			= static_cast<uint32>(m_entries.size());
+		stat.shapingCacheCapacity	= static_cast<uint32>(Min<size_t>(m_capacity, UINT32_MAX));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	evict
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ShapingCache::evict(const size_t capacity)
+	{
+		while (capacity < m_entries.size())
+		{
+			const Entry& entry = m_entries.back();
+
+			m_indices[entry.ligature.getBool()].erase(StringView{ entry.text });
+
+			m_entries.pop_back();
+		}
+	}
+}
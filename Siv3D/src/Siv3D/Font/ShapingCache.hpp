@@ -0,0 +1,89 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <array>
+# include <list>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/PredefinedYesNo.hpp>
+# include <Siv3D/ResolvedGlyph.hpp>
+# include <Siv3D/FontCacheStat.hpp>
+
+namespace s3d
+{
+	/// @brief 文字列ごとのシェーピング結果を保持する LRU キャッシュ
+	/// @remark スレッドセーフではありません。CFont を通してメインスレッドからのみ使われます。
+	class ShapingCache
+	{
+	public:
+
+		/// @brief デフォルトのキャッシュ容量（文字列の数）
+		static constexpr size_t DefaultCapacity = 256;
+
+		/// @brief キャッシュされたシェーピング結果を返します。
+		/// @param s 文字列
+		/// @param ligature リガチャを有効にしてシェーピングした結果を探す場合は Ligature::Yes
+		/// @return キャッシュされたシェーピング結果。キャッシュに無い場合は nullptr
+		/// @remark 見つかった結果は最も新しく使われたものとして扱われます。
+		[[nodiscard]]
+		const Array<ResolvedGlyph>* find(StringView s, Ligature ligature);
+
+		/// @brief シェーピング結果をキャッシュに追加します。
+		/// @param s 文字列
+		/// @param ligature リガチャを有効にしてシェーピングした場合は Ligature::Yes
+		/// @param glyphs シェーピング結果
+		/// @return 追加したシェーピング結果
+		/// @remark 容量を超えた場合は、最も長い間使われていない結果を破棄します。
+		const Array<ResolvedGlyph>& add(StringView s, Ligature ligature, Array<ResolvedGlyph>&& glyphs);
+
+		/// @brief キャッシュ容量を設定します。
+		/// @param capacity キャッシュ容量（文字列の数）。0 の場合はキャッシュしません。
+		void setCapacity(size_t capacity);
+
+		[[nodiscard]]
+		size_t capacity() const noexcept;
+
+		/// @brief 統計情報のうち、シェーピングキャッシュに関する値を書き込みます。
+		/// @param stat 統計情報
+		void fillStat(FontCacheStat& stat) const noexcept;
+
+	private:
+
+		struct Entry
+		{
+			String text;
+
+			Ligature ligature;
+
+			Array<ResolvedGlyph> glyphs;
+		};
+
+		/// @brief 先頭ほど最近使われた結果
+		std::list<Entry> m_entries;
+
+		/// @brief Ligature::No, Ligature::Yes それぞれの索引（キーは m_entries 内の文字列を指す）
+		std::array<HashMap<StringView, std::list<Entry>::iterator>, 2> m_indices;
+
+		size_t m_capacity = DefaultCapacity;
+
+		/// @brief 容量を 0 にしたときに add() が返す結果
+		Array<ResolvedGlyph> m_uncached;
+
+		uint64 m_hits = 0;
+
+		uint64 m_misses = 0;
+
+		void evict(size_t capacity);
+	};
+}
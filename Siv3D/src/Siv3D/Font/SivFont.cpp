@@ -369,6 +369,51 @@ namespace s3d
 		return SIV3D_ENGINE(Font)->getXAdvanceFromGlyphIndex(m_handle->id(), glyphIndex);
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	getResolvedGlyphs
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<ResolvedGlyph> Font::getResolvedGlyphs(const StringView s, const Ligature ligature) const
+	{
+		return SIV3D_ENGINE(Font)->getResolvedGlyphs(m_handle->id(), s, ligature);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	preload
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Font::preload(const StringView chars) const
+	{
+		return SIV3D_ENGINE(Font)->preload(m_handle->id(), chars);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getCacheStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	FontCacheStat Font::getCacheStat() const
+	{
+		return SIV3D_ENGINE(Font)->getCacheStat(m_handle->id());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setShapingCacheCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Font& Font::setShapingCacheCapacity(const size_t capacity) const
+	{
+		SIV3D_ENGINE(Font)->setShapingCacheCapacity(m_handle->id(), capacity);
+		return *this;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	swap
@@ -30,6 +30,12 @@ namespace s3d
 		{
 			throw Error{ U"PSSampler index out of range" };
 		}
+
+		[[noreturn]]
+		static void ThrowSizeMismatch(const StringView functionName)
+		{
+			throw Error{ U"Graphics2D::{}(): the sizes of the arrays do not match"_fmt(functionName) };
+		}
 	}
 
 	namespace Graphics2D
@@ -202,6 +208,72 @@ namespace s3d
 			}
 		}
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	SetDrawCallReorderingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		void SetDrawCallReorderingEnabled(const bool enabled)
+		{
+			SIV3D_ENGINE(Renderer2D)->setDrawCallReorderingEnabled(enabled);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	IsDrawCallReorderingEnabled
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool IsDrawCallReorderingEnabled() noexcept
+		{
+			return SIV3D_ENGINE(Renderer2D)->isDrawCallReorderingEnabled();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DrawRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		void DrawRects(const std::span<const FloatRect> rects, const ColorF& color)
+		{
+			const Float4 colorF = color.toFloat4();
+			SIV3D_ENGINE(Renderer2D)->addRects(rects, std::span{ &colorF, 1 });
+		}
+
+		void DrawRects(const std::span<const FloatRect> rects, const std::span<const Float4> colors)
+		{
+			if (colors.size() != rects.size())
+			{
+				ThrowSizeMismatch(U"DrawRects");
+			}
+
+			SIV3D_ENGINE(Renderer2D)->addRects(rects, colors);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DrawCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		void DrawCircles(const std::span<const Float2> centers, const float r, const ColorF& color)
+		{
+			const Float4 colorF = color.toFloat4();
+			SIV3D_ENGINE(Renderer2D)->addCircles(centers, std::span{ &r, 1 }, std::span{ &colorF, 1 });
+		}
+
+		void DrawCircles(const std::span<const Float2> centers, const std::span<const float> rs, const std::span<const Float4> colors)
+		{
+			if ((rs.size() != centers.size()) || (colors.size() != centers.size()))
+			{
+				ThrowSizeMismatch(U"DrawCircles");
+			}
+
+			SIV3D_ENGINE(Renderer2D)->addCircles(centers, rs, colors);
+		}
+
 		namespace Internal
 		{
 			void SetColorMul(const Float4& color)
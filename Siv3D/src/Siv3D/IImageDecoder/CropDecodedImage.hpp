@@ -0,0 +1,26 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Image.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief デコードした画像から、指定した範囲を切り出します。
+		/// @param image デコードした画像
+		/// @param region 切り出す範囲（image の座標）
+		/// @return 切り出した画像。範囲が空の場合は空の画像
+		[[nodiscard]]
+		Image CropDecodedImage(Image&& image, const Rect& region);
+	}
+}
@@ -11,9 +11,41 @@
 
 # include <Siv3D/IImageDecoder.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include "CropDecodedImage.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	CropDecodedImage
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image CropDecodedImage(Image&& image, const Rect& region)
+		{
+			if (region.isEmpty())
+			{
+				return{};
+			}
+
+			if (region.size == image.size())
+			{
+				return std::move(image);
+			}
+
+			Image result(region.size);
+
+			for (int32 y = 0; y < region.h; ++y)
+			{
+				std::memcpy(result[y], (image[region.y + y] + region.x), (region.w * sizeof(Color)));
+			}
+
+			return result;
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	getImageInfo
@@ -50,6 +82,14 @@ namespace s3d
 		return decode(reader, path, premultiplyAlpha);
 	}
 
+	Image IImageDecoder::decode(IReader& reader, const FilePathView pathHint, const ImageDecodeOptions& options) const
+	{
+		Image image = decode(reader, pathHint, options.premultiplyAlpha);
+		const Rect region = options.getRegion(image.size());
+
+		return detail::CropDecodedImage(std::move(image), region);
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	decodeGray16
@@ -13,9 +13,34 @@
 # include <Siv3D/Emoji.hpp>
 # include <Siv3D/ImageDecoder.hpp>
 # include <Siv3D/ImageEncoder.hpp>
+# include <Siv3D/Threading.hpp>
 
 namespace s3d
 {
+	namespace
+	{
+		/// @brief 並列実行で 1 つのタスクが受け持つ最小のピクセル数
+		static constexpr size_t MinPixelsPerTask = (1 << 14);
+
+		/// @brief 画像の行を帯状に分割し、ワーカースレッドで並列に処理します。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param f 各帯 [beginY, endY) に対して呼ばれる関数
+		static void ParallelForRows(const Size size, FunctionRef<void(int32, int32)> f)
+		{
+			if ((size.x <= 0) || (size.y <= 0))
+			{
+				return;
+			}
+
+			const size_t grainSize = Max<size_t>(1, (MinPixelsPerTask / size.x));
+
+			Threading::ParallelFor(0, size.y, [&](const size_t beginY, const size_t endY)
+			{
+				f(static_cast<int32>(beginY), static_cast<int32>(endY));
+			}, grainSize);
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	(constructor)
@@ -140,6 +165,106 @@ namespace s3d
 		}
 	}
 
+	Image::Image(const Size size, Arg::parallelGenerator_<FunctionRef<Color(int32, int32)>> generator)
+		: Image{ size }
+	{
+		const auto& f = *generator;
+
+		ParallelForRows(m_size, [&](const int32 beginY, const int32 endY)
+		{
+			Color* pDst = (m_pixels.data() + (static_cast<size_t>(m_size.x) * beginY));
+
+			for (int32 y = beginY; y < endY; ++y)
+			{
+				for (int32 x = 0; x < m_size.x; ++x)
+				{
+					*pDst++ = f(x, y);
+				}
+			}
+		});
+	}
+
+	Image::Image(const Size size, Arg::parallelGenerator_<FunctionRef<Color(Point)>> generator)
+		: Image{ size }
+	{
+		const auto& f = *generator;
+
+		ParallelForRows(m_size, [&](const int32 beginY, const int32 endY)
+		{
+			Color* pDst = (m_pixels.data() + (static_cast<size_t>(m_size.x) * beginY));
+
+			for (int32 y = beginY; y < endY; ++y)
+			{
+				for (int32 x = 0; x < m_size.x; ++x)
+				{
+					*pDst++ = f(Point{ x, y });
+				}
+			}
+		});
+	}
+
+	Image::Image(const Size size, Arg::parallelGenerator0_1_<FunctionRef<Color(double, double)>> generator)
+		: Image{ size }
+	{
+		const auto& f = *generator;
+
+		const double dx = (1.0 / m_size.x);
+		const double dy = (1.0 / m_size.y);
+		const double offsetX = (dx * 0.5);
+		const double offsetY = (dy * 0.5);
+
+		ParallelForRows(m_size, [&](const int32 beginY, const int32 endY)
+		{
+			Color* pDst = (m_pixels.data() + (static_cast<size_t>(m_size.x) * beginY));
+
+			for (int32 y = beginY; y < endY; ++y)
+			{
+				for (int32 x = 0; x < m_size.x; ++x)
+				{
+					*pDst++ = f((x * dx + offsetX), (y * dy + offsetY));
+				}
+			}
+		});
+	}
+
+	Image::Image(const Size size, Arg::parallelGenerator0_1_<FunctionRef<Color(Vec2)>> generator)
+		: Image{ size }
+	{
+		const auto& f = *generator;
+
+		const double dx = (1.0 / m_size.x);
+		const double dy = (1.0 / m_size.y);
+		const double offsetX = (dx * 0.5);
+		const double offsetY = (dy * 0.5);
+
+		ParallelForRows(m_size, [&](const int32 beginY, const int32 endY)
+		{
+			Color* pDst = (m_pixels.data() + (static_cast<size_t>(m_size.x) * beginY));
+
+			for (int32 y = beginY; y < endY; ++y)
+			{
+				for (int32 x = 0; x < m_size.x; ++x)
+				{
+					*pDst++ = f(Vec2{ (x * dx + offsetX), (y * dy + offsetY) });
+				}
+			}
+		});
+	}
+
+	Image::Image(const Size size, Arg::rowGenerator_<FunctionRef<void(int32, std::span<Color>)>> generator)
+		: Image{ size }
+	{
+		const auto& f = *generator;
+
+		ParallelForRows(m_size, [&](const int32 beginY, const int32 endY)
+		{
+			for (int32 y = beginY; y < endY; ++y)
+			{
+				f(y, std::span<Color>{ (m_pixels.data() + (static_cast<size_t>(m_size.x) * y)), static_cast<size_t>(m_size.x) });
+			}
+		});
+	}
+
 	Image::Image(const FilePathView path, const PremultiplyAlpha premultiplyAlpha, const ImageFormat format)
 	{
 		*this = ImageDecoder::Decode(path, premultiplyAlpha, format);
@@ -259,7 +384,7 @@ namespace s3d
 		const int32 oldHeight = m_size.y;
 
 		// 高さが変更されない場合は何もしない
-		if (oldHeight == m_size.y)
+		if (oldHeight == static_cast<int32>(height))
 		{
 			return;
 		}
@@ -12,6 +12,11 @@
 # include "CImageDecoder.hpp"
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/MemoryViewReader.hpp>
+# include <Siv3D/Hash.hpp>
+# include <Siv3D/Time.hpp>
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/ImageFormat/BMPDecoder.hpp>
 # include <Siv3D/ImageFormat/PNGDecoder.hpp>
@@ -235,7 +240,35 @@ namespace s3d
 
 		LOG_TRACE(fmt::format("Image decoder name: {}", (*it)->name()));
 
-		return (*it)->decode(reader, pathHint, premultiplyAlpha);
+		const int64 startNanosec = Time::GetNanosec();
+
+		Image image = (*it)->decode(reader, pathHint, premultiplyAlpha);
+
+		addTiming(**it, (Time::GetNanosec() - startNanosec));
+
+		return image;
+	}
+
+	Image CImageDecoder::decode(IReader& reader, const FilePathView pathHint, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+	{
+		LOG_SCOPED_DEBUG("CImageDecoder::decode(options)");
+
+		const auto it = FindDecoder(m_decoders, imageFormat, reader, pathHint);
+
+		if (it == m_decoders.end())
+		{
+			return{};
+		}
+
+		LOG_TRACE(fmt::format("Image decoder name: {}", (*it)->name()));
+
+		const int64 startNanosec = Time::GetNanosec();
+
+		Image image = (*it)->decode(reader, pathHint, options);
+
+		addTiming(**it, (Time::GetNanosec() - startNanosec));
+
+		return image;
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -259,4 +292,181 @@ namespace s3d
 
 		return (*it)->decodeGray16(reader, pathHint);
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decodeBatch
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<Image> CImageDecoder::decodeBatch(const Array<FilePath>& paths, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+	{
+		LOG_SCOPED_DEBUG(fmt::format("CImageDecoder::decodeBatch({} files)", paths.size()));
+
+		Array<Image> images(paths.size());
+
+		// ファイルごとに処理時間が大きく異なるため、1 ファイルずつワーカーに分配する
+		Threading::ParallelFor(0, paths.size(), [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					images[i] = decodeFile(paths[i], options, imageFormat);
+				}
+			}, 1);
+
+		return images;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setCacheCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CImageDecoder::setCacheCapacity(const size_t capacityBytes)
+	{
+		m_cache.setCapacity(capacityBytes);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getCacheCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t CImageDecoder::getCacheCapacity() const noexcept
+	{
+		return m_cache.capacity();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clearCache
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CImageDecoder::clearCache()
+	{
+		m_cache.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	ImageDecoderStat CImageDecoder::getStat() const
+	{
+		ImageDecoderStat stat;
+
+		m_cache.fillStat(stat);
+		{
+			std::lock_guard lock{ m_timingMutex };
+
+			for (const auto& [name, timing] : m_timings)
+			{
+				stat.timings.push_back(timing);
+			}
+		}
+
+		std::sort(stat.timings.begin(), stat.timings.end(), [](const ImageDecodeTiming& a, const ImageDecodeTiming& b)
+			{
+				return (a.decoderName < b.decoderName);
+			});
+
+		return stat;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	resetStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CImageDecoder::resetStat()
+	{
+		m_cache.resetStat();
+
+		std::lock_guard lock{ m_timingMutex };
+
+		m_timings.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Image CImageDecoder::decodeFile(const FilePath& path, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+	{
+		// ファイルをコピーせずに、マップしたメモリから直接デコードする
+		MemoryMappedFileView file{ path };
+
+		if (not file)
+		{
+			LOG_FAIL(fmt::format("❌ ImageDecoder::DecodeBatch(): Failed to open `{}`", path));
+			return{};
+		}
+
+		const MappedMemoryView mapped = file.mapAll();
+
+		if (not mapped)
+		{
+			LOG_FAIL(fmt::format("❌ ImageDecoder::DecodeBatch(): Failed to map `{}`", path));
+			return{};
+		}
+
+		const bool useCache = (m_cache.capacity() != 0);
+		uint64 hash = 0;
+
+		if (useCache)
+		{
+			// 同じ内容のファイルでも、デコードの設定が異なれば別の画像になる
+			const Rect region = options.region.value_or(Rect{ 0, 0, -1, -1 });
+			const Size targetSize = options.targetSize.value_or(Size{ -1, -1 });
+			const int32 settings[] = { FromEnum(imageFormat), options.premultiplyAlpha.getBool(),
+				targetSize.x, targetSize.y, region.x, region.y, region.w, region.h };
+			const uint64 seed = rapidhash::Hash(settings, sizeof(settings));
+
+			hash = rapidhash::Hash(mapped.data, mapped.size, seed);
+
+			if (const auto cached = m_cache.find(hash, mapped.size))
+			{
+				return *cached;
+			}
+		}
+
+		MemoryViewReader reader{ mapped.data, mapped.size };
+
+		Image image = decode(reader, path, options, imageFormat);
+
+		if (useCache && image)
+		{
+			m_cache.add(hash, mapped.size, std::make_shared<const Image>(image));
+		}
+
+		return image;
+	}
+
+	void CImageDecoder::addTiming(const IImageDecoder& decoder, const int64 nanosec)
+	{
+		const double millisec = (nanosec / 1'000'000.0);
+		String name{ decoder.name() };
+
+		std::lock_guard lock{ m_timingMutex };
+
+		auto it = m_timings.find(name);
+
+		if (it == m_timings.end())
+		{
+			it = m_timings.emplace(name, ImageDecodeTiming{ .imageFormat = decoder.imageFormat(), .decoderName = name }).first;
+		}
+
+		ImageDecodeTiming& timing = it->second;
+		++timing.decodeCount;
+		timing.totalMillisec += millisec;
+		timing.maxMillisec = Max(timing.maxMillisec, millisec);
+	}
 }
@@ -10,7 +10,10 @@
 //-----------------------------------------------
 
 # pragma once
+# include <mutex>
+# include <Siv3D/HashMap.hpp>
 # include "IImageDecoder.hpp"
+# include "DecodedImageCache.hpp"
 
 namespace s3d
 {
@@ -34,10 +37,36 @@ namespace s3d
 
 		Image decode(IReader& reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha, ImageFormat imageFormat) override;
 
+		Image decode(IReader& reader, FilePathView pathHint, const ImageDecodeOptions& options, ImageFormat imageFormat) override;
+
 		Grid<uint16> decodeGray16(IReader& reader, FilePathView pathHint, ImageFormat imageFormat) override;
 
+		Array<Image> decodeBatch(const Array<FilePath>& paths, const ImageDecodeOptions& options, ImageFormat imageFormat) override;
+
+		void setCacheCapacity(size_t capacityBytes) override;
+
+		size_t getCacheCapacity() const noexcept override;
+
+		void clearCache() override;
+
+		ImageDecoderStat getStat() const override;
+
+		void resetStat() override;
+
 	private:
 
 		Array<std::unique_ptr<IImageDecoder>> m_decoders;
+
+		DecodedImageCache m_cache;
+
+		/// @brief 画像デコーダの名前ごとのデコード時間
+		HashMap<String, ImageDecodeTiming> m_timings;
+
+		mutable std::mutex m_timingMutex;
+
+		[[nodiscard]]
+		Image decodeFile(const FilePath& path, const ImageDecodeOptions& options, ImageFormat imageFormat);
+
+		void addTiming(const IImageDecoder& decoder, int64 nanosec);
 	};
 }
@@ -0,0 +1,166 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "DecodedImageCache.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	find
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::shared_ptr<const Image> DecodedImageCache::find(const uint64 hash, const size_t fileSize)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if (const auto it = m_index.find(hash);
+			(it != m_index.end()) && (it->second->fileSize == fileSize))
+		{
+			++m_hits;
+
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+			return it->second->image;
+		}
+
+		++m_misses;
+
+		return nullptr;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecodedImageCache::add(const uint64 hash, const size_t fileSize, std::shared_ptr<const Image> image)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		const size_t imageSize = image->size_bytes();
+		const size_t capacity = m_capacity.load(std::memory_order_relaxed);
+
+		if (capacity < imageSize)
+		{
+			return;
+		}
+
+		// 同じハッシュ値の画像（別のスレッドが先に追加したもの、またはサイズの異なるファイル）を置き換える
+		if (const auto it = m_index.find(hash);
+			it != m_index.end())
+		{
+			erase(it->second);
+		}
+
+		evict(capacity - imageSize);
+
+		m_entries.push_front(Entry{ hash, fileSize, std::move(image) });
+		m_index.emplace(hash, m_entries.begin());
+		m_sizeBytes += imageSize;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecodedImageCache::setCapacity(const size_t capacityBytes)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_capacity.store(capacityBytes, std::memory_order_relaxed);
+
+		evict(capacityBytes);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	capacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t DecodedImageCache::capacity() const noexcept
+	{
+		return m_capacity.load(std::memory_order_relaxed);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecodedImageCache::clear()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		evict(0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	fillStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecodedImageCache::fillStat(ImageDecoderStat& stat) const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		stat.cacheHits			= m_hits;
+		stat.cacheMisses		= m_misses;
+		stat.cachedImages		= static_cast<uint32>(m_entries.size());
+		stat.cachedBytes		= m_sizeBytes;
+		stat.cacheCapacityBytes	= m_capacity.load(std::memory_order_relaxed);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	resetStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecodedImageCache::resetStat()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DecodedImageCache::erase(const std::list<Entry>::iterator it)
+	{
+		m_sizeBytes -= it->image->size_bytes();
+
+		m_index.erase(it->hash);
+
+		m_entries.erase(it);
+	}
+
+	void DecodedImageCache::evict(const size_t capacityBytes)
+	{
+		while (capacityBytes < m_sizeBytes)
+		{
+			erase(std::prev(m_entries.end()));
+		}
+	}
+}
@@ -0,0 +1,94 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <atomic>
+# include <list>
+# include <memory>
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/ImageDecoderStat.hpp>
+
+namespace s3d
+{
+	/// @brief ファイルの内容のハッシュ値をキーに、デコードした画像を保持する LRU キャッシュ
+	/// @remark スレッドセーフです。
+	class DecodedImageCache
+	{
+	public:
+
+		/// @brief キャッシュされた画像を返します。
+		/// @param hash ファイルの内容とデコードの設定から求めたハッシュ値
+		/// @param fileSize ファイルのサイズ（バイト）
+		/// @return キャッシュされた画像。キャッシュに無い場合は nullptr
+		/// @remark 見つかった画像は最も新しく使われたものとして扱われます。
+		[[nodiscard]]
+		std::shared_ptr<const Image> find(uint64 hash, size_t fileSize);
+
+		/// @brief 画像をキャッシュに追加します。
+		/// @param hash ファイルの内容とデコードの設定から求めたハッシュ値
+		/// @param fileSize ファイルのサイズ（バイト）
+		/// @param image 画像
+		/// @remark 容量を超えた場合は、最も長い間使われていない画像を破棄します。容量より大きい画像は追加しません。
+		void add(uint64 hash, size_t fileSize, std::shared_ptr<const Image> image);
+
+		/// @brief キャッシュ容量を設定します。
+		/// @param capacityBytes キャッシュ容量（バイト）。0 の場合はキャッシュしません。
+		void setCapacity(size_t capacityBytes);
+
+		[[nodiscard]]
+		size_t capacity() const noexcept;
+
+		/// @brief キャッシュされている画像をすべて破棄します。
+		void clear();
+
+		/// @brief 統計情報のうち、キャッシュに関する値を書き込みます。
+		/// @param stat 統計情報
+		void fillStat(ImageDecoderStat& stat) const;
+
+		/// @brief キャッシュのヒット数とミス数を 0 にします。
+		void resetStat();
+
+	private:
+
+		struct Entry
+		{
+			uint64 hash = 0;
+
+			size_t fileSize = 0;
+
+			std::shared_ptr<const Image> image;
+		};
+
+		mutable std::mutex m_mutex;
+
+		/// @brief 先頭ほど最近使われた画像
+		std::list<Entry> m_entries;
+
+		HashMap<uint64, std::list<Entry>::iterator> m_index;
+
+		/// @brief キャッシュされている画像の合計サイズ（バイト）
+		size_t m_sizeBytes = 0;
+
+		std::atomic<size_t> m_capacity = 0;
+
+		uint64 m_hits = 0;
+
+		uint64 m_misses = 0;
+
+		void erase(std::list<Entry>::iterator it);
+
+		void evict(size_t capacityBytes);
+	};
+}
@@ -12,6 +12,7 @@
 # pragma once
 # include <Siv3D/Common.hpp>
 # include <Siv3D/IImageDecoder.hpp>
+# include <Siv3D/ImageDecoderStat.hpp>
 
 namespace s3d
 {
@@ -36,6 +37,20 @@ namespace s3d
 
 		virtual Image decode(IReader& reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha, ImageFormat imageFormat) = 0;
 
+		virtual Image decode(IReader& reader, FilePathView pathHint, const ImageDecodeOptions& options, ImageFormat imageFormat) = 0;
+
 		virtual Grid<uint16> decodeGray16(IReader& reader, FilePathView pathHint, ImageFormat imageFormat) = 0;
+
+		virtual Array<Image> decodeBatch(const Array<FilePath>& paths, const ImageDecodeOptions& options, ImageFormat imageFormat) = 0;
+
+		virtual void setCacheCapacity(size_t capacityBytes) = 0;
+
+		virtual size_t getCacheCapacity() const noexcept = 0;
+
+		virtual void clearCache() = 0;
+
+		virtual ImageDecoderStat getStat() const = 0;
+
+		virtual void resetStat() = 0;
 	};
 }
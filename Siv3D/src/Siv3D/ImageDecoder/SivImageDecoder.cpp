@@ -63,6 +63,23 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(ImageDecoder)->decode(reader, {}, premultiplyAlpha, imageFormat);
 		}
+
+		Image Decode(const FilePathView path, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+		{
+			BinaryReader reader{ path };
+
+			if (not reader)
+			{
+				return{};
+			}
+
+			return SIV3D_ENGINE(ImageDecoder)->decode(reader, path, options, imageFormat);
+		}
+
+		Image Decode(IReader& reader, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+		{
+			return SIV3D_ENGINE(ImageDecoder)->decode(reader, {}, options, imageFormat);
+		}
 		
 		////////////////////////////////////////////////////////////////
 		//
@@ -86,6 +103,77 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(ImageDecoder)->decodeGray16(reader, {}, imageFormat);
 		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DecodeBatch
+		//
+		////////////////////////////////////////////////////////////////
+
+		Array<Image> DecodeBatch(const Array<FilePath>& paths, const PremultiplyAlpha premultiplyAlpha, const ImageFormat imageFormat)
+		{
+			return SIV3D_ENGINE(ImageDecoder)->decodeBatch(paths, ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha }, imageFormat);
+		}
+
+		Array<Image> DecodeBatch(const Array<FilePath>& paths, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+		{
+			return SIV3D_ENGINE(ImageDecoder)->decodeBatch(paths, options, imageFormat);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	SetCacheCapacity
+		//
+		////////////////////////////////////////////////////////////////
+
+		void SetCacheCapacity(const size_t capacityBytes)
+		{
+			SIV3D_ENGINE(ImageDecoder)->setCacheCapacity(capacityBytes);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetCacheCapacity
+		//
+		////////////////////////////////////////////////////////////////
+
+		size_t GetCacheCapacity() noexcept
+		{
+			return SIV3D_ENGINE(ImageDecoder)->getCacheCapacity();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ClearCache
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ClearCache()
+		{
+			SIV3D_ENGINE(ImageDecoder)->clearCache();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		ImageDecoderStat GetStat()
+		{
+			return SIV3D_ENGINE(ImageDecoder)->getStat();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ResetStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ResetStat()
+		{
+			SIV3D_ENGINE(ImageDecoder)->resetStat();
+		}
 		
 		////////////////////////////////////////////////////////////////
 		//
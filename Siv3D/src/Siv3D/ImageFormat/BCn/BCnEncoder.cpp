@@ -14,7 +14,11 @@
 # include <Siv3D/MemoryWriter.hpp>
 # include <Siv3D/ImageProcessing.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Interpolation.hpp>
+# include <Siv3D/Threading.hpp>
 # include <ThirdParty/bc7enc_rdo/rdo_bc_encoder.h>
+# include <future>
+# include <span>
 
 namespace s3d
 {
@@ -51,262 +55,489 @@ namespace s3d
 			writer.write(header);
 		}
 
-		static void EncodeBC1(IWriter& writer, const Image& image)
+		/// @brief BC3 のアルファブロック、BC4 / BC5 の探索半径の最大値
+		constexpr uint32 MaxBC345SearchRadius = 32;
+
+		enum class BCnFormat : uint8
 		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+			BC1,
+
+			BC3,
+
+			BC4,
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+			BC5,
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			BC7,
+		};
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 8> block{};
+		/// @brief 1 ブロックあたりのバイト数を返します。
+		[[nodiscard]]
+		constexpr size_t GetBlockSize(const BCnFormat format) noexcept
+		{
+			return (((format == BCnFormat::BC1) || (format == BCnFormat::BC4)) ? 8 : 16);
+		}
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+		static void WriteHeader(IWriter& writer, const BCnFormat format, const uint32 width, const uint32 height, const uint32 mipCount)
+		{
+			switch (format)
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
+			case BCnFormat::BC1:
+				WriteDDSHeader(writer, PIXEL_FMT_DXT1, width, height, 4, mipCount);
+				break;
+			case BCnFormat::BC3:
+				WriteDDSHeader(writer, PIXEL_FMT_DXT5, width, height, 8, mipCount);
+				break;
+			case BCnFormat::BC4:
+				WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '4', 'U')), width, height, 4, mipCount);
+				break;
+			case BCnFormat::BC5:
+				WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '5', 'U')), width, height, 8, mipCount);
+				break;
+			case BCnFormat::BC7:
+				WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('D', 'X', '1', '0')), width, height, 8, mipCount);
+				WriteDX10Header(writer, DXGI_FORMAT_BC7_UNORM);
+				break;
+			}
+		}
+
+		/// @brief 画像から 4x4 のブロックを取り出します。画像の範囲外は端のピクセルで埋めます。
+		static void GetBlock(const Image& image, const uint32 bx, const uint32 by, uint8* pixels)
+		{
+			const uint32 width = image.width();
+			const uint32 height = image.height();
+			const uint32 dstBaseY = (by * 4);
+			const uint32 dstBaseX = (bx * 4);
+			uint8* pDst = pixels;
+
+			for (uint32 y = 0; y < 4; ++y)
+			{
+				if ((height <= (dstBaseY + y)))
 				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+					std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
+					pDst += (4 * sizeof(Color));
+					continue;
+				}
 
-					for (uint32 y = 0; y < 4; ++y)
-					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
+				const Color* pSrcLine = image[dstBaseY + y];
 
-						for (uint32 x = 0; x < 4; ++x)
-						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
-						}
+				if ((dstBaseX + 4) <= width)
+				{
+					std::memcpy(pDst, (pSrcLine + dstBaseX), (4 * sizeof(Color)));
+					pDst += (4 * sizeof(Color));
+					continue;
+				}
+
+				for (uint32 x = 0; x < 4; ++x)
+				{
+					if ((width <= (dstBaseX + x)))
+					{
+						std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
+						pDst += sizeof(Color);
+						continue;
 					}
 
-					rgbcx::encode_bc1(rgbcx::MAX_LEVEL, block.data(), pixels, true, false);
-					writer.write(block);
+					std::memcpy(pDst, &pSrcLine[dstBaseX + x], sizeof(Color));
+					pDst += sizeof(Color);
 				}
 			}
 		}
 
-		static void EncodeBC3(IWriter& writer, const Image& image)
+		////////////////////////////////////////////////////////////////
+		//
+		//	BlockEncoder
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 1 ブロックをエンコードする関数オブジェクト
+		/// @remark 状態を書き換えないため、複数のスレッドから同時に呼び出せます。
+		class BlockEncoder
 		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+		public:
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+			[[nodiscard]]
+			BlockEncoder(const BCnFormat format, const BCnEncodeOptions& options)
+				: m_format{ format }
+				, m_bc1QualityLevel{ Min(options.bc1QualityLevel, rgbcx::MAX_LEVEL) }
+				, m_bc345SearchRadius{ Clamp(options.bc345SearchRadius, 1u, MaxBC345SearchRadius) }
+			{
+				bc7enc_compress_block_params_init(&m_bc7Params);
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+				if (not options.perceptual)
+				{
+					bc7enc_compress_block_params_init_linear_weights(&m_bc7Params);
+				}
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 16> block{};
+				m_bc7Params.m_uber_level = Min(options.bc7UberLevel, static_cast<uint32>(BC7ENC_MAX_UBER_LEVEL));
+				m_bc7Params.m_max_partitions = Min(options.bc7MaxPartitions, static_cast<uint32>(BC7ENC_MAX_PARTITIONS));
+			}
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			void operator ()(void* pDst, const uint8* pixels) const
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
+				switch (m_format)
 				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+				case BCnFormat::BC1:
+					rgbcx::encode_bc1(m_bc1QualityLevel, pDst, pixels, true, false);
+					break;
+				case BCnFormat::BC3:
+					rgbcx::encode_bc3_hq(m_bc1QualityLevel, pDst, pixels, m_bc345SearchRadius);
+					break;
+				case BCnFormat::BC4:
+					rgbcx::encode_bc4_hq(pDst, pixels, 4, m_bc345SearchRadius);
+					break;
+				case BCnFormat::BC5:
+					rgbcx::encode_bc5_hq(pDst, pixels, 0, 1, 4, m_bc345SearchRadius);
+					break;
+				case BCnFormat::BC7:
+					bc7enc_compress_block(pDst, pixels, &m_bc7Params);
+					break;
+				}
+			}
 
-					for (uint32 y = 0; y < 4; ++y)
-					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
+		private:
 
-						for (uint32 x = 0; x < 4; ++x)
-						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
-						}
-					}
+			BCnFormat m_format;
 
-					rgbcx::encode_bc3_hq(rgbcx::MAX_LEVEL, block.data(), pixels);
-					writer.write(block);
-				}
+			uint32 m_bc1QualityLevel;
+
+			uint32 m_bc345SearchRadius;
+
+			bc7enc_compress_block_params m_bc7Params;
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	MipLevel
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief エンコード先のバッファ上の 1 つのミップレベル
+		struct MipLevel
+		{
+			const Image* image = nullptr;
+
+			/// @brief バッファ上の先頭ブロックのインデックス
+			size_t firstBlock = 0;
+
+			uint32 xBlocks = 0;
+
+			uint32 yBlocks = 0;
+
+			[[nodiscard]]
+			size_t numBlocks() const noexcept
+			{
+				return (static_cast<size_t>(xBlocks) * yBlocks);
+			}
+		};
+
+		/// @brief ミップマップを生成します。
+		/// @param image 元の画像
+		/// @param mipCount ミップレベルの数（元の画像を含む）
+		/// @return レベル 1 以降の画像
+		[[nodiscard]]
+		static Array<Image> MakeMipmaps(const Image& image, const uint32 mipCount)
+		{
+			Array<Image> mipmaps(Arg::reserve = (mipCount - 1));
+
+			for (uint32 mip = 1; mip < mipCount; ++mip)
+			{
+				const Size mipSize{ Max(1, (image.width() >> mip)), Max(1, (image.height() >> mip)) };
+				const Image& previousImage = ((mip == 1) ? image : mipmaps.back());
+				mipmaps << ImageProcessing::Resample(previousImage, mipSize, ResampleFilter::Mitchell);
 			}
+
+			return mipmaps;
 		}
 
-		static void EncodeBC4(IWriter& writer, const Image& image)
+		/// @brief 複数のミップレベルのブロック行を並列にエンコードします。
+		/// @param levels エンコードするミップレベル
+		/// @param encoder ブロックのエンコーダ
+		/// @param blockSize 1 ブロックあたりのバイト数
+		/// @param blocks エンコード先のバッファ
+		static void EncodeLevels(const std::span<const MipLevel> levels, const BlockEncoder& encoder, const size_t blockSize, uint8* blocks)
 		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+			struct BlockRow
+			{
+				const MipLevel* level;
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+				uint32 by;
+			};
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			Array<BlockRow> rows;
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 8> block{};
+			for (const auto& level : levels)
+			{
+				for (uint32 by = 0; by < level.yBlocks; ++by)
+				{
+					rows.push_back({ &level, by });
+				}
+			}
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			// 小さいミップレベルの行も含めて、すべての行を 1 回の ParallelFor で処理する
+			Threading::ParallelFor(0, rows.size(), [&](const size_t begin, const size_t end)
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
+				uint8 pixels[16 * 4 * 4]{};
+
+				for (size_t i = begin; i < end; ++i)
 				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+					const BlockRow& row = rows[i];
+					const MipLevel& level = *row.level;
+					uint8* pDst = (blocks + ((level.firstBlock + static_cast<size_t>(row.by) * level.xBlocks) * blockSize));
 
-					for (uint32 y = 0; y < 4; ++y)
+					for (uint32 bx = 0; bx < level.xBlocks; ++bx)
 					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
+						GetBlock(*level.image, bx, row.by, pixels);
+						encoder(pDst, pixels);
+						pDst += blockSize;
+					}
+				}
+			});
+		}
 
-						for (uint32 x = 0; x < 4; ++x)
+		////////////////////////////////////////////////////////////////
+		//
+		//	RDO
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief RDO で 1 回に処理するブロック数
+		/// @remark 分割した範囲ごとに並列に処理します。小さすぎると、範囲をまたいだ一致を探せず圧縮率が下がります。
+		constexpr size_t RDOBlocksPerChunk = 4096;
+
+		/// @brief BC1 のブロックを展開します。3 色モードのブロックは、透明なテクセルを使わない場合に限り許可します。
+		static bool UnpackBC1Block(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
+		{
+			if (rgbcx::unpack_bc1(pBlock, pPixels, true, rgbcx::bc1_approx_mode::cBC1Ideal))
+			{
+				const rgbcx::bc1_block* pBC1Block = static_cast<const rgbcx::bc1_block*>(pBlock);
+
+				for (uint32 y = 0; y < 4; ++y)
+				{
+					for (uint32 x = 0; x < 4; ++x)
+					{
+						if (pBC1Block->get_selector(x, y) == 3)
 						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
+							return false;
 						}
 					}
-
-					rgbcx::encode_bc4_hq(block.data(), pixels);
-					writer.write(block);
 				}
 			}
+
+			return true;
 		}
 
-		static void EncodeBC5(IWriter& writer, const Image& image)
+		/// @brief BC3 のカラーブロックを展開します。BC3 では 3 色モードを使えません。
+		static bool UnpackBC3ColorBlock(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
 		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+			return (not rgbcx::unpack_bc1(pBlock, pPixels, true, rgbcx::bc1_approx_mode::cBC1Ideal));
+		}
+
+		static bool UnpackBC4Block(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
+		{
+			std::memset(pPixels, 0, (sizeof(ert::color_rgba) * 16));
+			rgbcx::unpack_bc4(pBlock, reinterpret_cast<uint8*>(pPixels), 4);
+			return true;
+		}
+
+		static bool UnpackBC7Block(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
+		{
+			return bc7decomp::unpack_bc7(pBlock, reinterpret_cast<bc7decomp::color_rgba*>(pPixels));
+		}
+
+		/// @brief 元のピクセルのうち 1 チャンネルだけを、R チャンネルに移します。
+		static void ExtractChannel(ert::color_rgba* pixels, const size_t numPixels, const size_t channel)
+		{
+			for (size_t i = 0; i < numPixels; ++i)
+			{
+				pixels[i] = ert::color_rgba{ { pixels[i].m_c[channel], 0, 0, 0 } };
+			}
+		}
+
+		[[nodiscard]]
+		static ert::reduce_entropy_params MakeERTParams(const BCnEncodeOptions& options, const float autoMinScale, const float autoMaxScale, const float autoLambdaRange, const uint32 numComponents)
+		{
+			ert::reduce_entropy_params params;
+			params.m_lambda = options.rdoLambda;
+			params.m_lookback_window_size = Max(16u, options.rdoLookbackWindowSize);
+			params.m_max_smooth_block_std_dev = 18.0f;
+			params.m_try_two_matches = true;
+
+			if (0.0f < options.rdoSmoothBlockErrorScale)
+			{
+				params.m_smooth_block_max_mse_scale = options.rdoSmoothBlockErrorScale;
+			}
+			else
+			{
+				params.m_smooth_block_max_mse_scale = Math::Lerp(autoMinScale, autoMaxScale, Min(1.0f, (options.rdoLambda / autoLambdaRange)));
+			}
+
+			for (uint32 i = numComponents; i < 4; ++i)
+			{
+				params.m_color_weights[i] = 0;
+			}
+
+			return params;
+		}
+
+		/// @brief ブロック列に RDO を適用します。
+		/// @remark bc7enc_rdo の rdo_bc_encoder::postprocess_rdo() と同じ設定で ERT (Entropy Reduction Transform) を行います。
+		static void ReduceEntropy(const std::span<const MipLevel> levels, const BCnFormat format, const BCnEncodeOptions& options, const size_t blockSize, uint8* blocks)
+		{
+			struct Chunk
+			{
+				const MipLevel* level;
+
+				size_t firstBlock;
+
+				size_t numBlocks;
+			};
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+			Array<Chunk> chunks;
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			for (const auto& level : levels)
+			{
+				for (size_t i = 0; i < level.numBlocks(); i += RDOBlocksPerChunk)
+				{
+					chunks.push_back({ &level, i, Min(RDOBlocksPerChunk, (level.numBlocks() - i)) });
+				}
+			}
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 16> block{};
+			const ert::reduce_entropy_params rgbaParams	= MakeERTParams(options, 15.0f, 50.0f, 4.0f, 4);
+			const ert::reduce_entropy_params rgbParams	= MakeERTParams(options, 15.0f, 50.0f, 8.0f, 3);
+			const ert::reduce_entropy_params rParams	= MakeERTParams(options, 10.0f, 30.0f, 4.0f, 1);
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			Threading::ParallelFor(0, chunks.size(), [&](const size_t begin, const size_t end)
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
+				Array<ert::color_rgba> pixels;
+				Array<ert::color_rgba> channelPixels;
+
+				for (size_t c = begin; c < end; ++c)
 				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+					const Chunk& chunk = chunks[c];
+					const MipLevel& level = *chunk.level;
+					const uint32 numBlocks = static_cast<uint32>(chunk.numBlocks);
+					uint8* pBlocks = (blocks + ((level.firstBlock + chunk.firstBlock) * blockSize));
+
+					pixels.resize(chunk.numBlocks * 16);
+
+					for (size_t i = 0; i < chunk.numBlocks; ++i)
+					{
+						const size_t blockIndex = (chunk.firstBlock + i);
+						GetBlock(*level.image, static_cast<uint32>(blockIndex % level.xBlocks), static_cast<uint32>(blockIndex / level.xBlocks), reinterpret_cast<uint8*>(&pixels[i * 16]));
+					}
+
+					uint32 totalModified = 0;
 
-					for (uint32 y = 0; y < 4; ++y)
+					switch (format)
 					{
-						if ((height <= (dstBaseY + y)))
+					case BCnFormat::BC1:
 						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
+							ert::reduce_entropy(pBlocks, numBlocks, 8, 8, 4, 4, 3, pixels.data(), rgbParams, totalModified, UnpackBC1Block, nullptr);
+							break;
 						}
-
-						for (uint32 x = 0; x < 4; ++x)
+					case BCnFormat::BC3:
+						{
+							channelPixels = pixels;
+							ExtractChannel(channelPixels.data(), channelPixels.size(), 3);
+							ert::reduce_entropy(pBlocks, numBlocks, 16, 8, 4, 4, 1, channelPixels.data(), rParams, totalModified, UnpackBC4Block, nullptr);
+							ert::reduce_entropy((pBlocks + 8), numBlocks, 16, 8, 4, 4, 3, pixels.data(), rgbParams, totalModified, UnpackBC3ColorBlock, nullptr);
+							break;
+						}
+					case BCnFormat::BC4:
+						{
+							ExtractChannel(pixels.data(), pixels.size(), 0);
+							ert::reduce_entropy(pBlocks, numBlocks, 8, 8, 4, 4, 1, pixels.data(), rParams, totalModified, UnpackBC4Block, nullptr);
+							break;
+						}
+					case BCnFormat::BC5:
 						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
+							channelPixels = pixels;
+							ExtractChannel(channelPixels.data(), channelPixels.size(), 0);
+							ert::reduce_entropy(pBlocks, numBlocks, 16, 8, 4, 4, 1, channelPixels.data(), rParams, totalModified, UnpackBC4Block, nullptr);
+							ExtractChannel(pixels.data(), pixels.size(), 1);
+							ert::reduce_entropy((pBlocks + 8), numBlocks, 16, 8, 4, 4, 1, pixels.data(), rParams, totalModified, UnpackBC4Block, nullptr);
+							break;
+						}
+					case BCnFormat::BC7:
+						{
+							ert::reduce_entropy(pBlocks, numBlocks, 16, 16, 4, 4, 4, pixels.data(), rgbaParams, totalModified, UnpackBC7Block, nullptr);
+							break;
 						}
 					}
-
-					rgbcx::encode_bc5_hq(block.data(), pixels);
-					writer.write(block);
 				}
-			}
+			}, 1);
 		}
 
-		static void EncodeBC7(IWriter& writer, const Image& image)
+		////////////////////////////////////////////////////////////////
+		//
+		//	EncodeBCn
+		//
+		////////////////////////////////////////////////////////////////
+
+		static bool EncodeBCn(const Image& image, IWriter& writer, const BCnFormat format, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options)
 		{
+			if (not writer.isOpen())
+			{
+				return false;
+			}
+
 			const uint32 width = image.width();
 			const uint32 height = image.height();
+			if (((width % 4) != 0) || ((height % 4) != 0))
+			{
+				return false;
+			}
+
+			const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
+			const size_t blockSize = GetBlockSize(format);
+			const BlockEncoder encoder{ format, options };
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+			Array<MipLevel> levels;
+			size_t totalBlocks = 0;
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			for (uint32 mip = 0; mip < mipCount; ++mip)
+			{
+				const uint32 mipWidth = Max(1u, (width >> mip));
+				const uint32 mipHeight = Max(1u, (height >> mip));
+				const MipLevel level{ .firstBlock = totalBlocks, .xBlocks = ((mipWidth + 3) / 4), .yBlocks = ((mipHeight + 3) / 4) };
+				totalBlocks += level.numBlocks();
+				levels << level;
+			}
 
-			bc7enc_compress_block_params bc7Params{};
-			bc7enc_compress_block_params_init(&bc7Params);
+			// すべてのミップレベルのブロックを格納するバッファ
+			Array<uint8> blocks(totalBlocks * blockSize);
+			Array<Image> mipmaps;
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 16> block{};
+			levels.front().image = &image;
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			if (mipCount == 1)
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
-				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+				EncodeLevels(levels, encoder, blockSize, blocks.data());
+			}
+			else
+			{
+				// レベル 0 をエンコードしている間に、別のスレッドでミップマップを生成する
+				auto mipmapsTask = std::async(std::launch::async, [&]() { return MakeMipmaps(image, mipCount); });
 
-					for (uint32 y = 0; y < 4; ++y)
-					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
+				EncodeLevels(std::span{ levels }.first(1), encoder, blockSize, blocks.data());
 
-						for (uint32 x = 0; x < 4; ++x)
-						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
-						}
-					}
+				mipmaps = mipmapsTask.get();
 
-					bc7enc_compress_block(block.data(), pixels, &bc7Params);
-					writer.write(block);
+				for (uint32 mip = 1; mip < mipCount; ++mip)
+				{
+					levels[mip].image = &mipmaps[mip - 1];
 				}
+
+				EncodeLevels(std::span{ levels }.subspan(1), encoder, blockSize, blocks.data());
 			}
+
+			if (0.0f < options.rdoLambda)
+			{
+				ReduceEntropy(levels, format, options, blockSize, blocks.data());
+			}
+
+			WriteHeader(writer, format, width, height, mipCount);
+			return (writer.write(blocks.data(), blocks.size_bytes()) == static_cast<int64>(blocks.size_bytes()));
 		}
 	}
 
@@ -403,60 +634,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC1(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC1(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, PIXEL_FMT_DXT1, width, height, 4, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC1(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-				
-				EncodeBC1(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(image, writer, BCnFormat::BC1, generateMipmaps, options);
 	}
 
-	Blob BCnEncoder::encodeBC1(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC1(const Image& image, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
 		MemoryWriter writer;
 	
-		if (not encodeBC1(image, writer, generateMipmaps))
+		if (not encodeBC1(image, writer, generateMipmaps, options))
 		{
 			return{};
 		}
@@ -470,60 +657,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC3(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC3(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, PIXEL_FMT_DXT5, width, height, 8, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC3(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC3(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(image, writer, BCnFormat::BC3, generateMipmaps, options);
 	}
 
-	Blob BCnEncoder::encodeBC3(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC3(const Image& image, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
 		MemoryWriter writer;
 
-		if (not encodeBC3(image, writer, generateMipmaps))
+		if (not encodeBC3(image, writer, generateMipmaps, options))
 		{
 			return{};
 		}
@@ -537,60 +680,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC4(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC4(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '4', 'U')), width, height, 4, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC4(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC4(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(image, writer, BCnFormat::BC4, generateMipmaps, options);
 	}
 
-	Blob BCnEncoder::encodeBC4(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC4(const Image& image, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
 		MemoryWriter writer;
 
-		if (not encodeBC4(image, writer, generateMipmaps))
+		if (not encodeBC4(image, writer, generateMipmaps, options))
 		{
 			return{};
 		}
@@ -604,60 +703,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC5(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC5(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '5', 'U')), width, height, 8, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC5(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC5(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(image, writer, BCnFormat::BC5, generateMipmaps, options);
 	}
 
-	Blob BCnEncoder::encodeBC5(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC5(const Image& image, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
 		MemoryWriter writer;
 		
-		if (not encodeBC5(image, writer, generateMipmaps))
+		if (not encodeBC5(image, writer, generateMipmaps, options))
 		{
 			return{};
 		}
@@ -671,61 +726,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC7(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC7(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('D', 'X', '1', '0')), width, height, 8, mipCount);
-		WriteDX10Header(writer, DXGI_FORMAT_BC7_UNORM);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC7(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC7(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(image, writer, BCnFormat::BC7, generateMipmaps, options);
 	}
 
-	Blob BCnEncoder::encodeBC7(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC7(const Image& image, const GenerateMipmaps generateMipmaps, const BCnEncodeOptions& options) const
 	{
 		MemoryWriter writer;
 
-		if (not encodeBC7(image, writer, generateMipmaps))
+		if (not encodeBC7(image, writer, generateMipmaps, options))
 		{
 			return{};
 		}
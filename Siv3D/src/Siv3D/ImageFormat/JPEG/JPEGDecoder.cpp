@@ -11,7 +11,9 @@
 
 # include <Siv3D/ImageFormat/JPEGDecoder.hpp>
 # include <Siv3D/IReader.hpp>
+# include <Siv3D/ScopeExit.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/IImageDecoder/CropDecodedImage.hpp>
 # if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
 #	include <ThirdParty-prebuilt/libjpeg-turbo/turbojpeg.h>
 # else
@@ -192,4 +194,142 @@ namespace s3d
 
 		return image;
 	}
+
+	Image JPEGDecoder::decode(IReader& reader, const FilePathView, const ImageDecodeOptions& options) const
+	{
+		LOG_SCOPED_DEBUG("JPEGDecoder::decode(options)");
+
+		Array<uint8> buffer(static_cast<size_t>(reader.size()));
+
+		if (reader.read(buffer.data(), static_cast<int64>(buffer.size())) != static_cast<int64>(buffer.size()))
+		{
+			return{};
+		}
+
+	# if defined(TJ_NUMINIT) // TurboJPEG 3.0 以降
+
+		tjhandle tj = ::tj3Init(TJINIT_DECOMPRESS);
+
+		if (not tj)
+		{
+			return{};
+		}
+
+		ScopeExit cleanup = [&]()
+		{
+			::tj3Destroy(tj);
+		};
+
+		if (::tj3DecompressHeader(tj, buffer.data(), buffer.size()) != 0)
+		{
+			LOG_FAIL(fmt::format("❌ JPEGDecoder::decode(): {}", ::tj3GetErrorStr(tj)));
+			return{};
+		}
+
+		const Size imageSize{ ::tj3Get(tj, TJPARAM_JPEGWIDTH), ::tj3Get(tj, TJPARAM_JPEGHEIGHT) };
+		const Rect region = options.getRegion(imageSize);
+
+		if (region.isEmpty())
+		{
+			return{};
+		}
+
+		// ロスレス JPEG は縮小と部分的なデコードに対応しない
+		const bool lossless = (::tj3Get(tj, TJPARAM_LOSSLESS) == 1);
+		const int32 denominator = (lossless ? 1 : options.getScaleDenominator(region.size, 8));
+		const tjscalingfactor scalingFactor{ 1, denominator };
+
+		if (::tj3SetScalingFactor(tj, scalingFactor) != 0)
+		{
+			LOG_FAIL(fmt::format("❌ JPEGDecoder::decode(): {}", ::tj3GetErrorStr(tj)));
+			return{};
+		}
+
+		// 縮小後の画像での範囲
+		const Size scaledImageSize{ TJSCALED(imageSize.x, scalingFactor), TJSCALED(imageSize.y, scalingFactor) };
+		const int32 x0 = (region.x / denominator);
+		const int32 y0 = (region.y / denominator);
+		const int32 x1 = Min(((region.x + region.w + denominator - 1) / denominator), scaledImageSize.x);
+		const int32 y1 = Min(((region.y + region.h + denominator - 1) / denominator), scaledImageSize.y);
+
+		// 部分的なデコードでは、左端を MCU の幅の倍数にそろえる必要がある
+		const int subsampling = ::tj3Get(tj, TJPARAM_SUBSAMP);
+		const int32 mcuWidth = (InRange(subsampling, 0, (TJ_NUMSAMP - 1)) ? TJSCALED(tjMCUWidth[subsampling], scalingFactor) : 0);
+		Rect decodeRegion{ 0, 0, scaledImageSize };
+
+		if ((not lossless) && (0 < mcuWidth)
+			&& ((x0 != 0) || (y0 != 0) || (x1 != scaledImageSize.x) || (y1 != scaledImageSize.y)))
+		{
+			const int32 alignedX0 = (x0 - (x0 % mcuWidth));
+			const tjregion croppingRegion{ alignedX0, y0, (x1 - alignedX0), (y1 - y0) };
+
+			if (::tj3SetCroppingRegion(tj, croppingRegion) == 0)
+			{
+				decodeRegion.set(croppingRegion.x, croppingRegion.y, croppingRegion.w, croppingRegion.h);
+			}
+		}
+
+		Image image(decodeRegion.size);
+
+		if (::tj3Decompress8(tj, buffer.data(), buffer.size(), image.dataAsUint8(), static_cast<int>(image.bytesPerRow()), TJPF_RGBA) != 0)
+		{
+			LOG_FAIL(fmt::format("❌ JPEGDecoder::decode(): {}", ::tj3GetErrorStr(tj)));
+			return{};
+		}
+
+	# else
+
+		tjhandle tj = ::tjInitDecompress();
+
+		if (not tj)
+		{
+			return{};
+		}
+
+		ScopeExit cleanup = [&]()
+		{
+			::tjDestroy(tj);
+		};
+
+		int width = 0, height = 0, subsampling = 0, colorspace = 0;
+
+		if (::tjDecompressHeader3(tj, buffer.data(), static_cast<unsigned long>(buffer.size()), &width, &height, &subsampling, &colorspace) != 0)
+		{
+			LOG_FAIL(fmt::format("❌ JPEGDecoder::decode(): {}", ::tjGetErrorStr2(tj)));
+			return{};
+		}
+
+		const Size imageSize{ width, height };
+		const Rect region = options.getRegion(imageSize);
+
+		if (region.isEmpty())
+		{
+			return{};
+		}
+
+		// TurboJPEG 2 は部分的なデコードに対応しないため、縮小した画像全体をデコードしてから切り出す
+		const int32 denominator = options.getScaleDenominator(region.size, 8);
+		const tjscalingfactor scalingFactor{ 1, denominator };
+		const Size scaledImageSize{ TJSCALED(imageSize.x, scalingFactor), TJSCALED(imageSize.y, scalingFactor) };
+		const int32 x0 = (region.x / denominator);
+		const int32 y0 = (region.y / denominator);
+		const int32 x1 = Min(((region.x + region.w + denominator - 1) / denominator), scaledImageSize.x);
+		const int32 y1 = Min(((region.y + region.h + denominator - 1) / denominator), scaledImageSize.y);
+		const Rect decodeRegion{ 0, 0, scaledImageSize };
+
+		Image image(decodeRegion.size);
+
+		if (::tjDecompress2(tj, buffer.data(), static_cast<unsigned long>(buffer.size()), image.dataAsUint8(),
+			image.width(), static_cast<int>(image.bytesPerRow()), image.height(), TJPF_RGBA, 0) != 0)
+		{
+			LOG_FAIL(fmt::format("❌ JPEGDecoder::decode(): {}", ::tjGetErrorStr2(tj)));
+			return{};
+		}
+
+	# endif
+
+		LOG_TRACE(fmt::format("Image ({}x{}, 1/{}) decoded", decodeRegion.w, decodeRegion.h, denominator));
+
+		return detail::CropDecodedImage(std::move(image), Rect{ (x0 - decodeRegion.x), (y0 - decodeRegion.y), (x1 - x0), (y1 - y0) });
+	}
 }
@@ -30,6 +30,57 @@ namespace s3d
 
 			reader->read(buf, length);
 		}
+
+		/// @brief 画像を 8-bit RGBA で読み込むよう設定します。
+		static void SetRGBATransforms(png_structp png_ptr, png_infop info_ptr, const int iBitDepth, const int iColorType)
+		{
+			if (iColorType == PNG_COLOR_TYPE_PALETTE)
+			{
+				LOG_TRACE("png_set_palette_to_rgb()");
+				::png_set_palette_to_rgb(png_ptr);
+			}
+
+			if (::png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
+			{
+				LOG_TRACE("png_set_tRNS_to_alpha()");
+				::png_set_tRNS_to_alpha(png_ptr);
+			}
+
+			if (iColorType == PNG_COLOR_TYPE_GRAY && iBitDepth < 8)
+			{
+				LOG_TRACE("png_set_expand_gray_1_2_4_to_8()");
+				::png_set_expand_gray_1_2_4_to_8(png_ptr);
+			}
+
+			if (iBitDepth == 16)
+			{
+				LOG_TRACE("png_set_scale_16()");
+				::png_set_scale_16(png_ptr);
+			}
+
+			if (iBitDepth < 8)
+			{
+				LOG_TRACE("png_set_packing()");
+				::png_set_packing(png_ptr);
+			}
+
+			if ((iColorType == PNG_COLOR_TYPE_GRAY)
+				|| (iColorType == PNG_COLOR_TYPE_GRAY_ALPHA))
+			{
+				LOG_TRACE("png_set_gray_to_rgb()");
+				::png_set_gray_to_rgb(png_ptr);
+			}
+
+			::png_set_add_alpha(png_ptr, 0xff, PNG_FILLER_AFTER);
+
+			double dGamma;
+
+			if (::png_get_gAMA(png_ptr, info_ptr, &dGamma))
+			{
+				LOG_TRACE("png_set_gamma()");
+				::png_set_gamma(png_ptr, 2.2, dGamma);
+			}
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -222,80 +273,134 @@ namespace s3d
 			return{};
 		}
 
-		if (iColorType == PNG_COLOR_TYPE_PALETTE)
+		SetRGBATransforms(png_ptr, info_ptr, iBitDepth, iColorType);
+
+		::png_read_update_info(png_ptr, info_ptr);
+
+		const int nChannels = ::png_get_channels(png_ptr, info_ptr);
+
+		::png_get_IHDR(png_ptr, info_ptr, &width, &height, &iBitDepth, &iColorType, nullptr, nullptr, nullptr);
+
+		Image image(width, height);
+
+		Array<uint8*> ppbRowPointers(height);
 		{
-			LOG_TRACE("png_set_palette_to_rgb()");
-			::png_set_palette_to_rgb(png_ptr);
+			const size_t stride = (static_cast<size_t>(width) * nChannels);
+			uint8* pixels = image.dataAsUint8();
+
+			for (size_t i = 0; i < height; ++i)
+			{
+				ppbRowPointers[i] = pixels;
+				pixels += stride;
+			}
 		}
 
-		if (::png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
+		::png_read_image(png_ptr, ppbRowPointers.data());
+
+		::png_read_end(png_ptr, nullptr);
+
+		LOG_TRACE(fmt::format("Image ({}x{}) decoded", width, height));
+
+		if (premultiplyAlpha)
 		{
-			LOG_TRACE("png_set_tRNS_to_alpha()");
-			::png_set_tRNS_to_alpha(png_ptr);
+			image.premultiplyAlpha();
 		}
 
-		if (iColorType == PNG_COLOR_TYPE_GRAY && iBitDepth < 8)
+		return image;
+	}
+
+	Image PNGDecoder::decode(IReader& reader, const FilePathView pathHint, const ImageDecodeOptions& options) const
+	{
+		LOG_SCOPED_DEBUG("PNGDecoder::decode(options)");
+
+		if (not options.region)
 		{
-			LOG_TRACE("png_set_expand_gray_1_2_4_to_8()");
-			::png_set_expand_gray_1_2_4_to_8(png_ptr);
+			return decode(reader, pathHint, options.premultiplyAlpha);
 		}
 
-		if (iBitDepth == 16)
+		const int64 startPos = reader.getPos();
+
+		// png_ptr
+		png_structp png_ptr = ::png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
 		{
-			LOG_TRACE("png_set_scale_16()");
-			::png_set_scale_16(png_ptr);
+			if (not png_ptr)
+			{
+				return{};
+			}
 		}
 
-		if (iBitDepth < 8)
+		ScopeExit cleanup_struct = [&]()
 		{
-			LOG_TRACE("png_set_packing()");
-			::png_set_packing(png_ptr);
+			::png_destroy_read_struct(&png_ptr, nullptr, nullptr);
+		};
+
+		// info_ptr
+		png_infop info_ptr = ::png_create_info_struct(png_ptr);
+		{
+			if (not info_ptr)
+			{
+				return{};
+			}
 		}
 
-		if ((iColorType == PNG_COLOR_TYPE_GRAY)
-			|| (iColorType == PNG_COLOR_TYPE_GRAY_ALPHA))
+		ScopeExit cleanup_info = [&]()
+		{
+			::png_destroy_info_struct(png_ptr, &info_ptr);
+		};
+
+		// decode
+		::png_set_read_fn(png_ptr, &reader, PngReadCallback);
+
+		::png_read_info(png_ptr, info_ptr);
+
+		png_uint_32 width = 0, height = 0;
+
+		int iBitDepth, iColorType, iInterlaceType;
+
+		::png_get_IHDR(png_ptr, info_ptr, &width, &height, &iBitDepth, &iColorType, &iInterlaceType, nullptr, nullptr);
+
+		if ((Image::MaxWidth < width) || (Image::MaxHeight < height))
 		{
-			LOG_TRACE("png_set_gray_to_rgb()");
-			::png_set_gray_to_rgb(png_ptr);
+			LOG_FAIL(fmt::format("PNGDecoder::decode(): Image size {}x{} is not supported", width, height));
+			return{};
 		}
 
-		::png_set_add_alpha(png_ptr, 0xff, PNG_FILLER_AFTER);
+		// インターレースされた画像は、最後のパスまで読まないと行が完成しない
+		if (iInterlaceType != PNG_INTERLACE_NONE)
+		{
+			reader.setPos(startPos);
+			return IImageDecoder::decode(reader, pathHint, options);
+		}
 
-		double dGamma;
+		const Rect region = options.getRegion(Size{ static_cast<int32>(width), static_cast<int32>(height) });
 
-		if (::png_get_gAMA(png_ptr, info_ptr, &dGamma))
+		if (region.isEmpty())
 		{
-			LOG_TRACE("png_set_gamma()");
-			::png_set_gamma(png_ptr, 2.2, dGamma);
+			return{};
 		}
 
-		::png_read_update_info(png_ptr, info_ptr);
+		SetRGBATransforms(png_ptr, info_ptr, iBitDepth, iColorType);
 
-		const int nChannels = ::png_get_channels(png_ptr, info_ptr);
+		::png_read_update_info(png_ptr, info_ptr);
 
-		::png_get_IHDR(png_ptr, info_ptr, &width, &height, &iBitDepth, &iColorType, nullptr, nullptr, nullptr);
+		Array<Color> row(width);
 
-		Image image(width, height);
+		Image image(region.size);
 
-		Array<uint8*> ppbRowPointers(height);
+		// 範囲より上の行は読み飛ばし、範囲の最後の行より後は読まない
+		for (int32 y = 0; y < (region.y + region.h); ++y)
 		{
-			const size_t stride = (static_cast<size_t>(width) * nChannels);
-			uint8* pixels = image.dataAsUint8();
+			::png_read_row(png_ptr, reinterpret_cast<png_bytep>(row.data()), nullptr);
 
-			for (size_t i = 0; i < height; ++i)
+			if (region.y <= y)
 			{
-				ppbRowPointers[i] = pixels;
-				pixels += stride;
+				std::memcpy(image[y - region.y], (row.data() + region.x), (region.w * sizeof(Color)));
 			}
 		}
 
-		::png_read_image(png_ptr, ppbRowPointers.data());
-
-		::png_read_end(png_ptr, nullptr);
+		LOG_TRACE(fmt::format("Image ({}x{}) decoded from rows [{}, {})", region.w, region.h, region.y, (region.y + region.h)));
 
-		LOG_TRACE(fmt::format("Image ({}x{}) decoded", width, height));
-
-		if (premultiplyAlpha)
+		if (options.premultiplyAlpha)
 		{
 			image.premultiplyAlpha();
 		}
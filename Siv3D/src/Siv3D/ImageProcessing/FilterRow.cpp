@@ -0,0 +1,944 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cmath>
+# include <cstring>
+# include <limits>
+# include <Siv3D/CPUInfo.hpp>
+# include <Siv3D/SIMD.hpp>
+# include "FilterRow.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		template <class Type>
+		[[nodiscard]]
+		static Type RoundToInteger(const float value) noexcept
+		{
+			constexpr float MaxValue = static_cast<float>(std::numeric_limits<Type>::max());
+			return static_cast<Type>(std::lrintf((value < 0.0f) ? 0.0f : ((MaxValue < value) ? MaxValue : value)));
+		}
+
+		[[nodiscard]]
+		static uint8 Div255(const uint32 x) noexcept
+		{
+			const uint32 t = (x + 128);
+			return static_cast<uint8>((t + (t >> 8)) >> 8);
+		}
+
+		[[nodiscard]]
+		static uint8 CompositeChannel(const uint8 src, const uint8 dst, const uint8 inverseAlpha) noexcept
+		{
+			const uint32 result = (src + Div255(static_cast<uint32>(dst) * inverseAlpha));
+			return static_cast<uint8>((result < 255) ? result : 255);
+		}
+
+	# if SIV3D_INTRINSIC(SSE)
+
+		/// @brief 8 個の 16 ビット整数 x について、round(x / 255) を計算します。
+		[[nodiscard]]
+		static __m128i Div255_SSE41(__m128i x) noexcept
+		{
+			x = _mm_add_epi16(x, _mm_set1_epi16(128));
+			return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+		}
+
+		/// @brief 16 個の 16 ビット整数 x について、round(x / 255) を計算します。
+		[[nodiscard]]
+		static __m256i Div255_AVX2(__m256i x) noexcept
+		{
+			x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+			return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+		}
+
+	# endif
+	}
+
+	namespace FilterRow
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	ToFloat
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ToFloat(const uint8* src, float* dst, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 16) <= count; i += 16)
+				{
+					const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+					_mm256_storeu_ps((dst + i), _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)));
+					_mm256_storeu_ps((dst + i + 8), _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8))));
+				}
+			}
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm_storeu_ps((dst + i), _mm_cvtepi32_ps(_mm_cvtepu8_epi32(v)));
+				_mm_storeu_ps((dst + i + 4), _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 4))));
+				_mm_storeu_ps((dst + i + 8), _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 8))));
+				_mm_storeu_ps((dst + i + 12), _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 12))));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const uint8x16_t v = vld1q_u8(src + i);
+				const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+				const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+				vst1q_f32((dst + i), vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))));
+				vst1q_f32((dst + i + 4), vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))));
+				vst1q_f32((dst + i + 8), vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))));
+				vst1q_f32((dst + i + 12), vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = static_cast<float>(src[i]);
+			}
+		}
+
+		void ToFloat(const uint16* src, float* dst, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 16) <= count; i += 16)
+				{
+					const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+					_mm256_storeu_ps((dst + i), _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(v))));
+					_mm256_storeu_ps((dst + i + 8), _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1))));
+				}
+			}
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm_storeu_ps((dst + i), _mm_cvtepi32_ps(_mm_cvtepu16_epi32(v)));
+				_mm_storeu_ps((dst + i + 4), _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(v, 8))));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				const uint16x8_t v = vld1q_u16(src + i);
+				vst1q_f32((dst + i), vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+				vst1q_f32((dst + i + 4), vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = static_cast<float>(src[i]);
+			}
+		}
+
+		void ToFloat(const float* src, float* dst, const size_t count) noexcept
+		{
+			std::memcpy(dst, src, (count * sizeof(float)));
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	FromFloat
+		//
+		////////////////////////////////////////////////////////////////
+
+		void FromFloat(const float* src, uint8* dst, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				const __m256 zero = _mm256_setzero_ps();
+				const __m256 maxValue = _mm256_set1_ps(255.0f);
+				const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+				for (; (i + 32) <= count; i += 32)
+				{
+					const __m256i a = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), zero), maxValue));
+					const __m256i b = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i + 8), zero), maxValue));
+					const __m256i c = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i + 16), zero), maxValue));
+					const __m256i d = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i + 24), zero), maxValue));
+
+					// pack はレーンごとに行われるため、最後に 4 バイト単位で並べ替える
+					const __m256i packed = _mm256_packus_epi16(_mm256_packus_epi32(a, b), _mm256_packus_epi32(c, d));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permutevar8x32_epi32(packed, order));
+				}
+			}
+
+			{
+				const __m128 zero = _mm_setzero_ps();
+				const __m128 maxValue = _mm_set1_ps(255.0f);
+
+				for (; (i + 16) <= count; i += 16)
+				{
+					const __m128i a = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), zero), maxValue));
+					const __m128i b = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), zero), maxValue));
+					const __m128i c = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 8), zero), maxValue));
+					const __m128i d = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 12), zero), maxValue));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d)));
+				}
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				// vcvtnq は最も近い整数（偶数丸め）に変換し、vqmovn は飽和させる
+				const uint16x4_t a = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + i)));
+				const uint16x4_t b = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + i + 4)));
+				const uint16x4_t c = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + i + 8)));
+				const uint16x4_t d = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + i + 12)));
+				vst1q_u8((dst + i), vcombine_u8(vqmovn_u16(vcombine_u16(a, b)), vqmovn_u16(vcombine_u16(c, d))));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = RoundToInteger<uint8>(src[i]);
+			}
+		}
+
+		void FromFloat(const float* src, uint16* dst, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				const __m256 zero = _mm256_setzero_ps();
+				const __m256 maxValue = _mm256_set1_ps(65535.0f);
+
+				for (; (i + 16) <= count; i += 16)
+				{
+					const __m256i a = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), zero), maxValue));
+					const __m256i b = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i + 8), zero), maxValue));
+
+					// pack はレーンごとに行われるため、最後に 8 バイト単位で並べ替える
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8));
+				}
+			}
+
+			{
+				const __m128 zero = _mm_setzero_ps();
+				const __m128 maxValue = _mm_set1_ps(65535.0f);
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					const __m128i a = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), zero), maxValue));
+					const __m128i b = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), zero), maxValue));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(a, b));
+				}
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				const uint16x4_t a = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + i)));
+				const uint16x4_t b = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + i + 4)));
+				vst1q_u16((dst + i), vcombine_u16(a, b));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = RoundToInteger<uint16>(src[i]);
+			}
+		}
+
+		void FromFloat(const float* src, float* dst, const size_t count) noexcept
+		{
+			std::memcpy(dst, src, (count * sizeof(float)));
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Multiply, MultiplyAdd, AddSubtract
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Multiply(float* dst, const float* src, const float weight, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				const __m256 w = _mm256_set1_ps(weight);
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					_mm256_storeu_ps((dst + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), w));
+				}
+			}
+
+			{
+				const __m128 w = _mm_set1_ps(weight);
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					_mm_storeu_ps((dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w));
+				}
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				vst1q_f32((dst + i), vmulq_n_f32(vld1q_f32(src + i), weight));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = (src[i] * weight);
+			}
+		}
+
+		void MultiplyAdd(float* dst, const float* src, const float weight, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				const __m256 w = _mm256_set1_ps(weight);
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					_mm256_storeu_ps((dst + i), _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), w)));
+				}
+			}
+
+			{
+				const __m128 w = _mm_set1_ps(weight);
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					_mm_storeu_ps((dst + i), _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+				}
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				vst1q_f32((dst + i), vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), weight));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] += (src[i] * weight);
+			}
+		}
+
+		void AddSubtract(float* dst, const float* add, const float* sub, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 8) <= count; i += 8)
+				{
+					const __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(add + i), _mm256_loadu_ps(sub + i));
+					_mm256_storeu_ps((dst + i), _mm256_add_ps(_mm256_loadu_ps(dst + i), diff));
+				}
+			}
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				const __m128 diff = _mm_sub_ps(_mm_loadu_ps(add + i), _mm_loadu_ps(sub + i));
+				_mm_storeu_ps((dst + i), _mm_add_ps(_mm_loadu_ps(dst + i), diff));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				const float32x4_t diff = vsubq_f32(vld1q_f32(add + i), vld1q_f32(sub + i));
+				vst1q_f32((dst + i), vaddq_f32(vld1q_f32(dst + i), diff));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] += (add[i] - sub[i]);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Max, Min
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Max(uint8* dst, const uint8* src, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 32) <= count; i += 32)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(dst + i);
+					_mm256_storeu_si256(p, _mm256_max_epu8(_mm256_loadu_si256(p), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+				}
+			}
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				__m128i* p = reinterpret_cast<__m128i*>(dst + i);
+				_mm_storeu_si128(p, _mm_max_epu8(_mm_loadu_si128(p), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				vst1q_u8((dst + i), vmaxq_u8(vld1q_u8(dst + i), vld1q_u8(src + i)));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((dst[i] < src[i]) ? src[i] : dst[i]);
+			}
+		}
+
+		void Max(uint16* dst, const uint16* src, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 16) <= count; i += 16)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(dst + i);
+					_mm256_storeu_si256(p, _mm256_max_epu16(_mm256_loadu_si256(p), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+				}
+			}
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				__m128i* p = reinterpret_cast<__m128i*>(dst + i);
+				_mm_storeu_si128(p, _mm_max_epu16(_mm_loadu_si128(p), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				vst1q_u16((dst + i), vmaxq_u16(vld1q_u16(dst + i), vld1q_u16(src + i)));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((dst[i] < src[i]) ? src[i] : dst[i]);
+			}
+		}
+
+		void Max(float* dst, const float* src, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 8) <= count; i += 8)
+				{
+					_mm256_storeu_ps((dst + i), _mm256_max_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(src + i)));
+				}
+			}
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				_mm_storeu_ps((dst + i), _mm_max_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				vst1q_f32((dst + i), vmaxq_f32(vld1q_f32(dst + i), vld1q_f32(src + i)));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((dst[i] < src[i]) ? src[i] : dst[i]);
+			}
+		}
+
+		void Min(uint8* dst, const uint8* src, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 32) <= count; i += 32)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(dst + i);
+					_mm256_storeu_si256(p, _mm256_min_epu8(_mm256_loadu_si256(p), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+				}
+			}
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				__m128i* p = reinterpret_cast<__m128i*>(dst + i);
+				_mm_storeu_si128(p, _mm_min_epu8(_mm_loadu_si128(p), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				vst1q_u8((dst + i), vminq_u8(vld1q_u8(dst + i), vld1q_u8(src + i)));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((src[i] < dst[i]) ? src[i] : dst[i]);
+			}
+		}
+
+		void Min(uint16* dst, const uint16* src, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 16) <= count; i += 16)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(dst + i);
+					_mm256_storeu_si256(p, _mm256_min_epu16(_mm256_loadu_si256(p), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+				}
+			}
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				__m128i* p = reinterpret_cast<__m128i*>(dst + i);
+				_mm_storeu_si128(p, _mm_min_epu16(_mm_loadu_si128(p), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				vst1q_u16((dst + i), vminq_u16(vld1q_u16(dst + i), vld1q_u16(src + i)));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((src[i] < dst[i]) ? src[i] : dst[i]);
+			}
+		}
+
+		void Min(float* dst, const float* src, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 8) <= count; i += 8)
+				{
+					_mm256_storeu_ps((dst + i), _mm256_min_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(src + i)));
+				}
+			}
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				_mm_storeu_ps((dst + i), _mm_min_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				vst1q_f32((dst + i), vminq_f32(vld1q_f32(dst + i), vld1q_f32(src + i)));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((src[i] < dst[i]) ? src[i] : dst[i]);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Magnitude
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Magnitude(const float* x, const float* y, float* dst, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				for (; (i + 8) <= count; i += 8)
+				{
+					const __m256 vx = _mm256_loadu_ps(x + i);
+					const __m256 vy = _mm256_loadu_ps(y + i);
+					_mm256_storeu_ps((dst + i), _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy))));
+				}
+			}
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				const __m128 vx = _mm_loadu_ps(x + i);
+				const __m128 vy = _mm_loadu_ps(y + i);
+				_mm_storeu_ps((dst + i), _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy))));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				const float32x4_t vx = vld1q_f32(x + i);
+				const float32x4_t vy = vld1q_f32(y + i);
+				vst1q_f32((dst + i), vsqrtq_f32(vaddq_f32(vmulq_f32(vx, vx), vmulq_f32(vy, vy))));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = std::sqrt((x[i] * x[i]) + (y[i] * y[i]));
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Threshold
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Threshold(const uint8* src, uint8* dst, const uint8 threshold, const size_t count) noexcept
+		{
+			if (threshold == 255)
+			{
+				std::memset(dst, 0, count);
+				return;
+			}
+
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			// src >= (threshold + 1) を max(src, threshold + 1) == src で判定する
+			const __m128i limit = _mm_set1_epi8(static_cast<char>(threshold + 1));
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_cmpeq_epi8(_mm_max_epu8(v, limit), v));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const uint8x16_t t = vdupq_n_u8(threshold);
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				vst1q_u8((dst + i), vcgtq_u8(vld1q_u8(src + i), t));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((threshold < src[i]) ? 255 : 0);
+			}
+		}
+
+		void Threshold(const uint16* src, uint8* dst, const uint16 threshold, const size_t count) noexcept
+		{
+			if (threshold == 0xFFFF)
+			{
+				std::memset(dst, 0, count);
+				return;
+			}
+
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128i limit = _mm_set1_epi16(static_cast<short>(threshold + 1));
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+				const __m128i maskA = _mm_cmpeq_epi16(_mm_max_epu16(a, limit), a);
+				const __m128i maskB = _mm_cmpeq_epi16(_mm_max_epu16(b, limit), b);
+
+				// 0xFFFF (-1) は符号付き飽和で 0xFF になる
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi16(maskA, maskB));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const uint16x8_t t = vdupq_n_u16(threshold);
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const uint8x8_t a = vmovn_u16(vcgtq_u16(vld1q_u16(src + i), t));
+				const uint8x8_t b = vmovn_u16(vcgtq_u16(vld1q_u16(src + i + 8), t));
+				vst1q_u8((dst + i), vcombine_u8(a, b));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((threshold < src[i]) ? 255 : 0);
+			}
+		}
+
+		void Threshold(const float* src, uint8* dst, const float threshold, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128 t = _mm_set1_ps(threshold);
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const __m128i a = _mm_castps_si128(_mm_cmpgt_ps(_mm_loadu_ps(src + i), t));
+				const __m128i b = _mm_castps_si128(_mm_cmpgt_ps(_mm_loadu_ps(src + i + 4), t));
+				const __m128i c = _mm_castps_si128(_mm_cmpgt_ps(_mm_loadu_ps(src + i + 8), t));
+				const __m128i d = _mm_castps_si128(_mm_cmpgt_ps(_mm_loadu_ps(src + i + 12), t));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const float32x4_t t = vdupq_n_f32(threshold);
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const uint16x4_t a = vmovn_u32(vcgtq_f32(vld1q_f32(src + i), t));
+				const uint16x4_t b = vmovn_u32(vcgtq_f32(vld1q_f32(src + i + 4), t));
+				const uint16x4_t c = vmovn_u32(vcgtq_f32(vld1q_f32(src + i + 8), t));
+				const uint16x4_t d = vmovn_u32(vcgtq_f32(vld1q_f32(src + i + 12), t));
+				vst1q_u8((dst + i), vcombine_u8(vmovn_u16(vcombine_u16(a, b)), vmovn_u16(vcombine_u16(c, d))));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				dst[i] = ((threshold < src[i]) ? 255 : 0);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Grayscale
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Grayscale(const Color* src, uint8* dst, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			// (R, G, B, A) の重み。madd で (77R + 150G, 29B) の組を作り、hadd で足し合わせる
+			const __m128i weights = _mm_setr_epi16(77, 150, 29, 0, 77, 150, 29, 0);
+			const __m128i rounding = _mm_set1_epi32(128);
+			const __m128i zero = _mm_setzero_si128();
+
+			const auto luma4 = [&](const __m128i pixels)
+				{
+					const __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(pixels, zero), weights);
+					const __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(pixels, zero), weights);
+					return _mm_srli_epi32(_mm_add_epi32(_mm_hadd_epi32(lo, hi), rounding), 8);
+				};
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const __m128i* p = reinterpret_cast<const __m128i*>(src + i);
+				const __m128i a = luma4(_mm_loadu_si128(p));
+				const __m128i b = luma4(_mm_loadu_si128(p + 1));
+				const __m128i c = luma4(_mm_loadu_si128(p + 2));
+				const __m128i d = luma4(_mm_loadu_si128(p + 3));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d)));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const uint8*>(src + i));
+
+				uint16x8_t lo = vmull_u8(vget_low_u8(pixels.val[0]), vdup_n_u8(77));
+				lo = vmlal_u8(lo, vget_low_u8(pixels.val[1]), vdup_n_u8(150));
+				lo = vmlal_u8(lo, vget_low_u8(pixels.val[2]), vdup_n_u8(29));
+
+				uint16x8_t hi = vmull_u8(vget_high_u8(pixels.val[0]), vdup_n_u8(77));
+				hi = vmlal_u8(hi, vget_high_u8(pixels.val[1]), vdup_n_u8(150));
+				hi = vmlal_u8(hi, vget_high_u8(pixels.val[2]), vdup_n_u8(29));
+
+				vst1q_u8((dst + i), vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				const Color& pixel = src[i];
+				dst[i] = static_cast<uint8>(((77 * pixel.r) + (150 * pixel.g) + (29 * pixel.b) + 128) >> 8);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	CompositePremultiplied
+		//
+		////////////////////////////////////////////////////////////////
+
+		void CompositePremultiplied(const Color* src, Color* dst, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			if (SupportsAVX2())
+			{
+				const __m256i ones = _mm256_set1_epi8(-1);
+				const __m256i zero = _mm256_setzero_si256();
+				const __m256i alphaLo = _mm256_setr_epi8(3, -1, 3, -1, 3, -1, 3, -1, 7, -1, 7, -1, 7, -1, 7, -1,
+					3, -1, 3, -1, 3, -1, 3, -1, 7, -1, 7, -1, 7, -1, 7, -1);
+				const __m256i alphaHi = _mm256_setr_epi8(11, -1, 11, -1, 11, -1, 11, -1, 15, -1, 15, -1, 15, -1, 15, -1,
+					11, -1, 11, -1, 11, -1, 11, -1, 15, -1, 15, -1, 15, -1, 15, -1);
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+					__m256i* p = reinterpret_cast<__m256i*>(dst + i);
+					const __m256i d = _mm256_loadu_si256(p);
+					const __m256i inverseAlpha = _mm256_xor_si256(s, ones);
+					const __m256i lo = Div255_AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_shuffle_epi8(inverseAlpha, alphaLo)));
+					const __m256i hi = Div255_AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_shuffle_epi8(inverseAlpha, alphaHi)));
+					_mm256_storeu_si256(p, _mm256_adds_epu8(s, _mm256_packus_epi16(lo, hi)));
+				}
+			}
+
+			{
+				const __m128i ones = _mm_set1_epi8(-1);
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i alphaLo = _mm_setr_epi8(3, -1, 3, -1, 3, -1, 3, -1, 7, -1, 7, -1, 7, -1, 7, -1);
+				const __m128i alphaHi = _mm_setr_epi8(11, -1, 11, -1, 11, -1, 11, -1, 15, -1, 15, -1, 15, -1, 15, -1);
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+					__m128i* p = reinterpret_cast<__m128i*>(dst + i);
+					const __m128i d = _mm_loadu_si128(p);
+					const __m128i inverseAlpha = _mm_xor_si128(s, ones);
+					const __m128i lo = Div255_SSE41(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_shuffle_epi8(inverseAlpha, alphaLo)));
+					const __m128i hi = Div255_SSE41(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_shuffle_epi8(inverseAlpha, alphaHi)));
+					_mm_storeu_si128(p, _mm_adds_epu8(s, _mm_packus_epi16(lo, hi)));
+				}
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 16) <= count; i += 16)
+			{
+				const uint8x16x4_t s = vld4q_u8(reinterpret_cast<const uint8*>(src + i));
+				uint8x16x4_t d = vld4q_u8(reinterpret_cast<const uint8*>(dst + i));
+				const uint8x16_t inverseAlpha = vmvnq_u8(s.val[3]);
+
+				for (int32 c = 0; c < 4; ++c)
+				{
+					const uint16x8_t lo = vmull_u8(vget_low_u8(d.val[c]), vget_low_u8(inverseAlpha));
+					const uint16x8_t hi = vmull_u8(vget_high_u8(d.val[c]), vget_high_u8(inverseAlpha));
+
+					// (x + 128 + ((x + 128) >> 8)) >> 8
+					const uint8x16_t scaled = vcombine_u8(vraddhn_u16(lo, vrshrq_n_u16(lo, 8)), vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+					d.val[c] = vqaddq_u8(s.val[c], scaled);
+				}
+
+				vst4q_u8(reinterpret_cast<uint8*>(dst + i), d);
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				const Color& s = src[i];
+				Color& d = dst[i];
+				const uint8 inverseAlpha = static_cast<uint8>(255 - s.a);
+				d.r = CompositeChannel(s.r, d.r, inverseAlpha);
+				d.g = CompositeChannel(s.g, d.g, inverseAlpha);
+				d.b = CompositeChannel(s.b, d.b, inverseAlpha);
+				d.a = CompositeChannel(s.a, d.a, inverseAlpha);
+			}
+		}
+	}
+}
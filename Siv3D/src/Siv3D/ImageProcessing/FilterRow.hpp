@@ -0,0 +1,86 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Color.hpp>
+
+namespace s3d
+{
+	/// @brief 画像フィルタが使う、1 行分の要素に対する SIMD 演算
+	/// @remark x86-64 では実行時に AVX2 と SSE4.1 を切り替え、ARM では NEON を使います。
+	namespace FilterRow
+	{
+		/// @brief 要素を float に変換します。
+		void ToFloat(const uint8* src, float* dst, size_t count) noexcept;
+
+		/// @brief 要素を float に変換します。
+		void ToFloat(const uint16* src, float* dst, size_t count) noexcept;
+
+		/// @brief 要素を float に変換（コピー）します。
+		void ToFloat(const float* src, float* dst, size_t count) noexcept;
+
+		/// @brief float を最も近い整数に丸め、値の範囲に収めて書き込みます。
+		void FromFloat(const float* src, uint8* dst, size_t count) noexcept;
+
+		/// @brief float を最も近い整数に丸め、値の範囲に収めて書き込みます。
+		void FromFloat(const float* src, uint16* dst, size_t count) noexcept;
+
+		/// @brief float をそのまま書き込みます。
+		void FromFloat(const float* src, float* dst, size_t count) noexcept;
+
+		/// @brief dst[i] = src[i] * weight
+		void Multiply(float* dst, const float* src, float weight, size_t count) noexcept;
+
+		/// @brief dst[i] += src[i] * weight
+		void MultiplyAdd(float* dst, const float* src, float weight, size_t count) noexcept;
+
+		/// @brief dst[i] += (add[i] - sub[i])
+		void AddSubtract(float* dst, const float* add, const float* sub, size_t count) noexcept;
+
+		/// @brief dst[i] = Max(dst[i], src[i])
+		void Max(uint8* dst, const uint8* src, size_t count) noexcept;
+
+		/// @brief dst[i] = Max(dst[i], src[i])
+		void Max(uint16* dst, const uint16* src, size_t count) noexcept;
+
+		/// @brief dst[i] = Max(dst[i], src[i])
+		void Max(float* dst, const float* src, size_t count) noexcept;
+
+		/// @brief dst[i] = Min(dst[i], src[i])
+		void Min(uint8* dst, const uint8* src, size_t count) noexcept;
+
+		/// @brief dst[i] = Min(dst[i], src[i])
+		void Min(uint16* dst, const uint16* src, size_t count) noexcept;
+
+		/// @brief dst[i] = Min(dst[i], src[i])
+		void Min(float* dst, const float* src, size_t count) noexcept;
+
+		/// @brief dst[i] = sqrt(x[i] * x[i] + y[i] * y[i])
+		void Magnitude(const float* x, const float* y, float* dst, size_t count) noexcept;
+
+		/// @brief dst[i] = ((threshold < src[i]) ? 255 : 0)
+		void Threshold(const uint8* src, uint8* dst, uint8 threshold, size_t count) noexcept;
+
+		/// @brief dst[i] = ((threshold < src[i]) ? 255 : 0)
+		void Threshold(const uint16* src, uint8* dst, uint16 threshold, size_t count) noexcept;
+
+		/// @brief dst[i] = ((threshold < src[i]) ? 255 : 0)
+		void Threshold(const float* src, uint8* dst, float threshold, size_t count) noexcept;
+
+		/// @brief ピクセルの輝度 (77R + 150G + 29B + 128) / 256 を書き込みます。
+		void Grayscale(const Color* src, uint8* dst, size_t count) noexcept;
+
+		/// @brief 乗算済みアルファのピクセルを dst の上に合成します。
+		/// @remark dst[i] = src[i] + dst[i] * (255 - src[i].a) / 255（各チャンネル、四捨五入）
+		void CompositePremultiplied(const Color* src, Color* dst, size_t count) noexcept;
+	}
+}
@@ -9,14 +9,447 @@
 //
 //-----------------------------------------------
 
+# include <cmath>
+# include <cstring>
+# include <numbers>
 # include <Siv3D/ImageProcessing.hpp>
 # include <Siv3D/Image.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/CPUInfo.hpp>
+# include <Siv3D/SIMD.hpp>
 
 # define STB_IMAGE_RESIZE_IMPLEMENTATION
 # include <ThirdParty/stb/stb_image_resize2.h>
 
 namespace s3d
 {
+	namespace
+	{
+		/// @brief フィルタの重みの固定小数点のビット数
+		constexpr int32 WeightBits = 14;
+
+		/// @brief 水平方向の処理結果（中間バッファ）に残す小数部のビット数
+		constexpr int32 IntermediateBits = 6;
+
+		/// @brief 1 つのタスクが担当する出力行の最小数
+		constexpr size_t MinRowsPerBand = 16;
+
+		struct FilterKernel
+		{
+			double (*function)(double);
+
+			/// @brief フィルタの半径（拡大縮小しない場合）
+			double support;
+		};
+
+		[[nodiscard]]
+		static double Sinc(const double x) noexcept
+		{
+			if (x == 0.0)
+			{
+				return 1.0;
+			}
+
+			const double px = (std::numbers::pi * x);
+			return (std::sin(px) / px);
+		}
+
+		/// @brief Mitchell-Netravali の 3 次フィルタ
+		[[nodiscard]]
+		static double Cubic(double x, const double b, const double c) noexcept
+		{
+			x = std::abs(x);
+
+			if (x < 1.0)
+			{
+				return (((12.0 - 9.0 * b - 6.0 * c) * x * x * x) + ((-18.0 + 12.0 * b + 6.0 * c) * x * x) + (6.0 - 2.0 * b)) / 6.0;
+			}
+			else if (x < 2.0)
+			{
+				return (((-b - 6.0 * c) * x * x * x) + ((6.0 * b + 30.0 * c) * x * x) + ((-12.0 * b - 48.0 * c) * x) + (8.0 * b + 24.0 * c)) / 6.0;
+			}
+
+			return 0.0;
+		}
+
+		[[nodiscard]]
+		static FilterKernel GetFilterKernel(const ResampleFilter filter) noexcept
+		{
+			switch (filter)
+			{
+			case ResampleFilter::Box:
+				return{ [](const double x) { return (((-0.5 <= x) && (x < 0.5)) ? 1.0 : 0.0); }, 0.5 };
+			case ResampleFilter::Bilinear:
+				return{ [](const double x) { return Max((1.0 - std::abs(x)), 0.0); }, 1.0 };
+			case ResampleFilter::Bicubic:
+				return{ [](const double x) { return Cubic(x, 0.0, 0.5); }, 2.0 };
+			case ResampleFilter::Lanczos3:
+				return{ [](const double x) { return ((std::abs(x) < 3.0) ? (Sinc(x) * Sinc(x / 3.0)) : 0.0); }, 3.0 };
+			case ResampleFilter::Mitchell:
+			default:
+				return{ [](const double x) { return Cubic(x, (1.0 / 3.0), (1.0 / 3.0)); }, 2.0 };
+			}
+		}
+
+		/// @brief 1 次元のリサンプリングで、出力の各ピクセルが参照する入力の範囲と重み
+		struct ResampleWeights
+		{
+			/// @brief 参照する最初の入力ピクセル
+			Array<int32> starts;
+
+			/// @brief 参照する入力ピクセルの数
+			Array<int32> counts;
+
+			/// @brief 固定小数点の重み（出力ピクセルごとに stride 個）
+			Array<int16> weights;
+
+			size_t stride = 0;
+
+			[[nodiscard]]
+			const int16* weightsAt(const size_t i) const noexcept
+			{
+				return (weights.data() + (i * stride));
+			}
+		};
+
+		[[nodiscard]]
+		static ResampleWeights MakeResampleWeights(const int32 srcLength, const int32 dstLength, const FilterKernel& kernel)
+		{
+			const double scale = (static_cast<double>(srcLength) / dstLength);
+			const double filterScale = Max(scale, 1.0);
+			const double support = (kernel.support * filterScale);
+
+			ResampleWeights result;
+			result.starts.resize(dstLength);
+			result.counts.resize(dstLength);
+			result.stride = (static_cast<size_t>(std::ceil(support * 2.0)) + 2);
+			result.weights.resize((dstLength * result.stride), 0);
+
+			Array<double> weights(result.stride);
+
+			for (int32 i = 0; i < dstLength; ++i)
+			{
+				const double center = ((i + 0.5) * scale);
+				int32 left = Max(static_cast<int32>(std::floor(center - support)), 0);
+				int32 right = Min(static_cast<int32>(std::ceil(center + support)), srcLength);
+
+				double sum = 0.0;
+				int32 count = 0;
+
+				for (int32 k = left; k < right; ++k)
+				{
+					const double w = kernel.function(((k + 0.5) - center) / filterScale);
+					weights[count++] = w;
+					sum += w;
+				}
+
+				// 両端の重み 0 を取り除く
+				int32 first = 0;
+
+				while ((first < count) && (weights[first] == 0.0))
+				{
+					++first;
+				}
+
+				while ((first < count) && (weights[count - 1] == 0.0))
+				{
+					--count;
+				}
+
+				if ((first == count) || (sum == 0.0))
+				{
+					// 重みがすべて 0 の場合は最も近いピクセルを使う
+					left = Clamp(static_cast<int32>(center), 0, (srcLength - 1));
+					first = 0;
+					count = 1;
+					weights[0] = sum = 1.0;
+				}
+
+				// 正規化して固定小数点に変換し、丸め誤差は最大の重みに加える
+				int16* pWeights = (result.weights.data() + (i * result.stride));
+				int32 total = 0;
+				int32 maxIndex = 0;
+
+				for (int32 k = first; k < count; ++k)
+				{
+					const int32 w = static_cast<int32>(std::lround((weights[k] / sum) * (1 << WeightBits)));
+					pWeights[k - first] = static_cast<int16>(w);
+					total += w;
+
+					if (pWeights[maxIndex] < w)
+					{
+						maxIndex = (k - first);
+					}
+				}
+
+				pWeights[maxIndex] = static_cast<int16>(pWeights[maxIndex] + ((1 << WeightBits) - total));
+
+				result.starts[i] = (left + first);
+				result.counts[i] = (count - first);
+			}
+
+			return result;
+		}
+
+		/// @brief 1 行を水平方向にリサンプリングします。
+		/// @param src 入力の行
+		/// @param dst 出力の行（ピクセルあたり 4 要素、IntermediateBits の小数部を持つ）
+		/// @param weights 水平方向の重み
+		/// @param dstWidth 出力の幅
+		static void ResampleRowHorizontal(const Color* src, int16* dst, const ResampleWeights& weights, const int32 dstWidth) noexcept
+		{
+			constexpr int32 Shift = (WeightBits - IntermediateBits);
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			// (r0 g0 b0 a0 r1 g1 b1 a1) -> (r0 r1 g0 g1 b0 b1 a0 a1) の 16-bit
+			const __m128i shuffle = _mm_setr_epi8(0, -1, 4, -1, 1, -1, 5, -1, 2, -1, 6, -1, 3, -1, 7, -1);
+			const __m128i rounding = _mm_set1_epi32(1 << (Shift - 1));
+			const bool avx2 = SupportsAVX2();
+
+			// 下位レーンは (p0, p1)、上位レーンは (p2, p3) を同じ並びにする
+			const __m256i shuffle256 = _mm256_setr_epi8(
+				0, -1, 4, -1, 1, -1, 5, -1, 2, -1, 6, -1, 3, -1, 7, -1,
+				8, -1, 12, -1, 9, -1, 13, -1, 10, -1, 14, -1, 11, -1, 15, -1);
+			const __m256i weightIndices = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+
+			for (int32 x = 0; x < dstWidth; ++x)
+			{
+				const uint8* pSrc = reinterpret_cast<const uint8*>(src + weights.starts[x]);
+				const int16* pWeights = weights.weightsAt(x);
+				const int32 count = weights.counts[x];
+
+				__m128i acc = rounding;
+				int32 k = 0;
+
+				if (avx2 && (4 <= count))
+				{
+					__m256i acc256 = _mm256_setzero_si256();
+
+					// 4 ピクセルずつ処理する
+					for (; (k + 4) <= count; k += 4)
+					{
+						const __m256i pixels = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + (k * 4)))), shuffle256);
+						const __m256i w = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pWeights + k))), weightIndices);
+						acc256 = _mm256_add_epi32(acc256, _mm256_madd_epi16(pixels, w));
+					}
+
+					acc = _mm_add_epi32(acc, _mm_add_epi32(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1)));
+				}
+
+				for (; (k + 2) <= count; k += 2)
+				{
+					const __m128i pixels = _mm_shuffle_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc + (k * 4))), shuffle);
+					const __m128i w = _mm_set1_epi32(static_cast<int32>((static_cast<uint32>(static_cast<uint16>(pWeights[k + 1])) << 16) | static_cast<uint16>(pWeights[k])));
+					acc = _mm_add_epi32(acc, _mm_madd_epi16(pixels, w));
+				}
+
+				if (k < count)
+				{
+					int32 pixel;
+					std::memcpy(&pixel, (pSrc + (k * 4)), sizeof(pixel));
+					const __m128i pixels = _mm_shuffle_epi8(_mm_cvtsi32_si128(pixel), shuffle);
+					acc = _mm_add_epi32(acc, _mm_madd_epi16(pixels, _mm_set1_epi32(static_cast<uint16>(pWeights[k]))));
+				}
+
+				acc = _mm_srai_epi32(acc, Shift);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + (x * 4)), _mm_packs_epi32(acc, acc));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (int32 x = 0; x < dstWidth; ++x)
+			{
+				const uint8* pSrc = reinterpret_cast<const uint8*>(src + weights.starts[x]);
+				const int16* pWeights = weights.weightsAt(x);
+				const int32 count = weights.counts[x];
+
+				int32x4_t acc = vdupq_n_s32(1 << (Shift - 1));
+
+				for (int32 k = 0; k < count; ++k)
+				{
+					uint32 pixel;
+					std::memcpy(&pixel, (pSrc + (k * 4)), sizeof(pixel));
+					const int16x4_t pixels = vreinterpret_s16_u16(vget_low_u16(vmovl_u8(vcreate_u8(pixel))));
+					acc = vmlal_n_s16(acc, pixels, pWeights[k]);
+				}
+
+				vst1_s16((dst + (x * 4)), vqshrn_n_s32(acc, Shift));
+			}
+
+		# else
+
+			for (int32 x = 0; x < dstWidth; ++x)
+			{
+				const Color* pSrc = (src + weights.starts[x]);
+				const int16* pWeights = weights.weightsAt(x);
+				const int32 count = weights.counts[x];
+
+				int32 r = (1 << (Shift - 1)), g = r, b = r, a = r;
+
+				for (int32 k = 0; k < count; ++k)
+				{
+					r += (pSrc[k].r * pWeights[k]);
+					g += (pSrc[k].g * pWeights[k]);
+					b += (pSrc[k].b * pWeights[k]);
+					a += (pSrc[k].a * pWeights[k]);
+				}
+
+				dst[x * 4 + 0] = static_cast<int16>(Clamp((r >> Shift), -32768, 32767));
+				dst[x * 4 + 1] = static_cast<int16>(Clamp((g >> Shift), -32768, 32767));
+				dst[x * 4 + 2] = static_cast<int16>(Clamp((b >> Shift), -32768, 32767));
+				dst[x * 4 + 3] = static_cast<int16>(Clamp((a >> Shift), -32768, 32767));
+			}
+
+		# endif
+		}
+
+		/// @brief 中間バッファの複数行から、出力の 1 行を垂直方向にリサンプリングします。
+		/// @param rows 参照する中間バッファの行（rowStride 要素ごと）
+		/// @param rowStride 中間バッファの 1 行の要素数
+		/// @param pWeights 垂直方向の重み
+		/// @param count 参照する行の数
+		/// @param dst 出力の行
+		static void ResampleRowVertical(const int16* rows, const size_t rowStride, const int16* pWeights, const int32 count, Color* dst) noexcept
+		{
+			constexpr int32 Shift = (WeightBits + IntermediateBits);
+
+			uint8* pDst = reinterpret_cast<uint8*>(dst);
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128i rounding = _mm_set1_epi32(1 << (Shift - 1));
+
+			if (SupportsAVX2())
+			{
+				const __m256i rounding256 = _mm256_set1_epi32(1 << (Shift - 1));
+
+				// 16 要素（4 ピクセル）ずつ処理する
+				for (; (i + 16) <= rowStride; i += 16)
+				{
+					__m256i accLo = rounding256;
+					__m256i accHi = rounding256;
+					int32 k = 0;
+
+					for (; (k + 2) <= count; k += 2)
+					{
+						const __m256i row0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows + (k * rowStride) + i));
+						const __m256i row1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows + ((k + 1) * rowStride) + i));
+						const __m256i w = _mm256_set1_epi32(static_cast<int32>((static_cast<uint32>(static_cast<uint16>(pWeights[k + 1])) << 16) | static_cast<uint16>(pWeights[k])));
+						accLo = _mm256_add_epi32(accLo, _mm256_madd_epi16(_mm256_unpacklo_epi16(row0, row1), w));
+						accHi = _mm256_add_epi32(accHi, _mm256_madd_epi16(_mm256_unpackhi_epi16(row0, row1), w));
+					}
+
+					if (k < count)
+					{
+						const __m256i row0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows + (k * rowStride) + i));
+						const __m256i zero = _mm256_setzero_si256();
+						const __m256i w = _mm256_set1_epi32(static_cast<uint16>(pWeights[k]));
+						accLo = _mm256_add_epi32(accLo, _mm256_madd_epi16(_mm256_unpacklo_epi16(row0, zero), w));
+						accHi = _mm256_add_epi32(accHi, _mm256_madd_epi16(_mm256_unpackhi_epi16(row0, zero), w));
+					}
+
+					// unpack と pack はレーンごとに行われるため、packs_epi32 の結果は要素の順に並ぶ
+					const __m256i packed = _mm256_packs_epi32(_mm256_srai_epi32(accLo, Shift), _mm256_srai_epi32(accHi, Shift));
+					const __m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(packed, packed), 0b1000);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm256_castsi256_si128(bytes));
+				}
+			}
+
+			// 8 要素（2 ピクセル）ずつ処理する
+			for (; (i + 8) <= rowStride; i += 8)
+			{
+				__m128i accLo = rounding;
+				__m128i accHi = rounding;
+				int32 k = 0;
+
+				for (; (k + 2) <= count; k += 2)
+				{
+					const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + (k * rowStride) + i));
+					const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + ((k + 1) * rowStride) + i));
+					const __m128i w = _mm_set1_epi32(static_cast<int32>((static_cast<uint32>(static_cast<uint16>(pWeights[k + 1])) << 16) | static_cast<uint16>(pWeights[k])));
+					accLo = _mm_add_epi32(accLo, _mm_madd_epi16(_mm_unpacklo_epi16(row0, row1), w));
+					accHi = _mm_add_epi32(accHi, _mm_madd_epi16(_mm_unpackhi_epi16(row0, row1), w));
+				}
+
+				if (k < count)
+				{
+					const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + (k * rowStride) + i));
+					const __m128i zero = _mm_setzero_si128();
+					const __m128i w = _mm_set1_epi32(static_cast<uint16>(pWeights[k]));
+					accLo = _mm_add_epi32(accLo, _mm_madd_epi16(_mm_unpacklo_epi16(row0, zero), w));
+					accHi = _mm_add_epi32(accHi, _mm_madd_epi16(_mm_unpackhi_epi16(row0, zero), w));
+				}
+
+				const __m128i packed = _mm_packs_epi32(_mm_srai_epi32(accLo, Shift), _mm_srai_epi32(accHi, Shift));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(pDst + i), _mm_packus_epi16(packed, packed));
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			for (; (i + 8) <= rowStride; i += 8)
+			{
+				int32x4_t accLo = vdupq_n_s32(1 << (Shift - 1));
+				int32x4_t accHi = accLo;
+
+				for (int32 k = 0; k < count; ++k)
+				{
+					const int16x8_t row = vld1q_s16(rows + (k * rowStride) + i);
+					accLo = vmlal_n_s16(accLo, vget_low_s16(row), pWeights[k]);
+					accHi = vmlal_n_s16(accHi, vget_high_s16(row), pWeights[k]);
+				}
+
+				const int16x8_t packed = vcombine_s16(vqshrn_n_s32(accLo, Shift), vqshrn_n_s32(accHi, Shift));
+				vst1_u8((pDst + i), vqmovun_s16(packed));
+			}
+
+		# endif
+
+			for (; i < rowStride; ++i)
+			{
+				int32 acc = (1 << (Shift - 1));
+
+				for (int32 k = 0; k < count; ++k)
+				{
+					acc += (rows[(k * rowStride) + i] * pWeights[k]);
+				}
+
+				pDst[i] = static_cast<uint8>(Clamp((acc >> Shift), 0, 255));
+			}
+		}
+
+		/// @brief 出力の行 [beginY, endY) をリサンプリングします。
+		static void ResampleBand(const Image& src, Image& dst, const ResampleWeights& horizontal, const ResampleWeights& vertical, const size_t beginY, const size_t endY)
+		{
+			const int32 dstWidth = dst.width();
+			const size_t rowStride = (static_cast<size_t>(dstWidth) * 4);
+
+			// この帯が参照する入力行の範囲
+			int32 srcBegin = vertical.starts[beginY];
+			int32 srcEnd = 0;
+
+			for (size_t y = beginY; y < endY; ++y)
+			{
+				srcBegin = Min(srcBegin, vertical.starts[y]);
+				srcEnd = Max(srcEnd, (vertical.starts[y] + vertical.counts[y]));
+			}
+
+			Array<int16> intermediate((rowStride * (srcEnd - srcBegin)), 0);
+
+			for (int32 srcY = srcBegin; srcY < srcEnd; ++srcY)
+			{
+				ResampleRowHorizontal(src[srcY], (intermediate.data() + ((srcY - srcBegin) * rowStride)), horizontal, dstWidth);
+			}
+
+			for (size_t y = beginY; y < endY; ++y)
+			{
+				const int16* rows = (intermediate.data() + ((vertical.starts[y] - srcBegin) * rowStride));
+				ResampleRowVertical(rows, rowStride, vertical.weightsAt(y), vertical.counts[y], dst[y]);
+			}
+		}
+	}
+
 	namespace ImageProcessing
 	{
 		[[nodiscard]]
@@ -33,5 +466,61 @@ namespace s3d
 
 			return dst;
 		}
+
+		Image Resample(const Image& src, const Size& size, const ResampleFilter filter)
+		{
+			Image dst{ size };
+
+			Resample(src, dst, filter);
+
+			return dst;
+		}
+
+		void Resample(const Image& src, Image& dst, const ResampleFilter filter)
+		{
+			if (src.isEmpty() || dst.isEmpty())
+			{
+				return;
+			}
+
+			if (&src == &dst)
+			{
+				const Image copy = src;
+				Resample(copy, dst, filter);
+				return;
+			}
+
+			const FilterKernel kernel = GetFilterKernel(filter);
+			const ResampleWeights horizontal = MakeResampleWeights(src.width(), dst.width(), kernel);
+			const ResampleWeights vertical = MakeResampleWeights(src.height(), dst.height(), kernel);
+
+			const size_t height = dst.height();
+			const size_t rowsPerBand = Max(MinRowsPerBand, (height / (Threading::GetConcurrency() * 4)));
+
+			Threading::ParallelFor(0, height, [&](const size_t beginY, const size_t endY)
+			{
+				ResampleBand(src, dst, horizontal, vertical, beginY, endY);
+			}, rowsPerBand);
+		}
+
+		void GenerateMipmaps(const Image& src, Array<Image>& mipmaps, const ResampleFilter filter)
+		{
+			const size_t mipCount = CalculateMipmapLevel(src.width(), src.height());
+
+			mipmaps.resize((0 < mipCount) ? (mipCount - 1) : 0);
+
+			for (size_t mip = 1; mip < mipCount; ++mip)
+			{
+				const Size mipSize{ Max(1, (src.width() >> mip)), Max(1, (src.height() >> mip)) };
+				Image& mipmap = mipmaps[mip - 1];
+
+				if (mipmap.size() != mipSize)
+				{
+					mipmap.resize(mipSize);
+				}
+
+				Resample(((mip == 1) ? src : mipmaps[mip - 2]), mipmap, filter);
+			}
+		}
 	}
 }
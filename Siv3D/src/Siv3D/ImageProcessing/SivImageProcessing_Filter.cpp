@@ -0,0 +1,893 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cmath>
+# include <algorithm>
+# include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/FunctionRef.hpp>
+# include <Siv3D/Threading.hpp>
+# include "FilterRow.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 1 つのタスクが担当する出力行の最小数
+		constexpr size_t MinRowsPerBand = 16;
+
+		/// @brief 要素ごとの処理で、1 つのタスクが担当する要素の最小数
+		constexpr size_t MinElementsPerTask = (1 << 16);
+
+		/// @brief ボックスぼかしで、垂直方向の累積和を計算し直す間隔（行）。誤差の蓄積を防ぎます。
+		constexpr int32 BoxBlurResyncInterval = 32;
+
+		/// @brief tan(22.5°)
+		constexpr float Tan22_5 = 0.41421356f;
+
+		/// @brief 1 要素あたり channels 個の値が並ぶ 2 次元配列の形
+		struct PlaneLayout
+		{
+			int32 width = 0;
+
+			int32 height = 0;
+
+			int32 channels = 1;
+
+			[[nodiscard]]
+			size_t rowLength() const noexcept
+			{
+				return (static_cast<size_t>(width) * channels);
+			}
+		};
+
+		/// @brief 出力の行を帯に分け、複数のスレッドで処理します。
+		/// @param height 出力の行数
+		/// @param radius フィルタの垂直方向の半径。帯の上下で重複して読む行が多くなりすぎないよう、帯の高さの下限に使います。
+		/// @param f 出力の行 [beginY, endY) を処理する関数
+		static void ParallelForRows(const int32 height, const int32 radius, FunctionRef<void(int32, int32)> f)
+		{
+			const size_t rowsPerBand = Max(Max(MinRowsPerBand, (static_cast<size_t>(radius) * 2)), (static_cast<size_t>(height) / (Threading::GetConcurrency() * 4)));
+
+			Threading::ParallelFor(0, height, [&](const size_t beginY, const size_t endY)
+			{
+				f(static_cast<int32>(beginY), static_cast<int32>(endY));
+			}, rowsPerBand);
+		}
+
+		/// @brief 画像の外側を端の要素で埋めた 1 行を作ります。
+		/// @param srcRow 元の行
+		/// @param padded 書き込み先。(width + 2 * radius) * channels 個の要素が必要です。
+		template <class SrcType, class DstType>
+		static void LoadPaddedRow(const SrcType* srcRow, DstType* padded, const PlaneLayout& layout, const int32 radius)
+		{
+			const size_t rowLength = layout.rowLength();
+			const size_t channels = layout.channels;
+			DstType* body = (padded + (radius * channels));
+
+			if constexpr (std::is_same_v<SrcType, DstType>)
+			{
+				std::copy_n(srcRow, rowLength, body);
+			}
+			else
+			{
+				FilterRow::ToFloat(srcRow, body, rowLength);
+			}
+
+			for (int32 i = 0; i < radius; ++i)
+			{
+				std::copy_n(body, channels, (padded + (i * channels)));
+				std::copy_n((body + rowLength - channels), channels, (body + rowLength + (i * channels)));
+			}
+		}
+
+		[[nodiscard]]
+		static int32 ClampRow(const int32 y, const int32 height) noexcept
+		{
+			return Clamp(y, 0, (height - 1));
+		}
+
+		[[nodiscard]]
+		static Array<float> MakeGaussianWeights(const double sigma)
+		{
+			const int32 radius = Max(1, static_cast<int32>(std::ceil(sigma * 3.0)));
+			Array<double> weights((radius * 2 + 1), 0.0);
+			double sum = 0.0;
+
+			for (int32 i = -radius; i <= radius; ++i)
+			{
+				const double w = std::exp(-(i * i) / (2.0 * sigma * sigma));
+				weights[i + radius] = w;
+				sum += w;
+			}
+
+			return weights.map([=](const double w) { return static_cast<float>(w / sum); });
+		}
+
+		/// @brief 対称な 1 次元フィルタを水平・垂直にかけます。
+		template <class Type>
+		static void SeparableFilter(const Type* src, Type* dst, const PlaneLayout& layout, const Array<float>& weights)
+		{
+			const int32 radius = static_cast<int32>(weights.size() / 2);
+			const size_t rowLength = layout.rowLength();
+			const size_t paddedLength = ((static_cast<size_t>(layout.width) + (radius * 2)) * layout.channels);
+
+			ParallelForRows(layout.height, radius, [&](const int32 beginY, const int32 endY)
+			{
+				const int32 srcBegin = Max((beginY - radius), 0);
+				const int32 srcEnd = Min((endY + radius), layout.height);
+
+				Array<float> padded(paddedLength);
+				Array<float> horizontal((rowLength * (srcEnd - srcBegin)));
+				Array<float> accumulator(rowLength);
+
+				for (int32 srcY = srcBegin; srcY < srcEnd; ++srcY)
+				{
+					LoadPaddedRow((src + (srcY * rowLength)), padded.data(), layout, radius);
+
+					float* out = (horizontal.data() + ((srcY - srcBegin) * rowLength));
+					FilterRow::Multiply(out, padded.data(), weights[0], rowLength);
+
+					for (size_t k = 1; k < weights.size(); ++k)
+					{
+						FilterRow::MultiplyAdd(out, (padded.data() + (k * layout.channels)), weights[k], rowLength);
+					}
+				}
+
+				for (int32 y = beginY; y < endY; ++y)
+				{
+					for (int32 k = -radius; k <= radius; ++k)
+					{
+						const float* row = (horizontal.data() + ((ClampRow((y + k), layout.height) - srcBegin) * rowLength));
+
+						if (k == -radius)
+						{
+							FilterRow::Multiply(accumulator.data(), row, weights[0], rowLength);
+						}
+						else
+						{
+							FilterRow::MultiplyAdd(accumulator.data(), row, weights[k + radius], rowLength);
+						}
+					}
+
+					FilterRow::FromFloat(accumulator.data(), (dst + (y * rowLength)), rowLength);
+				}
+			});
+		}
+
+		/// @brief (2 * radius + 1) 四方の平均を、水平・垂直の累積和で計算します。
+		template <class Type>
+		static void BoxFilter(const Type* src, Type* dst, const PlaneLayout& layout, const int32 radius)
+		{
+			const size_t rowLength = layout.rowLength();
+			const size_t channels = layout.channels;
+			const size_t paddedLength = ((static_cast<size_t>(layout.width) + (radius * 2)) * channels);
+			const size_t windowSize = (radius * 2 + 1);
+			const float scale = (1.0f / static_cast<float>(windowSize * windowSize));
+
+			ParallelForRows(layout.height, radius, [&](const int32 beginY, const int32 endY)
+			{
+				const int32 srcBegin = Max((beginY - radius), 0);
+				const int32 srcEnd = Min((endY + radius), layout.height);
+
+				Array<float> padded(paddedLength);
+				Array<float> horizontal((rowLength * (srcEnd - srcBegin)));
+				Array<float> accumulator(rowLength);
+				Array<float> average(rowLength);
+
+				// 水平方向の累積和（行の中の依存があるため、チャンネルごとに double で順に計算する）
+				for (int32 srcY = srcBegin; srcY < srcEnd; ++srcY)
+				{
+					LoadPaddedRow((src + (srcY * rowLength)), padded.data(), layout, radius);
+
+					const float* in = padded.data();
+					float* out = (horizontal.data() + ((srcY - srcBegin) * rowLength));
+
+					for (size_t c = 0; c < channels; ++c)
+					{
+						double sum = 0.0;
+
+						for (size_t i = 0; i < windowSize; ++i)
+						{
+							sum += in[(i * channels) + c];
+						}
+
+						for (int32 x = 0; x < layout.width; ++x)
+						{
+							out[(x * channels) + c] = static_cast<float>(sum);
+
+							if ((x + 1) < layout.width)
+							{
+								sum += (in[((x + windowSize) * channels) + c] - in[(x * channels) + c]);
+							}
+						}
+					}
+				}
+
+				const auto rowAt = [&](const int32 y)
+					{
+						return (horizontal.data() + ((ClampRow(y, layout.height) - srcBegin) * rowLength));
+					};
+
+				// 垂直方向の累積和
+				for (int32 y = beginY; y < endY; ++y)
+				{
+					if (((y - beginY) % BoxBlurResyncInterval) == 0)
+					{
+						FilterRow::Multiply(accumulator.data(), rowAt(y - radius), 1.0f, rowLength);
+
+						for (int32 k = (-radius + 1); k <= radius; ++k)
+						{
+							FilterRow::MultiplyAdd(accumulator.data(), rowAt(y + k), 1.0f, rowLength);
+						}
+					}
+					else
+					{
+						FilterRow::AddSubtract(accumulator.data(), rowAt(y + radius), rowAt(y - radius - 1), rowLength);
+					}
+
+					FilterRow::Multiply(average.data(), accumulator.data(), scale, rowLength);
+					FilterRow::FromFloat(average.data(), (dst + (y * rowLength)), rowLength);
+				}
+			});
+		}
+
+		/// @brief N x N のカーネルで畳み込みます。
+		/// @param preserveAlpha 4 チャンネルのとき、アルファチャンネルを元の値のままにする場合 true
+		template <size_t N, class Type>
+		static void ConvolveFilter(const Type* src, Type* dst, const PlaneLayout& layout, const std::array<float, (N * N)>& kernel, const bool preserveAlpha)
+		{
+			constexpr int32 Radius = static_cast<int32>(N / 2);
+			const size_t rowLength = layout.rowLength();
+			const size_t paddedLength = ((static_cast<size_t>(layout.width) + (Radius * 2)) * layout.channels);
+
+			ParallelForRows(layout.height, Radius, [&](const int32 beginY, const int32 endY)
+			{
+				const int32 srcBegin = Max((beginY - Radius), 0);
+				const int32 srcEnd = Min((endY + Radius), layout.height);
+
+				Array<float> padded((paddedLength * (srcEnd - srcBegin)));
+				Array<float> accumulator(rowLength);
+
+				for (int32 srcY = srcBegin; srcY < srcEnd; ++srcY)
+				{
+					LoadPaddedRow((src + (srcY * rowLength)), (padded.data() + ((srcY - srcBegin) * paddedLength)), layout, Radius);
+				}
+
+				for (int32 y = beginY; y < endY; ++y)
+				{
+					std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+
+					for (int32 ky = 0; ky < static_cast<int32>(N); ++ky)
+					{
+						const float* row = (padded.data() + ((ClampRow((y + ky - Radius), layout.height) - srcBegin) * paddedLength));
+
+						for (size_t kx = 0; kx < N; ++kx)
+						{
+							if (const float w = kernel[(ky * N) + kx])
+							{
+								FilterRow::MultiplyAdd(accumulator.data(), (row + (kx * layout.channels)), w, rowLength);
+							}
+						}
+					}
+
+					Type* dstRow = (dst + (y * rowLength));
+					FilterRow::FromFloat(accumulator.data(), dstRow, rowLength);
+
+					if (preserveAlpha)
+					{
+						const Type* srcRow = (src + (y * rowLength));
+
+						for (size_t i = 3; i < rowLength; i += 4)
+						{
+							dstRow[i] = srcRow[i];
+						}
+					}
+				}
+			});
+		}
+
+		/// @brief (2 * radius + 1) 四方の最大値（膨張）または最小値（収縮）を、水平・垂直に分けて求めます。
+		template <bool IsDilate, class Type>
+		static void MorphologyFilter(const Type* src, Type* dst, const PlaneLayout& layout, const int32 radius)
+		{
+			const auto apply = [](Type* d, const Type* s, const size_t count)
+				{
+					if constexpr (IsDilate)
+					{
+						FilterRow::Max(d, s, count);
+					}
+					else
+					{
+						FilterRow::Min(d, s, count);
+					}
+				};
+
+			const size_t rowLength = layout.rowLength();
+			const size_t paddedLength = ((static_cast<size_t>(layout.width) + (radius * 2)) * layout.channels);
+
+			ParallelForRows(layout.height, radius, [&](const int32 beginY, const int32 endY)
+			{
+				const int32 srcBegin = Max((beginY - radius), 0);
+				const int32 srcEnd = Min((endY + radius), layout.height);
+
+				Array<Type> padded(paddedLength);
+				Array<Type> horizontal((rowLength * (srcEnd - srcBegin)));
+
+				for (int32 srcY = srcBegin; srcY < srcEnd; ++srcY)
+				{
+					LoadPaddedRow((src + (srcY * rowLength)), padded.data(), layout, radius);
+
+					Type* out = (horizontal.data() + ((srcY - srcBegin) * rowLength));
+					std::copy_n(padded.data(), rowLength, out);
+
+					for (int32 k = 1; k <= (radius * 2); ++k)
+					{
+						apply(out, (padded.data() + (k * layout.channels)), rowLength);
+					}
+				}
+
+				for (int32 y = beginY; y < endY; ++y)
+				{
+					Type* dstRow = (dst + (y * rowLength));
+					const int32 rowBegin = Max((y - radius), 0);
+					const int32 rowEnd = Min((y + radius + 1), layout.height);
+
+					std::copy_n((horizontal.data() + ((rowBegin - srcBegin) * rowLength)), rowLength, dstRow);
+
+					for (int32 row = (rowBegin + 1); row < rowEnd; ++row)
+					{
+						apply(dstRow, (horizontal.data() + ((row - srcBegin) * rowLength)), rowLength);
+					}
+				}
+			});
+		}
+
+		/// @brief Sobel フィルタで勾配を計算します。
+		/// @param gx 水平方向の勾配の書き込み先。不要な場合は nullptr
+		/// @param gy 垂直方向の勾配の書き込み先。不要な場合は nullptr
+		/// @param magnitude 勾配の大きさの書き込み先
+		template <class Type>
+		static void ComputeGradients(const Type* src, const PlaneLayout& layout, float* gx, float* gy, float* magnitude)
+		{
+			const size_t width = layout.width;
+			const size_t paddedLength = (width + 2);
+
+			ParallelForRows(layout.height, 1, [&](const int32 beginY, const int32 endY)
+			{
+				const int32 srcBegin = Max((beginY - 1), 0);
+				const int32 srcEnd = Min((endY + 1), layout.height);
+
+				Array<float> padded((paddedLength * (srcEnd - srcBegin)));
+				Array<float> gxBuffer(gx ? 0 : width);
+				Array<float> gyBuffer(gy ? 0 : width);
+
+				for (int32 srcY = srcBegin; srcY < srcEnd; ++srcY)
+				{
+					LoadPaddedRow((src + (srcY * width)), (padded.data() + ((srcY - srcBegin) * paddedLength)), layout, 1);
+				}
+
+				for (int32 y = beginY; y < endY; ++y)
+				{
+					const float* p0 = (padded.data() + ((ClampRow((y - 1), layout.height) - srcBegin) * paddedLength));
+					const float* p1 = (padded.data() + ((y - srcBegin) * paddedLength));
+					const float* p2 = (padded.data() + ((ClampRow((y + 1), layout.height) - srcBegin) * paddedLength));
+					float* gxRow = (gx ? (gx + (y * width)) : gxBuffer.data());
+					float* gyRow = (gy ? (gy + (y * width)) : gyBuffer.data());
+
+					// [-1 0 1] [-2 0 2] [-1 0 1]
+					FilterRow::Multiply(gxRow, (p0 + 2), 1.0f, width);
+					FilterRow::MultiplyAdd(gxRow, p0, -1.0f, width);
+					FilterRow::MultiplyAdd(gxRow, (p1 + 2), 2.0f, width);
+					FilterRow::MultiplyAdd(gxRow, p1, -2.0f, width);
+					FilterRow::MultiplyAdd(gxRow, (p2 + 2), 1.0f, width);
+					FilterRow::MultiplyAdd(gxRow, p2, -1.0f, width);
+
+					// [-1 -2 -1] [0 0 0] [1 2 1]
+					FilterRow::Multiply(gyRow, p2, 1.0f, width);
+					FilterRow::MultiplyAdd(gyRow, (p2 + 1), 2.0f, width);
+					FilterRow::MultiplyAdd(gyRow, (p2 + 2), 1.0f, width);
+					FilterRow::MultiplyAdd(gyRow, p0, -1.0f, width);
+					FilterRow::MultiplyAdd(gyRow, (p0 + 1), -2.0f, width);
+					FilterRow::MultiplyAdd(gyRow, (p0 + 2), -1.0f, width);
+
+					FilterRow::Magnitude(gxRow, gyRow, (magnitude + (y * width)), width);
+				}
+			});
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Image と Grid の共通化
+		//
+		////////////////////////////////////////////////////////////////
+
+		template <class Type, class Fty>
+		[[nodiscard]]
+		static Grid<Type> ApplyToGrid(const Grid<Type>& src, Fty f)
+		{
+			Grid<Type> dst(src.size());
+
+			if (not src.isEmpty())
+			{
+				f(src.data(), dst.data(), PlaneLayout{ src.width(), src.height(), 1 });
+			}
+
+			return dst;
+		}
+
+		template <class Fty>
+		[[nodiscard]]
+		static Image ApplyToImage(const Image& src, Fty f)
+		{
+			Image dst{ src.size() };
+
+			if (not src.isEmpty())
+			{
+				f(reinterpret_cast<const uint8*>(src.data()), reinterpret_cast<uint8*>(dst.data()), PlaneLayout{ src.width(), src.height(), 4 });
+			}
+
+			return dst;
+		}
+
+		template <class Source>
+		[[nodiscard]]
+		static Source GaussianBlurImpl(const Source& src, const double sigma)
+		{
+			if (sigma <= 0.0)
+			{
+				return src;
+			}
+
+			const Array<float> weights = MakeGaussianWeights(sigma);
+			const auto f = [&](const auto* s, auto* d, const PlaneLayout& layout) { SeparableFilter(s, d, layout, weights); };
+
+			if constexpr (std::is_same_v<Source, Image>)
+			{
+				return ApplyToImage(src, f);
+			}
+			else
+			{
+				return ApplyToGrid(src, f);
+			}
+		}
+
+		template <class Source>
+		[[nodiscard]]
+		static Source BoxBlurImpl(const Source& src, const int32 radius)
+		{
+			if (radius <= 0)
+			{
+				return src;
+			}
+
+			const auto f = [&](const auto* s, auto* d, const PlaneLayout& layout) { BoxFilter(s, d, layout, radius); };
+
+			if constexpr (std::is_same_v<Source, Image>)
+			{
+				return ApplyToImage(src, f);
+			}
+			else
+			{
+				return ApplyToGrid(src, f);
+			}
+		}
+
+		template <size_t N, class Source>
+		[[nodiscard]]
+		static Source ConvolveImpl(const Source& src, const std::array<float, (N * N)>& kernel)
+		{
+			if constexpr (std::is_same_v<Source, Image>)
+			{
+				return ApplyToImage(src, [&](const uint8* s, uint8* d, const PlaneLayout& layout) { ConvolveFilter<N>(s, d, layout, kernel, true); });
+			}
+			else
+			{
+				return ApplyToGrid(src, [&](const auto* s, auto* d, const PlaneLayout& layout) { ConvolveFilter<N>(s, d, layout, kernel, false); });
+			}
+		}
+
+		template <bool IsDilate, class Source>
+		[[nodiscard]]
+		static Source MorphologyImpl(const Source& src, const int32 radius)
+		{
+			if (radius <= 0)
+			{
+				return src;
+			}
+
+			const auto f = [&](const auto* s, auto* d, const PlaneLayout& layout) { MorphologyFilter<IsDilate>(s, d, layout, radius); };
+
+			if constexpr (std::is_same_v<Source, Image>)
+			{
+				return ApplyToImage(src, f);
+			}
+			else
+			{
+				return ApplyToGrid(src, f);
+			}
+		}
+
+		template <class Type>
+		[[nodiscard]]
+		static Grid<uint8> ThresholdImpl(const Grid<Type>& src, const Type threshold)
+		{
+			Grid<uint8> dst(src.size());
+
+			Threading::ParallelFor(0, src.num_elements(), [&](const size_t begin, const size_t end)
+			{
+				FilterRow::Threshold((src.data() + begin), (dst.data() + begin), threshold, (end - begin));
+			}, MinElementsPerTask);
+
+			return dst;
+		}
+
+		template <class Type>
+		[[nodiscard]]
+		static Grid<float> SobelImpl(const Grid<Type>& src)
+		{
+			Grid<float> dst(src.size());
+
+			if (not src.isEmpty())
+			{
+				ComputeGradients(src.data(), PlaneLayout{ src.width(), src.height(), 1 }, nullptr, nullptr, dst.data());
+			}
+
+			return dst;
+		}
+	}
+
+	namespace ImageProcessing
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	GaussianBlur
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image GaussianBlur(const Image& src, const double sigma)
+		{
+			return GaussianBlurImpl(src, sigma);
+		}
+
+		Grid<uint8> GaussianBlur(const Grid<uint8>& src, const double sigma)
+		{
+			return GaussianBlurImpl(src, sigma);
+		}
+
+		Grid<uint16> GaussianBlur(const Grid<uint16>& src, const double sigma)
+		{
+			return GaussianBlurImpl(src, sigma);
+		}
+
+		Grid<float> GaussianBlur(const Grid<float>& src, const double sigma)
+		{
+			return GaussianBlurImpl(src, sigma);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BoxBlur
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image BoxBlur(const Image& src, const int32 radius)
+		{
+			return BoxBlurImpl(src, radius);
+		}
+
+		Grid<uint8> BoxBlur(const Grid<uint8>& src, const int32 radius)
+		{
+			return BoxBlurImpl(src, radius);
+		}
+
+		Grid<uint16> BoxBlur(const Grid<uint16>& src, const int32 radius)
+		{
+			return BoxBlurImpl(src, radius);
+		}
+
+		Grid<float> BoxBlur(const Grid<float>& src, const int32 radius)
+		{
+			return BoxBlurImpl(src, radius);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Convolve
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image Convolve(const Image& src, const std::array<float, 9>& kernel)
+		{
+			return ConvolveImpl<3>(src, kernel);
+		}
+
+		Image Convolve(const Image& src, const std::array<float, 25>& kernel)
+		{
+			return ConvolveImpl<5>(src, kernel);
+		}
+
+		Grid<uint8> Convolve(const Grid<uint8>& src, const std::array<float, 9>& kernel)
+		{
+			return ConvolveImpl<3>(src, kernel);
+		}
+
+		Grid<uint8> Convolve(const Grid<uint8>& src, const std::array<float, 25>& kernel)
+		{
+			return ConvolveImpl<5>(src, kernel);
+		}
+
+		Grid<uint16> Convolve(const Grid<uint16>& src, const std::array<float, 9>& kernel)
+		{
+			return ConvolveImpl<3>(src, kernel);
+		}
+
+		Grid<uint16> Convolve(const Grid<uint16>& src, const std::array<float, 25>& kernel)
+		{
+			return ConvolveImpl<5>(src, kernel);
+		}
+
+		Grid<float> Convolve(const Grid<float>& src, const std::array<float, 9>& kernel)
+		{
+			return ConvolveImpl<3>(src, kernel);
+		}
+
+		Grid<float> Convolve(const Grid<float>& src, const std::array<float, 25>& kernel)
+		{
+			return ConvolveImpl<5>(src, kernel);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Dilate, Erode
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image Dilate(const Image& src, const int32 radius)
+		{
+			return MorphologyImpl<true>(src, radius);
+		}
+
+		Grid<uint8> Dilate(const Grid<uint8>& src, const int32 radius)
+		{
+			return MorphologyImpl<true>(src, radius);
+		}
+
+		Grid<uint16> Dilate(const Grid<uint16>& src, const int32 radius)
+		{
+			return MorphologyImpl<true>(src, radius);
+		}
+
+		Grid<float> Dilate(const Grid<float>& src, const int32 radius)
+		{
+			return MorphologyImpl<true>(src, radius);
+		}
+
+		Image Erode(const Image& src, const int32 radius)
+		{
+			return MorphologyImpl<false>(src, radius);
+		}
+
+		Grid<uint8> Erode(const Grid<uint8>& src, const int32 radius)
+		{
+			return MorphologyImpl<false>(src, radius);
+		}
+
+		Grid<uint16> Erode(const Grid<uint16>& src, const int32 radius)
+		{
+			return MorphologyImpl<false>(src, radius);
+		}
+
+		Grid<float> Erode(const Grid<float>& src, const int32 radius)
+		{
+			return MorphologyImpl<false>(src, radius);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Grayscale, Threshold
+		//
+		////////////////////////////////////////////////////////////////
+
+		Grid<uint8> Grayscale(const Image& src)
+		{
+			Grid<uint8> dst(src.size());
+
+			Threading::ParallelFor(0, src.num_pixels(), [&](const size_t begin, const size_t end)
+			{
+				FilterRow::Grayscale((src.data() + begin), (dst.data() + begin), (end - begin));
+			}, MinElementsPerTask);
+
+			return dst;
+		}
+
+		Grid<uint8> Threshold(const Grid<uint8>& src, const uint8 threshold)
+		{
+			return ThresholdImpl(src, threshold);
+		}
+
+		Grid<uint8> Threshold(const Grid<uint16>& src, const uint16 threshold)
+		{
+			return ThresholdImpl(src, threshold);
+		}
+
+		Grid<uint8> Threshold(const Grid<float>& src, const float threshold)
+		{
+			return ThresholdImpl(src, threshold);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Sobel, Canny
+		//
+		////////////////////////////////////////////////////////////////
+
+		Grid<float> Sobel(const Grid<uint8>& src)
+		{
+			return SobelImpl(src);
+		}
+
+		Grid<float> Sobel(const Grid<uint16>& src)
+		{
+			return SobelImpl(src);
+		}
+
+		Grid<float> Sobel(const Grid<float>& src)
+		{
+			return SobelImpl(src);
+		}
+
+		Grid<uint8> Canny(const Grid<uint8>& src, double lowThreshold, double highThreshold)
+		{
+			const int32 width = src.width();
+			const int32 height = src.height();
+			Grid<uint8> dst(src.size());
+
+			if ((width < 3) || (height < 3))
+			{
+				return dst;
+			}
+
+			if (highThreshold < lowThreshold)
+			{
+				std::swap(lowThreshold, highThreshold);
+			}
+
+			const size_t num_elements = src.num_elements();
+			Array<float> gx(num_elements), gy(num_elements), magnitude(num_elements);
+			ComputeGradients(src.data(), PlaneLayout{ width, height, 1 }, gx.data(), gy.data(), magnitude.data());
+
+			// 非極大値の抑制。0: エッジでない, 1: 弱いエッジ, 2: 強いエッジ
+			const float low = static_cast<float>(lowThreshold);
+			const float high = static_cast<float>(highThreshold);
+			Array<uint8> classes(num_elements, 0);
+
+			ParallelForRows(height, 1, [&](const int32 beginY, const int32 endY)
+			{
+				for (int32 y = Max(beginY, 1); y < Min(endY, (height - 1)); ++y)
+				{
+					for (int32 x = 1; x < (width - 1); ++x)
+					{
+						const size_t i = ((static_cast<size_t>(y) * width) + x);
+						const float m = magnitude[i];
+
+						if (m <= low)
+						{
+							continue;
+						}
+
+						// 勾配の方向に隣接する要素
+						const float ax = std::abs(gx[i]);
+						const float ay = std::abs(gy[i]);
+						size_t offset;
+
+						if (ay <= (ax * Tan22_5))
+						{
+							offset = 1;
+						}
+						else if (ax <= (ay * Tan22_5))
+						{
+							offset = width;
+						}
+						else if ((gx[i] < 0.0f) == (gy[i] < 0.0f))
+						{
+							offset = (width + 1);
+						}
+						else
+						{
+							offset = (width - 1);
+						}
+
+						if ((magnitude[i - offset] < m) && (magnitude[i + offset] <= m))
+						{
+							classes[i] = ((high < m) ? 2 : 1);
+						}
+					}
+				}
+			});
+
+			// ヒステリシス: 強いエッジとつながる弱いエッジを残す
+			uint8* pDst = dst.data();
+			Array<size_t> stack;
+
+			for (size_t i = 0; i < num_elements; ++i)
+			{
+				if (classes[i] == 2)
+				{
+					pDst[i] = 255;
+					stack << i;
+				}
+			}
+
+			const size_t w = width;
+			const std::array<size_t, 4> neighbors = { (w + 1), w, (w - 1), 1 };
+
+			while (not stack.isEmpty())
+			{
+				const size_t i = stack.back();
+				stack.pop_back();
+
+				for (const size_t neighbor : neighbors)
+				{
+					for (const size_t n : { (i - neighbor), (i + neighbor) })
+					{
+						if ((classes[n] == 1) && (pDst[n] == 0))
+						{
+							pDst[n] = 255;
+							stack << n;
+						}
+					}
+				}
+			}
+
+			return dst;
+		}
+
+		Grid<uint8> Canny(const Image& src, const double lowThreshold, const double highThreshold)
+		{
+			return Canny(Grayscale(src), lowThreshold, highThreshold);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	CompositePremultiplied
+		//
+		////////////////////////////////////////////////////////////////
+
+		void CompositePremultiplied(const Image& src, Image& dst, const Point& pos)
+		{
+			if (&src == &dst)
+			{
+				const Image copy = src;
+				CompositePremultiplied(copy, dst, pos);
+				return;
+			}
+
+			const int32 x0 = Max(pos.x, 0);
+			const int32 y0 = Max(pos.y, 0);
+			const int32 x1 = Min((pos.x + src.width()), dst.width());
+			const int32 y1 = Min((pos.y + src.height()), dst.height());
+
+			if ((x1 <= x0) || (y1 <= y0))
+			{
+				return;
+			}
+
+			ParallelForRows((y1 - y0), 0, [&](const int32 beginY, const int32 endY)
+			{
+				for (int32 y = (y0 + beginY); y < (y0 + endY); ++y)
+				{
+					FilterRow::CompositePremultiplied((src[y - pos.y] + (x0 - pos.x)), (dst[y] + x0), (x1 - x0));
+				}
+			});
+		}
+	}
+}
@@ -0,0 +1,50 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <array>
+# include <Siv3D/JSONEvent.hpp>
+# include <Siv3D/StringView.hpp>
+# include <Siv3D/FormatData.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		static constexpr std::array JSONEventStrings =
+		{
+			U"None"_sv,
+			U"BeginObject"_sv,
+			U"EndObject"_sv,
+			U"BeginArray"_sv,
+			U"EndArray"_sv,
+			U"Key"_sv,
+			U"String"_sv,
+			U"Bool"_sv,
+			U"NumberInt"_sv,
+			U"NumberUint"_sv,
+			U"NumberFloat"_sv,
+			U"Null"_sv,
+			U"EndOfDocument"_sv,
+			U"Error"_sv,
+		};
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, const JSONEvent value)
+	{
+		formatData.string.append(JSONEventStrings[FromEnum(value)]);
+	}
+}
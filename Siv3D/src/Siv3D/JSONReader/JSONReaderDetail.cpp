@@ -0,0 +1,916 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <charconv>
+# include "JSONReaderDetail.hpp"
+# include <Siv3D/EngineLog.hpp>
+# include <ThirdParty/fast_float/fast_float.h>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief readJSON() で構築できるオブジェクトと配列の入れ子の最大数
+		/// @remark 構築は再帰で行うため、深すぎる入れ子でスタックを使い切らないよう制限する
+		constexpr size_t MaxBuildDepth = 512;
+
+		[[nodiscard]]
+		static constexpr bool IsSpace(const int32 ch) noexcept
+		{
+			return ((ch == ' ') || (ch == '\n') || (ch == '\r') || (ch == '\t'));
+		}
+
+		[[nodiscard]]
+		static constexpr bool IsDigit(const int32 ch) noexcept
+		{
+			return (('0' <= ch) && (ch <= '9'));
+		}
+
+		[[nodiscard]]
+		static constexpr int32 HexValue(const int32 ch) noexcept
+		{
+			if (IsDigit(ch))
+			{
+				return (ch - '0');
+			}
+			else if (('a' <= ch) && (ch <= 'f'))
+			{
+				return (ch - 'a' + 10);
+			}
+			else if (('A' <= ch) && (ch <= 'F'))
+			{
+				return (ch - 'A' + 10);
+			}
+
+			return -1;
+		}
+
+		static void AppendUTF8(std::string& s, const char32 ch)
+		{
+			if (ch < 0x80)
+			{
+				s.push_back(static_cast<char>(ch));
+			}
+			else if (ch < 0x800)
+			{
+				s.push_back(static_cast<char>(0xC0 | (ch >> 6)));
+				s.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			}
+			else if (ch < 0x10000)
+			{
+				s.push_back(static_cast<char>(0xE0 | (ch >> 12)));
+				s.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+				s.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			}
+			else
+			{
+				s.push_back(static_cast<char>(0xF0 | (ch >> 18)));
+				s.push_back(static_cast<char>(0x80 | ((ch >> 12) & 0x3F)));
+				s.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+				s.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			}
+		}
+
+		/// @brief JSON の数値の文法に従っているかを返します。
+		[[nodiscard]]
+		static bool IsValidNumber(const std::string_view s) noexcept
+		{
+			size_t i = 0;
+
+			if ((i < s.size()) && (s[i] == '-'))
+			{
+				++i;
+			}
+
+			if ((i < s.size()) && (s[i] == '0'))
+			{
+				++i;
+			}
+			else if ((i < s.size()) && IsDigit(s[i]))
+			{
+				while ((i < s.size()) && IsDigit(s[i]))
+				{
+					++i;
+				}
+			}
+			else
+			{
+				return false;
+			}
+
+			if ((i < s.size()) && (s[i] == '.'))
+			{
+				const size_t first = ++i;
+
+				while ((i < s.size()) && IsDigit(s[i]))
+				{
+					++i;
+				}
+
+				if (i == first)
+				{
+					return false;
+				}
+			}
+
+			if ((i < s.size()) && ((s[i] == 'e') || (s[i] == 'E')))
+			{
+				++i;
+
+				if ((i < s.size()) && ((s[i] == '+') || (s[i] == '-')))
+				{
+					++i;
+				}
+
+				const size_t first = i;
+
+				while ((i < s.size()) && IsDigit(s[i]))
+				{
+					++i;
+				}
+
+				if (i == first)
+				{
+					return false;
+				}
+			}
+
+			return (i == s.size());
+		}
+	}
+
+	bool JSONReader::JSONReaderDetail::open(std::unique_ptr<IReader>&& reader)
+	{
+		close();
+
+		if ((not reader) || (not reader->isOpen()))
+		{
+			return false;
+		}
+
+		m_reader = std::move(reader);
+		m_buffer = std::make_unique_for_overwrite<char[]>(BufferSize);
+		m_isOpen = true;
+
+		return true;
+	}
+
+	bool JSONReader::JSONReaderDetail::open(const void* data, const size_t size)
+	{
+		close();
+
+		if (data == nullptr)
+		{
+			return false;
+		}
+
+		m_bufferBegin = m_current = static_cast<const char*>(data);
+		m_end = (m_current + size);
+		m_isOpen = true;
+
+		return true;
+	}
+
+	void JSONReader::JSONReaderDetail::close()
+	{
+		m_reader.reset();
+		m_buffer.reset();
+		reset();
+	}
+
+	bool JSONReader::JSONReaderDetail::isOpen() const noexcept
+	{
+		return m_isOpen;
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::next()
+	{
+		if ((m_event == JSONEvent::Error) || (m_event == JSONEvent::EndOfDocument))
+		{
+			return m_event;
+		}
+
+		if (not m_isOpen)
+		{
+			return setError("JSONReader is not open");
+		}
+
+		m_stringView = {};
+		m_stringViewInBuffer = false;
+
+		int32 ch = peekNonSpace();
+
+		switch (m_state)
+		{
+		case State::Done:
+			if (ch == -1)
+			{
+				return (m_event = JSONEvent::EndOfDocument);
+			}
+
+			return setError("unexpected data after the root value");
+		case State::CommaOrEnd:
+			if (ch == ',')
+			{
+				++m_current;
+				m_state = (m_containers.back() ? State::Key : State::Value);
+				ch = peekNonSpace();
+				break;
+			}
+			else if ((ch == '}') && m_containers.back())
+			{
+				++m_current;
+				m_containers.pop_back();
+				return onValue(JSONEvent::EndObject);
+			}
+			else if ((ch == ']') && (not m_containers.back()))
+			{
+				++m_current;
+				m_containers.pop_back();
+				return onValue(JSONEvent::EndArray);
+			}
+
+			return setError("expected ',' or a closing bracket");
+		case State::FirstKeyOrEnd:
+			if (ch == '}')
+			{
+				++m_current;
+				m_containers.pop_back();
+				return onValue(JSONEvent::EndObject);
+			}
+
+			m_state = State::Key;
+			break;
+		case State::FirstValueOrEnd:
+			if (ch == ']')
+			{
+				++m_current;
+				m_containers.pop_back();
+				return onValue(JSONEvent::EndArray);
+			}
+
+			m_state = State::Value;
+			break;
+		default:
+			break;
+		}
+
+		if (m_state == State::Key)
+		{
+			if (ch != '"')
+			{
+				return setError("expected an object key");
+			}
+
+			++m_current;
+
+			if (not readString())
+			{
+				return m_event;
+			}
+
+			if (peekNonSpace() != ':')
+			{
+				return setError("expected ':' after an object key");
+			}
+
+			++m_current;
+			m_state = State::Value;
+			return (m_event = JSONEvent::Key);
+		}
+
+		return readValue(ch);
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::getEvent() const noexcept
+	{
+		return m_event;
+	}
+
+	size_t JSONReader::JSONReaderDetail::getDepth() const noexcept
+	{
+		return m_containers.size();
+	}
+
+	std::string_view JSONReader::JSONReaderDetail::getStringUTF8() const noexcept
+	{
+		return m_stringView;
+	}
+
+	bool JSONReader::JSONReaderDetail::getBool() const noexcept
+	{
+		return ((m_event == JSONEvent::Bool) && m_bool);
+	}
+
+	int64 JSONReader::JSONReaderDetail::getInt64() const noexcept
+	{
+		switch (m_event)
+		{
+		case JSONEvent::NumberInt:
+			return m_int;
+		case JSONEvent::NumberUint:
+			return static_cast<int64>(m_uint);
+		case JSONEvent::NumberFloat:
+			return static_cast<int64>(m_double);
+		default:
+			return 0;
+		}
+	}
+
+	uint64 JSONReader::JSONReaderDetail::getUint64() const noexcept
+	{
+		switch (m_event)
+		{
+		case JSONEvent::NumberInt:
+			return static_cast<uint64>(m_int);
+		case JSONEvent::NumberUint:
+			return m_uint;
+		case JSONEvent::NumberFloat:
+			return static_cast<uint64>(m_double);
+		default:
+			return 0;
+		}
+	}
+
+	double JSONReader::JSONReaderDetail::getDouble() const noexcept
+	{
+		switch (m_event)
+		{
+		case JSONEvent::NumberInt:
+			return static_cast<double>(m_int);
+		case JSONEvent::NumberUint:
+			return static_cast<double>(m_uint);
+		case JSONEvent::NumberFloat:
+			return m_double;
+		default:
+			return 0.0;
+		}
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::skip()
+	{
+		if (m_event == JSONEvent::Key)
+		{
+			next();
+		}
+
+		if ((m_event == JSONEvent::BeginObject) || (m_event == JSONEvent::BeginArray))
+		{
+			return skipContainer();
+		}
+
+		return m_event;
+	}
+
+	JSON JSONReader::JSONReaderDetail::readJSON()
+	{
+		if (m_event == JSONEvent::Key)
+		{
+			next();
+		}
+
+		nlohmann::json json = buildValue(0);
+
+		if (m_event == JSONEvent::Error)
+		{
+			return JSON::Invalid();
+		}
+
+		return JSON{ std::move(json) };
+	}
+
+	int64 JSONReader::JSONReaderDetail::getPos() const noexcept
+	{
+		return (m_bufferOffset + (m_current - m_bufferBegin));
+	}
+
+	bool JSONReader::JSONReaderDetail::hasError() const noexcept
+	{
+		return (m_event == JSONEvent::Error);
+	}
+
+	const std::string& JSONReader::JSONReaderDetail::getErrorMessage() const noexcept
+	{
+		return m_errorMessage;
+	}
+
+	void JSONReader::JSONReaderDetail::reset()
+	{
+		m_current = m_end = m_bufferBegin = nullptr;
+		m_bufferOffset = 0;
+		m_isOpen = false;
+		m_event = JSONEvent::None;
+		m_state = State::Value;
+		m_containers.clear();
+		m_stringView = {};
+		m_stringViewInBuffer = false;
+		m_string.clear();
+		m_numberText.clear();
+		m_uint = 0;
+		m_errorMessage.clear();
+	}
+
+	bool JSONReader::JSONReaderDetail::fill()
+	{
+		if (m_current != m_end)
+		{
+			return true;
+		}
+
+		if (not m_reader)
+		{
+			return false;
+		}
+
+		// 上書きされるバッファを指している文字列は、先に退避する
+		if (m_stringViewInBuffer)
+		{
+			m_string.assign(m_stringView);
+			m_stringView = m_string;
+			m_stringViewInBuffer = false;
+		}
+
+		m_bufferOffset += (m_end - m_bufferBegin);
+
+		const int64 readSize = m_reader->read(m_buffer.get(), BufferSize);
+
+		m_bufferBegin = m_current = m_buffer.get();
+		m_end = (m_current + Max<int64>(readSize, 0));
+
+		return (m_current != m_end);
+	}
+
+	int32 JSONReader::JSONReaderDetail::peekNonSpace()
+	{
+		for (;;)
+		{
+			while ((m_current != m_end) && IsSpace(*m_current))
+			{
+				++m_current;
+			}
+
+			if (m_current != m_end)
+			{
+				return static_cast<uint8>(*m_current);
+			}
+
+			if (not fill())
+			{
+				return -1;
+			}
+		}
+	}
+
+	int32 JSONReader::JSONReaderDetail::getByte()
+	{
+		if ((m_current == m_end) && (not fill()))
+		{
+			return -1;
+		}
+
+		return static_cast<uint8>(*m_current++);
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::setError(const std::string_view message)
+	{
+		m_errorMessage = fmt::format("JSONReader: {} at byte {}", message, getPos());
+		m_stringView = {};
+		m_stringViewInBuffer = false;
+
+		LOG_FAIL(fmt::format("❌ {}", m_errorMessage));
+
+		return (m_event = JSONEvent::Error);
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::onValue(const JSONEvent event)
+	{
+		m_state = (m_containers ? State::CommaOrEnd : State::Done);
+
+		return (m_event = event);
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::readValue(const int32 ch)
+	{
+		switch (ch)
+		{
+		case '{':
+			++m_current;
+			m_containers.push_back(true);
+			m_state = State::FirstKeyOrEnd;
+			return (m_event = JSONEvent::BeginObject);
+		case '[':
+			++m_current;
+			m_containers.push_back(false);
+			m_state = State::FirstValueOrEnd;
+			return (m_event = JSONEvent::BeginArray);
+		case '"':
+			++m_current;
+
+			if (not readString())
+			{
+				return m_event;
+			}
+
+			return onValue(JSONEvent::String);
+		case 't':
+			if (not readLiteral("true"))
+			{
+				return m_event;
+			}
+
+			m_bool = true;
+			return onValue(JSONEvent::Bool);
+		case 'f':
+			if (not readLiteral("false"))
+			{
+				return m_event;
+			}
+
+			m_bool = false;
+			return onValue(JSONEvent::Bool);
+		case 'n':
+			if (not readLiteral("null"))
+			{
+				return m_event;
+			}
+
+			return onValue(JSONEvent::Null);
+		case -1:
+			return setError("unexpected end of data");
+		default:
+			if ((ch == '-') || IsDigit(ch))
+			{
+				return readNumber();
+			}
+
+			return setError("unexpected character");
+		}
+	}
+
+	bool JSONReader::JSONReaderDetail::readString()
+	{
+		m_string.clear();
+		bool copied = false;
+
+		for (;;)
+		{
+			const char* first = m_current;
+
+			while (m_current != m_end)
+			{
+				const uint8 ch = static_cast<uint8>(*m_current);
+
+				if ((ch == '"') || (ch == '\\') || (ch < 0x20))
+				{
+					break;
+				}
+
+				++m_current;
+			}
+
+			if (m_current == m_end)
+			{
+				m_string.append(first, m_current);
+				copied = true;
+
+				if (not fill())
+				{
+					setError("unterminated string");
+					return false;
+				}
+
+				continue;
+			}
+
+			const char ch = *m_current;
+
+			if (ch == '"')
+			{
+				// エスケープもバッファの境界も含まない文字列は、コピーせずに参照する
+				if (copied)
+				{
+					m_string.append(first, m_current);
+					m_stringView = m_string;
+				}
+				else
+				{
+					m_stringView = std::string_view{ first, static_cast<size_t>(m_current - first) };
+					m_stringViewInBuffer = static_cast<bool>(m_reader);
+				}
+
+				++m_current;
+				return true;
+			}
+			else if (ch != '\\')
+			{
+				setError("control character in a string");
+				return false;
+			}
+
+			m_string.append(first, m_current);
+			copied = true;
+			++m_current;
+
+			switch (getByte())
+			{
+			case '"':
+				m_string.push_back('"');
+				break;
+			case '\\':
+				m_string.push_back('\\');
+				break;
+			case '/':
+				m_string.push_back('/');
+				break;
+			case 'b':
+				m_string.push_back('\b');
+				break;
+			case 'f':
+				m_string.push_back('\f');
+				break;
+			case 'n':
+				m_string.push_back('\n');
+				break;
+			case 'r':
+				m_string.push_back('\r');
+				break;
+			case 't':
+				m_string.push_back('\t');
+				break;
+			case 'u':
+				{
+					const auto readHex4 = [this]()
+					{
+						int32 value = 0;
+
+						for (int32 i = 0; i < 4; ++i)
+						{
+							const int32 digit = HexValue(getByte());
+
+							if (digit < 0)
+							{
+								return -1;
+							}
+
+							value = ((value << 4) | digit);
+						}
+
+						return value;
+					};
+
+					int32 codePoint = readHex4();
+
+					if (codePoint < 0)
+					{
+						setError("invalid \\u escape");
+						return false;
+					}
+
+					if ((0xD800 <= codePoint) && (codePoint < 0xDC00))
+					{
+						int32 low = -1;
+
+						if ((getByte() == '\\') && (getByte() == 'u'))
+						{
+							low = readHex4();
+						}
+
+						if ((low < 0xDC00) || (0xE000 <= low))
+						{
+							setError("invalid surrogate pair");
+							return false;
+						}
+
+						codePoint = (0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00));
+					}
+					else if ((0xDC00 <= codePoint) && (codePoint < 0xE000))
+					{
+						setError("invalid surrogate pair");
+						return false;
+					}
+
+					AppendUTF8(m_string, static_cast<char32>(codePoint));
+					break;
+				}
+			default:
+				setError("invalid escape sequence");
+				return false;
+			}
+		}
+	}
+
+	bool JSONReader::JSONReaderDetail::readLiteral(const std::string_view literal)
+	{
+		for (const char ch : literal)
+		{
+			if (getByte() != static_cast<uint8>(ch))
+			{
+				setError("invalid literal");
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::readNumber()
+	{
+		m_numberText.clear();
+		bool isInteger = true;
+
+		for (;;)
+		{
+			if ((m_current == m_end) && (not fill()))
+			{
+				break;
+			}
+
+			const char ch = *m_current;
+
+			if (IsDigit(ch) || (ch == '-') || (ch == '+'))
+			{
+				m_numberText.push_back(ch);
+			}
+			else if ((ch == '.') || (ch == 'e') || (ch == 'E'))
+			{
+				m_numberText.push_back(ch);
+				isInteger = false;
+			}
+			else
+			{
+				break;
+			}
+
+			++m_current;
+		}
+
+		if (not IsValidNumber(m_numberText))
+		{
+			return setError("invalid number");
+		}
+
+		const char* first = m_numberText.data();
+		const char* last = (first + m_numberText.size());
+
+		if (isInteger)
+		{
+			if (m_numberText.front() == '-')
+			{
+				if (const auto result = std::from_chars(first, last, m_int);
+					result.ec == std::errc{})
+				{
+					return onValue(JSONEvent::NumberInt);
+				}
+			}
+			else
+			{
+				if (const auto result = std::from_chars(first, last, m_uint);
+					result.ec == std::errc{})
+				{
+					return onValue(JSONEvent::NumberUint);
+				}
+			}
+
+			// 整数型で表せない場合は浮動小数点数として扱う
+		}
+
+		fast_float::from_chars(first, last, m_double);
+
+		return onValue(JSONEvent::NumberFloat);
+	}
+
+	JSONEvent JSONReader::JSONReaderDetail::skipContainer()
+	{
+		size_t depth = 1;
+		bool inString = false;
+
+		while (depth)
+		{
+			if ((m_current == m_end) && (not fill()))
+			{
+				return setError("unexpected end of data");
+			}
+
+			if (inString)
+			{
+				while (m_current != m_end)
+				{
+					const char ch = *m_current++;
+
+					if (ch == '"')
+					{
+						inString = false;
+						break;
+					}
+					else if (ch == '\\')
+					{
+						// エスケープされた文字を読み飛ばす
+						if (getByte() == -1)
+						{
+							return setError("unexpected end of data");
+						}
+					}
+				}
+
+				continue;
+			}
+
+			while ((m_current != m_end) && depth)
+			{
+				const char ch = *m_current++;
+
+				if ((ch == '{') || (ch == '['))
+				{
+					++depth;
+				}
+				else if ((ch == '}') || (ch == ']'))
+				{
+					--depth;
+				}
+				else if (ch == '"')
+				{
+					inString = true;
+					break;
+				}
+			}
+		}
+
+		const bool isObject = m_containers.back();
+		m_containers.pop_back();
+
+		return onValue(isObject ? JSONEvent::EndObject : JSONEvent::EndArray);
+	}
+
+	nlohmann::json JSONReader::JSONReaderDetail::buildValue(const size_t depth)
+	{
+		if (((m_event == JSONEvent::BeginObject) || (m_event == JSONEvent::BeginArray))
+			&& (MaxBuildDepth <= depth))
+		{
+			setError("too deeply nested");
+			return nlohmann::json(nlohmann::json::value_t::discarded);
+		}
+
+		switch (m_event)
+		{
+		case JSONEvent::BeginObject:
+			{
+				nlohmann::json object = nlohmann::json::object();
+
+				while (next() == JSONEvent::Key)
+				{
+					std::string key{ m_stringView };
+
+					next();
+
+					object[std::move(key)] = buildValue(depth + 1);
+				}
+
+				return object;
+			}
+		case JSONEvent::BeginArray:
+			{
+				nlohmann::json array = nlohmann::json::array();
+
+				while (true)
+				{
+					if (const JSONEvent event = next();
+						(event == JSONEvent::EndArray) || (event == JSONEvent::Error))
+					{
+						break;
+					}
+
+					array.push_back(buildValue(depth + 1));
+				}
+
+				return array;
+			}
+		case JSONEvent::String:
+			return std::string{ m_stringView };
+		case JSONEvent::Bool:
+			return m_bool;
+		case JSONEvent::NumberInt:
+			return m_int;
+		case JSONEvent::NumberUint:
+			return m_uint;
+		case JSONEvent::NumberFloat:
+			return m_double;
+		case JSONEvent::Null:
+			return nullptr;
+		default:
+			if (m_event != JSONEvent::Error)
+			{
+				setError("expected a value");
+			}
+
+			return nlohmann::json(nlohmann::json::value_t::discarded);
+		}
+	}
+}
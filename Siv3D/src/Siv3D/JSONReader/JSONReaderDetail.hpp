@@ -0,0 +1,185 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/JSONReader.hpp>
+# include <Siv3D/JSON.hpp>
+
+namespace s3d
+{
+	class JSONReader::JSONReaderDetail
+	{
+	public:
+
+		JSONReaderDetail() = default;
+
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		bool open(const void* data, size_t size);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		JSONEvent next();
+
+		[[nodiscard]]
+		JSONEvent getEvent() const noexcept;
+
+		[[nodiscard]]
+		size_t getDepth() const noexcept;
+
+		[[nodiscard]]
+		std::string_view getStringUTF8() const noexcept;
+
+		[[nodiscard]]
+		bool getBool() const noexcept;
+
+		[[nodiscard]]
+		int64 getInt64() const noexcept;
+
+		[[nodiscard]]
+		uint64 getUint64() const noexcept;
+
+		[[nodiscard]]
+		double getDouble() const noexcept;
+
+		JSONEvent skip();
+
+		[[nodiscard]]
+		JSON readJSON();
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		[[nodiscard]]
+		bool hasError() const noexcept;
+
+		[[nodiscard]]
+		const std::string& getErrorMessage() const noexcept;
+
+	private:
+
+		/// @brief IReader から一度に読み込むサイズ（バイト）
+		static constexpr size_t BufferSize = (64 * 1024);
+
+		/// @brief 次に読み込む要素
+		enum class State : uint8
+		{
+			/// @brief 値
+			Value,
+
+			/// @brief `{` の直後のキーまたは `}`
+			FirstKeyOrEnd,
+
+			/// @brief `,` の直後のキー
+			Key,
+
+			/// @brief `[` の直後の値または `]`
+			FirstValueOrEnd,
+
+			/// @brief 値の直後の `,` または閉じ括弧
+			CommaOrEnd,
+
+			/// @brief ルートの値を読み終えた
+			Done,
+		};
+
+		std::unique_ptr<IReader> m_reader;
+
+		/// @brief IReader から読み込んだデータのバッファ
+		std::unique_ptr<char[]> m_buffer;
+
+		/// @brief 未処理のデータの先頭
+		const char* m_current = nullptr;
+
+		/// @brief 未処理のデータの終端
+		const char* m_end = nullptr;
+
+		/// @brief 現在のバッファより前に処理したデータのサイズ（バイト）
+		int64 m_bufferOffset = 0;
+
+		/// @brief 現在のバッファの先頭
+		const char* m_bufferBegin = nullptr;
+
+		bool m_isOpen = false;
+
+		JSONEvent m_event = JSONEvent::None;
+
+		State m_state = State::Value;
+
+		/// @brief 開いているオブジェクト (true) と配列 (false)
+		Array<bool> m_containers;
+
+		/// @brief 現在のキーまたは文字列
+		std::string_view m_stringView;
+
+		/// @brief エスケープを含む文字列や、バッファの境界をまたいだ文字列の格納先
+		std::string m_string;
+
+		/// @brief m_stringView が m_buffer を指しているか
+		bool m_stringViewInBuffer = false;
+
+		/// @brief 数値の文字列の格納先
+		std::string m_numberText;
+
+		union
+		{
+			int64 m_int;
+
+			uint64 m_uint = 0;
+
+			double m_double;
+
+			bool m_bool;
+		};
+
+		std::string m_errorMessage;
+
+		void reset();
+
+		/// @brief バッファを使い切った場合に、次のデータを読み込みます。
+		/// @return 未処理のデータがある場合 true, データの終端に達した場合は false
+		[[nodiscard]]
+		bool fill();
+
+		/// @brief 空白を読み飛ばし、次の 1 バイトを返します。
+		/// @return 次の 1 バイト。データの終端に達した場合は -1
+		[[nodiscard]]
+		int32 peekNonSpace();
+
+		[[nodiscard]]
+		int32 getByte();
+
+		JSONEvent setError(std::string_view message);
+
+		JSONEvent onValue(JSONEvent event);
+
+		JSONEvent readValue(int32 ch);
+
+		[[nodiscard]]
+		bool readString();
+
+		[[nodiscard]]
+		bool readLiteral(std::string_view rest);
+
+		JSONEvent readNumber();
+
+		/// @brief 現在のオブジェクトまたは配列の終端まで、構文を検証せずに読み飛ばします。
+		JSONEvent skipContainer();
+
+		/// @brief 現在の値から JSON を構築します。
+		/// @param depth 現在の値を囲む、構築中のオブジェクトと配列の数
+		[[nodiscard]]
+		nlohmann::json buildValue(size_t depth);
+	};
+}
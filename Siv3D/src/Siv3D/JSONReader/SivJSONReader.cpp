@@ -0,0 +1,240 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/JSONReader.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/Unicode.hpp>
+# include "JSONReaderDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONReader::JSONReader()
+		: pImpl{ std::make_shared<JSONReaderDetail>() } {}
+
+	JSONReader::JSONReader(const FilePathView path)
+		: JSONReader{}
+	{
+		open(path);
+	}
+
+	JSONReader::JSONReader(std::unique_ptr<IReader>&& reader)
+		: JSONReader{}
+	{
+		open(std::move(reader));
+	}
+
+	JSONReader::JSONReader(const void* data, const size_t size)
+		: JSONReader{}
+	{
+		open(data, size);
+	}
+
+	JSONReader::JSONReader(const MappedMemoryView& view)
+		: JSONReader{}
+	{
+		open(view);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONReader::open(const FilePathView path)
+	{
+		return pImpl->open(std::make_unique<BinaryReader>(path));
+	}
+
+	bool JSONReader::open(std::unique_ptr<IReader>&& reader)
+	{
+		return pImpl->open(std::move(reader));
+	}
+
+	bool JSONReader::open(const void* data, const size_t size)
+	{
+		return pImpl->open(data, size);
+	}
+
+	bool JSONReader::open(const MappedMemoryView& view)
+	{
+		return pImpl->open(view.data, view.size);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	void JSONReader::close()
+	{
+		pImpl->close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	next
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONEvent JSONReader::next()
+	{
+		return pImpl->next();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getEvent
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONEvent JSONReader::getEvent() const noexcept
+	{
+		return pImpl->getEvent();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getDepth
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t JSONReader::getDepth() const noexcept
+	{
+		return pImpl->getDepth();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getString, getStringUTF8
+	//
+	////////////////////////////////////////////////////////////////
+
+	String JSONReader::getString() const
+	{
+		return Unicode::FromUTF8(pImpl->getStringUTF8());
+	}
+
+	std::string_view JSONReader::getStringUTF8() const noexcept
+	{
+		return pImpl->getStringUTF8();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getBool, getInt64, getUint64, getDouble
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONReader::getBool() const noexcept
+	{
+		return pImpl->getBool();
+	}
+
+	int64 JSONReader::getInt64() const noexcept
+	{
+		return pImpl->getInt64();
+	}
+
+	uint64 JSONReader::getUint64() const noexcept
+	{
+		return pImpl->getUint64();
+	}
+
+	double JSONReader::getDouble() const noexcept
+	{
+		return pImpl->getDouble();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	skip
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONEvent JSONReader::skip()
+	{
+		return pImpl->skip();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	readJSON
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSON JSONReader::readJSON()
+	{
+		return pImpl->readJSON();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 JSONReader::getPos() const noexcept
+	{
+		return pImpl->getPos();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasError
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONReader::hasError() const noexcept
+	{
+		return pImpl->hasError();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getErrorMessage
+	//
+	////////////////////////////////////////////////////////////////
+
+	String JSONReader::getErrorMessage() const
+	{
+		return Unicode::FromUTF8(pImpl->getErrorMessage());
+	}
+}
@@ -0,0 +1,456 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cmath>
+# include <charconv>
+# include "JSONWriterDetail.hpp"
+# include <Siv3D/Error.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		static constexpr char HexDigits[] = "0123456789abcdef";
+
+		/// @brief 制御文字をエスケープして追加します。
+		static void AppendControl(std::string& s, const uint8 ch)
+		{
+			switch (ch)
+			{
+			case '\b':
+				s.append("\\b");
+				break;
+			case '\f':
+				s.append("\\f");
+				break;
+			case '\n':
+				s.append("\\n");
+				break;
+			case '\r':
+				s.append("\\r");
+				break;
+			case '\t':
+				s.append("\\t");
+				break;
+			default:
+				{
+					const char escaped[] = { '\\', 'u', '0', '0', HexDigits[ch >> 4], HexDigits[ch & 0xF] };
+					s.append(escaped, sizeof(escaped));
+					break;
+				}
+			}
+		}
+	}
+
+	JSONWriter::JSONWriterDetail::~JSONWriterDetail()
+	{
+		close();
+	}
+
+	bool JSONWriter::JSONWriterDetail::open(std::unique_ptr<IWriter>&& writer)
+	{
+		close();
+
+		if ((not writer) || (not writer->isOpen()))
+		{
+			return false;
+		}
+
+		m_writer = std::move(writer);
+		m_buffer.reserve(FlushThreshold * 2);
+
+		return true;
+	}
+
+	bool JSONWriter::JSONWriterDetail::close()
+	{
+		if (not m_writer)
+		{
+			return false;
+		}
+
+		const bool result = flush();
+
+		m_writer.reset();
+		reset();
+
+		return result;
+	}
+
+	bool JSONWriter::JSONWriterDetail::isOpen() const noexcept
+	{
+		return static_cast<bool>(m_writer);
+	}
+
+	void JSONWriter::JSONWriterDetail::setIndent(const char32 indent, const size_t spaceCount)
+	{
+		// JSON の空白として使える文字のみを受け付ける
+		if ((indent == U' ') || (indent == U'\t'))
+		{
+			m_indent = static_cast<char>(indent);
+		}
+
+		m_spaceCount = spaceCount;
+	}
+
+	void JSONWriter::JSONWriterDetail::startObject()
+	{
+		beginValue();
+		m_buffer.push_back('{');
+		m_containers.push_back({ .isObject = true });
+	}
+
+	void JSONWriter::JSONWriterDetail::endObject()
+	{
+		endContainer(true);
+	}
+
+	void JSONWriter::JSONWriterDetail::startArray()
+	{
+		beginValue();
+		m_buffer.push_back('[');
+		m_containers.push_back({ .isObject = false });
+	}
+
+	void JSONWriter::JSONWriterDetail::endArray()
+	{
+		endContainer(false);
+	}
+
+	void JSONWriter::JSONWriterDetail::key(const StringView key)
+	{
+		beginKey();
+		appendEscaped(key);
+		m_buffer.append(m_spaceCount ? "\": " : "\":");
+		m_afterKey = true;
+	}
+
+	void JSONWriter::JSONWriterDetail::keyUTF8(const std::string_view key)
+	{
+		beginKey();
+		appendEscaped(key);
+		m_buffer.append(m_spaceCount ? "\": " : "\":");
+		m_afterKey = true;
+	}
+
+	void JSONWriter::JSONWriterDetail::writeNull()
+	{
+		beginValue();
+		m_buffer.append("null");
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::writeBool(const bool value)
+	{
+		beginValue();
+		m_buffer.append(value ? "true" : "false");
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::writeInt64(const int64 value)
+	{
+		beginValue();
+		char buffer[24];
+		const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+		m_buffer.append(buffer, result.ptr);
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::writeUint64(const uint64 value)
+	{
+		beginValue();
+		char buffer[24];
+		const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+		m_buffer.append(buffer, result.ptr);
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::writeDouble(const double value)
+	{
+		beginValue();
+
+		if (not std::isfinite(value))
+		{
+			// nlohmann::json と同様に、NaN と無限大は null にする
+			m_buffer.append("null");
+		}
+		else
+		{
+			char buffer[64];
+			const char* last = nlohmann::detail::to_chars(std::begin(buffer), std::end(buffer), value);
+			m_buffer.append(buffer, static_cast<size_t>(last - buffer));
+		}
+
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::writeString(const StringView value)
+	{
+		beginValue();
+		m_buffer.push_back('"');
+		appendEscaped(value);
+		m_buffer.push_back('"');
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::writeStringUTF8(const std::string_view value)
+	{
+		beginValue();
+		m_buffer.push_back('"');
+		appendEscaped(value);
+		m_buffer.push_back('"');
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::writeJSON(const JSON& value)
+	{
+		beginValue();
+
+		if (m_spaceCount == 0)
+		{
+			m_buffer.append(value.formatUTF8Minified());
+		}
+		else
+		{
+			const std::string s = value.formatUTF8(static_cast<char32>(m_indent), m_spaceCount);
+
+			// 現在の深さの分だけ、2 行目以降をインデントする
+			const std::string indent((m_containers.size() * m_spaceCount), m_indent);
+
+			for (const char ch : s)
+			{
+				m_buffer.push_back(ch);
+
+				if (ch == '\n')
+				{
+					m_buffer.append(indent);
+				}
+			}
+		}
+
+		endValue();
+	}
+
+	bool JSONWriter::JSONWriterDetail::flush()
+	{
+		if ((not m_writer) || m_buffer.empty())
+		{
+			return (not m_hasError);
+		}
+
+		const int64 size = static_cast<int64>(m_buffer.size());
+
+		if (m_writer->write(m_buffer.data(), size) != size)
+		{
+			m_hasError = true;
+		}
+
+		m_buffer.clear();
+
+		return (not m_hasError);
+	}
+
+	bool JSONWriter::JSONWriterDetail::isComplete() const noexcept
+	{
+		return (m_hasRoot && m_containers.isEmpty());
+	}
+
+	bool JSONWriter::JSONWriterDetail::hasError() const noexcept
+	{
+		return m_hasError;
+	}
+
+	void JSONWriter::JSONWriterDetail::reset()
+	{
+		m_buffer.clear();
+		m_containers.clear();
+		m_afterKey = false;
+		m_hasRoot = false;
+		m_hasError = false;
+	}
+
+	void JSONWriter::JSONWriterDetail::newLine(const size_t depth)
+	{
+		if (m_spaceCount)
+		{
+			m_buffer.push_back('\n');
+			m_buffer.append((depth * m_spaceCount), m_indent);
+		}
+	}
+
+	void JSONWriter::JSONWriterDetail::beginValue()
+	{
+		if (not m_writer)
+		{
+			throw Error{ "JSONWriter: the writer is not open" };
+		}
+
+		if (m_afterKey)
+		{
+			m_afterKey = false;
+			return;
+		}
+
+		if (m_containers.isEmpty())
+		{
+			if (m_hasRoot)
+			{
+				throw Error{ "JSONWriter: the root value has already been written" };
+			}
+
+			return;
+		}
+
+		Container& container = m_containers.back();
+
+		if (container.isObject)
+		{
+			throw Error{ "JSONWriter: a value in an object must follow a key" };
+		}
+
+		if (container.hasElements)
+		{
+			m_buffer.push_back(',');
+		}
+
+		container.hasElements = true;
+		newLine(m_containers.size());
+	}
+
+	void JSONWriter::JSONWriterDetail::endValue()
+	{
+		if (m_containers.isEmpty())
+		{
+			m_hasRoot = true;
+		}
+
+		if (FlushThreshold <= m_buffer.size())
+		{
+			flush();
+		}
+	}
+
+	void JSONWriter::JSONWriterDetail::beginKey()
+	{
+		if (not m_writer)
+		{
+			throw Error{ "JSONWriter: the writer is not open" };
+		}
+
+		if (m_containers.isEmpty() || (not m_containers.back().isObject) || m_afterKey)
+		{
+			throw Error{ "JSONWriter: a key must be written in an object, before its value" };
+		}
+
+		Container& container = m_containers.back();
+
+		if (container.hasElements)
+		{
+			m_buffer.push_back(',');
+		}
+
+		container.hasElements = true;
+		newLine(m_containers.size());
+		m_buffer.push_back('"');
+	}
+
+	void JSONWriter::JSONWriterDetail::endContainer(const bool isObject)
+	{
+		if (m_containers.isEmpty() || (m_containers.back().isObject != isObject) || m_afterKey)
+		{
+			throw Error{ isObject ? "JSONWriter: endObject() does not match startObject()" : "JSONWriter: endArray() does not match startArray()" };
+		}
+
+		const bool hasElements = m_containers.back().hasElements;
+		m_containers.pop_back();
+
+		if (hasElements)
+		{
+			newLine(m_containers.size());
+		}
+
+		m_buffer.push_back(isObject ? '}' : ']');
+		endValue();
+	}
+
+	void JSONWriter::JSONWriterDetail::appendEscaped(const std::string_view s)
+	{
+		const char* first = s.data();
+		const char* const last = (first + s.size());
+
+		for (const char* p = first; p != last; ++p)
+		{
+			const uint8 ch = static_cast<uint8>(*p);
+
+			if ((ch == '"') || (ch == '\\') || (ch < 0x20))
+			{
+				m_buffer.append(first, p);
+
+				if (ch < 0x20)
+				{
+					AppendControl(m_buffer, ch);
+				}
+				else
+				{
+					m_buffer.push_back('\\');
+					m_buffer.push_back(static_cast<char>(ch));
+				}
+
+				first = (p + 1);
+			}
+		}
+
+		m_buffer.append(first, last);
+	}
+
+	void JSONWriter::JSONWriterDetail::appendEscaped(const StringView s)
+	{
+		for (const char32 ch : s)
+		{
+			if (ch < 0x80)
+			{
+				if ((ch == U'"') || (ch == U'\\'))
+				{
+					m_buffer.push_back('\\');
+					m_buffer.push_back(static_cast<char>(ch));
+				}
+				else if (ch < 0x20)
+				{
+					AppendControl(m_buffer, static_cast<uint8>(ch));
+				}
+				else
+				{
+					m_buffer.push_back(static_cast<char>(ch));
+				}
+			}
+			else if (ch < 0x800)
+			{
+				m_buffer.push_back(static_cast<char>(0xC0 | (ch >> 6)));
+				m_buffer.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			}
+			else if ((ch < 0x10000) || (0x10FFFF < ch))
+			{
+				// サロゲートと範囲外の値は U+FFFD にする
+				const char32 c = (((0xD800 <= ch) && (ch < 0xE000)) || (0x10FFFF < ch)) ? 0xFFFD : ch;
+				m_buffer.push_back(static_cast<char>(0xE0 | (c >> 12)));
+				m_buffer.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+				m_buffer.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+			}
+			else
+			{
+				m_buffer.push_back(static_cast<char>(0xF0 | (ch >> 18)));
+				m_buffer.push_back(static_cast<char>(0x80 | ((ch >> 12) & 0x3F)));
+				m_buffer.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+				m_buffer.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+			}
+		}
+	}
+}
@@ -0,0 +1,122 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/JSONWriter.hpp>
+# include <Siv3D/JSON.hpp>
+
+namespace s3d
+{
+	class JSONWriter::JSONWriterDetail
+	{
+	public:
+
+		JSONWriterDetail() = default;
+
+		~JSONWriterDetail();
+
+		bool open(std::unique_ptr<IWriter>&& writer);
+
+		bool close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		void setIndent(char32 indent, size_t spaceCount);
+
+		void startObject();
+
+		void endObject();
+
+		void startArray();
+
+		void endArray();
+
+		void key(StringView key);
+
+		void keyUTF8(std::string_view key);
+
+		void writeNull();
+
+		void writeBool(bool value);
+
+		void writeInt64(int64 value);
+
+		void writeUint64(uint64 value);
+
+		void writeDouble(double value);
+
+		void writeString(StringView value);
+
+		void writeStringUTF8(std::string_view value);
+
+		void writeJSON(const JSON& value);
+
+		bool flush();
+
+		[[nodiscard]]
+		bool isComplete() const noexcept;
+
+		[[nodiscard]]
+		bool hasError() const noexcept;
+
+	private:
+
+		/// @brief バッファがこのサイズを超えたら書き出し先へ書き出す（バイト）
+		static constexpr size_t FlushThreshold = (64 * 1024);
+
+		struct Container
+		{
+			bool isObject = false;
+
+			/// @brief 1 つ以上の要素を書き込んだか
+			bool hasElements = false;
+		};
+
+		std::unique_ptr<IWriter> m_writer;
+
+		std::string m_buffer;
+
+		/// @brief 開いているオブジェクトと配列
+		Array<Container> m_containers;
+
+		/// @brief キーを書き込み、その値を待っているか
+		bool m_afterKey = false;
+
+		/// @brief ルートの値を書き終えたか
+		bool m_hasRoot = false;
+
+		bool m_hasError = false;
+
+		char m_indent = ' ';
+
+		/// @brief 1 段あたりのインデントの文字数（0 の場合は改行やインデントを含まない）
+		size_t m_spaceCount = 0;
+
+		void reset();
+
+		void newLine(size_t depth);
+
+		/// @brief 値を書き込む前に、区切り文字とインデントを書き込みます。
+		void beginValue();
+
+		/// @brief 値を書き込んだ後の状態を更新し、必要に応じてバッファを書き出します。
+		void endValue();
+
+		void beginKey();
+
+		void endContainer(bool isObject);
+
+		void appendEscaped(std::string_view s);
+
+		void appendEscaped(StringView s);
+	};
+}
@@ -0,0 +1,258 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/JSONWriter.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include "JSONWriterDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter::JSONWriter()
+		: pImpl{ std::make_shared<JSONWriterDetail>() } {}
+
+	JSONWriter::JSONWriter(const FilePathView path)
+		: JSONWriter{}
+	{
+		open(path);
+	}
+
+	JSONWriter::JSONWriter(std::unique_ptr<IWriter>&& writer)
+		: JSONWriter{}
+	{
+		open(std::move(writer));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONWriter::open(const FilePathView path)
+	{
+		return pImpl->open(std::make_unique<BinaryWriter>(path));
+	}
+
+	bool JSONWriter::open(std::unique_ptr<IWriter>&& writer)
+	{
+		return pImpl->open(std::move(writer));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONWriter::close()
+	{
+		return pImpl->close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONWriter::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setIndent
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter& JSONWriter::setIndent(const char32 indent, const size_t spaceCount)
+	{
+		pImpl->setIndent(indent, spaceCount);
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	startObject, endObject, startArray, endArray
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter& JSONWriter::startObject()
+	{
+		pImpl->startObject();
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::endObject()
+	{
+		pImpl->endObject();
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::startArray()
+	{
+		pImpl->startArray();
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::endArray()
+	{
+		pImpl->endArray();
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	key
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter& JSONWriter::key(const StringView key)
+	{
+		pImpl->key(key);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::key(const char32* key)
+	{
+		pImpl->key(key);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::keyUTF8(const std::string_view key)
+	{
+		pImpl->keyUTF8(key);
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	write
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter& JSONWriter::write(std::nullptr_t)
+	{
+		pImpl->writeNull();
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::write(const bool value)
+	{
+		pImpl->writeBool(value);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::write(const StringView value)
+	{
+		pImpl->writeString(value);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::write(const char32* value)
+	{
+		pImpl->writeString(value);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::write(const String& value)
+	{
+		pImpl->writeString(value);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::write(const JSON& value)
+	{
+		pImpl->writeJSON(value);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::writeUTF8(const std::string_view value)
+	{
+		pImpl->writeStringUTF8(value);
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONWriter::flush()
+	{
+		return pImpl->flush();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isComplete
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONWriter::isComplete() const noexcept
+	{
+		return pImpl->isComplete();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hasError
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool JSONWriter::hasError() const noexcept
+	{
+		return pImpl->hasError();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	writeInt64, writeUint64, writeDouble
+	//
+	////////////////////////////////////////////////////////////////
+
+	JSONWriter& JSONWriter::writeInt64(const int64 value)
+	{
+		pImpl->writeInt64(value);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::writeUint64(const uint64 value)
+	{
+		pImpl->writeUint64(value);
+		return *this;
+	}
+
+	JSONWriter& JSONWriter::writeDouble(const double value)
+	{
+		pImpl->writeDouble(value);
+		return *this;
+	}
+}
@@ -0,0 +1,291 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <bit>
+# include "AsyncLogWriter.hpp"
+# include <Siv3D/Time.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	AsyncLogWriter::AsyncLogWriter(const size_t capacity, const LogOverflowPolicy overflowPolicy, BatchWriter writer, Counters& counters)
+		: m_overflowPolicy{ overflowPolicy }
+		, m_writer{ std::move(writer) }
+		, m_counters{ counters }
+	{
+		const size_t cellCount = RoundCapacity(capacity);
+		m_cells = std::make_unique<Cell[]>(cellCount);
+		m_mask = (cellCount - 1);
+
+		for (size_t i = 0; i < cellCount; ++i)
+		{
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		m_thread = std::thread{ [this]() { run(); } };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	AsyncLogWriter::~AsyncLogWriter()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stop = true;
+		}
+
+		m_wakeCondition.notify_one();
+
+		m_thread.join();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	push
+	//
+	////////////////////////////////////////////////////////////////
+
+	void AsyncLogWriter::push(Entry&& entry)
+	{
+		if (tryPush(entry))
+		{
+			wake(false);
+			return;
+		}
+
+		if (m_overflowPolicy == LogOverflowPolicy::Block)
+		{
+			do
+			{
+				wake(true);
+				std::this_thread::yield();
+
+			} while (not tryPush(entry));
+
+			return;
+		}
+
+		m_counters.droppedMessageCount.fetch_add(1, std::memory_order_relaxed);
+
+		if (m_overflowPolicy == LogOverflowPolicy::Count)
+		{
+			m_unreportedDropCount.fetch_add(1, std::memory_order_relaxed);
+
+			// 書き出しスレッドが待機に入っていても、破棄したことを書き出させる
+			wake(false);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	void AsyncLogWriter::flush()
+	{
+		// 予約済みの位置まで書き出されるのを待つ。予約した生産者は必ず書き込みを終えるので、待ちは有限である
+		const size_t target = m_enqueuePos.load(std::memory_order_acquire);
+
+		if (target <= m_dequeuePos.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		wake(true);
+
+		std::unique_lock lock{ m_mutex };
+		m_flushCondition.wait(lock, [&]() { return (target <= m_dequeuePos.load(std::memory_order_acquire)); });
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	capacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t AsyncLogWriter::capacity() const noexcept
+	{
+		return (m_mask + 1);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RoundCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t AsyncLogWriter::RoundCapacity(const size_t capacity) noexcept
+	{
+		return std::bit_ceil(Max<size_t>(capacity, 2));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getOverflowPolicy
+	//
+	////////////////////////////////////////////////////////////////
+
+	LogOverflowPolicy AsyncLogWriter::getOverflowPolicy() const noexcept
+	{
+		return m_overflowPolicy;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getQueuedCount
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t AsyncLogWriter::getQueuedCount() const noexcept
+	{
+		const size_t dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+		const size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+		return (enqueuePos - Min(dequeuePos, enqueuePos));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private functions)
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool AsyncLogWriter::tryPush(Entry& entry)
+	{
+		size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			Cell& cell = m_cells[pos & m_mask];
+			const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t diff = (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos));
+
+			if (diff == 0)
+			{
+				if (m_enqueuePos.compare_exchange_weak(pos, (pos + 1), std::memory_order_relaxed))
+				{
+					cell.entry = std::move(entry);
+					cell.sequence.store((pos + 1), std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				// キューが一杯
+				return false;
+			}
+			else
+			{
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool AsyncLogWriter::hasPending(const size_t pos) const noexcept
+	{
+		return (m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) == (pos + 1));
+	}
+
+	void AsyncLogWriter::wake(const bool force)
+	{
+		// 書き出しスレッドの m_sleeping の書き込みと、生産者のセルへの書き込みの順序をそろえる
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (force || m_sleeping.load(std::memory_order_relaxed))
+		{
+			{
+				std::lock_guard lock{ m_mutex };
+			}
+
+			m_wakeCondition.notify_one();
+		}
+	}
+
+	void AsyncLogWriter::run()
+	{
+		Array<Entry> batch(Arg::reserve = (MaxBatchSize + 1));
+		size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			const size_t first = pos;
+
+			while ((batch.size() < MaxBatchSize) && hasPending(pos))
+			{
+				Cell& cell = m_cells[pos & m_mask];
+				batch.push_back(std::move(cell.entry));
+				cell.entry.text = std::string{};
+				cell.sequence.store((pos + m_mask + 1), std::memory_order_release);
+				++pos;
+			}
+
+			if (m_overflowPolicy == LogOverflowPolicy::Count)
+			{
+				if (const uint64 dropped = m_unreportedDropCount.exchange(0, std::memory_order_relaxed))
+				{
+					batch.push_back(Entry{ LogType::Warning, Time::GetMillisec(),
+						fmt::format("{} log messages were dropped because the queue was full", dropped) });
+				}
+			}
+
+			if (batch)
+			{
+				const size_t bytes = m_writer(batch);
+				m_counters.messageCount.fetch_add(batch.size(), std::memory_order_relaxed);
+				m_counters.byteCount.fetch_add(bytes, std::memory_order_relaxed);
+				m_counters.writeCount.fetch_add(1, std::memory_order_relaxed);
+				batch.clear();
+
+				if (first != pos)
+				{
+					{
+						std::lock_guard lock{ m_mutex };
+						m_dequeuePos.store(pos, std::memory_order_release);
+					}
+
+					m_flushCondition.notify_all();
+				}
+
+				continue;
+			}
+
+			std::unique_lock lock{ m_mutex };
+
+			if (m_stop && (m_enqueuePos.load(std::memory_order_acquire) == pos)
+				&& (m_unreportedDropCount.load(std::memory_order_relaxed) == 0))
+			{
+				break;
+			}
+
+			m_sleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			// 生産者は、セルに書き込んだ後に m_sleeping を確認して起こすため、タイムアウトなしで待機できる
+			m_wakeCondition.wait(lock, [&]()
+				{
+					return (m_stop || hasPending(pos) || (m_unreportedDropCount.load(std::memory_order_relaxed) != 0));
+				});
+
+			m_sleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+}
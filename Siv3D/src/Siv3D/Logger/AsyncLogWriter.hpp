@@ -0,0 +1,148 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <mutex>
+# include <condition_variable>
+# include <thread>
+# include <variant>
+# include <span>
+# include <functional>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/LogType.hpp>
+# include <Siv3D/LogOverflowPolicy.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	AsyncLogWriter
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief ログのメッセージを専用のスレッドでまとめて書き出すクラス
+	/// @remark メッセージは固定長の MPSC リングバッファ（Vyukov 方式）にロックなしで追加されます。
+	class AsyncLogWriter
+	{
+	public:
+
+		/// @brief キューに追加するメッセージ
+		struct Entry
+		{
+			/// @brief ログの種類。none の場合は時刻や種類を付けずに書き出す
+			Optional<LogType> type;
+
+			int64 timeMillisec = 0;
+
+			/// @brief UTF-8 または UTF-32 の本文。変換は書き出しスレッドで行う
+			std::variant<std::string, String> text;
+		};
+
+		/// @brief ロガーの統計のカウンタ
+		struct Counters
+		{
+			std::atomic<uint64> messageCount{ 0 };
+
+			std::atomic<uint64> byteCount{ 0 };
+
+			std::atomic<uint64> writeCount{ 0 };
+
+			std::atomic<uint64> droppedMessageCount{ 0 };
+		};
+
+		/// @brief メッセージをまとめて出力先に書き込み、書き込んだバイト数を返す関数
+		using BatchWriter = std::function<size_t(std::span<const Entry>)>;
+
+		[[nodiscard]]
+		AsyncLogWriter(size_t capacity, LogOverflowPolicy overflowPolicy, BatchWriter writer, Counters& counters);
+
+		/// @brief キューに残っているメッセージをすべて書き出してから、書き出しスレッドを終了します。
+		~AsyncLogWriter();
+
+		/// @brief メッセージをキューに追加します。
+		/// @param entry メッセージ
+		void push(Entry&& entry);
+
+		/// @brief この関数を呼ぶ前にキューに追加されたメッセージがすべて書き出されるまで待ちます。
+		void flush();
+
+		[[nodiscard]]
+		size_t capacity() const noexcept;
+
+		/// @brief 指定した容量に対して実際に確保されるキューの容量を返します。
+		[[nodiscard]]
+		static size_t RoundCapacity(size_t capacity) noexcept;
+
+		[[nodiscard]]
+		LogOverflowPolicy getOverflowPolicy() const noexcept;
+
+		/// @brief 書き出しを待っているメッセージの数を返します。
+		[[nodiscard]]
+		size_t getQueuedCount() const noexcept;
+
+	private:
+
+		/// @brief 1 回の書き込みでまとめる最大のメッセージ数
+		static constexpr size_t MaxBatchSize = 256;
+
+		struct Cell
+		{
+			std::atomic<size_t> sequence{ 0 };
+
+			Entry entry;
+		};
+
+		std::unique_ptr<Cell[]> m_cells;
+
+		size_t m_mask = 0;
+
+		LogOverflowPolicy m_overflowPolicy = LogOverflowPolicy::Block;
+
+		BatchWriter m_writer;
+
+		Counters& m_counters;
+
+		/// @brief 次に予約される位置（生産者が CAS で更新）
+		alignas(64) std::atomic<size_t> m_enqueuePos{ 0 };
+
+		/// @brief 書き出しを終えた位置（消費者のみが更新）
+		alignas(64) std::atomic<size_t> m_dequeuePos{ 0 };
+
+		/// @brief まだログに出力していない、破棄したメッセージの数
+		std::atomic<uint64> m_unreportedDropCount{ 0 };
+
+		/// @brief 書き出しスレッドが待機中か
+		std::atomic<bool> m_sleeping{ false };
+
+		std::mutex m_mutex;
+
+		std::condition_variable m_wakeCondition;
+
+		std::condition_variable m_flushCondition;
+
+		bool m_stop = false;
+
+		std::thread m_thread;
+
+		[[nodiscard]]
+		bool tryPush(Entry& entry);
+
+		[[nodiscard]]
+		bool hasPending(size_t pos) const noexcept;
+
+		void wake(bool force);
+
+		void run();
+	};
+}
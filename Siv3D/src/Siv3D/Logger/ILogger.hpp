@@ -12,6 +12,8 @@
 # pragma once
 # include <Siv3D/Common.hpp>
 # include <Siv3D/StringView.hpp>
+# include <Siv3D/LogOverflowPolicy.hpp>
+# include <Siv3D/LoggerStat.hpp>
 
 namespace s3d
 {
@@ -37,5 +39,15 @@ namespace s3d
 		virtual void setOutputLevel(LogType logType) noexcept = 0;
 
 		virtual LogType getOutputLevel() const noexcept = 0;
+
+		virtual void enableAsync(size_t capacity, LogOverflowPolicy overflowPolicy) = 0;
+
+		virtual void disableAsync() = 0;
+
+		virtual bool isAsync() const noexcept = 0;
+
+		virtual void flush() = 0;
+
+		virtual LoggerStat getStat() const = 0;
 	};
 }
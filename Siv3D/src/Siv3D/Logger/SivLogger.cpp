@@ -134,5 +134,63 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(Logger)->getOutputLevel();
 		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	enableAsync
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Logger_impl::enableAsync(const size_t capacity, const LogOverflowPolicy overflowPolicy) const
+		{
+			SIV3D_ENGINE(Logger)->enableAsync(capacity, overflowPolicy);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	disableAsync
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Logger_impl::disableAsync() const
+		{
+			SIV3D_ENGINE(Logger)->disableAsync();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isAsync
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool Logger_impl::isAsync() const noexcept
+		{
+			return SIV3D_ENGINE(Logger)->isAsync();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	flush
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Logger_impl::flush() const
+		{
+			if (const auto pLogger = SIV3D_ENGINE(Logger))
+			{
+				pLogger->flush();
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getStat
+		//
+		////////////////////////////////////////////////////////////////
+
+		LoggerStat Logger_impl::getStat() const
+		{
+			return SIV3D_ENGINE(Logger)->getStat();
+		}
 	}
 }
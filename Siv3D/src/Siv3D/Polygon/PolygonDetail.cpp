@@ -17,6 +17,7 @@
 # include <Siv3D/Engine/Siv3DEngine.hpp>
 # include "PolygonDetail.hpp"
 # include "Triangulate.hpp"
+# include "TriangleBVH.hpp"
 
 SIV3D_DISABLE_MSVC_WARNINGS_PUSH(4127)
 # include <ThirdParty/boost/geometry/extensions/algorithms/dissolve.hpp>
@@ -201,6 +202,65 @@ namespace s3d
 		{
 			return Abs((p0.x - p2.x) * (p1.y - p0.y) - (p0.x - p1.x) * (p2.y - p0.y));
 		}
+
+		/// @brief 点が BVH のノードに含まれうるかを返します。
+		[[nodiscard]]
+		static bool PointInBox(const Vec2& p, const Float2& min, const Float2& max) noexcept
+		{
+			return ((min.x <= p.x) && (p.x <= max.x)
+				&& (min.y <= p.y) && (p.y <= max.y));
+		}
+
+		/// @brief 線分が BVH のノードと交差しうるかを返します（Liang–Barsky 法）。
+		[[nodiscard]]
+		static bool LineInBox(const Line& line, const Float2& min, const Float2& max) noexcept
+		{
+			const Vec2 d = line.vector();
+			double t0 = 0.0, t1 = 1.0;
+
+			const auto clip = [&](const double p, const double q)
+				{
+					if (p == 0.0)
+					{
+						return (0.0 <= q);
+					}
+
+					const double t = (q / p);
+
+					if (p < 0.0)
+					{
+						t0 = Max(t0, t);
+					}
+					else
+					{
+						t1 = Min(t1, t);
+					}
+
+					return (t0 <= t1);
+				};
+
+			return (clip(-d.x, (line.start.x - min.x))
+				&& clip(d.x, (max.x - line.start.x))
+				&& clip(-d.y, (line.start.y - min.y))
+				&& clip(d.y, (max.y - line.start.y)));
+		}
+
+		/// @brief 円が BVH のノードと交差しうるかを返します。
+		[[nodiscard]]
+		static bool CircleInBox(const Circle& circle, const Float2& min, const Float2& max) noexcept
+		{
+			const double dx = (circle.x - Clamp<double>(circle.x, min.x, max.x));
+			const double dy = (circle.y - Clamp<double>(circle.y, min.y, max.y));
+			return ((dx * dx + dy * dy) <= (circle.r * circle.r));
+		}
+
+		/// @brief 長方形が BVH のノードと交差しうるかを返します。
+		[[nodiscard]]
+		static bool RectInBox(const RectF& rect, const Float2& min, const Float2& max) noexcept
+		{
+			return ((min.x <= (rect.x + rect.w)) && (rect.x <= max.x)
+				&& (min.y <= (rect.y + rect.h)) && (rect.y <= max.y));
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -582,19 +642,7 @@ namespace s3d
 			return false;
 		}
 
-		const Float2* pVertex = m_vertices.data();
-
-		for (const auto& triangleIndex : m_indices)
-		{
-			const Triangle triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] };
-
-			if (Geometry2D::Intersect(other, triangle))
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return intersectsTriangles(other, [&](const Float2& min, const Float2& max) { return PointInBox(other, min, max); });
 	}
 
 	bool Polygon::PolygonDetail::intersects(const Line& other) const
@@ -609,19 +657,7 @@ namespace s3d
 			return false;
 		}
 
-		const Float2* pVertex = m_vertices.data();
-
-		for (const auto& triangleIndex : m_indices)
-		{
-			const Triangle triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] };
-
-			if (Geometry2D::Intersect(other, triangle))
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return intersectsTriangles(other, [&](const Float2& min, const Float2& max) { return LineInBox(other, min, max); });
 	}
 
 	bool Polygon::PolygonDetail::intersects(const RectF& other) const
@@ -636,6 +672,13 @@ namespace s3d
 			return false;
 		}
 
+		if (const TriangleBVH* bvh = m_bvh.get(m_vertices, m_indices))
+		{
+			return bvh->any(m_vertices.data(),
+				[&](const Float2& min, const Float2& max) { return RectInBox(other, min, max); },
+				[&](const Triangle& triangle) { return Geometry2D::Intersect(other, triangle); });
+		}
+
 		const boost::geometry::model::box<Vec2> box{ other.pos, other.br() };
 
 		return boost::geometry::intersects(m_polygon, box);
@@ -653,19 +696,7 @@ namespace s3d
 			return false;
 		}
 
-		const Float2* pVertex = m_vertices.data();
-
-		for (const auto& triangleIndex : m_indices)
-		{
-			const Triangle triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] };
-
-			if (Geometry2D::Intersect(other, triangle))
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return intersectsTriangles(other, [&](const Float2& min, const Float2& max) { return CircleInBox(other, min, max); });
 	}
 
 	bool Polygon::PolygonDetail::intersects(const Ellipse& other) const
@@ -680,19 +711,7 @@ namespace s3d
 			return false;
 		}
 
-		const Float2* pVertex = m_vertices.data();
-
-		for (const auto& triangleIndex : m_indices)
-		{
-			const Triangle triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] };
-
-			if (Geometry2D::Intersect(other, triangle))
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return intersectsTriangles(other, [rect = other.boundingRect()](const Float2& min, const Float2& max) { return RectInBox(rect, min, max); });
 	}
 
 	bool Polygon::PolygonDetail::intersects(const Triangle& other) const
@@ -707,19 +726,7 @@ namespace s3d
 			return false;
 		}
 
-		const Float2* pVertex = m_vertices.data();
-
-		for (const auto& triangleIndex : m_indices)
-		{
-			const Triangle triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] };
-
-			if (Geometry2D::Intersect(other, triangle))
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return intersectsTriangles(other, [rect = other.boundingRect()](const Float2& min, const Float2& max) { return RectInBox(rect, min, max); });
 	}
 
 	bool Polygon::PolygonDetail::intersects(const Quad& other) const
@@ -734,19 +741,7 @@ namespace s3d
 			return false;
 		}
 
-		const Float2* pVertex = m_vertices.data();
-
-		for (const auto& triangleIndex : m_indices)
-		{
-			const Triangle triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] };
-
-			if (Geometry2D::Intersect(other, triangle))
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return intersectsTriangles(other, [rect = other.boundingRect()](const Float2& min, const Float2& max) { return RectInBox(rect, min, max); });
 	}
 
 	bool Polygon::PolygonDetail::intersects(const PolygonDetail& other) const
@@ -769,6 +764,29 @@ namespace s3d
 		return boost::geometry::intersects(m_polygon, other.m_polygon);
 	}
 
+	template <class Shape, class BoxTest>
+	bool Polygon::PolygonDetail::intersectsTriangles(const Shape& other, BoxTest boxTest) const
+	{
+		const auto triangleTest = [&](const Triangle& triangle) { return Geometry2D::Intersect(other, triangle); };
+
+		if (const TriangleBVH* bvh = m_bvh.get(m_vertices, m_indices))
+		{
+			return bvh->any(m_vertices.data(), boxTest, triangleTest);
+		}
+
+		const Float2* pVertex = m_vertices.data();
+
+		for (const auto& triangleIndex : m_indices)
+		{
+			if (triangleTest(Triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] }))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	draw
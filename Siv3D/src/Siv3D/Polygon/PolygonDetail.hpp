@@ -12,6 +12,7 @@
 # pragma once
 # include <Siv3D/Polygon.hpp>
 # include "GeometryCommon.hpp"
+# include "TriangleBVH.hpp"
 
 namespace s3d
 {
@@ -258,5 +259,16 @@ namespace s3d
 		Array<TriangleIndex> m_indices;
 
 		RectF m_boundingRect = RectF::Empty();
+
+		/// @brief 当たり判定用の BVH（最初の当たり判定で構築）
+		TriangleBVHCache m_bvh;
+
+		/// @brief 三角形のいずれかと交差するかを返します。三角形が多い場合は BVH で候補を絞り込みます。
+		/// @param other 対象
+		/// @param boxTest BVH のノードのバウンディングボックス (min, max) が対象と交差しうるかを返す関数
+		/// @return 交差する場合 true, それ以外の場合は false
+		template <class Shape, class BoxTest>
+		[[nodiscard]]
+		bool intersectsTriangles(const Shape& other, BoxTest boxTest) const;
 	};
 }
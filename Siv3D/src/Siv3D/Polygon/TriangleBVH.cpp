@@ -0,0 +1,144 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <algorithm>
+# include "TriangleBVH.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	TriangleBVH
+	//
+	////////////////////////////////////////////////////////////////
+
+	TriangleBVH::TriangleBVH(const std::span<const Float2> vertices, const std::span<const TriangleIndex> indices)
+	{
+		Array<Bounds> bounds(indices.size());
+
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			const Float2& p0 = vertices[indices[i].i0];
+			const Float2& p1 = vertices[indices[i].i1];
+			const Float2& p2 = vertices[indices[i].i2];
+
+			const Float2 min{ Min(p0.x, p1.x, p2.x), Min(p0.y, p1.y, p2.y) };
+			const Float2 max{ Max(p0.x, p1.x, p2.x), Max(p0.y, p1.y, p2.y) };
+
+			bounds[i] = { min, max, ((min + max) * 0.5f) };
+		}
+
+		Array<uint32> order(indices.size());
+
+		for (uint32 i = 0; i < order.size(); ++i)
+		{
+			order[i] = i;
+		}
+
+		m_nodes.reserve((indices.size() / MaxLeafSize) * 2 + 1);
+
+		build(order, bounds, 0, order.size());
+
+		m_indices.resize(order.size());
+
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			m_indices[i] = indices[order[i]];
+		}
+	}
+
+	uint32 TriangleBVH::build(Array<uint32>& order, const Array<Bounds>& bounds, const size_t first, const size_t last)
+	{
+		const uint32 nodeIndex = static_cast<uint32>(m_nodes.size());
+
+		Float2 min = bounds[order[first]].min;
+		Float2 max = bounds[order[first]].max;
+		Float2 centerMin = bounds[order[first]].center;
+		Float2 centerMax = centerMin;
+
+		for (size_t i = (first + 1); i < last; ++i)
+		{
+			const Bounds& b = bounds[order[i]];
+			min = { Min(min.x, b.min.x), Min(min.y, b.min.y) };
+			max = { Max(max.x, b.max.x), Max(max.y, b.max.y) };
+			centerMin = { Min(centerMin.x, b.center.x), Min(centerMin.y, b.center.y) };
+			centerMax = { Max(centerMax.x, b.center.x), Max(centerMax.y, b.center.y) };
+		}
+
+		m_nodes.push_back({ min, max, static_cast<uint32>(first), static_cast<uint32>(last - first) });
+
+		if ((last - first) <= MaxLeafSize)
+		{
+			return nodeIndex;
+		}
+
+		// 重心の分布が広い軸で、中央値を境に二分割する
+		const bool splitX = ((centerMax.y - centerMin.y) <= (centerMax.x - centerMin.x));
+		const size_t middle = (first + (last - first) / 2);
+
+		std::nth_element((order.begin() + first), (order.begin() + middle), (order.begin() + last),
+			[&](const uint32 a, const uint32 b)
+			{
+				return (splitX ? (bounds[a].center.x < bounds[b].center.x) : (bounds[a].center.y < bounds[b].center.y));
+			});
+
+		build(order, bounds, first, middle);
+		const uint32 right = build(order, bounds, middle, last);
+
+		m_nodes[nodeIndex].index = right;
+		m_nodes[nodeIndex].count = 0;
+
+		return nodeIndex;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	TriangleBVHCache
+	//
+	////////////////////////////////////////////////////////////////
+
+	TriangleBVHCache& TriangleBVHCache::operator =(const TriangleBVHCache&) noexcept
+	{
+		reset();
+		return *this;
+	}
+
+	const TriangleBVH* TriangleBVHCache::get(const std::span<const Float2> vertices, const std::span<const TriangleIndex> indices) const
+	{
+		if (indices.size() < TriangleBVH::MinTriangles)
+		{
+			return nullptr;
+		}
+
+		if (const TriangleBVH* bvh = m_bvh.load(std::memory_order_acquire))
+		{
+			return bvh;
+		}
+
+		std::lock_guard lock{ m_mutex };
+
+		if (not m_owner)
+		{
+			m_owner = std::make_unique<TriangleBVH>(vertices, indices);
+			m_bvh.store(m_owner.get(), std::memory_order_release);
+		}
+
+		return m_owner.get();
+	}
+
+	void TriangleBVHCache::reset() noexcept
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_bvh.store(nullptr, std::memory_order_relaxed);
+		m_owner.reset();
+	}
+}
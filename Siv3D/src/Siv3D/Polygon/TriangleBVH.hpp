@@ -0,0 +1,116 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <span>
+# include <atomic>
+# include <memory>
+# include <mutex>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/PointVector.hpp>
+# include <Siv3D/TriangleIndex.hpp>
+# include "GeometryCommon.hpp"
+
+namespace s3d
+{
+	/// @brief 三角形分割の結果に対する BVH（境界ボリューム階層）
+	/// @remark 三角形のバウンディングボックスを、重心の中央値で二分割して構築します。
+	class TriangleBVH
+	{
+	public:
+
+		/// @brief BVH を構築する三角形の最小数。これより少ない場合は全探索のほうが速いため、BVH を使いません。
+		static constexpr size_t MinTriangles = 64;
+
+		[[nodiscard]]
+		TriangleBVH(std::span<const Float2> vertices, std::span<const TriangleIndex> indices);
+
+		/// @brief 条件を満たす三角形が存在するかを返します。
+		/// @param vertices 構築時と同じ頂点配列
+		/// @param boxTest ノードのバウンディングボックス (min, max) が対象と交差しうるかを返す関数
+		/// @param triangleTest 三角形が対象と交差するかを返す関数
+		/// @return triangleTest が true を返す三角形が存在する場合 true, それ以外の場合は false
+		template <class BoxTest, class TriangleTest>
+		[[nodiscard]]
+		bool any(const Float2* vertices, BoxTest boxTest, TriangleTest triangleTest) const;
+
+	private:
+
+		/// @brief 葉に含める三角形の最大数
+		static constexpr size_t MaxLeafSize = 4;
+
+		/// @brief 探索に使うスタックの大きさ（中央値で分割するため、木の深さは log2(65536) 程度に収まる）
+		static constexpr size_t MaxStackSize = 64;
+
+		struct Node
+		{
+			Float2 min;
+
+			Float2 max;
+
+			/// @brief 葉の場合は最初の三角形のインデックス、それ以外の場合は右の子ノードのインデックス（左の子ノードは直後に配置）
+			uint32 index;
+
+			/// @brief 葉の場合は三角形の数、それ以外の場合は 0
+			uint32 count;
+		};
+
+		Array<Node> m_nodes;
+
+		/// @brief ノードの順に並べ替えた三角形
+		Array<TriangleIndex> m_indices;
+
+		struct Bounds
+		{
+			Float2 min;
+
+			Float2 max;
+
+			Float2 center;
+		};
+
+		uint32 build(Array<uint32>& order, const Array<Bounds>& bounds, size_t first, size_t last);
+	};
+
+	/// @brief TriangleBVH を最初に必要になったときに構築し、保持するクラス
+	/// @remark 複製しても BVH は引き継がず、複製先で必要になったときに構築し直します。
+	class TriangleBVHCache
+	{
+	public:
+
+		TriangleBVHCache() = default;
+
+		TriangleBVHCache(const TriangleBVHCache&) noexcept {}
+
+		TriangleBVHCache& operator =(const TriangleBVHCache&) noexcept;
+
+		/// @brief BVH を返します。まだ構築していない場合は構築します。
+		/// @param vertices 頂点
+		/// @param indices 三角形のインデックス
+		/// @return BVH。三角形の数が TriangleBVH::MinTriangles 未満の場合は nullptr
+		/// @remark 複数のスレッドから同時に呼び出すことができます。
+		[[nodiscard]]
+		const TriangleBVH* get(std::span<const Float2> vertices, std::span<const TriangleIndex> indices) const;
+
+		/// @brief 構築済みの BVH を破棄します。
+		void reset() noexcept;
+
+	private:
+
+		mutable std::mutex m_mutex;
+
+		mutable std::atomic<const TriangleBVH*> m_bvh{ nullptr };
+
+		mutable std::unique_ptr<TriangleBVH> m_owner;
+	};
+}
+
+# include "TriangleBVH.ipp"
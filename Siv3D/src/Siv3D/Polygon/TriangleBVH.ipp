@@ -0,0 +1,57 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	template <class BoxTest, class TriangleTest>
+	bool TriangleBVH::any(const Float2* vertices, BoxTest boxTest, TriangleTest triangleTest) const
+	{
+		uint32 stack[MaxStackSize];
+		size_t stackSize = 0;
+		stack[stackSize++] = 0;
+
+		const Node* nodes = m_nodes.data();
+		const TriangleIndex* indices = m_indices.data();
+
+		while (stackSize)
+		{
+			const Node& node = nodes[stack[--stackSize]];
+
+			if (not boxTest(node.min, node.max))
+			{
+				continue;
+			}
+
+			if (node.count)
+			{
+				for (uint32 i = node.index; i < (node.index + node.count); ++i)
+				{
+					const TriangleIndex& triangleIndex = indices[i];
+
+					if (triangleTest(Triangle{ vertices[triangleIndex.i0], vertices[triangleIndex.i1], vertices[triangleIndex.i2] }))
+					{
+						return true;
+					}
+				}
+			}
+			else
+			{
+				const uint32 left = static_cast<uint32>(&node - nodes + 1);
+				stack[stackSize++] = node.index;
+				stack[stackSize++] = left;
+			}
+		}
+
+		return false;
+	}
+}
@@ -10,10 +10,12 @@
 //-----------------------------------------------
 
 # include "CProfiler.hpp"
+# include "ScopeRecorder.hpp"
 # include <Siv3D/Time.hpp>
 # include <Siv3D/WindowState.hpp>
 # include <Siv3D/Window/IWindow.hpp>
 # include <Siv3D/Renderer/IRenderer.hpp>
+# include <Siv3D/Renderer2D/IRenderer2D.hpp>
 # include <Siv3D/Engine/Siv3DEngine.hpp>
 # include <Siv3D/EngineLog.hpp>
 
@@ -51,6 +53,15 @@ namespace s3d
 
 	void CProfiler::beginFrame()
 	{
+		// 前のフレームの 2D 描画の統計
+		{
+			const Renderer2DStat& stat = SIV3D_ENGINE(Renderer2D)->getStat();
+			m_stat.drawCalls = static_cast<int32>(stat.drawCalls);
+			m_stat.triangleCount = static_cast<int32>(stat.triangleCount);
+			m_stat.drawCallsSaved = static_cast<int32>(stat.drawCallsSaved);
+			m_fpsCounter.triangleCount += stat.triangleCount;
+		}
+
 		// FPS
 		{
 			if (const int64 timeStampMillisec = Time::GetMillisec();
@@ -61,19 +72,18 @@ namespace s3d
 			else
 			{
 				m_fpsCounter.currentFPS = m_fpsCounter.frameCount;
+				m_fpsCounter.currentTrianglesPerSecond = m_fpsCounter.triangleCount;
 				m_fpsCounter.frameCount = 1;
+				m_fpsCounter.triangleCount = 0;
 				m_fpsCounter.timeStampMillisec = timeStampMillisec;
 			}
+
+			m_stat.fps = m_fpsCounter.currentFPS;
+			m_stat.trianglesPerSecond = m_fpsCounter.currentTrianglesPerSecond;
 		}
 
 		//// Stat
 		//{
-		//	{
-		//		const auto stat = SIV3D_ENGINE(Renderer2D)->getStat();
-		//		m_stat.drawCalls = stat.drawCalls;
-		//		m_stat.triangleCount = stat.triangleCount;
-		//	}
-
 		//	m_stat.textureCount = static_cast<uint32>(SIV3D_ENGINE(Texture)->getTextureCount());
 		//	m_stat.fontCount = static_cast<uint32>(SIV3D_ENGINE(Font)->getFontCount());
 		//	m_stat.audioCount = static_cast<uint32>(SIV3D_ENGINE(Audio)->getAudioCount());
@@ -87,7 +97,10 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void CProfiler::endFrame() {}
+	void CProfiler::endFrame()
+	{
+		GetScopeRecorder().endFrame();
+	}
 
 	////////////////////////////////////////////////////////////////
 	//
@@ -40,6 +40,11 @@ namespace s3d
 
 			int32 currentFPS = 1;
 
+			/// @brief 現在の計測区間で描画された三角形の数
+			int64 triangleCount = 0;
+
+			int64 currentTrianglesPerSecond = 0;
+
 			int64 timeStampMillisec = 0;
 		
 		} m_fpsCounter;
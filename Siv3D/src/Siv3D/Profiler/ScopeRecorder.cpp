@@ -0,0 +1,493 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "ScopeRecorder.hpp"
+# include <Siv3D/CycleClock.hpp>
+# include <Siv3D/Time.hpp>
+# include <Siv3D/Format.hpp>
+# include <Siv3D/JSONWriter.hpp>
+# include <Siv3D/EngineLog.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 現在のスレッドで開いている計測区間の数
+		thread_local uint32 tl_depth = 0;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ThreadBufferHandle
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief スレッドの終了時に、そのスレッドのバッファを回収対象として印をつける
+	struct ScopeRecorder::ThreadBufferHandle
+	{
+		std::shared_ptr<ThreadBuffer> buffer;
+
+		~ThreadBufferHandle()
+		{
+			if (buffer)
+			{
+				buffer->alive.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ScopeRecorder::ScopeRecorder()
+		: m_startCycles{ GetCycleCount() }
+		, m_startNanosec{ Time::GetNanosec() } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setEnabled
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScopeRecorder::setEnabled(const bool enabled) noexcept
+	{
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Enter
+	//
+	////////////////////////////////////////////////////////////////
+
+	uint32 ScopeRecorder::Enter() noexcept
+	{
+		return tl_depth++;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	leave
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScopeRecorder::leave(const char32* name, const uint64 begin, const uint64 end, const uint32 depth)
+	{
+		tl_depth = depth;
+
+		ThreadBuffer* buffer = getThreadBuffer();
+		const size_t head = buffer->head.load(std::memory_order_relaxed);
+
+		if (ThreadBuffer::Capacity <= (head - buffer->tail.load(std::memory_order_acquire)))
+		{
+			buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		buffer->events[head & (ThreadBuffer::Capacity - 1)] = Event{ name, begin, end, depth, buffer->threadIndex };
+		buffer->head.store((head + 1), std::memory_order_release);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	endFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScopeRecorder::endFrame()
+	{
+		std::lock_guard lock{ m_consumerMutex };
+
+		m_mainThreadID = std::this_thread::get_id();
+		++m_frameCount;
+
+		drain();
+
+		Array<Event> events = std::exchange(m_pendingEvents, Array<Event>{});
+
+		buildStats(events);
+
+		if (isEnabled())
+		{
+			pushTraceFrame(std::move(events));
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getStats
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Array<ProfilerScopeStat>& ScopeRecorder::getStats() const noexcept
+	{
+		return m_stats;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	exportChromeTrace
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ScopeRecorder::exportChromeTrace(const FilePathView path)
+	{
+		std::lock_guard lock{ m_consumerMutex };
+
+		drain();
+
+		JSONWriter writer{ path };
+
+		if (not writer)
+		{
+			LOG_FAIL(fmt::format("❌ Profiler::ExportChromeTrace(): Failed to open `{}`", path.toUTF8()));
+			return false;
+		}
+
+		const double cyclesPerMicrosec = getCyclesPerMicrosec();
+
+		const auto writeEvents = [&](const Array<Event>& events)
+			{
+				for (const auto& event : events)
+				{
+					writer.startObject()
+						.key(U"name").write(event.name)
+						.key(U"cat").write(U"scope")
+						.key(U"ph").write(U"X")
+						.key(U"ts").write((event.begin - m_startCycles) / cyclesPerMicrosec)
+						.key(U"dur").write((event.end - event.begin) / cyclesPerMicrosec)
+						.key(U"pid").write(0)
+						.key(U"tid").write(event.threadIndex)
+						.endObject();
+				}
+			};
+
+		writer.startObject().key(U"traceEvents").startArray();
+		{
+			{
+				std::lock_guard registryLock{ m_registryMutex };
+
+				for (const auto& buffer : m_threadBuffers)
+				{
+					const String threadName = ((buffer->threadID == m_mainThreadID)
+						? U"Main thread"_s : U"Thread {}"_fmt(buffer->threadIndex));
+
+					writer.startObject()
+						.key(U"name").write(U"thread_name")
+						.key(U"ph").write(U"M")
+						.key(U"pid").write(0)
+						.key(U"tid").write(buffer->threadIndex)
+						.key(U"args").startObject().key(U"name").write(threadName).endObject()
+						.endObject();
+				}
+			}
+
+			for (const auto& frame : m_traceFrames)
+			{
+				writeEvents(frame);
+			}
+
+			writeEvents(m_pendingEvents);
+		}
+		writer.endArray().key(U"displayTimeUnit").write(U"ms").endObject();
+
+		if ((not writer.close()) || writer.hasError())
+		{
+			LOG_FAIL(fmt::format("❌ Profiler::ExportChromeTrace(): Failed to write `{}`", path.toUTF8()));
+			return false;
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getThreadBuffer
+	//
+	////////////////////////////////////////////////////////////////
+
+	ScopeRecorder::ThreadBuffer* ScopeRecorder::getThreadBuffer()
+	{
+		thread_local ThreadBufferHandle handle;
+
+		if (not handle.buffer)
+		{
+			auto buffer = std::make_shared<ThreadBuffer>();
+			buffer->threadID = std::this_thread::get_id();
+
+			std::lock_guard lock{ m_registryMutex };
+			buffer->threadIndex = m_nextThreadIndex++;
+			m_threadBuffers << buffer;
+			handle.buffer = std::move(buffer);
+		}
+
+		return handle.buffer.get();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	drain
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScopeRecorder::drain()
+	{
+		std::lock_guard lock{ m_registryMutex };
+
+		for (auto& buffer : m_threadBuffers)
+		{
+			// alive を先に読むことで、終了したスレッドの最後の記録まで回収する
+			const bool alive = buffer->alive.load(std::memory_order_acquire);
+			const size_t head = buffer->head.load(std::memory_order_acquire);
+			const size_t tail = buffer->tail.load(std::memory_order_relaxed);
+
+			for (size_t i = tail; i < head; ++i)
+			{
+				m_pendingEvents << buffer->events[i & (ThreadBuffer::Capacity - 1)];
+			}
+
+			buffer->tail.store(head, std::memory_order_release);
+
+			if (const uint64 dropped = buffer->dropped.exchange(0, std::memory_order_relaxed))
+			{
+				LOG_WARN(fmt::format("ProfilerScope: {} events on thread {} were dropped because the buffer was full", dropped, buffer->threadIndex));
+			}
+
+			if (not alive)
+			{
+				buffer.reset();
+			}
+		}
+
+		m_threadBuffers.remove(nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	buildStats
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScopeRecorder::buildStats(Array<Event>& events)
+	{
+		struct Node
+		{
+			const char32* name = nullptr;
+
+			uint32 threadIndex = 0;
+
+			int32 depth = 0;
+
+			int32 callCount = 0;
+
+			uint64 totalCycles = 0;
+
+			uint64 childCycles = 0;
+
+			Array<int32> children;
+		};
+
+		// 親は子より先に始まるので、開始時刻順に並べると親が先に来る
+		std::sort(events.begin(), events.end(), [](const Event& a, const Event& b)
+			{
+				return (std::tie(a.threadIndex, a.begin, a.depth) < std::tie(b.threadIndex, b.begin, b.depth));
+			});
+
+		Array<Node> nodes;
+		Array<int32> roots;
+		Array<int32> stack;
+		uint32 currentThread = 0;
+
+		for (const auto& event : events)
+		{
+			if (event.threadIndex != currentThread)
+			{
+				stack.clear();
+				currentThread = event.threadIndex;
+			}
+
+			// フレームをまたいだ計測区間の場合、親が見つからないことがある
+			while (event.depth < stack.size())
+			{
+				stack.pop_back();
+			}
+
+			const int32 parent = (stack ? stack.back() : -1);
+			const Array<int32>& siblings = ((parent == -1) ? roots : nodes[parent].children);
+			const StringView name{ event.name };
+			int32 nodeIndex = -1;
+
+			for (const int32 sibling : siblings)
+			{
+				if ((nodes[sibling].threadIndex == event.threadIndex) && (StringView{ nodes[sibling].name } == name))
+				{
+					nodeIndex = sibling;
+					break;
+				}
+			}
+
+			if (nodeIndex == -1)
+			{
+				nodeIndex = static_cast<int32>(nodes.size());
+				nodes.push_back(Node{ .name = event.name, .threadIndex = event.threadIndex, .depth = static_cast<int32>(stack.size()) });
+				((parent == -1) ? roots : nodes[parent].children).push_back(nodeIndex);
+			}
+
+			const uint64 cycles = (event.end - event.begin);
+			++nodes[nodeIndex].callCount;
+			nodes[nodeIndex].totalCycles += cycles;
+
+			if (parent != -1)
+			{
+				nodes[parent].childCycles += cycles;
+			}
+
+			stack.push_back(nodeIndex);
+		}
+
+		// 深さ優先の順で統計を出力する
+		const double cyclesPerMillisec = (getCyclesPerMicrosec() * 1000.0);
+		Array<std::pair<int32, int32>> pending; // (ノード, 親の統計のインデックス)
+		Array<String> paths;
+
+		m_stats.clear();
+
+		for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+		{
+			pending.emplace_back(*it, -1);
+		}
+
+		while (pending)
+		{
+			const auto [nodeIndex, parentStat] = pending.back();
+			pending.pop_back();
+
+			const Node& node = nodes[nodeIndex];
+
+			String path = ((parentStat == -1) ? Format(node.threadIndex) : paths[parentStat]);
+			path.push_back(U'/');
+			path.append(node.name);
+
+			ProfilerScopeStat stat;
+			stat.name			= node.name;
+			stat.threadIndex	= node.threadIndex;
+			stat.parent			= parentStat;
+			stat.depth			= node.depth;
+			stat.callCount		= node.callCount;
+			stat.totalMillisec	= (node.totalCycles / cyclesPerMillisec);
+			stat.selfMillisec	= ((node.totalCycles - Min(node.childCycles, node.totalCycles)) / cyclesPerMillisec);
+
+			// 直近のフレームの統計
+			{
+				RollingStat& rolling = m_rollingStats[path];
+				rolling.samples[rolling.next] = stat.totalMillisec;
+				rolling.next = ((rolling.next + 1) % StatWindow);
+				rolling.count = Min((rolling.count + 1), StatWindow);
+				rolling.lastFrame = m_frameCount;
+
+				double sum = 0.0, minValue = rolling.samples[0], maxValue = rolling.samples[0];
+
+				for (size_t i = 0; i < rolling.count; ++i)
+				{
+					const double sample = rolling.samples[i];
+					sum += sample;
+					minValue = Min(minValue, sample);
+					maxValue = Max(maxValue, sample);
+				}
+
+				stat.averageMillisec	= (sum / rolling.count);
+				stat.minMillisec		= minValue;
+				stat.maxMillisec		= maxValue;
+			}
+
+			const int32 statIndex = static_cast<int32>(m_stats.size());
+			m_stats.push_back(std::move(stat));
+			paths.push_back(std::move(path));
+
+			for (auto it = node.children.rbegin(); it != node.children.rend(); ++it)
+			{
+				pending.emplace_back(*it, statIndex);
+			}
+		}
+
+		// しばらく計測されていない区間の統計を破棄する
+		for (auto it = m_rollingStats.begin(); it != m_rollingStats.end();)
+		{
+			if (StatWindow <= (m_frameCount - it->second.lastFrame))
+			{
+				m_rollingStats.erase(it++);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	pushTraceFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScopeRecorder::pushTraceFrame(Array<Event>&& events)
+	{
+		m_traceEventCount += events.size();
+		m_traceFrames.push_back(std::move(events));
+
+		while ((1 < m_traceFrames.size())
+			&& ((MaxTraceFrames < m_traceFrames.size()) || (MaxTraceEvents < m_traceEventCount)))
+		{
+			m_traceEventCount -= m_traceFrames.front().size();
+			m_traceFrames.pop_front();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getCyclesPerMicrosec
+	//
+	////////////////////////////////////////////////////////////////
+
+	double ScopeRecorder::getCyclesPerMicrosec() const noexcept
+	{
+		if (const uint64 frequency = GetCycleFrequency())
+		{
+			return (frequency / 1'000'000.0);
+		}
+
+		// サイクルカウンタの周波数が得られない場合は、経過時間から推定する
+		const uint64 cycles = (GetCycleCount() - m_startCycles);
+		const int64 nanosec = (Time::GetNanosec() - m_startNanosec);
+
+		if ((cycles == 0) || (nanosec <= 0))
+		{
+			return 1.0;
+		}
+
+		return (cycles * 1000.0 / nanosec);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	GetScopeRecorder
+	//
+	////////////////////////////////////////////////////////////////
+
+	ScopeRecorder& GetScopeRecorder()
+	{
+		static ScopeRecorder recorder;
+		return recorder;
+	}
+}
@@ -0,0 +1,171 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <mutex>
+# include <deque>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/ProfilerScopeStat.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ScopeRecorder
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief `ProfilerScope` の記録を集計するクラス
+	/// @remark 各スレッドは自身のリングバッファ（単一生産者・単一消費者）にロックなしで書き込み、メインスレッドが `endFrame()` でまとめて回収します。
+	class ScopeRecorder
+	{
+	public:
+
+		/// @brief 1 つの計測区間の記録
+		struct Event
+		{
+			const char32* name = nullptr;
+
+			uint64 begin = 0;
+
+			uint64 end = 0;
+
+			uint32 depth = 0;
+
+			uint32 threadIndex = 0;
+		};
+
+		[[nodiscard]]
+		ScopeRecorder();
+
+		[[nodiscard]]
+		bool isEnabled() const noexcept
+		{
+			return m_enabled.load(std::memory_order_relaxed);
+		}
+
+		void setEnabled(bool enabled) noexcept;
+
+		/// @brief 計測区間に入ります。
+		/// @return 計測区間の入れ子の深さ
+		[[nodiscard]]
+		static uint32 Enter() noexcept;
+
+		/// @brief 計測区間を出て、記録を現在のスレッドのバッファに追加します。
+		/// @remark バッファが一杯の場合、記録は破棄されます。
+		void leave(const char32* name, uint64 begin, uint64 end, uint32 depth);
+
+		/// @brief 各スレッドの記録を回収し、フレームごとの統計を更新します。
+		void endFrame();
+
+		[[nodiscard]]
+		const Array<ProfilerScopeStat>& getStats() const noexcept;
+
+		bool exportChromeTrace(FilePathView path);
+
+	private:
+
+		/// @brief 直近何フレームの統計をとるか
+		static constexpr size_t StatWindow = 120;
+
+		/// @brief Chrome トレース用に保持する最大のフレーム数
+		static constexpr size_t MaxTraceFrames = 300;
+
+		/// @brief Chrome トレース用に保持する最大の記録数
+		static constexpr size_t MaxTraceEvents = (1 << 20);
+
+		/// @brief スレッドごとのリングバッファ
+		struct ThreadBuffer
+		{
+			static constexpr size_t Capacity = (1 << 14);
+
+			std::unique_ptr<Event[]> events = std::make_unique<Event[]>(Capacity);
+
+			/// @brief 書き込み位置（生産者のみが更新）
+			alignas(64) std::atomic<size_t> head{ 0 };
+
+			/// @brief 読み出し位置（消費者のみが更新）
+			alignas(64) std::atomic<size_t> tail{ 0 };
+
+			std::atomic<uint64> dropped{ 0 };
+
+			/// @brief スレッドが終了した場合 false
+			std::atomic<bool> alive{ true };
+
+			std::thread::id threadID;
+
+			uint32 threadIndex = 0;
+		};
+
+		struct ThreadBufferHandle;
+
+		struct RollingStat
+		{
+			std::array<double, StatWindow> samples{};
+
+			size_t count = 0;
+
+			size_t next = 0;
+
+			uint64 lastFrame = 0;
+		};
+
+		std::atomic<bool> m_enabled{ false };
+
+		/// @brief スレッドの登録を保護する
+		std::mutex m_registryMutex;
+
+		Array<std::shared_ptr<ThreadBuffer>> m_threadBuffers;
+
+		uint32 m_nextThreadIndex = 0;
+
+		/// @brief 記録の回収と集計を保護する
+		std::mutex m_consumerMutex;
+
+		/// @brief 回収済みで、まだフレームに割り当てていない記録
+		Array<Event> m_pendingEvents;
+
+		std::deque<Array<Event>> m_traceFrames;
+
+		size_t m_traceEventCount = 0;
+
+		Array<ProfilerScopeStat> m_stats;
+
+		HashMap<String, RollingStat> m_rollingStats;
+
+		uint64 m_frameCount = 0;
+
+		std::thread::id m_mainThreadID;
+
+		uint64 m_startCycles = 0;
+
+		int64 m_startNanosec = 0;
+
+		[[nodiscard]]
+		ThreadBuffer* getThreadBuffer();
+
+		void drain();
+
+		void buildStats(Array<Event>& events);
+
+		void pushTraceFrame(Array<Event>&& events);
+
+		[[nodiscard]]
+		double getCyclesPerMicrosec() const noexcept;
+	};
+
+	[[nodiscard]]
+	ScopeRecorder& GetScopeRecorder();
+}
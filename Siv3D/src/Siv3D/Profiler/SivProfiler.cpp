@@ -11,6 +11,7 @@
 
 # include <Siv3D/Profiler.hpp>
 # include <Siv3D/Profiler/IProfiler.hpp>
+# include <Siv3D/Profiler/ScopeRecorder.hpp>
 //# include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
 # include <Siv3D/Engine/Siv3DEngine.hpp>
 
@@ -32,5 +33,25 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(Profiler)->getStat();
 		}
+
+		void EnableScopeProfiling(const bool enabled)
+		{
+			GetScopeRecorder().setEnabled(enabled);
+		}
+
+		bool IsScopeProfilingEnabled() noexcept
+		{
+			return GetScopeRecorder().isEnabled();
+		}
+
+		const Array<ProfilerScopeStat>& GetScopeStats()
+		{
+			return GetScopeRecorder().getStats();
+		}
+
+		bool ExportChromeTrace(const FilePathView path)
+		{
+			return GetScopeRecorder().exportChromeTrace(path);
+		}
 	}
 }
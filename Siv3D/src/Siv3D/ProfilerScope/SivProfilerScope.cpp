@@ -0,0 +1,48 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ProfilerScope.hpp>
+# include <Siv3D/CycleClock.hpp>
+# include <Siv3D/Profiler/ScopeRecorder.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProfilerScope::ProfilerScope(const char32* name) noexcept
+	{
+		if (GetScopeRecorder().isEnabled())
+		{
+			m_name	= name;
+			m_depth	= ScopeRecorder::Enter();
+			m_begin	= GetCycleCount();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProfilerScope::~ProfilerScope()
+	{
+		if (m_name)
+		{
+			const uint64 end = GetCycleCount();
+			GetScopeRecorder().leave(m_name, m_begin, end, m_depth);
+		}
+	}
+}
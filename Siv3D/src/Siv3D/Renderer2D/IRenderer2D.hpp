@@ -17,6 +17,7 @@
 # include <Siv3D/TriangleIndex.hpp>
 # include <Siv3D/Texture.hpp>
 # include "ColorFillDirection.hpp"
+# include "Renderer2DStat.hpp"
 
 namespace s3d
 {
@@ -29,6 +30,7 @@ namespace s3d
 	struct Mat3x2;
 	enum class LineCap : uint8;
 	struct PatternParameters;
+	class Renderer2DCommandList;
 
 	class SIV3D_NOVTABLE ISiv3DRenderer2D
 	{
@@ -57,6 +59,8 @@ namespace s3d
 
 		virtual void addRect(const FloatRect& rect, const PatternParameters& pattern) = 0;
 
+		virtual void addRects(std::span<const FloatRect> rects, std::span<const Float4> colors) = 0;
+
 		virtual void addRectFrame(const FloatRect& innerRect, float thickness, const Float4& color0, const Float4& color1, ColorFillDirection colorType) = 0;
 
 		virtual void addRectFrame(const FloatRect& innerRect, float thickness, const PatternParameters& pattern) = 0;
@@ -65,6 +69,8 @@ namespace s3d
 
 		virtual void addCircle(const Float2& center, float r, const PatternParameters& pattern) = 0;
 
+		virtual void addCircles(std::span<const Float2> centers, std::span<const float> rs, std::span<const Float4> colors) = 0;
+
 		virtual void addCircleFrame(const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor) = 0;
 
 		virtual void addCircleFrame(const Float2& center, float rInner, float thickness, const PatternParameters& pattern) = 0;
@@ -138,6 +144,8 @@ namespace s3d
 
 		virtual void addQuadWarp(const Texture& texture, const FloatRect& uv, const FloatQuad& quad, const Float4(&colors)[4]) = 0;
 
+		virtual void addCommandList(const Renderer2DCommandList& commandList) = 0;
+
 
 		virtual void flush() = 0;
 
@@ -183,5 +191,11 @@ namespace s3d
 		virtual void setCameraTransform(const Mat3x2& matrix) = 0;
 
 		virtual float getMaxScaling() const noexcept = 0;
+
+		virtual const Renderer2DStat& getStat() const noexcept = 0;
+
+		virtual void setDrawCallReorderingEnabled(bool enabled) = 0;
+
+		virtual bool isDrawCallReorderingEnabled() const noexcept = 0;
 	};
 }
@@ -11,11 +11,10 @@
 
 # pragma once
 # include <Siv3D/Array.hpp>
-# include <Siv3D/Renderer/D3D11/D3D11.hpp>
 
 namespace s3d
 {
-	enum class D3D11Renderer2DCommandType : uint32
+	enum class Renderer2DCommandType : uint32
 	{
 		Null,
 
@@ -125,16 +124,16 @@ namespace s3d
 
 		SIZE_,
 	};
-	static_assert(FromEnum(D3D11Renderer2DCommandType::SIZE_) < 64);
+	static_assert(FromEnum(Renderer2DCommandType::SIZE_) < 64);
 
-	struct D3D11Renderer2DCommand
+	struct Renderer2DCommand
 	{
-		D3D11Renderer2DCommandType type	: 8 = D3D11Renderer2DCommandType::Null;
+		Renderer2DCommandType type	: 8 = Renderer2DCommandType::Null;
 
 		uint32 index					: 24 = 0;
 	};
 
-	struct D3D11DrawCommand
+	struct Renderer2DDrawCommand
 	{
 		uint32 indexCount = 0;
 	};
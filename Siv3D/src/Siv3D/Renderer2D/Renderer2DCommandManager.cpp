@@ -9,7 +9,7 @@
 //
 //-----------------------------------------------
 
-# include "D3D11Renderer2DCommandManager.hpp"
+# include "Renderer2DCommandManager.hpp"
 # include <Siv3D/EngineLog.hpp>
 
 namespace s3d
@@ -29,7 +29,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	D3D11Renderer2DCommandManager::D3D11Renderer2DCommandManager()
+	Renderer2DCommandManager::Renderer2DCommandManager()
 	{
 		reset();
 	}
@@ -40,7 +40,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::reset()
+	void Renderer2DCommandManager::reset()
 	{
 		// clear commands
 		{
@@ -91,69 +91,69 @@ namespace s3d
 
 		// Begin a new frame
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::SetBuffers, 0);
-			m_commands.emplace_back(D3D11Renderer2DCommandType::UpdateBuffers, 0);
+			m_commands.emplace_back(Renderer2DCommandType::SetBuffers, 0);
+			m_commands.emplace_back(Renderer2DCommandType::UpdateBuffers, 0);
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::ColorMul, 0);
+			m_commands.emplace_back(Renderer2DCommandType::ColorMul, 0);
 			m_current.colorMul = m_buffer.colorMuls.front();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::ColorAdd, 0);
+			m_commands.emplace_back(Renderer2DCommandType::ColorAdd, 0);
 			m_current.colorAdd = m_buffer.colorAdds.front();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::QuadWarpParameters, 0);
+			m_commands.emplace_back(Renderer2DCommandType::QuadWarpParameters, 0);
 			m_current.quadWarpParameter = m_buffer.quadWarpParameters.front();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::PatternParameters, 0);
+			m_commands.emplace_back(Renderer2DCommandType::PatternParameters, 0);
 			m_current.patternParameter = m_buffer.patternParameters.front();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::BlendState, 0);
+			m_commands.emplace_back(Renderer2DCommandType::BlendState, 0);
 			m_current.blendState = m_buffer.blendStates.front();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::RasterizerState, 0);
+			m_commands.emplace_back(Renderer2DCommandType::RasterizerState, 0);
 			m_current.rasterizerState = m_buffer.rasterizerStates.front();
 
 			for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 			{
-				const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::VSSamplerState0) + i);
+				const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::VSSamplerState0) + i);
 				m_commands.emplace_back(command, 0);
 				m_current.vsSamplerStates[i] = m_buffer.vsSamplerStates[i].front();
 			}
 
 			for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 			{
-				const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::PSSamplerState0) + i);
+				const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::PSSamplerState0) + i);
 				m_commands.emplace_back(command, 0);
 				m_current.psSamplerStates[i] = m_buffer.psSamplerStates[i].front();
 			}
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::ScissorRect, 0);
+			m_commands.emplace_back(Renderer2DCommandType::ScissorRect, 0);
 			m_current.scissorRect = m_buffer.scissorRects.front();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::Viewport, 0);
+			m_commands.emplace_back(Renderer2DCommandType::Viewport, 0);
 			m_current.viewport = m_buffer.viewports.front();
 
-			//m_commands.emplace_back(D3D11Renderer2DCommandType::SDFParams, 0);
+			//m_commands.emplace_back(Renderer2DCommandType::SDFParams, 0);
 			//m_currentSDFParams = m_sdfParams.front();
 
-			//m_commands.emplace_back(D3D11Renderer2DCommandType::InternalPSConstants, 0);
+			//m_commands.emplace_back(Renderer2DCommandType::InternalPSConstants, 0);
 			//m_currentInternalPSConstants = m_internalPSConstants.front();
 
-			//m_commands.emplace_back(D3D11Renderer2DCommandType::SetRT, 0);
+			//m_commands.emplace_back(Renderer2DCommandType::SetRT, 0);
 			//m_currentRT = m_RTs.front();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::SetVS, 0);
+			m_commands.emplace_back(Renderer2DCommandType::SetVS, 0);
 			m_current.vertexShader = VertexShader::IDType::Invalid();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::SetPS, 0);
+			m_commands.emplace_back(Renderer2DCommandType::SetPS, 0);
 			m_current.pixelShader = PixelShader::IDType::Invalid();
 
-			m_commands.emplace_back(D3D11Renderer2DCommandType::Transform, 0);
+			m_commands.emplace_back(Renderer2DCommandType::Transform, 0);
 			m_current.combinedTransform = m_buffer.combinedTransforms.front();
 
 			{
 				for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 				{
-					const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::VSTexture0) + i);
+					const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::VSTexture0) + i);
 					m_buffer.vsTextures[i] = { Texture::IDType::Invalid() };
 					m_commands.emplace_back(command, 0);
 				}
@@ -164,7 +164,7 @@ namespace s3d
 			{
 				for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 				{
-					const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::PSTexture0) + i);
+					const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::PSTexture0) + i);
 					m_buffer.psTextures[i] = { Texture::IDType::Invalid() };
 					m_commands.emplace_back(command, 0);
 				}
@@ -180,59 +180,59 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::flush()
+	void Renderer2DCommandManager::flush()
 	{
 		if (m_current.draw.indexCount)
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::Draw, static_cast<uint32>(m_buffer.draws.size()));
+			m_commands.emplace_back(Renderer2DCommandType::Draw, static_cast<uint32>(m_buffer.draws.size()));
 			m_buffer.draws.push_back(m_current.draw);
 			m_current.draw.indexCount = 0;
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::SetBuffers))
+		if (m_stateTracker.has(Renderer2DCommandType::SetBuffers))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::SetBuffers, 0);
+			m_commands.emplace_back(Renderer2DCommandType::SetBuffers, 0);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::ColorMul))
+		if (m_stateTracker.has(Renderer2DCommandType::ColorMul))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::ColorMul, static_cast<uint32>(m_buffer.colorMuls.size()));
+			m_commands.emplace_back(Renderer2DCommandType::ColorMul, static_cast<uint32>(m_buffer.colorMuls.size()));
 			m_buffer.colorMuls.push_back(m_current.colorMul);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::ColorAdd))
+		if (m_stateTracker.has(Renderer2DCommandType::ColorAdd))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::ColorAdd, static_cast<uint32>(m_buffer.colorAdds.size()));
+			m_commands.emplace_back(Renderer2DCommandType::ColorAdd, static_cast<uint32>(m_buffer.colorAdds.size()));
 			m_buffer.colorAdds.push_back(m_current.colorAdd);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::QuadWarpParameters))
+		if (m_stateTracker.has(Renderer2DCommandType::QuadWarpParameters))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::QuadWarpParameters, static_cast<uint32>(m_buffer.quadWarpParameters.size()));
+			m_commands.emplace_back(Renderer2DCommandType::QuadWarpParameters, static_cast<uint32>(m_buffer.quadWarpParameters.size()));
 			m_buffer.quadWarpParameters.push_back(m_current.quadWarpParameter);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::PatternParameters))
+		if (m_stateTracker.has(Renderer2DCommandType::PatternParameters))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::PatternParameters, static_cast<uint32>(m_buffer.patternParameters.size()));
+			m_commands.emplace_back(Renderer2DCommandType::PatternParameters, static_cast<uint32>(m_buffer.patternParameters.size()));
 			m_buffer.patternParameters.push_back(m_current.patternParameter);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::BlendState))
+		if (m_stateTracker.has(Renderer2DCommandType::BlendState))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::BlendState, static_cast<uint32>(m_buffer.blendStates.size()));
+			m_commands.emplace_back(Renderer2DCommandType::BlendState, static_cast<uint32>(m_buffer.blendStates.size()));
 			m_buffer.blendStates.push_back(m_current.blendState);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::RasterizerState))
+		if (m_stateTracker.has(Renderer2DCommandType::RasterizerState))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::RasterizerState, static_cast<uint32>(m_buffer.rasterizerStates.size()));
+			m_commands.emplace_back(Renderer2DCommandType::RasterizerState, static_cast<uint32>(m_buffer.rasterizerStates.size()));
 			m_buffer.rasterizerStates.push_back(m_current.rasterizerState);
 		}
 
 		for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 		{
-			const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::VSSamplerState0) + i);
+			const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::VSSamplerState0) + i);
 
 			if (m_stateTracker.has(command))
 			{
@@ -243,7 +243,7 @@ namespace s3d
 
 		for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 		{
-			const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::PSSamplerState0) + i);
+			const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::PSSamplerState0) + i);
 			if (m_stateTracker.has(command))
 			{
 				m_commands.emplace_back(command, static_cast<uint32>(m_buffer.psSamplerStates[i].size()));
@@ -251,63 +251,63 @@ namespace s3d
 			}
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::ScissorRect))
+		if (m_stateTracker.has(Renderer2DCommandType::ScissorRect))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::ScissorRect, static_cast<uint32>(m_buffer.scissorRects.size()));
+			m_commands.emplace_back(Renderer2DCommandType::ScissorRect, static_cast<uint32>(m_buffer.scissorRects.size()));
 			m_buffer.scissorRects.push_back(m_current.scissorRect);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::Viewport))
+		if (m_stateTracker.has(Renderer2DCommandType::Viewport))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::Viewport, static_cast<uint32>(m_buffer.viewports.size()));
+			m_commands.emplace_back(Renderer2DCommandType::Viewport, static_cast<uint32>(m_buffer.viewports.size()));
 			m_buffer.viewports.push_back(m_current.viewport);
 		}
 
-		//if (m_changes.has(D3D11Renderer2DCommandType::SDFParams))
+		//if (m_changes.has(Renderer2DCommandType::SDFParams))
 		//{
-		//	m_commands.emplace_back(D3D11Renderer2DCommandType::SDFParams, static_cast<uint32>(m_sdfParams.size()));
+		//	m_commands.emplace_back(Renderer2DCommandType::SDFParams, static_cast<uint32>(m_sdfParams.size()));
 		//	m_sdfParams.push_back(m_currentSDFParams);
 		//}
 
-		//if (m_changes.has(D3D11Renderer2DCommandType::InternalPSConstants))
+		//if (m_changes.has(Renderer2DCommandType::InternalPSConstants))
 		//{
-		//	m_commands.emplace_back(D3D11Renderer2DCommandType::InternalPSConstants, static_cast<uint32>(m_internalPSConstants.size()));
+		//	m_commands.emplace_back(Renderer2DCommandType::InternalPSConstants, static_cast<uint32>(m_internalPSConstants.size()));
 		//	m_internalPSConstants.push_back(m_currentInternalPSConstants);
 		//}
 
-		//if (m_changes.has(D3D11Renderer2DCommandType::SetRT))
+		//if (m_changes.has(Renderer2DCommandType::SetRT))
 		//{
-		//	m_commands.emplace_back(D3D11Renderer2DCommandType::SetRT, static_cast<uint32>(m_RTs.size()));
+		//	m_commands.emplace_back(Renderer2DCommandType::SetRT, static_cast<uint32>(m_RTs.size()));
 		//	m_RTs.push_back(m_currentRT);
 		//}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::SetVS))
+		if (m_stateTracker.has(Renderer2DCommandType::SetVS))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::SetVS, static_cast<uint32>(m_buffer.vertexShaders.size()));
+			m_commands.emplace_back(Renderer2DCommandType::SetVS, static_cast<uint32>(m_buffer.vertexShaders.size()));
 			m_buffer.vertexShaders.push_back(m_current.vertexShader);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::SetPS))
+		if (m_stateTracker.has(Renderer2DCommandType::SetPS))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::SetPS, static_cast<uint32>(m_buffer.pixelShaders.size()));
+			m_commands.emplace_back(Renderer2DCommandType::SetPS, static_cast<uint32>(m_buffer.pixelShaders.size()));
 			m_buffer.pixelShaders.push_back(m_current.pixelShader);
 		}
 
-		if (m_stateTracker.has(D3D11Renderer2DCommandType::Transform))
+		if (m_stateTracker.has(Renderer2DCommandType::Transform))
 		{
-			m_commands.emplace_back(D3D11Renderer2DCommandType::Transform, static_cast<uint32>(m_buffer.combinedTransforms.size()));
+			m_commands.emplace_back(Renderer2DCommandType::Transform, static_cast<uint32>(m_buffer.combinedTransforms.size()));
 			m_buffer.combinedTransforms.push_back(m_current.combinedTransform);
 		}
 
-		//if (m_changes.has(D3D11Renderer2DCommandType::SetConstantBuffer))
+		//if (m_changes.has(Renderer2DCommandType::SetConstantBuffer))
 		//{
 		//	assert(not m_constantBufferCommands.isEmpty());
-		//	m_commands.emplace_back(D3D11Renderer2DCommandType::SetConstantBuffer, static_cast<uint32>(m_constantBufferCommands.size()) - 1);
+		//	m_commands.emplace_back(Renderer2DCommandType::SetConstantBuffer, static_cast<uint32>(m_constantBufferCommands.size()) - 1);
 		//}
 
 		for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 		{
-			const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::VSTexture0) + i);
+			const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::VSTexture0) + i);
 
 			if (m_stateTracker.has(command))
 			{
@@ -318,7 +318,7 @@ namespace s3d
 
 		for (uint32 i = 0; i < Graphics::TextureSlotCount; ++i)
 		{
-			const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::PSTexture0) + i);
+			const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::PSTexture0) + i);
 			
 			if (m_stateTracker.has(command))
 			{
@@ -336,22 +336,33 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	const Array<D3D11Renderer2DCommand>& D3D11Renderer2DCommandManager::getCommands() const noexcept
+	const Array<Renderer2DCommand>& Renderer2DCommandManager::getCommands() const noexcept
 	{
 		return m_commands;
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	reorderDraws
+	//
+	////////////////////////////////////////////////////////////////
+
+	uint32 Renderer2DCommandManager::reorderDraws(const Renderer2DBufferView& buffer)
+	{
+		return Renderer2DCommandReorder::Reorder(m_commands, m_buffer.draws, *this, buffer);
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	pushUpdateBuffers
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushUpdateBuffers(const uint32 batchIndex)
+	void Renderer2DCommandManager::pushUpdateBuffers(const uint32 batchIndex)
 	{
 		flush();
 
-		m_commands.emplace_back(D3D11Renderer2DCommandType::UpdateBuffers, batchIndex);
+		m_commands.emplace_back(Renderer2DCommandType::UpdateBuffers, batchIndex);
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -360,7 +371,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushDraw(const Vertex2D::IndexType indexCount)
+	void Renderer2DCommandManager::pushDraw(const Vertex2D::IndexType indexCount)
 	{
 		if (m_stateTracker.hasStateChange())
 		{
@@ -370,7 +381,7 @@ namespace s3d
 		m_current.draw.indexCount += indexCount;
 	}
 
-	const D3D11DrawCommand& D3D11Renderer2DCommandManager::getDraw(const uint32 index) const noexcept
+	const Renderer2DDrawCommand& Renderer2DCommandManager::getDraw(const uint32 index) const noexcept
 	{
 		return m_buffer.draws[index];
 	}
@@ -381,9 +392,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushColorMul(const Float4& color)
+	void Renderer2DCommandManager::pushColorMul(const Float4& color)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::ColorMul;
+		constexpr auto Command = Renderer2DCommandType::ColorMul;
 		auto& current = m_current.colorMul;
 		auto& buffer = m_buffer.colorMuls;
 
@@ -406,12 +417,12 @@ namespace s3d
 		}
 	}
 
-	const Float4& D3D11Renderer2DCommandManager::getColorMul(const uint32 index) const
+	const Float4& Renderer2DCommandManager::getColorMul(const uint32 index) const
 	{
 		return m_buffer.colorMuls[index];
 	}
 
-	const Float4& D3D11Renderer2DCommandManager::getCurrentColorMul() const
+	const Float4& Renderer2DCommandManager::getCurrentColorMul() const
 	{
 		return m_current.colorMul;
 	}
@@ -422,9 +433,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushColorAdd(const Float3& color)
+	void Renderer2DCommandManager::pushColorAdd(const Float3& color)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::ColorAdd;
+		constexpr auto Command = Renderer2DCommandType::ColorAdd;
 		auto& current = m_current.colorAdd;
 		auto& buffer = m_buffer.colorAdds;
 
@@ -447,12 +458,12 @@ namespace s3d
 		}
 	}
 
-	const Float3& D3D11Renderer2DCommandManager::getColorAdd(const uint32 index) const
+	const Float3& Renderer2DCommandManager::getColorAdd(const uint32 index) const
 	{
 		return m_buffer.colorAdds[index];
 	}
 
-	const Float3& D3D11Renderer2DCommandManager::getCurrentColorAdd() const
+	const Float3& Renderer2DCommandManager::getCurrentColorAdd() const
 	{
 		return m_current.colorAdd;
 	}
@@ -463,9 +474,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushQuadWarpParameter(const std::array<Float4, 3>& params)
+	void Renderer2DCommandManager::pushQuadWarpParameter(const std::array<Float4, 3>& params)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::QuadWarpParameters;
+		constexpr auto Command = Renderer2DCommandType::QuadWarpParameters;
 		auto& current = m_current.quadWarpParameter;
 		auto& buffer = m_buffer.quadWarpParameters;
 		
@@ -488,12 +499,12 @@ namespace s3d
 		}
 	}
 
-	const std::array<Float4, 3>& D3D11Renderer2DCommandManager::getQuadWarpParameter(const uint32 index) const
+	const std::array<Float4, 3>& Renderer2DCommandManager::getQuadWarpParameter(const uint32 index) const
 	{
 		return m_buffer.quadWarpParameters[index];
 	}
 	
-	const std::array<Float4, 3>& D3D11Renderer2DCommandManager::getQuadWarpParameter() const
+	const std::array<Float4, 3>& Renderer2DCommandManager::getQuadWarpParameter() const
 	{
 		return m_current.quadWarpParameter;
 	}
@@ -504,9 +515,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushPatternParameter(const std::array<Float4, 3>& patternParameter)
+	void Renderer2DCommandManager::pushPatternParameter(const std::array<Float4, 3>& patternParameter)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::PatternParameters;
+		constexpr auto Command = Renderer2DCommandType::PatternParameters;
 		auto& current = m_current.patternParameter;
 		auto& buffer = m_buffer.patternParameters;
 
@@ -529,12 +540,12 @@ namespace s3d
 		}
 	}
 	
-	const std::array<Float4, 3>& D3D11Renderer2DCommandManager::getPatternParameter(const uint32 index) const
+	const std::array<Float4, 3>& Renderer2DCommandManager::getPatternParameter(const uint32 index) const
 	{
 		return m_buffer.patternParameters[index];
 	}
 	
-	const std::array<Float4, 3>& D3D11Renderer2DCommandManager::getPatternParameter() const
+	const std::array<Float4, 3>& Renderer2DCommandManager::getPatternParameter() const
 	{
 		return m_current.patternParameter;
 	}
@@ -545,9 +556,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushBlendState(const BlendState& state)
+	void Renderer2DCommandManager::pushBlendState(const BlendState& state)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::BlendState;
+		constexpr auto Command = Renderer2DCommandType::BlendState;
 		auto& current = m_current.blendState;
 		auto& buffer = m_buffer.blendStates;
 
@@ -570,12 +581,12 @@ namespace s3d
 		}
 	}
 
-	const BlendState& D3D11Renderer2DCommandManager::getBlendState(const uint32 index) const
+	const BlendState& Renderer2DCommandManager::getBlendState(const uint32 index) const
 	{
 		return m_buffer.blendStates[index];
 	}
 
-	const BlendState& D3D11Renderer2DCommandManager::getCurrentBlendState() const
+	const BlendState& Renderer2DCommandManager::getCurrentBlendState() const
 	{
 		return m_current.blendState;
 	}
@@ -586,9 +597,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushRasterizerState(const RasterizerState& state)
+	void Renderer2DCommandManager::pushRasterizerState(const RasterizerState& state)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::RasterizerState;
+		constexpr auto Command = Renderer2DCommandType::RasterizerState;
 		auto& current = m_current.rasterizerState;
 		auto& buffer = m_buffer.rasterizerStates;
 
@@ -611,12 +622,12 @@ namespace s3d
 		}
 	}
 
-	const RasterizerState& D3D11Renderer2DCommandManager::getRasterizerState(const uint32 index) const
+	const RasterizerState& Renderer2DCommandManager::getRasterizerState(const uint32 index) const
 	{
 		return m_buffer.rasterizerStates[index];
 	}
 
-	const RasterizerState& D3D11Renderer2DCommandManager::getCurrentRasterizerState() const
+	const RasterizerState& Renderer2DCommandManager::getCurrentRasterizerState() const
 	{
 		return m_current.rasterizerState;
 	}
@@ -627,11 +638,11 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushVSSamplerState(const SamplerState& state, const uint32 slot)
+	void Renderer2DCommandManager::pushVSSamplerState(const SamplerState& state, const uint32 slot)
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
-		const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::VSSamplerState0) + slot);
+		const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::VSSamplerState0) + slot);
 		auto& current = m_current.vsSamplerStates[slot];
 		auto& buffer = m_buffer.vsSamplerStates[slot];
 
@@ -654,14 +665,14 @@ namespace s3d
 		}
 	}
 	
-	const SamplerState& D3D11Renderer2DCommandManager::getVSSamplerState(const uint32 slot, const uint32 index) const
+	const SamplerState& Renderer2DCommandManager::getVSSamplerState(const uint32 slot, const uint32 index) const
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
 		return m_buffer.vsSamplerStates[slot][index];
 	}
 	
-	const SamplerState& D3D11Renderer2DCommandManager::getCurrentVSSamplerState(const uint32 slot) const
+	const SamplerState& Renderer2DCommandManager::getCurrentVSSamplerState(const uint32 slot) const
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
@@ -674,11 +685,11 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushPSSamplerState(const SamplerState& state, const uint32 slot)
+	void Renderer2DCommandManager::pushPSSamplerState(const SamplerState& state, const uint32 slot)
 	{
 		assert(slot < Graphics::TextureSlotCount);
 		
-		const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::PSSamplerState0) + slot);
+		const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::PSSamplerState0) + slot);
 		auto& current = m_current.psSamplerStates[slot];
 		auto& buffer = m_buffer.psSamplerStates[slot];
 		
@@ -701,14 +712,14 @@ namespace s3d
 		}
 	}
 
-	const SamplerState& D3D11Renderer2DCommandManager::getPSSamplerState(const uint32 slot, const uint32 index) const
+	const SamplerState& Renderer2DCommandManager::getPSSamplerState(const uint32 slot, const uint32 index) const
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
 		return m_buffer.psSamplerStates[slot][index];
 	}
 
-	const SamplerState& D3D11Renderer2DCommandManager::getCurrentPSSamplerState(const uint32 slot) const
+	const SamplerState& Renderer2DCommandManager::getCurrentPSSamplerState(const uint32 slot) const
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
@@ -721,9 +732,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushScissorRect(const Optional<Rect>& state)
+	void Renderer2DCommandManager::pushScissorRect(const Optional<Rect>& state)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::ScissorRect;
+		constexpr auto Command = Renderer2DCommandType::ScissorRect;
 		auto& current = m_current.scissorRect;
 		auto& buffer = m_buffer.scissorRects;
 
@@ -746,12 +757,12 @@ namespace s3d
 		}
 	}
 
-	const Optional<Rect>& D3D11Renderer2DCommandManager::getScissorRect(const uint32 index) const
+	const Optional<Rect>& Renderer2DCommandManager::getScissorRect(const uint32 index) const
 	{
 		return m_buffer.scissorRects[index];
 	}
 
-	const Optional<Rect>& D3D11Renderer2DCommandManager::getCurrentScissorRect() const
+	const Optional<Rect>& Renderer2DCommandManager::getCurrentScissorRect() const
 	{
 		return m_current.scissorRect;
 	}
@@ -762,9 +773,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushViewport(const Optional<Rect>& state)
+	void Renderer2DCommandManager::pushViewport(const Optional<Rect>& state)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::Viewport;
+		constexpr auto Command = Renderer2DCommandType::Viewport;
 		auto& current = m_current.viewport;
 		auto& buffer = m_buffer.viewports;
 
@@ -787,12 +798,12 @@ namespace s3d
 		}
 	}
 	
-	const Optional<Rect>& D3D11Renderer2DCommandManager::getViewport(const uint32 index) const
+	const Optional<Rect>& Renderer2DCommandManager::getViewport(const uint32 index) const
 	{
 		return m_buffer.viewports[index];
 	}
 	
-	const Optional<Rect>& D3D11Renderer2DCommandManager::getCurrentViewport() const
+	const Optional<Rect>& Renderer2DCommandManager::getCurrentViewport() const
 	{
 		return m_current.viewport;
 	}
@@ -803,9 +814,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushEngineVS(const VertexShader::IDType id)
+	void Renderer2DCommandManager::pushEngineVS(const VertexShader::IDType id)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::SetVS;
+		constexpr auto Command = Renderer2DCommandType::SetVS;
 		auto& current = m_current.vertexShader;
 		auto& buffer = m_buffer.vertexShaders;
 
@@ -828,7 +839,7 @@ namespace s3d
 		}
 	}
 
-	VertexShader::IDType D3D11Renderer2DCommandManager::getVS(const uint32 index) const
+	VertexShader::IDType Renderer2DCommandManager::getVS(const uint32 index) const
 	{
 		return m_buffer.vertexShaders[index];
 	}
@@ -839,9 +850,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushEnginePS(const PixelShader::IDType id)
+	void Renderer2DCommandManager::pushEnginePS(const PixelShader::IDType id)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::SetPS;
+		constexpr auto Command = Renderer2DCommandType::SetPS;
 		auto& current = m_current.pixelShader;
 		auto& buffer = m_buffer.pixelShaders;
 
@@ -864,7 +875,7 @@ namespace s3d
 		}
 	}
 
-	PixelShader::IDType D3D11Renderer2DCommandManager::getPS(const uint32 index) const
+	PixelShader::IDType Renderer2DCommandManager::getPS(const uint32 index) const
 	{
 		return m_buffer.pixelShaders[index];
 	}
@@ -875,9 +886,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushLocalTransform(const Mat3x2& local)
+	void Renderer2DCommandManager::pushLocalTransform(const Mat3x2& local)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::Transform;
+		constexpr auto Command = Renderer2DCommandType::Transform;
 		auto& currentLocal = m_current.localTransform;
 		auto& currentCombined = m_current.combinedTransform;
 		auto& buffer = m_buffer.combinedTransforms;
@@ -906,7 +917,7 @@ namespace s3d
 		}
 	}
 
-	const Mat3x2& D3D11Renderer2DCommandManager::getCurrentLocalTransform() const
+	const Mat3x2& Renderer2DCommandManager::getCurrentLocalTransform() const
 	{
 		return m_current.localTransform;
 	}
@@ -917,9 +928,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushCameraTransform(const Mat3x2& camera)
+	void Renderer2DCommandManager::pushCameraTransform(const Mat3x2& camera)
 	{
-		constexpr auto Command = D3D11Renderer2DCommandType::Transform;
+		constexpr auto Command = Renderer2DCommandType::Transform;
 		auto& currentCamera = m_current.cameraTransform;
 		auto& currentCombined = m_current.combinedTransform;
 		auto& buffer = m_buffer.combinedTransforms;
@@ -948,7 +959,7 @@ namespace s3d
 		}
 	}
 
-	const Mat3x2& D3D11Renderer2DCommandManager::getCurrentCameraTransform() const
+	const Mat3x2& Renderer2DCommandManager::getCurrentCameraTransform() const
 	{
 		return m_current.cameraTransform;
 	}
@@ -959,12 +970,12 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	const Mat3x2& D3D11Renderer2DCommandManager::getCombinedTransform(const uint32 index) const
+	const Mat3x2& Renderer2DCommandManager::getCombinedTransform(const uint32 index) const
 	{
 		return m_buffer.combinedTransforms[index];
 	}
 
-	const Mat3x2& D3D11Renderer2DCommandManager::getCurrentCombinedTransform() const
+	const Mat3x2& Renderer2DCommandManager::getCurrentCombinedTransform() const
 	{
 		return m_current.combinedTransform;
 	}
@@ -975,7 +986,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	float D3D11Renderer2DCommandManager::getCurrentMaxScaling() const noexcept
+	float Renderer2DCommandManager::getCurrentMaxScaling() const noexcept
 	{
 		return m_current.maxScaling;
 	}
@@ -986,12 +997,12 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushVSTextureUnbind(const uint32 slot)
+	void Renderer2DCommandManager::pushVSTextureUnbind(const uint32 slot)
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
 		static constexpr auto InvalidID = Texture::IDType::Invalid();
-		const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::VSTexture0) + slot);
+		const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::VSTexture0) + slot);
 		auto& current = m_current.vsTextures[slot];
 		auto& buffer = m_buffer.vsTextures[slot];
 
@@ -1014,11 +1025,11 @@ namespace s3d
 		}
 	}
 
-	void D3D11Renderer2DCommandManager::pushVSTexture(const uint32 slot, const Texture& texture)
+	void Renderer2DCommandManager::pushVSTexture(const uint32 slot, const Texture& texture)
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
-		const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::VSTexture0) + slot);
+		const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::VSTexture0) + slot);
 		auto& current = m_current.vsTextures[slot];
 		auto& buffer = m_buffer.vsTextures[slot];
 
@@ -1041,14 +1052,14 @@ namespace s3d
 		}
 	}
 	
-	const Texture::IDType& D3D11Renderer2DCommandManager::getVSTexture(const uint32 slot, const uint32 index) const
+	const Texture::IDType& Renderer2DCommandManager::getVSTexture(const uint32 slot, const uint32 index) const
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
 		return m_buffer.vsTextures[slot][index];
 	}
 
-	const std::array<Texture::IDType, Graphics::TextureSlotCount>& D3D11Renderer2DCommandManager::getCurrentVSTextures() const
+	const std::array<Texture::IDType, Graphics::TextureSlotCount>& Renderer2DCommandManager::getCurrentVSTextures() const
 	{
 		return m_current.vsTextures;
 	}
@@ -1059,12 +1070,12 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	void D3D11Renderer2DCommandManager::pushPSTextureUnbind(const uint32 slot)
+	void Renderer2DCommandManager::pushPSTextureUnbind(const uint32 slot)
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
 		static constexpr auto InvalidID = Texture::IDType::Invalid();
-		const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::PSTexture0) + slot);
+		const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::PSTexture0) + slot);
 		auto& current = m_current.psTextures[slot];
 		auto& buffer = m_buffer.psTextures[slot];
 
@@ -1087,11 +1098,11 @@ namespace s3d
 		}
 	}
 
-	void D3D11Renderer2DCommandManager::pushPSTexture(const uint32 slot, const Texture& texture)
+	void Renderer2DCommandManager::pushPSTexture(const uint32 slot, const Texture& texture)
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
-		const auto command = ToEnum<D3D11Renderer2DCommandType>(FromEnum(D3D11Renderer2DCommandType::PSTexture0) + slot);
+		const auto command = ToEnum<Renderer2DCommandType>(FromEnum(Renderer2DCommandType::PSTexture0) + slot);
 		auto& current = m_current.psTextures[slot];
 		auto& buffer = m_buffer.psTextures[slot];
 
@@ -1114,14 +1125,14 @@ namespace s3d
 		}
 	}
 
-	const Texture::IDType& D3D11Renderer2DCommandManager::getPSTexture(const uint32 slot, const uint32 index) const
+	const Texture::IDType& Renderer2DCommandManager::getPSTexture(const uint32 slot, const uint32 index) const
 	{
 		assert(slot < Graphics::TextureSlotCount);
 
 		return m_buffer.psTextures[slot][index];
 	}
 
-	const std::array<Texture::IDType, Graphics::TextureSlotCount>& D3D11Renderer2DCommandManager::getCurrentPSTextures() const
+	const std::array<Texture::IDType, Graphics::TextureSlotCount>& Renderer2DCommandManager::getCurrentPSTextures() const
 	{
 		return m_current.psTextures;
 	}
@@ -1132,7 +1143,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	std::array<Array<SamplerState>, Graphics::TextureSlotCount> D3D11Renderer2DCommandManager::MakeDefaultSamplerStates()
+	std::array<Array<SamplerState>, Graphics::TextureSlotCount> Renderer2DCommandManager::MakeDefaultSamplerStates()
 	{
 		std::array<Array<SamplerState>, Graphics::TextureSlotCount> result;
 		
@@ -1141,7 +1152,7 @@ namespace s3d
 		return result;
 	}
 
-	std::array<SamplerState, Graphics::TextureSlotCount> D3D11Renderer2DCommandManager::MakeDefaultSamplerState()
+	std::array<SamplerState, Graphics::TextureSlotCount> Renderer2DCommandManager::MakeDefaultSamplerState()
 	{
 		std::array<SamplerState, Graphics::TextureSlotCount> result;
 
@@ -1150,7 +1161,7 @@ namespace s3d
 		return result;
 	}
 
-	std::array<Array<Texture::IDType>, Graphics::TextureSlotCount> D3D11Renderer2DCommandManager::MakeDefaultTextures()
+	std::array<Array<Texture::IDType>, Graphics::TextureSlotCount> Renderer2DCommandManager::MakeDefaultTextures()
 	{
 		std::array<Array<Texture::IDType>, Graphics::TextureSlotCount> result;
 		
@@ -22,28 +22,34 @@
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/Graphics.hpp>
 # include <Siv3D/Texture.hpp>
-# include <Siv3D/Renderer/D3D11/D3D11.hpp>
-# include "D3D11Renderer2DCommand.hpp"
+# include "Renderer2DCommand.hpp"
 # include <Siv3D/Renderer2D/BatchStateTracker.hpp>
+# include <Siv3D/Renderer2D/Renderer2DCommandReorder.hpp>
 
 namespace s3d
 {
-	class D3D11Renderer2DCommandManager
+	/// @brief 2D 描画のコマンドと、コマンドが参照するステートを記録する。各バックエンドの CRenderer2D で共通して使う
+	class Renderer2DCommandManager
 	{
 	public:
 
-		D3D11Renderer2DCommandManager();
+		Renderer2DCommandManager();
 
 		void reset();
 
 		void flush();
 
-		const Array<D3D11Renderer2DCommand>& getCommands() const noexcept;
+		const Array<Renderer2DCommand>& getCommands() const noexcept;
+
+		/// @brief 重ならない Draw コマンドを並べ替えて結合します。
+		/// @param buffer CPU 側の頂点・インデックス配列
+		/// @return 削減された Draw コマンドの数
+		uint32 reorderDraws(const Renderer2DBufferView& buffer);
 
 		void pushUpdateBuffers(uint32 batchIndex);
 
 		void pushDraw(Vertex2D::IndexType indexCount);
-		const D3D11DrawCommand& getDraw(uint32 index) const noexcept;
+		const Renderer2DDrawCommand& getDraw(uint32 index) const noexcept;
 
 		void pushColorMul(const Float4& color);
 		const Float4& getColorMul(uint32 index) const;
@@ -113,13 +119,13 @@ namespace s3d
 
 	private:
 
-		Array<D3D11Renderer2DCommand> m_commands;
+		Array<Renderer2DCommand> m_commands;
 
-		BatchStateTracker<D3D11Renderer2DCommandType> m_stateTracker;
+		BatchStateTracker<Renderer2DCommandType> m_stateTracker;
 
 		struct Buffer
 		{
-			Array<D3D11DrawCommand> draws;
+			Array<Renderer2DDrawCommand> draws;
 
 			Array<Float4> colorMuls					= { Float4{ 1.0f, 1.0f, 1.0f, 1.0f } };
 			
@@ -155,7 +161,7 @@ namespace s3d
 
 		struct Current
 		{
-			D3D11DrawCommand draw;
+			Renderer2DDrawCommand draw;
 
 			Float4 colorMul						= Float4{ 1.0f, 1.0f, 1.0f, 1.0f };
 			
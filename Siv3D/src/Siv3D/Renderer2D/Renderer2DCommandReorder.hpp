@@ -0,0 +1,315 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/Graphics.hpp>
+# include <Siv3D/ScopeExit.hpp>
+# include <Siv3D/DrawCallReorder.hpp>
+
+namespace s3d
+{
+	/// @brief 描画コマンドの並べ替えに使う、CPU 側の頂点・インデックス配列
+	struct Renderer2DBufferView
+	{
+		struct BatchOffset
+		{
+			/// @brief バッチの先頭の頂点の、頂点配列の中の位置
+			uint32 vertexOffset = 0;
+
+			/// @brief バッチの先頭のインデックスの、インデックス配列の中の位置
+			uint32 indexOffset = 0;
+		};
+
+		std::span<const Vertex2D> vertices;
+
+		std::span<Vertex2D::IndexType> indices;
+
+		Array<BatchOffset> batches;
+	};
+
+	/// @brief 2D 描画コマンド列の並べ替え
+	/// @remark D3D11 / Metal / ソフトウェアの各バックエンドが共通で使う Renderer2DCommandManager から呼ばれます。
+	namespace Renderer2DCommandReorder
+	{
+		/// @brief 並べ替えで入れ替えてよいステート（頂点シェーダ、ピクセルシェーダ、ブレンドステート、ピクセルシェーダのテクスチャ）の数
+		inline constexpr size_t KeyStateCount = (3 + Graphics::TextureSlotCount);
+
+		/// @brief 同じステートを探すときに、さかのぼるステートの種類の数
+		inline constexpr size_t MaxStateSearch = 64;
+
+		using KeyStates = std::array<uint32, KeyStateCount>;
+
+		template <class CommandType>
+		[[nodiscard]]
+		constexpr int32 GetKeySlot(const CommandType type) noexcept
+		{
+			switch (type)
+			{
+			case CommandType::SetVS:
+				return 0;
+			case CommandType::SetPS:
+				return 1;
+			case CommandType::BlendState:
+				return 2;
+			default:
+				if ((CommandType::PSTexture0 <= type) && (type <= CommandType::PSTexture7))
+				{
+					return static_cast<int32>(3 + FromEnum(type) - FromEnum(CommandType::PSTexture0));
+				}
+
+				return -1;
+			}
+		}
+
+		template <class CommandType>
+		[[nodiscard]]
+		constexpr CommandType GetKeyCommand(const size_t slot) noexcept
+		{
+			switch (slot)
+			{
+			case 0:
+				return CommandType::SetVS;
+			case 1:
+				return CommandType::SetPS;
+			case 2:
+				return CommandType::BlendState;
+			default:
+				return ToEnum<CommandType>(static_cast<uint32>(FromEnum(CommandType::PSTexture0) + (slot - 3)));
+			}
+		}
+
+		/// @brief 2 つのステートのインデックスが、同じ値を指しているかを返します。
+		template <class CommandManager>
+		[[nodiscard]]
+		bool IsSameState(const CommandManager& commandManager, const size_t slot, const uint32 a, const uint32 b)
+		{
+			if (a == b)
+			{
+				return true;
+			}
+
+			switch (slot)
+			{
+			case 0:
+				return (commandManager.getVS(a) == commandManager.getVS(b));
+			case 1:
+				return (commandManager.getPS(a) == commandManager.getPS(b));
+			case 2:
+				return (commandManager.getBlendState(a) == commandManager.getBlendState(b));
+			default:
+				return (commandManager.getPSTexture(static_cast<uint32>(slot - 3), a) == commandManager.getPSTexture(static_cast<uint32>(slot - 3), b));
+			}
+		}
+
+		/// @brief 描画コマンド列の中の、入れ替えてよいステートと Draw だけが続く区間で、Draw を並べ替えて統合します。
+		/// @param commands コマンド列
+		/// @param draws Draw コマンドの配列。統合された Draw のインデックス数が書き換えられます。
+		/// @param commandManager ステートの値を取得するコマンドマネージャ
+		/// @param buffer CPU 側の頂点・インデックス配列。並べ替えた順にインデックスが書き換えられます。
+		/// @return 削減された Draw コマンドの数
+		/// @remark バウンディングボックスは座標変換前の頂点座標で求めます。区間内では座標変換が変わらないので、重ならない図形は座標変換後も重なりません。
+		template <class Command, class DrawCommand, class CommandManager>
+		uint32 Reorder(Array<Command>& commands, Array<DrawCommand>& draws, const CommandManager& commandManager, const Renderer2DBufferView& buffer)
+		{
+			using CommandType = decltype(Command::type);
+
+			struct DrawEntry
+			{
+				uint32 drawIndex;
+
+				uint32 indexStart;
+
+				uint32 indexCount;
+
+				KeyStates states;
+			};
+
+			Array<Command> result;
+			result.reserve(commands.size());
+
+			Array<DrawEntry> entries;
+			Array<DrawCallInfo> drawCalls;
+			Array<KeyStates> distinctStates;
+			Array<Vertex2D::IndexType> indexBuffer;
+
+			KeyStates current{};
+			KeyStates runStartStates{};
+			size_t runBegin = 0;
+			uint32 vertexOffset = 0;
+			uint32 indexPos = 0;
+			uint32 saved = 0;
+
+			const auto flushRun = [&](const size_t runEnd)
+				{
+					ScopeExit clear = [&]()
+						{
+							entries.clear();
+						};
+
+					// A, B, A のように 3 つ以上の Draw が無ければ統合できない
+					if (entries.size() < 3)
+					{
+						result.insert(result.end(), (commands.begin() + runBegin), (commands.begin() + runEnd));
+						return;
+					}
+
+					drawCalls.clear();
+					distinctStates.clear();
+
+					for (const auto& entry : entries)
+					{
+						FloatRect bounds{ Math::InfF, Math::InfF, -Math::InfF, -Math::InfF };
+
+						for (const auto index : buffer.indices.subspan(entry.indexStart, entry.indexCount))
+						{
+							const Float2 pos = buffer.vertices[vertexOffset + index].pos;
+							bounds.left = Min(bounds.left, pos.x);
+							bounds.top = Min(bounds.top, pos.y);
+							bounds.right = Max(bounds.right, pos.x);
+							bounds.bottom = Max(bounds.bottom, pos.y);
+						}
+
+						// 値が同じステートには同じ ID を割り当てる
+						uint32 stateID = static_cast<uint32>(distinctStates.size());
+
+						for (size_t k = distinctStates.size(), end = ((MaxStateSearch < k) ? (k - MaxStateSearch) : 0); end < k; --k)
+						{
+							const KeyStates& states = distinctStates[k - 1];
+							bool same = true;
+
+							for (size_t slot = 0; (slot < KeyStateCount) && same; ++slot)
+							{
+								same = IsSameState(commandManager, slot, states[slot], entry.states[slot]);
+							}
+
+							if (same)
+							{
+								stateID = static_cast<uint32>(k - 1);
+								break;
+							}
+						}
+
+						if (stateID == distinctStates.size())
+						{
+							distinctStates.push_back(entry.states);
+						}
+
+						drawCalls.push_back(DrawCallInfo{ stateID, bounds, entry.indexCount });
+					}
+
+					const DrawCallReorderResult reordered = DrawCallReorder::Reorder(drawCalls);
+
+					if (reordered.numSaved() == 0)
+					{
+						result.insert(result.end(), (commands.begin() + runBegin), (commands.begin() + runEnd));
+						return;
+					}
+
+					// インデックスを並べ替えた順に書き換える（区間内の Draw のインデックスは連続している）
+					{
+						const uint32 runIndexStart = entries.front().indexStart;
+						const uint32 runIndexCount = ((entries.back().indexStart + entries.back().indexCount) - runIndexStart);
+						const auto runIndices = buffer.indices.subspan(runIndexStart, runIndexCount);
+						indexBuffer.assign(runIndices.begin(), runIndices.end());
+
+						Vertex2D::IndexType* pDst = runIndices.data();
+
+						for (const auto i : reordered.order)
+						{
+							const DrawEntry& entry = entries[i];
+							std::memcpy(pDst, (indexBuffer.data() + (entry.indexStart - runIndexStart)), (entry.indexCount * sizeof(Vertex2D::IndexType)));
+							pDst += entry.indexCount;
+						}
+					}
+
+					// 統合した Draw ごとに、必要なステートのコマンドだけを発行する
+					KeyStates emitted = runStartStates;
+
+					for (const auto& drawCall : reordered.drawCalls)
+					{
+						const DrawEntry& entry = entries[reordered.order[drawCall.first]];
+
+						for (size_t slot = 0; slot < KeyStateCount; ++slot)
+						{
+							if (not IsSameState(commandManager, slot, emitted[slot], entry.states[slot]))
+							{
+								result.emplace_back(GetKeyCommand<CommandType>(slot), entry.states[slot]);
+								emitted[slot] = entry.states[slot];
+							}
+						}
+
+						draws[entry.drawIndex].indexCount = drawCall.indexCount;
+						result.emplace_back(CommandType::Draw, entry.drawIndex);
+					}
+
+					// 区間の後のコマンドのために、元のコマンド列と同じステートに戻す
+					for (size_t slot = 0; slot < KeyStateCount; ++slot)
+					{
+						if (not IsSameState(commandManager, slot, emitted[slot], current[slot]))
+						{
+							result.emplace_back(GetKeyCommand<CommandType>(slot), current[slot]);
+						}
+					}
+
+					saved += static_cast<uint32>(reordered.numSaved());
+				};
+
+			for (size_t i = 0; i < commands.size(); ++i)
+			{
+				const Command command = commands[i];
+
+				if (command.type == CommandType::Draw)
+				{
+					const uint32 indexCount = draws[command.index].indexCount;
+					entries.push_back(DrawEntry{ command.index, indexPos, indexCount, current });
+					indexPos += indexCount;
+					continue;
+				}
+
+				if (const int32 slot = GetKeySlot(command.type);
+					0 <= slot)
+				{
+					current[slot] = command.index;
+					continue;
+				}
+
+				// それ以外のコマンドは並べ替えの区切りになる
+				flushRun(i);
+				result.push_back(command);
+
+				// Metal のように、1 フレームを 1 つのバッチで描くバックエンドには UpdateBuffers が無い
+				if constexpr (requires { CommandType::UpdateBuffers; })
+				{
+					if (command.type == CommandType::UpdateBuffers)
+					{
+						vertexOffset = buffer.batches[command.index].vertexOffset;
+						indexPos = buffer.batches[command.index].indexOffset;
+					}
+				}
+
+				runBegin = (i + 1);
+				runStartStates = current;
+			}
+
+			flushRun(commands.size());
+
+			if (saved)
+			{
+				commands = std::move(result);
+			}
+
+			return saved;
+		}
+	}
+}
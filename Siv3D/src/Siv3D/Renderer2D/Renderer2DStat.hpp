@@ -0,0 +1,29 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	/// @brief 1 フレームの 2D 描画の統計情報
+	struct Renderer2DStat
+	{
+		/// @brief Draw コール回数
+		uint32 drawCalls = 0;
+
+		/// @brief 描画された三角形の数
+		uint32 triangleCount = 0;
+
+		/// @brief 並べ替えによって削減された Draw コール回数
+		uint32 drawCallsSaved = 0;
+	};
+}
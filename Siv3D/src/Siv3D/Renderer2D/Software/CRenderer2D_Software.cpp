@@ -0,0 +1,1015 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "CRenderer2D_Software.hpp"
+# include <Siv3D/ScopeExit.hpp>
+# include <Siv3D/Mat3x2.hpp>
+# include <Siv3D/LineStyle.hpp>
+# include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/Scene.hpp>
+# include <Siv3D/Pattern/PatternParameters.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include <Siv3D/Renderer2DCommandList.hpp>
+# include <Siv3D/EngineLog.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		[[nodiscard]]
+		static Rect Intersect(const Rect& a, const Rect& b) noexcept
+		{
+			const int32 x0 = Max(a.x, b.x);
+			const int32 y0 = Max(a.y, b.y);
+			const int32 x1 = Min((a.x + a.w), (b.x + b.w));
+			const int32 y1 = Min((a.y + a.h), (b.y + b.h));
+			return{ x0, y0, Max((x1 - x0), 0), Max((y1 - y0), 0) };
+		}
+	}
+
+	struct SoftwareCommandState
+	{
+		SoftwareBatchInfo2D batchInfo;
+
+		SoftwareRasterizerState rasterizerState;
+
+		Optional<Rect> scissorRect;
+
+		Rect viewport{ 0, 0, 0, 0 };
+
+		Mat3x2 transform = Mat3x2::Identity();
+
+		void update()
+		{
+			// D3D11 / Metal バックエンドの Transform * Screen とビューポート変換をまとめて、ピクセル座標に直接変換する
+			rasterizerState.transform = (transform * Mat3x2::Translate(viewport.pos));
+			rasterizerState.clipRect = (scissorRect ? Intersect(viewport, *scissorRect) : viewport);
+		}
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	CRenderer2D_Software::~CRenderer2D_Software()
+	{
+		LOG_SCOPED_DEBUG("CRenderer2D_Software::~CRenderer2D_Software()");
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	init
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::init()
+	{
+		LOG_SCOPED_DEBUG("CRenderer2D_Software::init()");
+
+		m_renderTarget = Image{ Scene::DefaultSceneSize, Scene::DefaultBackgroundColor.toColor() };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addLine
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addLine(const LineCap startCap, const LineCap endCap, const Float2& start, const Float2& end, float thickness, const Float4(&colors)[2])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLine(std::bind_front(&CRenderer2D_Software::createBuffer, this), startCap, endCap, start, end, thickness, colors, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addLine(const LineStyle& style, const Float2& start, const Float2& end, float thickness, const Float4(&colors)[2])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLine(std::bind_front(&CRenderer2D_Software::createBuffer, this), style, start, end, thickness, colors, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addTriangle
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addTriangle(const Float2(&points)[3], const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(std::bind_front(&CRenderer2D_Software::createBuffer, this), points, color))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addTriangle(const Float2(&points)[3], const Float4(&colors)[3])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(std::bind_front(&CRenderer2D_Software::createBuffer, this), points, colors))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addTriangle(const Float2(&points)[3], const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(std::bind_front(&CRenderer2D_Software::createBuffer, this), points, pattern.primaryColor))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addRect(const FloatRect& rect, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(std::bind_front(&CRenderer2D_Software::createBuffer, this), rect, color))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addRect(const FloatRect& rect, const Float4(&colors)[4])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(std::bind_front(&CRenderer2D_Software::createBuffer, this), rect, colors))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addRect(const FloatRect& rect, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(std::bind_front(&CRenderer2D_Software::createBuffer, this), rect, pattern.primaryColor))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRects
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addRects(const std::span<const FloatRect> rects, const std::span<const Float4> colors)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_Software::createBuffer, this);
+
+		// 1 回のバッファ確保に収まるだけの長方形をまとめて構築し、1 つの描画コマンドにする
+		for (size_t i = 0; i < rects.size();)
+		{
+			const auto [indexCount, count] = Vertex2DBuilder::BuildRects(bufferCreator, rects, colors, i);
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			i += count;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRectFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addRectFrame(const FloatRect& innerRect, const float thickness, const Float4& color0, const Float4& color1, const ColorFillDirection colorType)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this), innerRect, thickness, colorType, color0, color1))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addRectFrame(const FloatRect& innerRect, const float thickness, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this), innerRect, thickness, ColorFillDirection::InOut, pattern.primaryColor, pattern.primaryColor))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircle
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addCircle(const Float2& center, const float r, const Float4& color0, const Float4& color1, const ColorFillDirection colorType)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircle(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, r, colorType, color0, color1, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addCircle(const Float2& center, const float r, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircle(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, r, ColorFillDirection::InOut, pattern.primaryColor, pattern.primaryColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircles
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addCircles(const std::span<const Float2> centers, const std::span<const float> rs, const std::span<const Float4> colors)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_Software::createBuffer, this);
+		const float scale = getMaxScaling();
+
+		// 1 回のバッファ確保に収まるだけの円をまとめて構築し、1 つの描画コマンドにする
+		for (size_t i = 0; i < centers.size();)
+		{
+			const auto [indexCount, count] = Vertex2DBuilder::BuildCircles(bufferCreator, centers, rs, colors, scale, i);
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			i += count;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircleFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, rInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addCircleFrame(const Float2& center, const float rInner, const float thickness, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, rInner, thickness, pattern.primaryColor, pattern.primaryColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCirclePie
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addCirclePie(const Float2& center, const float r, const float startAngle, const float angle, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCirclePie(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, r, startAngle, angle, innerColor, outerColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addCirclePie(const Float2& center, const float r, const float startAngle, const float angle, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCirclePie(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, r, startAngle, angle, pattern.primaryColor, pattern.primaryColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircleArc
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addCircleArc(const LineCap lineCap, const Float2& center, const float rInner, const float startAngle, const float angle, const float thickness, const Float4& color0, const Float4& color1, ColorFillDirection colorType)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleArc(std::bind_front(&CRenderer2D_Software::createBuffer, this), lineCap, center, rInner, startAngle, angle, thickness, colorType, color0, color1, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addCircleArc(const LineCap lineCap, const Float2& center, const float rInner, const float startAngle, const float angle, const float thickness, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleArc(std::bind_front(&CRenderer2D_Software::createBuffer, this), lineCap, center, rInner, startAngle, angle, thickness, ColorFillDirection::InOut, pattern.primaryColor, pattern.primaryColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircleSegment
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addCircleSegment(const Float2& center, const float r, const float startAngle, const float angle, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleSegment(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, r, startAngle, angle, color, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addCircleSegment(const Float2& center, const float r, const float startAngle, const float angle, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleSegment(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, r, startAngle, angle, pattern.primaryColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addEllipse
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addEllipse(const Float2& center, const float a, const float b, const Float4& color0, const Float4& color1, const ColorFillDirection colorType)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipse(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, a, b, colorType, color0, color1, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addEllipse(const Float2& center, const float a, const float b, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipse(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, a, b, ColorFillDirection::InOut, pattern.primaryColor, pattern.primaryColor, getMaxScaling()))
+		{
+			
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addEllipseFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addEllipseFrame(const Float2& center, const float aInner, const float bInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipseFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, aInner, bInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addEllipseFrame(const Float2& center, const float aInner, const float bInner, const float thickness, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipseFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this), center, aInner, bInner, thickness, pattern.primaryColor, pattern.primaryColor, getMaxScaling()))
+		{
+			
+			
+			
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addQuad
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addQuad(const FloatQuad& quad, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(std::bind_front(&CRenderer2D_Software::createBuffer, this), quad, color))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addQuad(const FloatQuad& quad, const Float4(&colors)[4])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(std::bind_front(&CRenderer2D_Software::createBuffer, this), quad, colors))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addQuad(const FloatQuad& quad, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(std::bind_front(&CRenderer2D_Software::createBuffer, this), quad, pattern.primaryColor))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRoundRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addRoundRect(const FloatRect& rect, const float r, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(std::bind_front(&CRenderer2D_Software::createBuffer, this), rect, r, color, getMaxScaling()))
+		{
+			
+			
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRect(const FloatRect& rect, const float r, const Float4& color0, const Float4& color1, const ColorFillDirection colorType)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(std::bind_front(&CRenderer2D_Software::createBuffer, this), rect, r, colorType, color0, color1, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRect(const FloatRect& rect, const float r, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(std::bind_front(&CRenderer2D_Software::createBuffer, this), rect, r, pattern.primaryColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRoundRectFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addRoundRectFrame(const FloatRect& innerRect, const float innerR, const FloatRect& outerRect, const float outerR, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this),
+			innerRect, innerR, outerRect, outerR, color, getMaxScaling()))
+		{
+			
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRectFrame(const FloatRect& innerRect, const float innerR, const FloatRect& outerRect, const float outerR, const Float4& color0, const Float4& color1, const ColorFillDirection colorType)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this),
+			innerRect, innerR, outerRect, outerR, colorType, color0, color1, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRectFrame(const FloatRect& innerRect, const float innerR, const FloatRect& outerRect, const float outerR, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(std::bind_front(&CRenderer2D_Software::createBuffer, this),
+			innerRect, innerR, outerRect, outerR, pattern.primaryColor, getMaxScaling()))
+		{
+			
+			
+			
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addPolygon
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addPolygon(const std::span<const Float2> vertices, const std::span<const TriangleIndex> triangleIndices, const Optional<Float2>& offset, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(std::bind_front(&CRenderer2D_Software::createBuffer, this), vertices, triangleIndices, offset, color))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addPolygon(const std::span<const Float2> vertices, const std::span<const TriangleIndex> triangleIndices, const Optional<Float2>& offset, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(std::bind_front(&CRenderer2D_Software::createBuffer, this), vertices, triangleIndices, offset, pattern.primaryColor))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addPolygon(const std::span<const Float2> vertices, const std::span<const Vertex2D::IndexType> indices, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(std::bind_front(&CRenderer2D_Software::createBuffer, this), vertices, indices, color))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addPolygon(const std::span<const Float2> vertices, const std::span<const Vertex2D::IndexType> indices, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(std::bind_front(&CRenderer2D_Software::createBuffer, this), vertices, indices, pattern.primaryColor))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addLineString
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addLineString(const LineCap startCap, const LineCap endCap, const std::span<const Vec2> points, const Optional<Float2>& offset, const float thickness, const bool inner, const CloseRing closeRing, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLineString(std::bind_front(&CRenderer2D_Software::createBuffer, this), startCap, endCap, points, offset, thickness, inner, closeRing, color, getMaxScaling()))
+		{
+			
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addLineString(const LineCap startCap, const LineCap endCap, const std::span<const Vec2> points, const Optional<Float2>& offset, const float thickness, const bool inner, const Float4& colorStart, const Float4& colorEnd)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLineString(std::bind_front(&CRenderer2D_Software::createBuffer, this), startCap, endCap, points, offset, thickness, inner, colorStart, colorEnd, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addLineString(const LineCap startCap, const LineCap endCap, const std::span<const Vec2> points, const Optional<Float2>& offset, const float thickness, const bool inner, const CloseRing closeRing, const PatternParameters& pattern)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLineString(std::bind_front(&CRenderer2D_Software::createBuffer, this), startCap, endCap, points, offset, thickness, inner, closeRing, pattern.primaryColor, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addLineString(const LineCap startCap, const LineCap endCap, const std::span<const Vec2> points, const Optional<Float2>& offset, const float thickness, const bool inner, const CloseRing closeRing, const std::span<const ColorF> colors)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLineString(std::bind_front(&CRenderer2D_Software::createBuffer, this), startCap, endCap, points, offset, thickness, inner, closeRing, colors, getMaxScaling()))
+		{
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addTexturedCircle
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addTexturedCircle(const Texture& texture, const Circle& circle, const FloatRect& uv, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedCircle(std::bind_front(&CRenderer2D_Software::createBuffer, this), circle, uv, color, getMaxScaling()))
+		{
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addTexturedQuad
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addTexturedQuad(const Texture& texture, const FloatQuad& quad, const FloatRect& uv, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedQuad(std::bind_front(&CRenderer2D_Software::createBuffer, this), quad, uv, color))
+		{
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addTexturedQuad(const Texture& texture, const FloatQuad& quad, const FloatRect& uv, const Float4(&colors)[4])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedQuad(std::bind_front(&CRenderer2D_Software::createBuffer, this), quad, uv, colors))
+		{
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addTexturedRoundRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addTexturedRoundRect(const Texture& texture, const FloatRect& rect, const float w, const float h, const float r, const FloatRect& uvRect, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedRoundRect(std::bind_front(&CRenderer2D_Software::createBuffer, this), rect, w, h, r, uvRect, color, getMaxScaling()))
+		{
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addQuadWarp
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addQuadWarp(const Texture& texture, const FloatRect& uv, const FloatQuad& quad, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedQuad(std::bind_front(&CRenderer2D_Software::createBuffer, this), quad, uv, color))
+		{
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Software::addQuadWarp(const Texture& texture, const FloatRect& uv, const FloatQuad& quad, const Float4(&colors)[4])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedQuad(std::bind_front(&CRenderer2D_Software::createBuffer, this), quad, uv, colors))
+		{
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCommandList
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::addCommandList(const Renderer2DCommandList& commandList)
+	{
+		const auto bufferCreator = std::bind_front(&CRenderer2D_Software::createBuffer, this);
+		const std::span<const Vertex2D> vertices = commandList.getVertices();
+		const std::span<const Vertex2D::IndexType> indices = commandList.getIndices();
+
+		// 記録されたバッチを、記録順にそのまま描画コマンドに追加する
+		for (const auto& batch : commandList.getBatches())
+		{
+			const auto indexCount = Vertex2DBuilder::BuildVertices(bufferCreator,
+				vertices.subspan(batch.vertexOffset, batch.vertexCount), indices.subspan(batch.indexOffset, batch.indexCount));
+
+			if (not indexCount)
+			{
+				break;
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::flush()
+	{
+		ScopeExit cleanUp = [this]()
+		{
+			m_vertexBufferManager2D.reset();
+			m_commandManager.reset();
+		};
+
+		m_commandManager.flush();
+
+		if (m_drawCallReordering)
+		{
+			m_stat.drawCallsSaved += m_commandManager.reorderDraws(m_vertexBufferManager2D.getBufferView());
+		}
+
+		m_rasterizer.begin(m_renderTarget);
+
+		const Rect renderTargetRect{ 0, 0, m_renderTarget.width(), m_renderTarget.height() };
+
+		SoftwareCommandState commandState;
+		commandState.viewport = renderTargetRect;
+		commandState.update();
+
+		for (const auto& command : m_commandManager.getCommands())
+		{
+			switch (command.type)
+			{
+			case Renderer2DCommandType::UpdateBuffers:
+				{
+					commandState.batchInfo = m_vertexBufferManager2D.commitBuffers(command.index);
+					break;
+				}
+			case Renderer2DCommandType::Draw:
+				{
+					const Renderer2DDrawCommand& draw = m_commandManager.getDraw(command.index);
+					const uint32 indexCount = draw.indexCount;
+					const Vertex2D::IndexType* pIndex = (commandState.batchInfo.pIndex + commandState.batchInfo.startIndexLocation);
+
+					m_rasterizer.addTriangles(commandState.rasterizerState, commandState.batchInfo.pVertex, pIndex, indexCount);
+					commandState.batchInfo.startIndexLocation += indexCount;
+
+					++m_stat.drawCalls;
+					m_stat.triangleCount += (indexCount / 3);
+					break;
+				}
+			case Renderer2DCommandType::ColorMul:
+				{
+					commandState.rasterizerState.colorMul = m_commandManager.getColorMul(command.index);
+					break;
+				}
+			case Renderer2DCommandType::ColorAdd:
+				{
+					commandState.rasterizerState.colorAdd = m_commandManager.getColorAdd(command.index);
+					break;
+				}
+			case Renderer2DCommandType::BlendState:
+				{
+					commandState.rasterizerState.blendState = m_commandManager.getBlendState(command.index);
+					break;
+				}
+			case Renderer2DCommandType::RasterizerState:
+				{
+					commandState.rasterizerState.cullMode = m_commandManager.getRasterizerState(command.index).cullMode;
+					break;
+				}
+			case Renderer2DCommandType::ScissorRect:
+				{
+					commandState.scissorRect = m_commandManager.getScissorRect(command.index);
+					commandState.update();
+					break;
+				}
+			case Renderer2DCommandType::Viewport:
+				{
+					const auto& viewport = m_commandManager.getViewport(command.index);
+					commandState.viewport = viewport.value_or(renderTargetRect);
+					commandState.update();
+					break;
+				}
+			case Renderer2DCommandType::Transform:
+				{
+					commandState.transform = m_commandManager.getCombinedTransform(command.index);
+					commandState.update();
+					break;
+				}
+			default:
+				// シェーダ、テクスチャ、サンプラーに関するコマンドは使わない
+				break;
+			}
+		}
+
+		m_rasterizer.execute();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getColorMul, setColorMul
+	//
+	////////////////////////////////////////////////////////////////
+
+	Float4 CRenderer2D_Software::getColorMul() const
+	{
+		return m_commandManager.getCurrentColorMul();
+	}
+
+	void CRenderer2D_Software::setColorMul(const Float4& color)
+	{
+		m_commandManager.pushColorMul(color);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getColorAdd, setColorAdd
+	//
+	////////////////////////////////////////////////////////////////
+
+	Float3 CRenderer2D_Software::getColorAdd() const
+	{
+		return m_commandManager.getCurrentColorAdd();
+	}
+
+	void CRenderer2D_Software::setColorAdd(const Float3& color)
+	{
+		m_commandManager.pushColorAdd(color);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getBlendState, setBlendState
+	//
+	////////////////////////////////////////////////////////////////
+
+	BlendState CRenderer2D_Software::getBlendState() const
+	{
+		return m_commandManager.getCurrentBlendState();
+	}
+
+	void CRenderer2D_Software::setBlendState(const BlendState& state)
+	{
+		m_commandManager.pushBlendState(state);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getRasterizerState, setRasterizerState
+	//
+	////////////////////////////////////////////////////////////////
+
+	RasterizerState CRenderer2D_Software::getRasterizerState() const
+	{
+		return m_commandManager.getCurrentRasterizerState();
+	}
+
+	void CRenderer2D_Software::setRasterizerState(const RasterizerState& state)
+	{
+		m_commandManager.pushRasterizerState(state);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getVSSamplerState, setVSSamplerState
+	//
+	////////////////////////////////////////////////////////////////
+
+	SamplerState CRenderer2D_Software::getVSSamplerState(const uint32 slot) const
+	{
+		return m_commandManager.getCurrentVSSamplerState(slot);
+	}
+
+	void CRenderer2D_Software::setVSSamplerState(const uint32 slot, const SamplerState& state)
+	{
+		m_commandManager.pushVSSamplerState(state, slot);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getPSSamplerState, setPSSamplerState
+	//
+	////////////////////////////////////////////////////////////////
+
+	SamplerState CRenderer2D_Software::getPSSamplerState(const uint32 slot) const
+	{
+		return m_commandManager.getCurrentPSSamplerState(slot);
+	}
+
+	void CRenderer2D_Software::setPSSamplerState(const uint32 slot, const SamplerState& state)
+	{
+		m_commandManager.pushPSSamplerState(state, slot);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getScissorRect, setScissorRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<Rect> CRenderer2D_Software::getScissorRect() const
+	{
+		return m_commandManager.getCurrentScissorRect();
+	}
+
+	void CRenderer2D_Software::setScissorRect(const Optional<Rect>& rect)
+	{
+		m_commandManager.pushScissorRect(rect);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getViewport, setViewport
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<Rect> CRenderer2D_Software::getViewport() const
+	{
+		return m_commandManager.getCurrentViewport();
+	}
+
+	void CRenderer2D_Software::setViewport(const Optional<Rect>& viewport)
+	{
+		m_commandManager.pushViewport(viewport);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getLocalTransform, setLocalTransform
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Mat3x2& CRenderer2D_Software::getLocalTransform() const
+	{
+		return m_commandManager.getCurrentLocalTransform();
+	}
+
+	void CRenderer2D_Software::setLocalTransform(const Mat3x2& matrix)
+	{
+		m_commandManager.pushLocalTransform(matrix);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getCameraTransform, setCameraTransform
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Mat3x2& CRenderer2D_Software::getCameraTransform() const
+	{
+		return m_commandManager.getCurrentCameraTransform();
+	}
+
+	void CRenderer2D_Software::setCameraTransform(const Mat3x2& matrix)
+	{
+		m_commandManager.pushCameraTransform(matrix);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getMaxScaling
+	//
+	////////////////////////////////////////////////////////////////
+
+	float CRenderer2D_Software::getMaxScaling() const noexcept
+	{
+		return m_commandManager.getCurrentMaxScaling();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Renderer2DStat& CRenderer2D_Software::getStat() const noexcept
+	{
+		return m_stat;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setDrawCallReorderingEnabled, isDrawCallReorderingEnabled
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::setDrawCallReorderingEnabled(const bool enabled)
+	{
+		m_drawCallReordering = enabled;
+	}
+
+	bool CRenderer2D_Software::isDrawCallReorderingEnabled() const noexcept
+	{
+		return m_drawCallReordering;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	beginFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Software::beginFrame()
+	{
+		m_stat = {};
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getRenderTarget, resizeRenderTarget, clearRenderTarget
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Image& CRenderer2D_Software::getRenderTarget() const noexcept
+	{
+		return m_renderTarget;
+	}
+
+	void CRenderer2D_Software::resizeRenderTarget(const Size& size)
+	{
+		m_renderTarget.resize(size);
+	}
+
+	void CRenderer2D_Software::clearRenderTarget(const ColorF& color)
+	{
+		m_renderTarget.fill(color.toColor());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Vertex2DBufferPointer CRenderer2D_Software::createBuffer(const uint16 vertexCount, const uint32 indexCount)
+	{
+		return m_vertexBufferManager2D.requestBuffer(vertexCount, indexCount, m_commandManager);
+	}
+}
@@ -0,0 +1,528 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cmath>
+# include <bit>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include "SoftwareRasterizer.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		using Edge		= SoftwareRasterizer::Edge;
+
+		using Triangle	= SoftwareRasterizer::Triangle;
+
+		/// @brief 頂点シェーダ (VS_Shape) とピクセルシェーダ (PS_Shape) のうち、頂点ごとに計算できる部分を適用します。
+		/// @remark colorAdd の加算は頂点色について線形なので、補間前に適用しても結果は変わりません。
+		[[nodiscard]]
+		static Float4 ShadeVertex(const Float4& color, const Float4& colorMul, const Float3& colorAdd) noexcept
+		{
+			const float a = (color.w * colorMul.w);
+			const float r = (color.x * colorMul.x * a);
+			const float g = (color.y * colorMul.y * a);
+			const float b = (color.z * colorMul.z * a);
+			return{ (r + colorAdd.x * a), (g + colorAdd.y * a), (b + colorAdd.z * a), a };
+		}
+
+		/// @brief 点 a から点 b へのエッジを作成します。
+		[[nodiscard]]
+		static Edge MakeEdge(const Float2& a, const Float2& b) noexcept
+		{
+			// 共有されるエッジが隣接する三角形で符号だけが異なる同じ値になるよう、端点の順序を正規化する
+			const bool swapped = ((b.y < a.y) || ((b.y == a.y) && (b.x < a.x)));
+			const Float2& o = (swapped ? b : a);
+			const Float2& t = (swapped ? a : b);
+
+			const float dx = (b.x - a.x);
+			const float dy = (b.y - a.y);
+
+			return{
+				.ox			= o.x,
+				.oy			= o.y,
+				.dx			= (t.x - o.x),
+				.dy			= (t.y - o.y),
+				.sign		= (swapped ? -1.0f : 1.0f),
+				.topLeft	= ((dy < 0.0f) || ((dy == 0.0f) && (0.0f < dx))),
+			};
+		}
+
+		[[nodiscard]]
+		static float EvaluateEdge(const Edge& edge, const float x, const float y) noexcept
+		{
+			return (edge.sign * ((edge.dx * (y - edge.oy)) - (edge.dy * (x - edge.ox))));
+		}
+
+		/// @brief 三角形が矩形内のいずれかのピクセル中心を含む可能性があるかを返します。
+		[[nodiscard]]
+		static bool Overlaps(const Triangle& triangle, const int32 x0, const int32 y0, const int32 x1, const int32 y1) noexcept
+		{
+			const float left	= (x0 + 0.5f);
+			const float top		= (y0 + 0.5f);
+			const float right	= (x1 - 0.5f);
+			const float bottom	= (y1 - 0.5f);
+
+			for (const auto& edge : triangle.edges)
+			{
+				// エッジ関数は線形なので、最大値は矩形の角のいずれかで得られる
+				const float e = Max(Max(EvaluateEdge(edge, left, top), EvaluateEdge(edge, right, top)),
+					Max(EvaluateEdge(edge, left, bottom), EvaluateEdge(edge, right, bottom)));
+
+				if (e < 0.0f)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		/// @brief 横に並んだ 4 ピクセルのカバレッジを求めます。
+		/// @param triangle 三角形
+		/// @param rowTerms 各エッジの dx * (y - oy)
+		/// @param x 左端のピクセル中心の X 座標
+		/// @param weights 各エッジのエッジ関数の値の格納先
+		/// @return ピクセルが三角形に含まれる場合にビットが立つマスク
+		[[nodiscard]]
+		static uint32 CoverageMask4(const Triangle& triangle, const float(&rowTerms)[3], const float x, float(&weights)[3][4]) noexcept
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128 px = _mm_add_ps(_mm_set1_ps(x), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+			const __m128 zero = _mm_setzero_ps();
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+			for (size_t i = 0; i < 3; ++i)
+			{
+				const Edge& edge = triangle.edges[i];
+				const __m128 t = _mm_mul_ps(_mm_set1_ps(edge.dy), _mm_sub_ps(px, _mm_set1_ps(edge.ox)));
+				const __m128 e = _mm_mul_ps(_mm_set1_ps(edge.sign), _mm_sub_ps(_mm_set1_ps(rowTerms[i]), t));
+				inside = _mm_and_ps(inside, (edge.topLeft ? _mm_cmpge_ps(e, zero) : _mm_cmpgt_ps(e, zero)));
+				_mm_storeu_ps(weights[i], e);
+			}
+
+			return static_cast<uint32>(_mm_movemask_ps(inside));
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const float lanes[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+			const float32x4_t px = vaddq_f32(vdupq_n_f32(x), vld1q_f32(lanes));
+			const float32x4_t zero = vdupq_n_f32(0.0f);
+			uint32x4_t inside = vdupq_n_u32(0xFFFFFFFF);
+
+			for (size_t i = 0; i < 3; ++i)
+			{
+				const Edge& edge = triangle.edges[i];
+				const float32x4_t t = vmulq_f32(vdupq_n_f32(edge.dy), vsubq_f32(px, vdupq_n_f32(edge.ox)));
+				const float32x4_t e = vmulq_f32(vdupq_n_f32(edge.sign), vsubq_f32(vdupq_n_f32(rowTerms[i]), t));
+				inside = vandq_u32(inside, (edge.topLeft ? vcgeq_f32(e, zero) : vcgtq_f32(e, zero)));
+				vst1q_f32(weights[i], e);
+			}
+
+			const uint32 bits[4] = { 1, 2, 4, 8 };
+			return vaddvq_u32(vandq_u32(inside, vld1q_u32(bits)));
+
+		# else
+
+			uint32 mask = 0b1111;
+
+			for (size_t i = 0; i < 3; ++i)
+			{
+				const Edge& edge = triangle.edges[i];
+
+				for (uint32 lane = 0; lane < 4; ++lane)
+				{
+					const float e = (edge.sign * (rowTerms[i] - (edge.dy * ((x + lane) - edge.ox))));
+					const bool in = (edge.topLeft ? (0.0f <= e) : (0.0f < e));
+					mask &= ~(static_cast<uint32>(not in) << lane);
+					weights[i][lane] = e;
+				}
+			}
+
+			return mask;
+
+		# endif
+		}
+
+		[[nodiscard]]
+		static Float4 ToFloat4(const Color& color) noexcept
+		{
+			constexpr float s = (1.0f / 255.0f);
+			return{ (color.r * s), (color.g * s), (color.b * s), (color.a * s) };
+		}
+
+		[[nodiscard]]
+		static uint8 ToUNorm8(const float value) noexcept
+		{
+			return static_cast<uint8>(Clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+		}
+
+		/// @brief ブレンド係数を返します。
+		/// @remark ブレンドカラーとデュアルソースブレンドには対応しないため、それらの係数は 1 として扱います。
+		[[nodiscard]]
+		static Float4 GetBlendFactor(const BlendFactor factor, const Float4& src, const Float4& dst) noexcept
+		{
+			switch (factor)
+			{
+			case BlendFactor::Zero:
+				return{ 0.0f, 0.0f, 0.0f, 0.0f };
+			case BlendFactor::SourceColor:
+				return src;
+			case BlendFactor::OneMinusSourceColor:
+				return{ (1.0f - src.x), (1.0f - src.y), (1.0f - src.z), (1.0f - src.w) };
+			case BlendFactor::SourceAlpha:
+				return{ src.w, src.w, src.w, src.w };
+			case BlendFactor::OneMinusSourceAlpha:
+				return{ (1.0f - src.w), (1.0f - src.w), (1.0f - src.w), (1.0f - src.w) };
+			case BlendFactor::DestinationAlpha:
+				return{ dst.w, dst.w, dst.w, dst.w };
+			case BlendFactor::OneMinusDestinationAlpha:
+				return{ (1.0f - dst.w), (1.0f - dst.w), (1.0f - dst.w), (1.0f - dst.w) };
+			case BlendFactor::DestinationColor:
+				return dst;
+			case BlendFactor::OneMinusDestinationColor:
+				return{ (1.0f - dst.x), (1.0f - dst.y), (1.0f - dst.z), (1.0f - dst.w) };
+			case BlendFactor::SourceAlphaSaturated:
+				{
+					const float f = Min(src.w, (1.0f - dst.w));
+					return{ f, f, f, 1.0f };
+				}
+			default:
+				return{ 1.0f, 1.0f, 1.0f, 1.0f };
+			}
+		}
+
+		[[nodiscard]]
+		static float ApplyBlendOperation(const BlendOperation op, const float src, const float srcFactor, const float dst, const float dstFactor) noexcept
+		{
+			switch (op)
+			{
+			case BlendOperation::Subtract:
+				return ((src * srcFactor) - (dst * dstFactor));
+			case BlendOperation::ReverseSubtract:
+				return ((dst * dstFactor) - (src * srcFactor));
+			case BlendOperation::Min:
+				return Min(src, dst);
+			case BlendOperation::Max:
+				return Max(src, dst);
+			default:
+				return ((src * srcFactor) + (dst * dstFactor));
+			}
+		}
+
+		/// @brief ピクセルシェーダの出力をレンダーターゲットにブレンドします。
+		static void BlendPixel(Color& pixel, const Float4& color, const BlendState& blendState) noexcept
+		{
+			// UNORM のレンダーターゲットでは、ブレンドの前に出力が [0, 1] に丸められる
+			const Float4 src{ Clamp(color.x, 0.0f, 1.0f), Clamp(color.y, 0.0f, 1.0f), Clamp(color.z, 0.0f, 1.0f), Clamp(color.w, 0.0f, 1.0f) };
+
+			Float4 result;
+
+			if (not blendState.enabled)
+			{
+				result = src;
+			}
+			else if ((blendState.sourceRGB == BlendFactor::One)
+				&& (blendState.destinationRGB == BlendFactor::OneMinusSourceAlpha)
+				&& (blendState.rgbOperation == BlendOperation::Add)
+				&& (blendState.sourceAlpha == BlendFactor::Zero)
+				&& (blendState.destinationAlpha == BlendFactor::One)
+				&& (blendState.alphaOperation == BlendOperation::Add))
+			{
+				// BlendState::Default2D
+				const Float4 dst = ToFloat4(pixel);
+				const float t = (1.0f - src.w);
+				result = { (src.x + dst.x * t), (src.y + dst.y * t), (src.z + dst.z * t), dst.w };
+			}
+			else
+			{
+				const Float4 dst = ToFloat4(pixel);
+				const Float4 srcRGB = GetBlendFactor(blendState.sourceRGB, src, dst);
+				const Float4 dstRGB = GetBlendFactor(blendState.destinationRGB, src, dst);
+				const float srcAlpha = GetBlendFactor(blendState.sourceAlpha, src, dst).w;
+				const float dstAlpha = GetBlendFactor(blendState.destinationAlpha, src, dst).w;
+
+				result.x = ApplyBlendOperation(blendState.rgbOperation, src.x, srcRGB.x, dst.x, dstRGB.x);
+				result.y = ApplyBlendOperation(blendState.rgbOperation, src.y, srcRGB.y, dst.y, dstRGB.y);
+				result.z = ApplyBlendOperation(blendState.rgbOperation, src.z, srcRGB.z, dst.z, dstRGB.z);
+				result.w = ApplyBlendOperation(blendState.alphaOperation, src.w, srcAlpha, dst.w, dstAlpha);
+			}
+
+			if (blendState.writeR)
+			{
+				pixel.r = ToUNorm8(result.x);
+			}
+
+			if (blendState.writeG)
+			{
+				pixel.g = ToUNorm8(result.y);
+			}
+
+			if (blendState.writeB)
+			{
+				pixel.b = ToUNorm8(result.z);
+			}
+
+			if (blendState.writeA)
+			{
+				pixel.a = ToUNorm8(result.w);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	begin
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRasterizer::begin(Image& renderTarget)
+	{
+		m_renderTarget = &renderTarget;
+		m_numTilesX = ((renderTarget.width() + TileSize - 1) / TileSize);
+		m_numTilesY = ((renderTarget.height() + TileSize - 1) / TileSize);
+
+		m_triangles.clear();
+		m_blendStates.clear();
+		m_bins.resize(static_cast<size_t>(m_numTilesX) * m_numTilesY);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addTriangles
+	//
+	////////////////////////////////////////////////////////////////
+
+	uint32 SoftwareRasterizer::addTriangles(const SoftwareRasterizerState& state, const Vertex2D* pVertex, const Vertex2D::IndexType* pIndex, const uint32 indexCount)
+	{
+		if ((not m_renderTarget)
+			|| (state.clipRect.w <= 0)
+			|| (state.clipRect.h <= 0))
+		{
+			return 0;
+		}
+
+		if (m_blendStates.isEmpty() || (m_blendStates.back() != state.blendState))
+		{
+			m_blendStates.push_back(state.blendState);
+		}
+
+		const uint32 blendStateIndex = static_cast<uint32>(m_blendStates.size() - 1);
+		const int32 clipX0 = Max(state.clipRect.x, 0);
+		const int32 clipY0 = Max(state.clipRect.y, 0);
+		const int32 clipX1 = Min((state.clipRect.x + state.clipRect.w), m_renderTarget->width());
+		const int32 clipY1 = Min((state.clipRect.y + state.clipRect.h), m_renderTarget->height());
+		uint32 count = 0;
+
+		for (uint32 i = 0; (i + 2) < indexCount; i += 3)
+		{
+			const Vertex2D& v0 = pVertex[pIndex[i]];
+			const Vertex2D& v1 = pVertex[pIndex[i + 1]];
+			const Vertex2D& v2 = pVertex[pIndex[i + 2]];
+
+			std::array<Float2, 3> p = { state.transform.transformPoint(v0.pos), state.transform.transformPoint(v1.pos), state.transform.transformPoint(v2.pos) };
+
+			// y 軸が下向きのピクセル座標で、時計回りの三角形が正の面積を持つ
+			float area = (((p[1].x - p[0].x) * (p[2].y - p[0].y)) - ((p[1].y - p[0].y) * (p[2].x - p[0].x)));
+
+			if ((area == 0.0f) || (not std::isfinite(area)))
+			{
+				continue;
+			}
+
+			// 時計回りを表面とする
+			if (((state.cullMode == CullMode::Back) && (area < 0.0f))
+				|| ((state.cullMode == CullMode::Front) && (0.0f < area)))
+			{
+				continue;
+			}
+
+			Triangle triangle;
+			triangle.colors = { ShadeVertex(v0.color, state.colorMul, state.colorAdd), ShadeVertex(v1.color, state.colorMul, state.colorAdd), ShadeVertex(v2.color, state.colorMul, state.colorAdd) };
+
+			if (area < 0.0f)
+			{
+				std::swap(p[1], p[2]);
+				std::swap(triangle.colors[1], triangle.colors[2]);
+				area = -area;
+			}
+
+			// 画面外の巨大な座標で int32 への変換があふれないよう、浮動小数点数のままクリップ範囲に収める
+			const float left	= std::ceil(Min(Min(p[0].x, p[1].x), p[2].x) - 0.5f);
+			const float top		= std::ceil(Min(Min(p[0].y, p[1].y), p[2].y) - 0.5f);
+			const float right	= (std::floor(Max(Max(p[0].x, p[1].x), p[2].x) - 0.5f) + 1.0f);
+			const float bottom	= (std::floor(Max(Max(p[0].y, p[1].y), p[2].y) - 0.5f) + 1.0f);
+			triangle.minX = static_cast<int32>(Clamp(left, static_cast<float>(clipX0), static_cast<float>(clipX1)));
+			triangle.minY = static_cast<int32>(Clamp(top, static_cast<float>(clipY0), static_cast<float>(clipY1)));
+			triangle.maxX = static_cast<int32>(Clamp(right, static_cast<float>(clipX0), static_cast<float>(clipX1)));
+			triangle.maxY = static_cast<int32>(Clamp(bottom, static_cast<float>(clipY0), static_cast<float>(clipY1)));
+
+			if ((triangle.maxX <= triangle.minX) || (triangle.maxY <= triangle.minY))
+			{
+				continue;
+			}
+
+			triangle.edges = { MakeEdge(p[1], p[2]), MakeEdge(p[2], p[0]), MakeEdge(p[0], p[1]) };
+			triangle.invArea = (1.0f / area);
+			triangle.blendStateIndex = blendStateIndex;
+			triangle.flatColor = ((triangle.colors[0] == triangle.colors[1]) && (triangle.colors[0] == triangle.colors[2]));
+
+			m_triangles.push_back(triangle);
+			++count;
+		}
+
+		return count;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	execute
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRasterizer::execute()
+	{
+		if ((not m_renderTarget) || m_triangles.isEmpty())
+		{
+			return;
+		}
+
+		binTriangles();
+
+		// 各タイルは独立したピクセル領域を持つので、ロックなしで並列に描画できる
+		Threading::ParallelFor(0, m_bins.size(), [this](const size_t begin, const size_t end)
+			{
+				for (size_t tileIndex = begin; tileIndex < end; ++tileIndex)
+				{
+					rasterizeTile(tileIndex);
+				}
+			}, 1);
+
+		m_triangles.clear();
+		m_blendStates.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRasterizer::binTriangles()
+	{
+		for (auto& bin : m_bins)
+		{
+			bin.clear();
+		}
+
+		const int32 width = m_renderTarget->width();
+		const int32 height = m_renderTarget->height();
+
+		for (uint32 triangleIndex = 0; triangleIndex < m_triangles.size(); ++triangleIndex)
+		{
+			const Triangle& triangle = m_triangles[triangleIndex];
+			const int32 tileX0 = (triangle.minX / TileSize);
+			const int32 tileY0 = (triangle.minY / TileSize);
+			const int32 tileX1 = ((triangle.maxX - 1) / TileSize);
+			const int32 tileY1 = ((triangle.maxY - 1) / TileSize);
+			const bool singleTile = ((tileX0 == tileX1) && (tileY0 == tileY1));
+
+			for (int32 tileY = tileY0; tileY <= tileY1; ++tileY)
+			{
+				for (int32 tileX = tileX0; tileX <= tileX1; ++tileX)
+				{
+					// 細長い三角形がバウンディングボックスだけ重なるタイルを除外する
+					if ((not singleTile)
+						&& (not Overlaps(triangle, (tileX * TileSize), (tileY * TileSize),
+							Min(((tileX + 1) * TileSize), width), Min(((tileY + 1) * TileSize), height))))
+					{
+						continue;
+					}
+
+					m_bins[static_cast<size_t>(tileY) * m_numTilesX + tileX].push_back(triangleIndex);
+				}
+			}
+		}
+	}
+
+	void SoftwareRasterizer::rasterizeTile(const size_t tileIndex) const
+	{
+		const Array<uint32>& bin = m_bins[tileIndex];
+
+		if (bin.isEmpty())
+		{
+			return;
+		}
+
+		const int32 width = m_renderTarget->width();
+		const int32 height = m_renderTarget->height();
+		const int32 tileX0 = (static_cast<int32>(tileIndex % m_numTilesX) * TileSize);
+		const int32 tileY0 = (static_cast<int32>(tileIndex / m_numTilesX) * TileSize);
+		const int32 tileX1 = Min((tileX0 + TileSize), width);
+		const int32 tileY1 = Min((tileY0 + TileSize), height);
+		Color* const pixels = m_renderTarget->data();
+
+		for (const uint32 triangleIndex : bin)
+		{
+			const Triangle& triangle = m_triangles[triangleIndex];
+			const BlendState& blendState = m_blendStates[triangle.blendStateIndex];
+			const int32 x0 = Max(triangle.minX, tileX0);
+			const int32 y0 = Max(triangle.minY, tileY0);
+			const int32 x1 = Min(triangle.maxX, tileX1);
+			const int32 y1 = Min(triangle.maxY, tileY1);
+
+			for (int32 y = y0; y < y1; ++y)
+			{
+				const float py = (y + 0.5f);
+				const float rowTerms[3] =
+				{
+					(triangle.edges[0].dx * (py - triangle.edges[0].oy)),
+					(triangle.edges[1].dx * (py - triangle.edges[1].oy)),
+					(triangle.edges[2].dx * (py - triangle.edges[2].oy)),
+				};
+				Color* const line = (pixels + static_cast<size_t>(y) * width);
+
+				for (int32 x = x0; x < x1; x += 4)
+				{
+					float weights[3][4];
+					uint32 mask = CoverageMask4(triangle, rowTerms, (x + 0.5f), weights);
+
+					if (x1 < (x + 4))
+					{
+						mask &= ((1u << (x1 - x)) - 1);
+					}
+
+					while (mask)
+					{
+						const int32 lane = std::countr_zero(mask);
+						mask &= (mask - 1);
+
+						if (triangle.flatColor)
+						{
+							BlendPixel(line[x + lane], triangle.colors[0], blendState);
+						}
+						else
+						{
+							const float w0 = (weights[0][lane] * triangle.invArea);
+							const float w1 = (weights[1][lane] * triangle.invArea);
+							const float w2 = (weights[2][lane] * triangle.invArea);
+							const Float4 color = ((triangle.colors[0] * w0) + (triangle.colors[1] * w1) + (triangle.colors[2] * w2));
+							BlendPixel(line[x + lane], color, blendState);
+						}
+					}
+				}
+			}
+		}
+	}
+}
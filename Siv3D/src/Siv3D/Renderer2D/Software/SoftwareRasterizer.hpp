@@ -0,0 +1,131 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <array>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/Rect.hpp>
+# include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/Mat3x2.hpp>
+# include <Siv3D/BlendState.hpp>
+# include <Siv3D/CullMode.hpp>
+
+namespace s3d
+{
+	/// @brief ソフトウェアラスタライザの描画ステート
+	struct SoftwareRasterizerState
+	{
+		/// @brief 頂点座標をレンダーターゲットのピクセル座標に変換する行列
+		Mat3x2 transform		= Mat3x2::Identity();
+
+		Float4 colorMul			= Float4{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+		Float3 colorAdd			= Float3{ 0.0f, 0.0f, 0.0f };
+
+		BlendState blendState	= BlendState::Default2D;
+
+		CullMode cullMode		= CullMode::None;
+
+		/// @brief 描画可能な領域（ビューポート、シザー矩形、レンダーターゲットの共通部分）
+		Rect clipRect			= Rect{ 0, 0, 0, 0 };
+	};
+
+	/// @brief 三角形リストを Image に描画する、タイル分割方式のエッジ関数ラスタライザ
+	/// @remark 追加された三角形はタイルごとに振り分けられ、タイル単位で並列に描画されます。
+	/// @remark 各タイルの中では追加された順に描画されるため、ブレンドの結果は逐次描画と一致します。
+	class SoftwareRasterizer
+	{
+	public:
+
+		/// @brief タイルの一辺のピクセル数
+		static constexpr int32 TileSize = 64;
+
+		/// @brief 描画を開始します。
+		/// @param renderTarget レンダーターゲット
+		/// @remark execute() を呼ぶまで、renderTarget を破棄・リサイズしてはいけません。
+		void begin(Image& renderTarget);
+
+		/// @brief 三角形リストを追加します。
+		/// @param state 描画ステート
+		/// @param pVertex 頂点配列
+		/// @param pIndex インデックス配列
+		/// @param indexCount インデックスの数
+		/// @return カリング後に残った三角形の数
+		uint32 addTriangles(const SoftwareRasterizerState& state, const Vertex2D* pVertex, const Vertex2D::IndexType* pIndex, uint32 indexCount);
+
+		/// @brief 追加された三角形をすべて描画します。
+		void execute();
+
+		/// @brief エッジ関数 E(p) = sign * (dx * (p.y - oy) - dy * (p.x - ox))
+		/// @remark 隣接する三角形で同じ値が得られるよう、端点の順序を正規化して保持します。
+		struct Edge
+		{
+			float ox = 0.0f;
+
+			float oy = 0.0f;
+
+			float dx = 0.0f;
+
+			float dy = 0.0f;
+
+			float sign = 1.0f;
+
+			/// @brief E(p) == 0 のピクセルを含めるか（トップレフトルール）
+			bool topLeft = false;
+		};
+
+		struct Triangle
+		{
+			/// @brief edges[i] は頂点 i の対辺
+			std::array<Edge, 3> edges;
+
+			/// @brief 乗算済みアルファの頂点色
+			std::array<Float4, 3> colors;
+
+			float invArea = 0.0f;
+
+			int32 minX = 0;
+
+			int32 minY = 0;
+
+			/// @brief 描画範囲の右端（この値を含まない）
+			int32 maxX = 0;
+
+			/// @brief 描画範囲の下端（この値を含まない）
+			int32 maxY = 0;
+
+			uint32 blendStateIndex = 0;
+
+			bool flatColor = false;
+		};
+
+	private:
+
+		Image* m_renderTarget = nullptr;
+
+		int32 m_numTilesX = 0;
+
+		int32 m_numTilesY = 0;
+
+		Array<Triangle> m_triangles;
+
+		Array<BlendState> m_blendStates;
+
+		/// @brief タイルごとの三角形のインデックス
+		Array<Array<uint32>> m_bins;
+
+		void binTriangles();
+
+		void rasterizeTile(size_t tileIndex) const;
+	};
+}
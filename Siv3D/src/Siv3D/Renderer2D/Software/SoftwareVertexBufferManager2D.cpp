@@ -0,0 +1,196 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "SoftwareVertexBufferManager2D.hpp"
+# include <Siv3D/Renderer2D/Renderer2DCommandManager.hpp>
+# include <Siv3D/EngineLog.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		static void Resize(Array<Vertex2D>& vertexArray, const size_t vertexArrayWritePosTarget)
+		{
+			const size_t newVertexArraySize = std::bit_ceil(vertexArrayWritePosTarget);
+			
+			LOG_TRACE(fmt::format("ℹ️ Resized SoftwareVertexBufferManager2D::m_vertexArray (size: {} -> {})", vertexArray.size(), newVertexArraySize));
+			
+			vertexArray.resize(newVertexArraySize);
+		}
+
+		static void Resize(Array<Vertex2D::IndexType>& indexArray, const size_t indexArrayWritePosTarget)
+		{
+			const size_t newIndexArraySize = std::bit_ceil(indexArrayWritePosTarget);
+
+			LOG_TRACE(fmt::format("ℹ️ Resized SoftwareVertexBufferManager2D::m_indexArray (size: {} -> {})", indexArray.size(), newIndexArraySize));
+
+			indexArray.resize(newIndexArraySize);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	SoftwareVertexBufferManager2D::SoftwareVertexBufferManager2D()
+		: m_vertexArray(InitialVertexArraySize)
+		, m_indexArray(InitialIndexArraySize)
+		, m_batches(1) {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	requestBuffer
+	//
+	////////////////////////////////////////////////////////////////
+
+	Vertex2DBufferPointer SoftwareVertexBufferManager2D::requestBuffer(const uint16 vertexCount, const uint32 indexCount, Renderer2DCommandManager& commandManager)
+	{
+		// VB
+		{
+			const uint32 vertexArrayWritePosTarget = (m_vertexArrayWritePos + vertexCount);
+
+			if (m_vertexArray.size() < vertexArrayWritePosTarget)
+			{
+				if (MaxVertexArraySize < vertexArrayWritePosTarget)
+				{
+					return{ nullptr, 0, 0 };
+				}
+
+				Resize(m_vertexArray, vertexArrayWritePosTarget);
+			}
+		}
+
+		// IB
+		{
+			const uint32 indexArrayWritePosTarget = (m_indexArrayWritePos + indexCount);
+
+			if (m_indexArray.size() < indexArrayWritePosTarget)
+			{
+				if (MaxIndexArraySize < indexArrayWritePosTarget)
+				{
+					return{ nullptr, 0, 0 };
+				}
+
+				Resize(m_indexArray, indexArrayWritePosTarget);
+			}
+		}
+		
+		BatchBufferPos* pLastBatch = &m_batches.back();
+		{
+			if ((VertexBufferSize < (pLastBatch->vertexPos + vertexCount)
+				|| (IndexBufferSize < (pLastBatch->indexPos + indexCount))))
+			{
+				commandManager.pushUpdateBuffers(static_cast<uint32>(m_batches.size()));
+				m_batches.emplace_back();
+				pLastBatch = &m_batches.back();
+			}
+		}
+
+		const Vertex2DBufferPointer result
+		{
+			.pVertex		= (m_vertexArray.data() + m_vertexArrayWritePos),
+			.pIndex			= (m_indexArray.data() + m_indexArrayWritePos),
+			.indexOffset	= static_cast<Vertex2D::IndexType>(pLastBatch->vertexPos),
+		};
+
+		m_vertexArrayWritePos	+= vertexCount;
+		m_indexArrayWritePos	+= indexCount;
+
+		pLastBatch->vertexPos	+= vertexCount;
+		pLastBatch->indexPos	+= indexCount;
+
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_batches
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t SoftwareVertexBufferManager2D::num_batches() const noexcept
+	{
+		return m_batches.size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	reset
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareVertexBufferManager2D::reset()
+	{
+		m_batches.assign(1, BatchBufferPos{});
+		m_vertexArrayWritePos	= 0;
+		m_indexArrayWritePos	= 0;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	commitBuffers
+	//
+	////////////////////////////////////////////////////////////////
+
+	SoftwareBatchInfo2D SoftwareVertexBufferManager2D::commitBuffers(const size_t batchIndex) const
+	{
+		assert(batchIndex < m_batches.size());
+
+		size_t vertexArrayReadPos	= 0;
+		size_t indexArrayReadPos	= 0;
+
+		for (size_t i = 0; i < batchIndex; ++i)
+		{
+			const auto& batch	= m_batches[i];
+			vertexArrayReadPos	+= batch.vertexPos;
+			indexArrayReadPos	+= batch.indexPos;
+		}
+
+		// GPU へのコピーは不要なので、CPU 側の配列の位置をそのまま返す
+		return{
+			.pVertex			= (m_vertexArray.data() + vertexArrayReadPos),
+			.pIndex				= (m_indexArray.data() + indexArrayReadPos),
+			.indexCount			= m_batches[batchIndex].indexPos,
+			.startIndexLocation	= 0,
+		};
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getBufferView
+	//
+	////////////////////////////////////////////////////////////////
+
+	Renderer2DBufferView SoftwareVertexBufferManager2D::getBufferView()
+	{
+		Renderer2DBufferView view{
+			.vertices	= std::span{ m_vertexArray.data(), m_vertexArrayWritePos },
+			.indices	= std::span{ m_indexArray.data(), m_indexArrayWritePos },
+			.batches	= {},
+		};
+
+		view.batches.reserve(m_batches.size());
+
+		uint32 vertexOffset	= 0;
+		uint32 indexOffset	= 0;
+
+		for (const auto& batch : m_batches)
+		{
+			view.batches.push_back({ vertexOffset, indexOffset });
+			vertexOffset	+= batch.vertexPos;
+			indexOffset		+= batch.indexPos;
+		}
+
+		return view;
+	}
+}
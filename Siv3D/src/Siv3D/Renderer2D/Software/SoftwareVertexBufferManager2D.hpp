@@ -0,0 +1,87 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBufferPointer.hpp>
+# include <Siv3D/Renderer2D/Renderer2DCommandReorder.hpp>
+
+namespace s3d
+{
+	class Renderer2DCommandManager;
+
+	/// @brief ソフトウェアレンダラーのバッチ情報
+	struct SoftwareBatchInfo2D
+	{
+		/// @brief バッチの先頭の頂点
+		const Vertex2D* pVertex = nullptr;
+
+		/// @brief バッチの先頭のインデックス
+		const Vertex2D::IndexType* pIndex = nullptr;
+
+		/// @brief バッチ内のインデックスの数
+		uint32 indexCount = 0;
+
+		/// @brief 次の Draw コマンドが使う、バッチ内のインデックスの開始位置
+		uint32 startIndexLocation = 0;
+	};
+
+	/// @brief ソフトウェアレンダラー用の頂点バッファ管理
+	/// @remark GPU バッファを持たず、CPU 側の頂点・インデックス配列をそのままラスタライザに渡します。
+	class SoftwareVertexBufferManager2D
+	{
+	public:
+
+		SoftwareVertexBufferManager2D();
+
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer(uint16 vertexCount, uint32 indexCount, Renderer2DCommandManager& commandManager);
+
+		[[nodiscard]]
+		size_t num_batches() const noexcept;
+
+		void reset();
+
+		[[nodiscard]]
+		SoftwareBatchInfo2D commitBuffers(size_t batchIndex) const;
+
+		[[nodiscard]]
+		Renderer2DBufferView getBufferView();
+
+	private:
+
+		static constexpr uint32 InitialVertexArraySize	= (1 << 12);	// 4,096
+		static constexpr uint32 InitialIndexArraySize	= (1 << 15);	// 32,768
+
+		static constexpr uint32 MaxVertexArraySize		= (1 << 22);	// 4,194,304
+		static constexpr uint32 MaxIndexArraySize		= (1 << 22);	// 4,194,304
+
+		// インデックスは 16-bit なので、バッチあたりの頂点数は GPU バックエンドと同じ上限を持つ
+		static constexpr uint32 VertexBufferSize		= 65535;
+		static constexpr uint32 IndexBufferSize			= ((VertexBufferSize + 1) * 4); // 262,144
+
+		struct BatchBufferPos
+		{
+			uint32 vertexPos	= 0;
+
+			uint32 indexPos		= 0;
+		};
+
+		Array<Vertex2D> m_vertexArray;
+		uint32 m_vertexArrayWritePos	= 0;
+
+		Array<Vertex2D::IndexType> m_indexArray;
+		uint32 m_indexArrayWritePos		= 0;
+		
+		Array<BatchBufferPos> m_batches;
+	};
+}
@@ -25,6 +25,16 @@ namespace s3d
 	struct FloatQuad;
 	enum class LineCap : uint8;
 
+	/// @brief 複数の図形をまとめて構築した結果
+	struct Vertex2DBatchResult
+	{
+		/// @brief 構築したインデックスの数
+		Vertex2D::IndexType indexCount = 0;
+
+		/// @brief 構築した図形の数
+		size_t count = 0;
+	};
+
 	namespace Vertex2DBuilder
 	{
 		[[nodiscard]]
@@ -45,12 +55,23 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRect(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, const Float4(&colors)[4]);
 
+		/// @brief rects[first] 以降の長方形を、1 回のバッファ確保に収まるだけまとめて構築します。
+		/// @param colors 長方形の色。要素数が 1 の場合はすべての長方形に同じ色を使います。
+		[[nodiscard]]
+		Vertex2DBatchResult BuildRects(const BufferCreatorFunc& bufferCreator, std::span<const FloatRect> rects, std::span<const Float4> colors, size_t first);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRectFrame(const BufferCreatorFunc& bufferCreator, const FloatRect& innerRect, float thickness, ColorFillDirection colorType, const Float4& color0, const Float4& color1);
 
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircle(const BufferCreatorFunc& bufferCreator, const Float2& center, float r, ColorFillDirection colorType, const Float4& color0, const Float4& color1, float scale);
 
+		/// @brief centers[first] 以降の円を、1 回のバッファ確保に収まるだけまとめて構築します。
+		/// @param rs 円の半径。要素数が 1 の場合はすべての円に同じ半径を使います。
+		/// @param colors 円の色。要素数が 1 の場合はすべての円に同じ色を使います。
+		[[nodiscard]]
+		Vertex2DBatchResult BuildCircles(const BufferCreatorFunc& bufferCreator, std::span<const Float2> centers, std::span<const float> rs, std::span<const Float4> colors, float scale, size_t first);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircleFrame(const BufferCreatorFunc& bufferCreator, const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor, float scale);
 
@@ -93,6 +114,11 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildPolygon(const BufferCreatorFunc& bufferCreator, std::span<const Float2> vertices, std::span<const Vertex2D::IndexType> indices, const Float4& color);
 
+		/// @brief 作成済みの頂点とインデックスをそのまま書き込みます。
+		/// @remark インデックスは vertices の先頭を 0 とする値です。
+		[[nodiscard]]
+		Vertex2D::IndexType BuildVertices(const BufferCreatorFunc& bufferCreator, std::span<const Vertex2D> vertices, std::span<const Vertex2D::IndexType> indices);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildLineString(const BufferCreatorFunc& bufferCreator, LineCap startCap, LineCap endCap, std::span<const Vec2> points, const Optional<Float2>& offset, float thickness, bool inner, CloseRing closeRing, const Float4& color, float scale);
 
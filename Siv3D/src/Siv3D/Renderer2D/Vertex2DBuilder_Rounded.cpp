@@ -13,6 +13,7 @@
 # include "Vertex2DBuilder.hpp"
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/SIMD.hpp>
 
 namespace s3d
 {
@@ -48,6 +49,256 @@ namespace s3d
 			return ((quality - 1) * quality / 2);
 		}
 
+		/// @brief 全周を quality 等分した単位ベクトル (cos θ, sin θ) の表 (quality = 1, ..., 63)
+		/// @remark GetSinCosTableIndex() で先頭の位置を求めます。
+		static const std::array<Float2, 2016> FullCircleCosSinTable = []()
+		{
+			std::array<Float2, 2016> table;
+
+			Float2* pDst = table.data();
+
+			for (int32 quality = 1; quality <= 63; ++quality)
+			{
+				const float radDelta = (Math::TwoPiF / quality);
+
+				for (int32 i = 0; i < quality; ++i)
+				{
+					const float rad = (radDelta * i);
+					*pDst++ = { std::cos(rad), std::sin(rad) };
+				}
+			}
+
+			return table;
+		}();
+
+		/// @brief 丸い線端の品質の最小値
+		static constexpr Vertex2D::IndexType MinRoundCapQuality = 5;
+
+		/// @brief 丸い線端の品質の最大値（CalculateCirclePieQuality(r, π) の上限）
+		static constexpr Vertex2D::IndexType MaxRoundCapQuality = 127;
+
+		/// @brief 半周を (quality - 1) 等分した単位ベクトル (sin θ, -cos θ) の表 (quality = 5, ..., 127)
+		/// @remark GetRoundCapTableIndex() で先頭の位置を求めます。
+		static const std::array<Float2, 8118> RoundCapTable = []()
+		{
+			std::array<Float2, 8118> table;
+
+			Float2* pDst = table.data();
+
+			for (int32 quality = MinRoundCapQuality; quality <= MaxRoundCapQuality; ++quality)
+			{
+				const float radDelta = (Math::PiF / (quality - 1));
+
+				for (int32 i = 0; i < quality; ++i)
+				{
+					const float rad = (radDelta * i);
+					*pDst++ = { std::sin(rad), -std::cos(rad) };
+				}
+			}
+
+			return table;
+		}();
+
+		[[nodiscard]]
+		static constexpr size_t GetRoundCapTableIndex(const Vertex2D::IndexType quality)
+		{
+			return (((quality - 1) * quality / 2) - ((MinRoundCapQuality - 1) * MinRoundCapQuality / 2));
+		}
+
+		/// @brief 円弧の頂点を一度に求める角度の数
+		static constexpr size_t ArcBlockSize = 64;
+
+		/// @brief 円弧上の単位ベクトル (sin θ, -cos θ) を、θ = startAngle + radDelta * i (i = 0, ..., count - 1) について求めます。
+		/// @param dst 結果の格納先
+		/// @param startAngle 開始角度
+		/// @param radDelta 角度の間隔
+		/// @param count 求める単位ベクトルの数。ArcBlockSize 以下である必要があります。
+		/// @remark 先頭の 4 つだけ三角関数で求め、以降は 4 つずつ radDelta * 4 の回転を繰り返して求めます。
+		static void GenerateArcDirections(Float2* dst, const float startAngle, const float radDelta, const size_t count) noexcept
+		{
+			float s[4], c[4];
+
+			for (size_t k = 0; k < 4; ++k)
+			{
+				std::tie(s[k], c[k]) = FastMath::SinCos(startAngle + (radDelta * k));
+			}
+
+			const auto [stepS, stepC] = FastMath::SinCos(radDelta * 4);
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			__m128 vs = _mm_loadu_ps(s);
+			__m128 vc = _mm_loadu_ps(c);
+			const __m128 rs = _mm_set1_ps(stepS);
+			const __m128 rc = _mm_set1_ps(stepC);
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+			for (size_t i = 0; i < count; i += 4)
+			{
+				// [s0, -c0, s1, -c1], [s2, -c2, s3, -c3]
+				const __m128 nc = _mm_xor_ps(vc, signMask);
+				const __m128 lo = _mm_unpacklo_ps(vs, nc);
+				const __m128 hi = _mm_unpackhi_ps(vs, nc);
+
+				if ((i + 4) <= count)
+				{
+					_mm_storeu_ps(&dst[i].x, lo);
+					_mm_storeu_ps(&dst[i + 2].x, hi);
+				}
+				else
+				{
+					Float2 tail[4];
+					_mm_storeu_ps(&tail[0].x, lo);
+					_mm_storeu_ps(&tail[2].x, hi);
+					std::copy_n(tail, (count - i), (dst + i));
+				}
+
+				// sin(θ + φ) = sin θ cos φ + cos θ sin φ, cos(θ + φ) = cos θ cos φ - sin θ sin φ
+				const __m128 nextS = _mm_add_ps(_mm_mul_ps(vs, rc), _mm_mul_ps(vc, rs));
+				vc = _mm_sub_ps(_mm_mul_ps(vc, rc), _mm_mul_ps(vs, rs));
+				vs = nextS;
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			float32x4_t vs = vld1q_f32(s);
+			float32x4_t vc = vld1q_f32(c);
+
+			for (size_t i = 0; i < count; i += 4)
+			{
+				const float32x4x2_t zipped = vzipq_f32(vs, vnegq_f32(vc));
+
+				if ((i + 4) <= count)
+				{
+					vst1q_f32(&dst[i].x, zipped.val[0]);
+					vst1q_f32(&dst[i + 2].x, zipped.val[1]);
+				}
+				else
+				{
+					Float2 tail[4];
+					vst1q_f32(&tail[0].x, zipped.val[0]);
+					vst1q_f32(&tail[2].x, zipped.val[1]);
+					std::copy_n(tail, (count - i), (dst + i));
+				}
+
+				const float32x4_t nextS = vmlaq_n_f32(vmulq_n_f32(vs, stepC), vc, stepS);
+				vc = vmlsq_n_f32(vmulq_n_f32(vc, stepC), vs, stepS);
+				vs = nextS;
+			}
+
+		# else
+
+			for (size_t i = 0; i < count; i += 4)
+			{
+				for (size_t k = 0; ((k < 4) && ((i + k) < count)); ++k)
+				{
+					dst[i + k].set(s[k], -c[k]);
+				}
+
+				for (size_t k = 0; k < 4; ++k)
+				{
+					const float nextS = (s[k] * stepC + c[k] * stepS);
+					c[k] = (c[k] * stepC - s[k] * stepS);
+					s[k] = nextS;
+				}
+			}
+
+		# endif
+		}
+
+		/// @brief 単位ベクトルに半径を掛けて中心座標を足した位置を、頂点の pos に書き込みます。
+		/// @param pVertex 最初の頂点
+		/// @param stride 頂点の間隔
+		/// @param directions 単位ベクトル
+		/// @param count 単位ベクトルの数
+		/// @param center 中心座標
+		/// @param r 半径
+		static void WriteArcPositions(Vertex2D* pVertex, const size_t stride, const Float2* directions, const size_t count, const Float2& center, const float r) noexcept
+		{
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128 c = _mm_setr_ps(center.x, center.y, center.x, center.y);
+			const __m128 vr = _mm_set1_ps(r);
+
+			for (; (i + 2) <= count; i += 2)
+			{
+				const __m128 pos = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&directions[i].x), vr), c);
+				_mm_storel_pi(reinterpret_cast<__m64*>(&pVertex[i * stride].pos.x), pos);
+				_mm_storeh_pi(reinterpret_cast<__m64*>(&pVertex[(i + 1) * stride].pos.x), pos);
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const float32x2_t c = vld1_f32(&center.x);
+
+			for (; (i + 2) <= count; i += 2)
+			{
+				const float32x4_t pos = vmlaq_n_f32(vcombine_f32(c, c), vld1q_f32(&directions[i].x), r);
+				vst1_f32(&pVertex[i * stride].pos.x, vget_low_f32(pos));
+				vst1_f32(&pVertex[(i + 1) * stride].pos.x, vget_high_f32(pos));
+			}
+
+		# endif
+
+			for (; i < count; ++i)
+			{
+				pVertex[i * stride].pos.set((center.x + directions[i].x * r), (center.y + directions[i].y * r));
+			}
+		}
+
+		/// @brief 円弧上の頂点の位置を書き込みます。
+		/// @param pVertex 最初の頂点。角度 i, 半径 radii[k] の頂点は pVertex[i * radii.size() + k] です。
+		/// @param center 中心座標
+		/// @param radii 半径
+		/// @param startAngle 開始角度
+		/// @param radDelta 角度の間隔
+		/// @param count 角度の数
+		static void WriteArcVertices(Vertex2D* pVertex, const Float2& center, const std::initializer_list<float> radii, const float startAngle, const float radDelta, const size_t count) noexcept
+		{
+			Float2 directions[ArcBlockSize];
+
+			for (size_t first = 0; first < count; first += ArcBlockSize)
+			{
+				const size_t blockSize = Min((count - first), ArcBlockSize);
+
+				GenerateArcDirections(directions, (startAngle + radDelta * first), radDelta, blockSize);
+
+				size_t k = 0;
+
+				for (const float r : radii)
+				{
+					WriteArcPositions((pVertex + (first * radii.size()) + k++), radii.size(), directions, blockSize, center, r);
+				}
+			}
+		}
+
+		/// @brief 丸い線端の周上の頂点の位置を書き込みます。
+		/// @param pVertex 最初の頂点
+		/// @param center 中心座標
+		/// @param r 半径
+		/// @param startAngle 開始角度
+		/// @param quality 品質
+		/// @return 回転前の単位ベクトル (sin θ, -cos θ) の表
+		static const Float2* WriteRoundCapVertices(Vertex2D* pVertex, const Float2& center, const float r, const float startAngle, const Vertex2D::IndexType quality) noexcept
+		{
+			const Float2* pTable = (RoundCapTable.data() + GetRoundCapTableIndex(quality));
+			const auto [s, c] = FastMath::SinCos(startAngle);
+
+			// (sin θ, -cos θ) を startAngle だけ回転する
+			Float2 directions[MaxRoundCapQuality];
+
+			for (Vertex2D::IndexType i = 0; i < quality; ++i)
+			{
+				directions[i].set((c * pTable[i].x - s * pTable[i].y), (s * pTable[i].x + c * pTable[i].y));
+			}
+
+			WriteArcPositions(pVertex, 1, directions, quality, center, r);
+
+			return pTable;
+		}
+
 		/// @brief 円の品質を計算します。
 		/// @param r 円の半径
 		/// @return 円の品質
@@ -72,6 +323,59 @@ namespace s3d
 			}
 		}
 
+		/// @brief 円の中心からの相対位置に中心の座標を足して、円周上の頂点を書き込みます。
+		/// @param pVertex 頂点の書き込み先
+		/// @param center 円の中心座標
+		/// @param offsets 円周上の頂点の、中心からの相対位置
+		/// @param count 頂点の数。2 の倍数である必要があります。
+		/// @param color 色
+		static void WriteCircleVertices(Vertex2D* pVertex, const Float2& center, const Float2* offsets, const size_t count, const Float4& color) noexcept
+		{
+			float* pDst = &pVertex->pos.x;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128 c = _mm_setr_ps(center.x, center.y, center.x, center.y);
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 col = _mm_loadu_ps(&color.x);
+
+			for (size_t i = 0; i < count; i += 2)
+			{
+				// 2 頂点分の [x0, y0, x1, y1]
+				const __m128 pos = _mm_add_ps(_mm_loadu_ps(&offsets[i].x), c);
+				_mm_storeu_ps((pDst + 0), _mm_movelh_ps(pos, zero));
+				_mm_storeu_ps((pDst + 4), col);
+				_mm_storeu_ps((pDst + 8), _mm_movehl_ps(zero, pos));
+				_mm_storeu_ps((pDst + 12), col);
+				pDst += 16;
+			}
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const float32x2_t c = vld1_f32(&center.x);
+			const float32x2_t zero = vdup_n_f32(0.0f);
+			const float32x4_t col = vld1q_f32(&color.x);
+
+			for (size_t i = 0; i < count; i += 2)
+			{
+				const float32x4_t pos = vaddq_f32(vld1q_f32(&offsets[i].x), vcombine_f32(c, c));
+				vst1q_f32((pDst + 0), vcombine_f32(vget_low_f32(pos), zero));
+				vst1q_f32((pDst + 4), col);
+				vst1q_f32((pDst + 8), vcombine_f32(vget_high_f32(pos), zero));
+				vst1q_f32((pDst + 12), col);
+				pDst += 16;
+			}
+
+		# else
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				pVertex[i].set((center.x + offsets[i].x), (center.y + offsets[i].y), 0.0f, 0.0f, color);
+			}
+
+		# endif
+		}
+
 		[[nodiscard]]
 		constexpr Vertex2D::IndexType CalculateCirclePieQuality(const float r, const float angle)
 		{
@@ -83,7 +387,7 @@ namespace s3d
 		[[nodiscard]]
 		static Vertex2D::IndexType BuildRoundCap(const BufferCreatorFunc& bufferCreator, const Float2& center, const float r, const float startAngle, const Float4& color, const float scale)
 		{
-			const Vertex2D::IndexType Quality = CalculateCirclePieQuality((r * scale), Math::PiF);
+			const Vertex2D::IndexType Quality = Min(CalculateCirclePieQuality((r * scale), Math::PiF), MaxRoundCapQuality);
 			const Vertex2D::IndexType VertexCount = (Quality + 1);
 			const Vertex2D::IndexType IndexCount = ((Quality - 1) * 3);
 			auto [pVertex, pIndex, indexOffset] = bufferCreator(VertexCount, IndexCount);
@@ -100,17 +404,7 @@ namespace s3d
 			pVertex[0].pos.set(centerX, centerY);
 
 			// 周
-			{
-				const float radDelta = (Math::PiF / (Quality - 1));
-				Vertex2D* pDst = &pVertex[1];
-
-				for (Vertex2D::IndexType i = 0; i < Quality; ++i)
-				{
-					const float rad = (startAngle + (radDelta * i));
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set((centerX + r * s), (centerY - r * c));
-				}
-			}
+			WriteRoundCapVertices(&pVertex[1], center, r, startAngle, Quality);
 
 			for (size_t i = 0; i < VertexCount; ++i)
 			{
@@ -130,7 +424,7 @@ namespace s3d
 		[[nodiscard]]
 		static Vertex2D::IndexType BuildRoundCap(const BufferCreatorFunc& bufferCreator, const Float2& center, const float r, const float startAngle, const ColorFillDirection colorType, const Float4& color0, const Float4& color1, const float scale)
 		{
-			const Vertex2D::IndexType Quality = CalculateCirclePieQuality((r * scale), Math::PiF);
+			const Vertex2D::IndexType Quality = Min(CalculateCirclePieQuality((r * scale), Math::PiF), MaxRoundCapQuality);
 			const Vertex2D::IndexType VertexCount = (Quality + 1);
 			const Vertex2D::IndexType IndexCount = ((Quality - 1) * 3);
 			auto [pVertex, pIndex, indexOffset] = bufferCreator(VertexCount, IndexCount);
@@ -146,23 +440,18 @@ namespace s3d
 			const Float4 c1 = color1;
 			const Float4 colorDiff = (c1 - c0);
 
+			// 周
+			const Float2* pTable = WriteRoundCapVertices(&pVertex[1], center, r, startAngle, Quality);
+
 			if (colorType == ColorFillDirection::LeftRight)
 			{
 				// 中心
 				pVertex[0].set(centerX, centerY, c0);
 
-				// 周
+				// 周（f = sin(radDelta * i)）
+				for (Vertex2D::IndexType i = 0; i < Quality; ++i)
 				{
-					const float radDelta = (Math::PiF / (Quality - 1));
-					Vertex2D* pDst = &pVertex[1];
-
-					for (Vertex2D::IndexType i = 0; i < Quality; ++i)
-					{
-						const float rad = (startAngle + (radDelta * i));
-						const float f = std::sin(radDelta * i);
-						const auto [s, c] = FastMath::SinCos(rad);
-						(pDst++)->set((centerX + r * s), (centerY - r * c), (c0 + colorDiff * f));
-					}
+					pVertex[i + 1].color = (c0 + colorDiff * pTable[i].x);
 				}
 			}
 			else
@@ -170,18 +459,10 @@ namespace s3d
 				// 中心
 				pVertex[0].set(centerX, centerY, (c0 + colorDiff * 0.5f));
 
-				// 周
+				// 周（f = cos(radDelta * i) * -0.5 + 0.5）
+				for (Vertex2D::IndexType i = 0; i < Quality; ++i)
 				{
-					const float radDelta = (Math::PiF / (Quality - 1));
-					Vertex2D* pDst = &pVertex[1];
-
-					for (Vertex2D::IndexType i = 0; i < Quality; ++i)
-					{
-						const float rad = (startAngle + (radDelta * i));
-						const float f = (std::cos(radDelta * i) * -0.5f + 0.5f);
-						const auto [s, c] = FastMath::SinCos(rad);
-						(pDst++)->set((centerX + r * s), (centerY - r * c), (c0 + colorDiff * f));
-					}
+					pVertex[i + 1].color = (c0 + colorDiff * (pTable[i].y * 0.5f + 0.5f));
 				}
 			}
 
@@ -262,19 +543,9 @@ namespace s3d
 				}
 
 				{
-					const float centerX = center.x;
-					const float centerY = center.y;
 					const float start = (startAngle + ((angle < 0.0f) ? angle : 0.0f));
 					const float radDelta = (Abs(angle) / (Quality - 1));
-					Vertex2D* pDst = pVertex;
-
-					for (Vertex2D::IndexType i = 0; i < Quality; ++i)
-					{
-						const float rad = (start + (radDelta * i));
-						const auto [s, c] = FastMath::SinCos(rad);
-						(pDst++)->pos.set((centerX + rInner * s), (centerY - rInner * c));
-						(pDst++)->pos.set((centerX + rOuter * s), (centerY - rOuter * c));
-					}
+					WriteArcVertices(pVertex, center, { rInner, rOuter }, start, radDelta, Quality);
 				}
 
 				if (colorType == ColorFillDirection::LeftRight)
@@ -351,19 +622,9 @@ namespace s3d
 			}
 
 			{
-				const float centerX = center.x;
-				const float centerY = center.y;
 				const float start = (startAngle + ((angle < 0.0f) ? angle : 0.0f));
 				const float radDelta = (Abs(angle) / (Quality - 1));
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < Quality; ++i)
-				{
-					const float rad = (start + (radDelta * i));
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set((centerX + rInner * s), (centerY - rInner * c));
-					(pDst++)->pos.set((centerX + rOuter * s), (centerY - rOuter * c));
-				}
+				WriteArcVertices(pVertex, center, { rInner, rOuter }, start, radDelta, Quality);
 			}
 
 			if (colorType == ColorFillDirection::LeftRight)
@@ -1722,6 +1983,116 @@ namespace s3d
 			return IndexCount;
 		}
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		Vertex2DBatchResult BuildCircles(const BufferCreatorFunc& bufferCreator, const std::span<const Float2> centers, const std::span<const float> rs, const std::span<const Float4> colors, const float scale, const size_t first)
+		{
+			const size_t remaining = (centers.size() - first);
+
+			if (remaining == 0)
+			{
+				return{};
+			}
+
+			const bool uniformRadius = (rs.size() == 1);
+			const bool uniformColor = (colors.size() == 1);
+
+			// 1 回のバッファ確保に収まる円の数を求める
+			size_t count = 0;
+			uint32 vertexCount = 0;
+			uint32 indexCount = 0;
+
+			if (uniformRadius)
+			{
+				const uint32 quality = CalculateCircleQuality(Abs(rs.front()) * scale);
+				count = Min<size_t>(remaining, (0xFFFF / (quality * 12)));
+				vertexCount = static_cast<uint32>(count * (quality * 4 + 1));
+				indexCount = static_cast<uint32>(count * (quality * 12));
+			}
+			else
+			{
+				for (; count < remaining; ++count)
+				{
+					const uint32 quality = CalculateCircleQuality(Abs(rs[first + count]) * scale);
+
+					if ((0xFFFF < (vertexCount + (quality * 4 + 1)))
+						|| (0xFFFF < (indexCount + (quality * 12))))
+					{
+						break;
+					}
+
+					vertexCount += (quality * 4 + 1);
+					indexCount += (quality * 12);
+				}
+			}
+
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(static_cast<Vertex2D::IndexType>(vertexCount), static_cast<Vertex2D::IndexType>(indexCount));
+
+			if (not pVertex)
+			{
+				return{};
+			}
+
+			// 円周上の頂点の、中心からの相対位置（同じ半径の円が続く間は再利用する）
+			Float2 offsets[63 * 4];
+			float currentR = -1.0f;
+			Vertex2D::IndexType FullQuality = 0;
+
+			Vertex2D::IndexType vertexPos = 0;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const size_t index = (first + i);
+				const float r = Abs(rs[uniformRadius ? 0 : index]);
+
+				if (r != currentR)
+				{
+					const Vertex2D::IndexType Quality = CalculateCircleQuality(r * scale);
+					const Float2* pCS = (SinCosTable.data() + GetSinCosTableIndex(Quality));
+
+					for (Vertex2D::IndexType k = 0; k < Quality; ++k)
+					{
+						const float x = (pCS[k].x * r);
+						const float y = (pCS[k].y * r);
+						offsets[k].set(x, y);
+						offsets[Quality + k].set(-y, x);
+						offsets[Quality * 2 + k].set(-x, -y);
+						offsets[Quality * 3 + k].set(y, -x);
+					}
+
+					currentR = r;
+					FullQuality = (Quality * 4);
+				}
+
+				const Float2& center = centers[index];
+				const Float4& color = colors[uniformColor ? 0 : index];
+
+				pVertex[vertexPos].set(center, 0.0f, 0.0f, color);
+				WriteCircleVertices((pVertex + vertexPos + 1), center, offsets, FullQuality, color);
+
+				const Vertex2D::IndexType base = static_cast<Vertex2D::IndexType>(indexOffset + vertexPos);
+
+				for (Vertex2D::IndexType k = 0; k < (FullQuality - 1); ++k)
+				{
+					*pIndex++ = base;
+					*pIndex++ = (base + (k + 1));
+					*pIndex++ = (base + (k + 2));
+				}
+
+				*pIndex++ = base;
+				*pIndex++ = (base + FullQuality);
+				*pIndex++ = (base + 1);
+
+				vertexPos += (FullQuality + 1);
+			}
+
+			return{ static_cast<Vertex2D::IndexType>(indexCount), count };
+		}
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	BuildCircleFrame
@@ -1823,14 +2194,7 @@ namespace s3d
 			{
 				const float start = (startAngle + ((angle < 0.0f) ? angle : 0.0f));
 				const float radDelta = (Abs(angle) / (Quality - 1));
-				Vertex2D* pDst = &pVertex[1];
-
-				for (Vertex2D::IndexType i = 0; i < Quality; ++i)
-				{
-					const float rad = (start + (radDelta * i));
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set((centerX + r * s), (centerY - r * c));
-				}
+				WriteArcVertices(&pVertex[1], center, { r }, start, radDelta, Quality);
 			}
 
 			{
@@ -1918,14 +2282,7 @@ namespace s3d
 			{
 				const float start = (startAngle + ((angle < 0.0f) ? angle : 0.0f));
 				const float radDelta = (Abs(angle) / (Quality - 1));
-				Vertex2D* pDst = &pVertex[1];
-
-				for (Vertex2D::IndexType i = 0; i < Quality; ++i)
-				{
-					const float rad = (start + (radDelta * i));
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set((centerX + r * s), (centerY - r * c));
-				}
+				WriteArcVertices(&pVertex[1], center, { r }, start, radDelta, Quality);
 			}
 
 			{
@@ -3036,13 +3393,13 @@ namespace s3d
 
 			// 周
 			{
-				const float radDelta = (Math::TwoPiF / Quality);
+				const Float2* pCS = (FullCircleCosSinTable.data() + GetSinCosTableIndex(Quality));
 				Vertex2D* pDst = &pVertex[1];
 
 				for (Vertex2D::IndexType i = 0; i < Quality; ++i)
 				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
+					const float c = pCS[i].x;
+					const float s = pCS[i].y;
 					(pDst++)->set((centerX + rf * c), (centerY - rf * s), (centerU + rU * c), (centerV - rV * s));
 				}
 			}
@@ -13,6 +13,7 @@
 # include "Vertex2DBuilder.hpp"
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/SIMD.hpp>
 
 namespace s3d
 {
@@ -21,6 +22,60 @@ namespace s3d
 		static constexpr Vertex2D::IndexType RectIndexTable[6] = { 0, 1, 2, 2, 1, 3 };
 
 		static constexpr Vertex2D::IndexType RectFrameIndexTable[24] = { 0, 2, 1, 1, 2, 3, 2, 4, 3, 3, 4, 5, 4, 6, 5, 5, 6, 7, 6, 0, 7, 7, 0, 1 };
+
+		/// @brief 1 回のバッファ確保で構築する長方形の最大数（インデックス数が Vertex2D::IndexType に収まる数）
+		static constexpr size_t MaxRectsPerBatch = (0xFFFF / 6);
+
+		/// @brief 長方形の 4 つの頂点を書き込みます。
+		/// @param pVertex 頂点の書き込み先
+		/// @param rect 長方形
+		/// @param color 色
+		static void WriteRectVertices(Vertex2D* pVertex, const FloatRect& rect, const Float4& color) noexcept
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			// [left, top, right, bottom]
+			const __m128 ltrb = _mm_loadu_ps(&rect.left);
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 c = _mm_loadu_ps(&color.x);
+			float* pDst = &pVertex->pos.x;
+
+			// 各頂点は [x, y, u, v][r, g, b, a]
+			_mm_storeu_ps((pDst + 0), _mm_movelh_ps(ltrb, zero));
+			_mm_storeu_ps((pDst + 4), c);
+			_mm_storeu_ps((pDst + 8), _mm_shuffle_ps(ltrb, zero, _MM_SHUFFLE(0, 0, 1, 2)));
+			_mm_storeu_ps((pDst + 12), c);
+			_mm_storeu_ps((pDst + 16), _mm_shuffle_ps(ltrb, zero, _MM_SHUFFLE(0, 0, 3, 0)));
+			_mm_storeu_ps((pDst + 20), c);
+			_mm_storeu_ps((pDst + 24), _mm_movehl_ps(zero, ltrb));
+			_mm_storeu_ps((pDst + 28), c);
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const float32x2_t lt = vld1_f32(&rect.left);
+			const float32x2_t rb = vld1_f32(&rect.right);
+			const float32x2_t zero = vdup_n_f32(0.0f);
+			const float32x4_t c = vld1q_f32(&color.x);
+			float* pDst = &pVertex->pos.x;
+
+			vst1q_f32((pDst + 0), vcombine_f32(lt, zero));
+			vst1q_f32((pDst + 4), c);
+			vst1q_f32((pDst + 8), vcombine_f32(vset_lane_f32(rect.right, lt, 0), zero));
+			vst1q_f32((pDst + 12), c);
+			vst1q_f32((pDst + 16), vcombine_f32(vset_lane_f32(rect.left, rb, 0), zero));
+			vst1q_f32((pDst + 20), c);
+			vst1q_f32((pDst + 24), vcombine_f32(rb, zero));
+			vst1q_f32((pDst + 28), c);
+
+		# else
+
+			pVertex[0].set(rect.left, rect.top, 0.0f, 0.0f, color);
+			pVertex[1].set(rect.right, rect.top, 0.0f, 0.0f, color);
+			pVertex[2].set(rect.left, rect.bottom, 0.0f, 0.0f, color);
+			pVertex[3].set(rect.right, rect.bottom, 0.0f, 0.0f, color);
+
+		# endif
+		}
 	}
 
 	namespace Vertex2DBuilder
@@ -190,6 +245,64 @@ namespace s3d
 			return IndexCount;
 		}
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		Vertex2DBatchResult BuildRects(const BufferCreatorFunc& bufferCreator, const std::span<const FloatRect> rects, const std::span<const Float4> colors, const size_t first)
+		{
+			const size_t count = Min((rects.size() - first), MaxRectsPerBatch);
+
+			if (count == 0)
+			{
+				return{};
+			}
+
+			const Vertex2D::IndexType VertexCount	= static_cast<Vertex2D::IndexType>(count * 4);
+			const Vertex2D::IndexType IndexCount	= static_cast<Vertex2D::IndexType>(count * 6);
+			auto [pVertex, pIndex, indexOffset]		= bufferCreator(VertexCount, IndexCount);
+
+			if (not pVertex)
+			{
+				return{};
+			}
+
+			const FloatRect* pRect = (rects.data() + first);
+
+			if (colors.size() == 1)
+			{
+				const Float4 color = colors.front();
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					WriteRectVertices((pVertex + (i * 4)), pRect[i], color);
+				}
+			}
+			else
+			{
+				const Float4* pColor = (colors.data() + first);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					WriteRectVertices((pVertex + (i * 4)), pRect[i], pColor[i]);
+				}
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Vertex2D::IndexType base = static_cast<Vertex2D::IndexType>(indexOffset + (i * 4));
+
+				for (Vertex2D::IndexType k = 0; k < 6; ++k)
+				{
+					*pIndex++ = (base + RectIndexTable[k]);
+				}
+			}
+
+			return{ IndexCount, count };
+		}
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	BuildRectFrame
@@ -418,6 +531,39 @@ namespace s3d
 			return IndexCount;
 		}
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildVertices
+		//
+		////////////////////////////////////////////////////////////////
+
+		Vertex2D::IndexType BuildVertices(const BufferCreatorFunc& bufferCreator, const std::span<const Vertex2D> vertices, const std::span<const Vertex2D::IndexType> indices)
+		{
+			const Vertex2D::IndexType VertexCount = static_cast<Vertex2D::IndexType>(vertices.size());
+			const Vertex2D::IndexType IndexCount = static_cast<Vertex2D::IndexType>(indices.size());
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(VertexCount, IndexCount);
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			// 頂点バッファへの書き込み
+			std::memcpy(pVertex, vertices.data(), vertices.size_bytes());
+
+			// インデックスバッファへの書き込み
+			{
+				const Vertex2D::IndexType* pSrc = indices.data();
+
+				for (size_t i = 0; i < IndexCount; ++i)
+				{
+					*(pIndex++) = static_cast<Vertex2D::IndexType>(indexOffset + *pSrc++);
+				}
+			}
+
+			return IndexCount;
+		}
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	BuildTexturedQuad
@@ -0,0 +1,495 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Renderer2DCommandList.hpp>
+# include <Siv3D/FloatRect.hpp>
+# include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/LineCap.hpp>
+# include <Siv3D/Error.hpp>
+# include <Siv3D/Renderer2D/IRenderer2D.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include <Siv3D/Engine/Siv3DEngine.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 1 つのバッチに含められる頂点数とインデックス数の上限
+		constexpr uint32 MaxBatchCount = 0xFFFF;
+
+		[[nodiscard]]
+		static float CalculateMaxScaling(const Mat3x2& mat)
+		{
+			return (Float2{ (mat._11 + mat._21), (mat._12 + mat._22) }.length() / Math::Sqrt2_v<float>);
+		}
+
+		[[noreturn]]
+		static void ThrowSizeMismatch(const StringView functionName)
+		{
+			throw Error{ U"Renderer2DCommandList::{}(): the sizes of the arrays do not match"_fmt(functionName) };
+		}
+
+		/// @brief 1 回のバッファ確保に収まるだけの図形をまとめて構築することを、count 個の図形をすべて構築するまで繰り返します。
+		/// @param count 図形の数
+		/// @param buildBatch first 番目以降の図形を構築し、Vertex2DBatchResult を返す関数
+		/// @return 図形を 1 つ以上構築した場合 true
+		template <class BuildBatch>
+		[[nodiscard]]
+		static bool BuildAllBatches(const size_t count, BuildBatch buildBatch)
+		{
+			bool built = false;
+
+			for (size_t first = 0; first < count;)
+			{
+				const Vertex2DBatchResult result = buildBatch(first);
+
+				if (not result.indexCount)
+				{
+					break;
+				}
+
+				built = true;
+				first += result.count;
+			}
+
+			return built;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ScopedTransform
+	//
+	////////////////////////////////////////////////////////////////
+
+	Renderer2DCommandList::ScopedTransform::ScopedTransform(Renderer2DCommandList& commandList, const Mat3x2& transform)
+		: m_commandList{ commandList }
+	{
+		m_commandList.pushTransform(transform);
+	}
+
+	Renderer2DCommandList::ScopedTransform::~ScopedTransform()
+	{
+		m_commandList.popTransform();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	Renderer2DCommandList::Renderer2DCommandList()
+		: m_transforms{ Mat3x2::Identity() } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	pushTransform, popTransform
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::pushTransform(const Mat3x2& transform)
+	{
+		m_transforms.push_back(transform * m_transforms.back());
+		m_maxScaling = CalculateMaxScaling(m_transforms.back());
+	}
+
+	void Renderer2DCommandList::popTransform()
+	{
+		if (m_transforms.size() <= 1)
+		{
+			return;
+		}
+
+		m_transforms.pop_back();
+		m_maxScaling = CalculateMaxScaling(m_transforms.back());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getTransform
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Mat3x2& Renderer2DCommandList::getTransform() const noexcept
+	{
+		return m_transforms.back();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	allocate
+	//
+	////////////////////////////////////////////////////////////////
+
+	Vertex2D* Renderer2DCommandList::allocate(const Vertex2D::IndexType vertexCount, const Vertex2D::IndexType indexCount, Vertex2D::IndexType*& pIndex, Vertex2D::IndexType& indexOffset)
+	{
+		// 現在のバッチに収まらない場合は、新しいバッチを始める
+		if ((not m_batches)
+			|| (MaxBatchCount < (m_batches.back().vertexCount + vertexCount))
+			|| (MaxBatchCount < (m_batches.back().indexCount + indexCount)))
+		{
+			m_batches.push_back(Batch{ static_cast<uint32>(m_vertices.size()), 0, static_cast<uint32>(m_indices.size()), 0 });
+		}
+
+		Batch& batch = m_batches.back();
+		indexOffset = static_cast<Vertex2D::IndexType>(batch.vertexCount);
+		batch.vertexCount += vertexCount;
+		batch.indexCount += indexCount;
+
+		const size_t vertexBegin = m_vertices.size();
+		const size_t indexBegin = m_indices.size();
+		m_vertices.resize(vertexBegin + vertexCount);
+		m_indices.resize(indexBegin + indexCount);
+
+		pIndex = (m_indices.data() + indexBegin);
+		return (m_vertices.data() + vertexBegin);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	record
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Builder>
+	void Renderer2DCommandList::record(Builder builder)
+	{
+		const size_t vertexBegin = m_vertices.size();
+
+		const auto bufferCreator = [this](const Vertex2D::IndexType vertexCount, const Vertex2D::IndexType indexCount)
+			{
+				Vertex2D::IndexType* pIndex = nullptr;
+				Vertex2D::IndexType indexOffset = 0;
+				Vertex2D* pVertex = allocate(vertexCount, indexCount, pIndex, indexOffset);
+				return Vertex2DBufferPointer{ pVertex, pIndex, indexOffset };
+			};
+
+		if (not builder(bufferCreator))
+		{
+			return;
+		}
+
+		// 座標変換は、記録時に頂点へ適用する
+		if (const Mat3x2& transform = m_transforms.back();
+			transform != Mat3x2::Identity())
+		{
+			for (auto it = (m_vertices.begin() + vertexBegin); it != m_vertices.end(); ++it)
+			{
+				it->pos = transform.transformPoint(it->pos);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addLine
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addLine(const Line& line, const double thickness, const ColorF& color)
+	{
+		addLine(line, LineCap::Square, thickness, color);
+	}
+
+	void Renderer2DCommandList::addLine(const Line& line, const LineCap cap, const double thickness, const ColorF& color)
+	{
+		const Float4 colorF = color.toFloat4();
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return Vertex2DBuilder::BuildLine(bufferCreator, cap, cap, line.start, line.end, static_cast<float>(thickness), { colorF, colorF }, m_maxScaling);
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addTriangle
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addTriangle(const Triangle& triangle, const ColorF& color)
+	{
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return Vertex2DBuilder::BuildTriangle(bufferCreator, { triangle.p0, triangle.p1, triangle.p2 }, color.toFloat4());
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addRect(const RectF& rect, const ColorF& color)
+	{
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return Vertex2DBuilder::BuildRect(bufferCreator, FloatRect{ rect.x, rect.y, (rect.x + rect.w), (rect.y + rect.h) }, color.toFloat4());
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRects
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addRects(const std::span<const FloatRect> rects, const ColorF& color)
+	{
+		const Float4 colorF = color.toFloat4();
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return BuildAllBatches(rects.size(), [&](const size_t first) { return Vertex2DBuilder::BuildRects(bufferCreator, rects, std::span{ &colorF, 1 }, first); });
+			});
+	}
+
+	void Renderer2DCommandList::addRects(const std::span<const FloatRect> rects, const std::span<const Float4> colors)
+	{
+		if (colors.size() != rects.size())
+		{
+			ThrowSizeMismatch(U"addRects");
+		}
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return BuildAllBatches(rects.size(), [&](const size_t first) { return Vertex2DBuilder::BuildRects(bufferCreator, rects, colors, first); });
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircle
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addCircle(const Circle& circle, const ColorF& color)
+	{
+		const Float4 colorF = color.toFloat4();
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return Vertex2DBuilder::BuildCircle(bufferCreator, circle.center, Abs(static_cast<float>(circle.r)), ColorFillDirection::InOut, colorF, colorF, m_maxScaling);
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircles
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addCircles(const std::span<const Float2> centers, const float r, const ColorF& color)
+	{
+		const Float4 colorF = color.toFloat4();
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return BuildAllBatches(centers.size(), [&](const size_t first) { return Vertex2DBuilder::BuildCircles(bufferCreator, centers, std::span{ &r, 1 }, std::span{ &colorF, 1 }, m_maxScaling, first); });
+			});
+	}
+
+	void Renderer2DCommandList::addCircles(const std::span<const Float2> centers, const std::span<const float> rs, const std::span<const Float4> colors)
+	{
+		if ((rs.size() != centers.size()) || (colors.size() != centers.size()))
+		{
+			ThrowSizeMismatch(U"addCircles");
+		}
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return BuildAllBatches(centers.size(), [&](const size_t first) { return Vertex2DBuilder::BuildCircles(bufferCreator, centers, rs, colors, m_maxScaling, first); });
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCirclePie
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addCirclePie(const Circle& circle, const double startAngle, const double angle, const ColorF& color)
+	{
+		const Float4 colorF = color.toFloat4();
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return Vertex2DBuilder::BuildCirclePie(bufferCreator, circle.center, Abs(static_cast<float>(circle.r)), static_cast<float>(startAngle), static_cast<float>(angle), colorF, colorF, m_maxScaling);
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addQuad
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addQuad(const Quad& quad, const ColorF& color)
+	{
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return Vertex2DBuilder::BuildQuad(bufferCreator, FloatQuad{ quad }, color.toFloat4());
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRoundRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::addRoundRect(const RoundRect& roundRect, const ColorF& color)
+	{
+		if (roundRect.r == 0.0)
+		{
+			addRect(roundRect.rect, color);
+			return;
+		}
+
+		const RectF& rect = roundRect.rect;
+		const double radius = Min(Abs(rect.w * 0.5), Abs(rect.h * 0.5), Abs(roundRect.r));
+
+		record([&](const BufferCreatorFunc& bufferCreator)
+			{
+				return Vertex2DBuilder::BuildRoundRect(bufferCreator, FloatRect{ rect.x, rect.y, (rect.x + rect.w), (rect.y + rect.h) }, static_cast<float>(radius), color.toFloat4(), m_maxScaling);
+			});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	append
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::append(const Renderer2DCommandList& other)
+	{
+		if (this == &other)
+		{
+			append(Renderer2DCommandList{ other });
+			return;
+		}
+
+		const uint32 vertexBase = static_cast<uint32>(m_vertices.size());
+		const uint32 indexBase = static_cast<uint32>(m_indices.size());
+
+		m_vertices.append(other.m_vertices);
+		m_indices.append(other.m_indices);
+
+		for (const auto& batch : other.m_batches)
+		{
+			// 直前のバッチに収まる場合は、インデックスをずらして連結する
+			if (m_batches)
+			{
+				Batch& last = m_batches.back();
+
+				if (((last.vertexCount + batch.vertexCount) <= MaxBatchCount)
+					&& ((last.indexCount + batch.indexCount) <= MaxBatchCount))
+				{
+					Vertex2D::IndexType* pIndex = (m_indices.data() + indexBase + batch.indexOffset);
+					const Vertex2D::IndexType indexOffset = static_cast<Vertex2D::IndexType>(last.vertexCount);
+
+					for (uint32 i = 0; i < batch.indexCount; ++i)
+					{
+						*(pIndex++) += indexOffset;
+					}
+
+					last.vertexCount += batch.vertexCount;
+					last.indexCount += batch.indexCount;
+					continue;
+				}
+			}
+
+			m_batches.push_back(Batch{ (vertexBase + batch.vertexOffset), batch.vertexCount, (indexBase + batch.indexOffset), batch.indexCount });
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::clear() noexcept
+	{
+		m_vertices.clear();
+		m_indices.clear();
+		m_batches.clear();
+		m_transforms.resize(1);
+		m_transforms.front() = Mat3x2::Identity();
+		m_maxScaling = 1.0f;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isEmpty
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool Renderer2DCommandList::isEmpty() const noexcept
+	{
+		return m_indices.isEmpty();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_vertices, num_indices
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t Renderer2DCommandList::num_vertices() const noexcept
+	{
+		return m_vertices.size();
+	}
+
+	size_t Renderer2DCommandList::num_indices() const noexcept
+	{
+		return m_indices.size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getVertices, getIndices, getBatches
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Array<Vertex2D>& Renderer2DCommandList::getVertices() const noexcept
+	{
+		return m_vertices;
+	}
+
+	const Array<Vertex2D::IndexType>& Renderer2DCommandList::getIndices() const noexcept
+	{
+		return m_indices;
+	}
+
+	const Array<Renderer2DCommandList::Batch>& Renderer2DCommandList::getBatches() const noexcept
+	{
+		return m_batches;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	draw
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Renderer2DCommandList::draw() const
+	{
+		if (isEmpty())
+		{
+			return;
+		}
+
+		SIV3D_ENGINE(Renderer2D)->addCommandList(*this);
+	}
+}
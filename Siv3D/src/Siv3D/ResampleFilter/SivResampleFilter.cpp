@@ -0,0 +1,41 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <array>
+# include <Siv3D/ResampleFilter.hpp>
+# include <Siv3D/StringView.hpp>
+# include <Siv3D/FormatData.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		static constexpr std::array ResampleFilterStrings =
+		{
+			U"Box"_sv,
+			U"Bilinear"_sv,
+			U"Bicubic"_sv,
+			U"Lanczos3"_sv,
+			U"Mitchell"_sv,
+		};
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, const ResampleFilter value)
+	{
+		formatData.string.append(ResampleFilterStrings[FromEnum(value)]);
+	}
+}
@@ -11,6 +11,7 @@
 
 # include <Siv3D/SVG.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/Blob.hpp>
 # include "SVGDetail.hpp"
 
 namespace s3d
@@ -60,11 +61,10 @@ namespace s3d
 
 	bool SVG::load(std::unique_ptr<IReader>&& reader)
 	{
-		std::string source(static_cast<size_t>(reader->size()), '\0');
+		// サイズが不明な IReader にも対応するため、Blob を介して終端まで読み込む
+		const Blob blob{ *reader };
 
-		reader->read(source.data(), source.size());
-
-		return parse(source);
+		return parse(std::string(reinterpret_cast<const char*>(blob.data()), blob.size()));
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -0,0 +1,479 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <atomic>
+# include <limits>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Compression/SeekableFormat.hpp>
+# include "SeekableDecompressionReaderDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		[[nodiscard]]
+		static uint32 ReadUInt32(const Byte* p) noexcept
+		{
+			uint32 value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	SeekableDecompressionReader::SeekableDecompressionReaderDetail::~SeekableDecompressionReaderDetail()
+	{
+		close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::SeekableDecompressionReaderDetail::open(const FilePathView path, const size_t cacheCapacity)
+	{
+		close();
+
+		if (not m_file.open(path))
+		{
+			return false;
+		}
+
+		const MappedMemoryView view = m_file.mapAll();
+
+		if (not view.data)
+		{
+			m_file.close();
+			return false;
+		}
+
+		m_data = static_cast<const Byte*>(view.data);
+		m_dataSize = view.size;
+
+		if (not load(cacheCapacity))
+		{
+			LOG_FAIL(fmt::format("❌ SeekableDecompressionReader::open(): `{}` is not in the Zstandard seekable format", path.toUTF8()));
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SeekableDecompressionReader::SeekableDecompressionReaderDetail::open(Blob&& blob, const size_t cacheCapacity)
+	{
+		close();
+
+		m_blob = std::move(blob);
+		m_data = m_blob.data();
+		m_dataSize = m_blob.size();
+
+		if (not load(cacheCapacity))
+		{
+			LOG_FAIL("❌ SeekableDecompressionReader::open(): The data is not in the Zstandard seekable format");
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SeekableDecompressionReader::SeekableDecompressionReaderDetail::close()
+	{
+		ZSTD_freeDCtx(m_context);
+		m_context = nullptr;
+		m_cache.clear();
+		m_cacheCapacity = 0;
+		m_useCount = 0;
+		m_frames.clear();
+		m_size = 0;
+		m_pos = 0;
+		m_data = nullptr;
+		m_dataSize = 0;
+		m_blob = Blob{};
+		m_file.close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::SeekableDecompressionReaderDetail::isOpen() const noexcept
+	{
+		return (m_context != nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::SeekableDecompressionReaderDetail::size() const noexcept
+	{
+		return m_size;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::SeekableDecompressionReaderDetail::getPos() const noexcept
+	{
+		return m_pos;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::SeekableDecompressionReaderDetail::setPos(const int64 pos) noexcept
+	{
+		m_pos = Clamp<int64>(pos, 0, m_size);
+		return m_pos;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	read
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::SeekableDecompressionReaderDetail::read(void* dst, const int64 size)
+	{
+		const int64 readSize = lookahead(dst, m_pos, size);
+		m_pos += readSize;
+		return readSize;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	lookahead
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::SeekableDecompressionReaderDetail::lookahead(void* dst, int64 pos, const int64 size)
+	{
+		if ((not m_context) || (size <= 0) || (pos < 0) || (m_size <= pos))
+		{
+			return 0;
+		}
+
+		Byte* out = static_cast<Byte*>(dst);
+		const int64 endPos = Min((pos + size), m_size);
+
+		for (size_t frameIndex = findFrame(pos); pos < endPos; ++frameIndex)
+		{
+			const Frame& frame = m_frames[frameIndex];
+			const size_t offsetInFrame = static_cast<size_t>(pos - frame.offset);
+			const size_t copySize = static_cast<size_t>(Min((frame.offset + static_cast<int64>(frame.size)), endPos) - pos);
+
+			if ((offsetInFrame == 0) && (copySize == frame.size))
+			{
+				// フレーム全体を読み込む場合は、キャッシュを経由せずに直接展開する
+				if (not decompressFrame(m_context, frameIndex, out))
+				{
+					break;
+				}
+			}
+			else
+			{
+				const Blob* data = getFrame(frameIndex);
+
+				if (not data)
+				{
+					break;
+				}
+
+				std::memcpy(out, (data->data() + offsetInFrame), copySize);
+			}
+
+			out += copySize;
+			pos += static_cast<int64>(copySize);
+		}
+
+		return static_cast<int64>(out - static_cast<Byte*>(dst));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	numFrames
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t SeekableDecompressionReader::SeekableDecompressionReaderDetail::numFrames() const noexcept
+	{
+		return m_frames.size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decompressAll
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::SeekableDecompressionReaderDetail::decompressAll(Blob& dst) const
+	{
+		dst.clear();
+
+		if (not m_context)
+		{
+			return false;
+		}
+
+		dst.resize(static_cast<size_t>(m_size));
+
+		std::atomic<bool> failed{ false };
+
+		Threading::ParallelFor(0, m_frames.size(), [&](const size_t begin, const size_t end)
+		{
+			// 展開コンテキストはスレッド間で共有できないため、チャンクごとに作成する
+			ZSTD_DCtx* const context = ZSTD_createDCtx();
+
+			if (not context)
+			{
+				failed = true;
+				return;
+			}
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (failed.load(std::memory_order_relaxed))
+				{
+					break;
+				}
+
+				if (not decompressFrame(context, i, (dst.data() + m_frames[i].offset)))
+				{
+					failed = true;
+				}
+			}
+
+			ZSTD_freeDCtx(context);
+		}, 1);
+
+		if (failed)
+		{
+			dst.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	load
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::SeekableDecompressionReaderDetail::load(const size_t cacheCapacity)
+	{
+		if (m_dataSize < SeekableFormat::GetSeekTableSize(0))
+		{
+			return false;
+		}
+
+		// フッタ
+		const Byte* const footer = (m_data + m_dataSize - SeekableFormat::FooterSize);
+		const size_t numFrames = ReadUInt32(footer);
+		const uint8 descriptor = static_cast<uint8>(footer[4]);
+
+		if ((ReadUInt32(footer + 5) != SeekableFormat::SeekableMagicNumber)
+			|| (descriptor & SeekableFormat::ReservedBits))
+		{
+			return false;
+		}
+
+		const size_t entrySize = ((descriptor & SeekableFormat::ChecksumFlag) ? SeekableFormat::EntrySizeWithChecksum : SeekableFormat::EntrySize);
+
+		if ((SeekableFormat::MaxFrames < numFrames)
+			|| (m_dataSize < SeekableFormat::GetSeekTableSize(numFrames, entrySize)))
+		{
+			return false;
+		}
+
+		// スキップ可能フレームのヘッダ
+		const size_t seekTableSize = SeekableFormat::GetSeekTableSize(numFrames, entrySize);
+		const Byte* const header = (m_data + m_dataSize - seekTableSize);
+
+		if ((ReadUInt32(header) != SeekableFormat::SkippableMagicNumber)
+			|| (ReadUInt32(header + 4) != (seekTableSize - SeekableFormat::SkippableHeaderSize)))
+		{
+			return false;
+		}
+
+		// エントリ
+		const size_t compressedDataSize = (m_dataSize - seekTableSize);
+		const Byte* entry = (header + SeekableFormat::SkippableHeaderSize);
+		size_t compressedOffset = 0;
+		int64 offset = 0;
+
+		m_frames.reserve(numFrames);
+
+		for (size_t i = 0; i < numFrames; ++i)
+		{
+			const size_t compressedSize = ReadUInt32(entry);
+			const size_t size = ReadUInt32(entry + 4);
+			entry += entrySize;
+
+			if ((compressedDataSize - compressedOffset) < compressedSize)
+			{
+				return false;
+			}
+
+			// 展開後のサイズが 0 のフレームは読み込みに影響しないため除外する
+			if (size != 0)
+			{
+				// 展開時の確保サイズはシークテーブルの値で決まるため、上限とフレームヘッダとの一致を確かめる
+				if ((SeekableFormat::MaxFrameSize < size)
+					|| (static_cast<uint64>(std::numeric_limits<size_t>::max() - size) < static_cast<uint64>(offset)))
+				{
+					return false;
+				}
+
+				const unsigned long long contentSize = ZSTD_getFrameContentSize((m_data + compressedOffset), compressedSize);
+
+				if ((contentSize == ZSTD_CONTENTSIZE_ERROR)
+					|| ((contentSize != ZSTD_CONTENTSIZE_UNKNOWN) && (contentSize != size)))
+				{
+					return false;
+				}
+
+				m_frames.push_back(Frame{ .data = (m_data + compressedOffset), .compressedSize = compressedSize, .offset = offset, .size = size });
+			}
+
+			compressedOffset += compressedSize;
+			offset += static_cast<int64>(size);
+		}
+
+		if (compressedOffset != compressedDataSize)
+		{
+			return false;
+		}
+
+		m_context = ZSTD_createDCtx();
+
+		if (not m_context)
+		{
+			return false;
+		}
+
+		m_size = offset;
+		m_cacheCapacity = Max<size_t>(cacheCapacity, 1);
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	findFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t SeekableDecompressionReader::SeekableDecompressionReaderDetail::findFrame(const int64 pos) const noexcept
+	{
+		// pos 以下の開始位置を持つ最後のフレーム
+		const auto it = std::upper_bound(m_frames.begin(), m_frames.end(), pos,
+			[](const int64 value, const Frame& frame) { return (value < frame.offset); });
+
+		return static_cast<size_t>(std::distance(m_frames.begin(), it) - 1);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Blob* SeekableDecompressionReader::SeekableDecompressionReaderDetail::getFrame(const size_t frameIndex)
+	{
+		++m_useCount;
+
+		for (auto& cached : m_cache)
+		{
+			if (cached.frameIndex == frameIndex)
+			{
+				cached.lastUsed = m_useCount;
+				return &cached.data;
+			}
+		}
+
+		// キャッシュが一杯の場合は、最も長く使われていないフレームを再利用する
+		CachedFrame* slot = nullptr;
+
+		if (m_cache.size() < m_cacheCapacity)
+		{
+			slot = &m_cache.emplace_back();
+		}
+		else
+		{
+			slot = &*std::min_element(m_cache.begin(), m_cache.end(),
+				[](const CachedFrame& a, const CachedFrame& b) { return (a.lastUsed < b.lastUsed); });
+		}
+
+		slot->frameIndex = frameIndex;
+		slot->lastUsed = m_useCount;
+		slot->data.resize(m_frames[frameIndex].size);
+
+		if (not decompressFrame(m_context, frameIndex, slot->data.data()))
+		{
+			slot->frameIndex = m_frames.size();
+			slot->lastUsed = 0;
+			return nullptr;
+		}
+
+		return &slot->data;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decompressFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::SeekableDecompressionReaderDetail::decompressFrame(ZSTD_DCtx* context, const size_t frameIndex, void* dst) const
+	{
+		const Frame& frame = m_frames[frameIndex];
+
+		const size_t result = ZSTD_decompressDCtx(context, dst, frame.size, frame.data, frame.compressedSize);
+
+		if (ZSTD_isError(result) || (result != frame.size))
+		{
+			LOG_FAIL(fmt::format("❌ SeekableDecompressionReader: Failed to decompress frame {} ({})", frameIndex,
+				(ZSTD_isError(result) ? ZSTD_getErrorName(result) : "size mismatch")));
+			return false;
+		}
+
+		return true;
+	}
+}
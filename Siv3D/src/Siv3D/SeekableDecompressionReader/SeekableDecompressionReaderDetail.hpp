@@ -0,0 +1,118 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/SeekableDecompressionReader.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/Array.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class SeekableDecompressionReader::SeekableDecompressionReaderDetail
+	{
+	public:
+
+		SeekableDecompressionReaderDetail() = default;
+
+		~SeekableDecompressionReaderDetail();
+
+		bool open(FilePathView path, size_t cacheCapacity);
+
+		bool open(Blob&& blob, size_t cacheCapacity);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		int64 size() const noexcept;
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		int64 setPos(int64 pos) noexcept;
+
+		int64 read(void* dst, int64 size);
+
+		int64 lookahead(void* dst, int64 pos, int64 size);
+
+		[[nodiscard]]
+		size_t numFrames() const noexcept;
+
+		bool decompressAll(Blob& dst) const;
+
+	private:
+
+		struct Frame
+		{
+			/// @brief 圧縮されたフレームの先頭
+			const Byte* data = nullptr;
+
+			/// @brief 圧縮されたフレームのサイズ（バイト）
+			size_t compressedSize = 0;
+
+			/// @brief 展開後のデータにおけるフレームの開始位置（バイト）
+			int64 offset = 0;
+
+			/// @brief 展開後のフレームのサイズ（バイト）
+			size_t size = 0;
+		};
+
+		struct CachedFrame
+		{
+			size_t frameIndex = 0;
+
+			Blob data;
+
+			uint64 lastUsed = 0;
+		};
+
+		MemoryMappedFileView m_file;
+
+		Blob m_blob;
+
+		const Byte* m_data = nullptr;
+
+		size_t m_dataSize = 0;
+
+		Array<Frame> m_frames;
+
+		int64 m_size = 0;
+
+		int64 m_pos = 0;
+
+		ZSTD_DCtx* m_context = nullptr;
+
+		Array<CachedFrame> m_cache;
+
+		size_t m_cacheCapacity = 0;
+
+		uint64 m_useCount = 0;
+
+		/// @brief シークテーブルを読み込み、フレームの一覧を作成する
+		[[nodiscard]]
+		bool load(size_t cacheCapacity);
+
+		/// @brief 展開後のデータの位置 pos を含むフレームのインデックスを返す
+		[[nodiscard]]
+		size_t findFrame(int64 pos) const noexcept;
+
+		/// @brief フレームを展開してキャッシュし、その内容を返す
+		[[nodiscard]]
+		const Blob* getFrame(size_t frameIndex);
+
+		/// @brief フレームを dst に直接展開する
+		[[nodiscard]]
+		bool decompressFrame(ZSTD_DCtx* context, size_t frameIndex, void* dst) const;
+	};
+}
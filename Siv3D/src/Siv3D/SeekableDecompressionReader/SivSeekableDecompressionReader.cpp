@@ -0,0 +1,217 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/SeekableDecompressionReader.hpp>
+# include "SeekableDecompressionReaderDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	SeekableDecompressionReader::SeekableDecompressionReader()
+		: pImpl{ std::make_shared<SeekableDecompressionReaderDetail>() } {}
+
+	SeekableDecompressionReader::SeekableDecompressionReader(const FilePathView path, const size_t cacheCapacity)
+		: SeekableDecompressionReader{}
+	{
+		open(path, cacheCapacity);
+	}
+
+	SeekableDecompressionReader::SeekableDecompressionReader(const Blob& blob, const size_t cacheCapacity)
+		: SeekableDecompressionReader{}
+	{
+		open(blob, cacheCapacity);
+	}
+
+	SeekableDecompressionReader::SeekableDecompressionReader(Blob&& blob, const size_t cacheCapacity)
+		: SeekableDecompressionReader{}
+	{
+		open(std::move(blob), cacheCapacity);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	open
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::open(const FilePathView path, const size_t cacheCapacity)
+	{
+		return pImpl->open(path, cacheCapacity);
+	}
+
+	bool SeekableDecompressionReader::open(const Blob& blob, const size_t cacheCapacity)
+	{
+		return pImpl->open(Blob{ blob }, cacheCapacity);
+	}
+
+	bool SeekableDecompressionReader::open(Blob&& blob, const size_t cacheCapacity)
+	{
+		return pImpl->open(std::move(blob), cacheCapacity);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	close
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SeekableDecompressionReader::close()
+	{
+		pImpl->close();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	supportsLookahead
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::supportsLookahead() const noexcept
+	{
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool SeekableDecompressionReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	SeekableDecompressionReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::size() const
+	{
+		return pImpl->size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setPos
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::setPos(const int64 pos)
+	{
+		return pImpl->setPos(pos);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	skip
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::skip(const int64 offset)
+	{
+		return pImpl->setPos(pImpl->getPos() + offset);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	read
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::read(void* dst, const int64 size)
+	{
+		return pImpl->read(dst, size);
+	}
+
+	int64 SeekableDecompressionReader::read(void* dst, const int64 pos, const int64 size)
+	{
+		pImpl->setPos(pos);
+
+		return pImpl->read(dst, size);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	lookahead
+	//
+	////////////////////////////////////////////////////////////////
+
+	int64 SeekableDecompressionReader::lookahead(void* dst, const int64 size) const
+	{
+		return pImpl->lookahead(dst, pImpl->getPos(), size);
+	}
+
+	int64 SeekableDecompressionReader::lookahead(void* dst, const int64 pos, const int64 size) const
+	{
+		return pImpl->lookahead(dst, pos, size);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	numFrames
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t SeekableDecompressionReader::numFrames() const noexcept
+	{
+		return pImpl->numFrames();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decompressAll
+	//
+	////////////////////////////////////////////////////////////////
+
+	Blob SeekableDecompressionReader::decompressAll() const
+	{
+		Blob blob;
+
+		pImpl->decompressAll(blob);
+
+		return blob;
+	}
+
+	bool SeekableDecompressionReader::decompressAll(Blob& dst) const
+	{
+		return pImpl->decompressAll(dst);
+	}
+}
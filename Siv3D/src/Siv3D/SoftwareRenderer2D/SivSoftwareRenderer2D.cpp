@@ -0,0 +1,146 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/SoftwareRenderer2D.hpp>
+# include <Siv3D/Scene.hpp>
+# include <Siv3D/Renderer2D/Software/CRenderer2D_Software.hpp>
+
+namespace s3d
+{
+	class SoftwareRenderer2D::SoftwareRenderer2DDetail
+	{
+	public:
+
+		CRenderer2D_Software renderer;
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	SoftwareRenderer2D::SoftwareRenderer2D()
+		: SoftwareRenderer2D{ Scene::DefaultSceneSize, Scene::DefaultBackgroundColor } {}
+
+	SoftwareRenderer2D::SoftwareRenderer2D(const Size& size, const ColorF& backgroundColor)
+		: pImpl{ std::make_shared<SoftwareRenderer2DDetail>() }
+	{
+		pImpl->renderer.init();
+		pImpl->renderer.resizeRenderTarget(size);
+		beginFrame(backgroundColor);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	beginFrame
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRenderer2D::beginFrame(const ColorF& backgroundColor)
+	{
+		pImpl->renderer.beginFrame();
+		pImpl->renderer.clearRenderTarget(backgroundColor);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	resize
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRenderer2D::resize(const Size& size)
+	{
+		pImpl->renderer.resizeRenderTarget(size);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setBlendState, setScissorRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRenderer2D::setBlendState(const BlendState& state)
+	{
+		pImpl->renderer.setBlendState(state);
+	}
+
+	void SoftwareRenderer2D::setScissorRect(const Optional<Rect>& rect)
+	{
+		pImpl->renderer.setScissorRect(rect);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setDrawCallReorderingEnabled
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRenderer2D::setDrawCallReorderingEnabled(const bool enabled)
+	{
+		pImpl->renderer.setDrawCallReorderingEnabled(enabled);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	draw
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRenderer2D::draw(const Renderer2DCommandList& commandList)
+	{
+		if (commandList.isEmpty())
+		{
+			return;
+		}
+
+		pImpl->renderer.addCommandList(commandList);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SoftwareRenderer2D::flush()
+	{
+		pImpl->renderer.flush();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getImage
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Image& SoftwareRenderer2D::getImage() const noexcept
+	{
+		return pImpl->renderer.getRenderTarget();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getStat
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProfilerStat SoftwareRenderer2D::getStat() const noexcept
+	{
+		const Renderer2DStat& stat = pImpl->renderer.getStat();
+
+		ProfilerStat result;
+		result.drawCalls = static_cast<int32>(stat.drawCalls);
+		result.triangleCount = static_cast<int32>(stat.triangleCount);
+		result.drawCallsSaved = static_cast<int32>(stat.drawCallsSaved);
+		return result;
+	}
+}
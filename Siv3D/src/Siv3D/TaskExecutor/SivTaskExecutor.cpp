@@ -0,0 +1,40 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <array>
+# include <Siv3D/TaskExecutor.hpp>
+# include <Siv3D/StringView.hpp>
+# include <Siv3D/FormatData.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		static constexpr std::array TaskExecutorStrings =
+		{
+			U"ThreadPool"_sv,
+			U"MainThread"_sv,
+			U"Inline"_sv,
+		};
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, const TaskExecutor value)
+	{
+		formatData.string.append(TaskExecutorStrings[FromEnum(value)]);
+	}
+}
@@ -9,17 +9,23 @@
 //
 //-----------------------------------------------
 
+# include <bit>
+# include <cstring>
 # include "TextReaderDetail.hpp"
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Endian.hpp>
+# include <Siv3D/SIMD.hpp>
 # include <Siv3D/UnicodeConverter.hpp>
+# include <Siv3D/Utility.hpp>
+# include <ThirdParty/simdutf/simdutf.h>
 
 namespace s3d
 {
 	namespace
 	{
-		static void SplitLines(const std::string& s, Array<std::string>& lines)
+		template <class CharType, class StringType, class Converter>
+		static void SplitLines(const std::basic_string_view<CharType> s, Array<StringType>& lines, Converter converter)
 		{
 			lines.clear();
 
@@ -30,39 +36,171 @@ namespace s3d
 
 			size_t start = 0;
 
-			for (size_t i = 0; i < s.size(); ++i)
+			for (;;)
 			{
-				if (s[i] == '\n')
+				const size_t newline = s.find(CharType('\n'), start);
+
+				if (newline == std::basic_string_view<CharType>::npos)
 				{
-					lines.push_back(s.substr(start, (i - start)));
-					start = (i + 1);
+					break;
 				}
+
+				lines.push_back(converter(s.substr(start, (newline - start))));
+				start = (newline + 1);
 			}
 
-			lines.push_back(s.substr(start));
+			lines.push_back(converter(s.substr(start)));
 		}
 
-		static void SplitLines(const std::string& s, Array<String>& lines)
+		/// @brief [first, last) から最初の LF または NUL を探します。
+		/// @return 見つかった位置。見つからなかった場合は last
+		[[nodiscard]]
+		static const uint8* FindLineEndUTF8(const uint8* first, const uint8* last) noexcept
 		{
-			lines.clear();
+			const size_t size = (last - first);
 
-			if (s.empty())
+			if (size == 0)
 			{
-				return;
+				return last;
 			}
 
-			size_t start = 0;
+			// memchr は各プラットフォームで SIMD 実装されている
+			const uint8* lineEnd = static_cast<const uint8*>(std::memchr(first, '\n', size));
+
+			if (not lineEnd)
+			{
+				lineEnd = last;
+			}
 
-			for (size_t i = 0; i < s.size(); ++i)
+			if (const void* nul = std::memchr(first, '\0', (lineEnd - first)))
 			{
-				if (s[i] == '\n')
+				return static_cast<const uint8*>(nul);
+			}
+
+			return lineEnd;
+		}
+
+		/// @brief UTF-16 のコードユニット列から最初の LF または NUL を探します。
+		/// @param p コードユニット列の先頭（アラインされていなくてもよい）
+		/// @param numUnits コードユニットの数
+		/// @param bigEndian コードユニット列がビッグエンディアンである場合 true
+		/// @return 見つかったコードユニットのインデックス。見つからなかった場合は numUnits
+		[[nodiscard]]
+		static size_t FindLineEndUTF16(const uint8* p, const size_t numUnits, const bool bigEndian) noexcept
+		{
+			const uint16 lf = (bigEndian ? uint16{ 0x0A00 } : uint16{ 0x000A });
+
+			size_t i = 0;
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128i vLF = _mm_set1_epi16(static_cast<short>(lf));
+			const __m128i vNUL = _mm_setzero_si128();
+
+			for (; (i + 8) <= numUnits; i += 8)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + (i * 2)));
+				const __m128i eq = _mm_or_si128(_mm_cmpeq_epi16(v, vLF), _mm_cmpeq_epi16(v, vNUL));
+
+				if (const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(eq)))
 				{
-					lines.push_back(Unicode::FromUTF8(s.substr(start, (i - start))));
-					start = (i + 1);
+					return (i + (std::countr_zero(mask) / 2));
 				}
 			}
 
-			lines.push_back(Unicode::FromUTF8(s.substr(start)));
+		# elif SIV3D_INTRINSIC(NEON)
+
+			const uint16x8_t vLF = vdupq_n_u16(lf);
+
+			for (; (i + 8) <= numUnits; i += 8)
+			{
+				const uint16x8_t v = vreinterpretq_u16_u8(vld1q_u8(p + (i * 2)));
+				const uint16x8_t eq = vorrq_u16(vceqq_u16(v, vLF), vceqzq_u16(v));
+
+				if (vmaxvq_u16(eq))
+				{
+					break; // 残りはスカラーで位置を求める
+				}
+			}
+
+		# endif
+
+			for (; i < numUnits; ++i)
+			{
+				uint16 c;
+				std::memcpy(&c, (p + (i * 2)), sizeof(c));
+
+				if ((c == lf) || (c == 0))
+				{
+					return i;
+				}
+			}
+
+			return numUnits;
+		}
+
+		/// @brief CR を取り除いて文字列の末尾に追加します。
+		template <class CharType>
+		static void AppendWithoutCR(std::basic_string<CharType>& dst, const CharType* first, const CharType* last)
+		{
+			const size_t oldSize = dst.size();
+
+			dst.append(first, last);
+
+			if (std::find((dst.begin() + oldSize), dst.end(), CharType('\r')) != dst.end())
+			{
+				dst.erase(std::remove((dst.begin() + oldSize), dst.end(), CharType('\r')), dst.end());
+			}
+		}
+
+		/// @brief 読み込み元の終端までのデータを、文字列の offset バイト目以降に読み込みます。
+		/// @param reader 読み込み元
+		/// @param dst 読み込んだデータの格納先。読み込んだデータが収まるように拡張されます。
+		/// @param offset 格納を開始する位置（バイト）
+		/// @param chunkSize 読み込み元のサイズが不明な場合に、一度に読み込むサイズ（バイト）
+		/// @return 格納先の先頭から数えた、データの終端の位置（バイト）
+		template <class CharType>
+		[[nodiscard]]
+		static size_t ReadToEnd(IReader& reader, std::basic_string<CharType>& dst, const size_t offset, const size_t chunkSize)
+		{
+			const auto ResizeBytes = [&dst](const size_t bytes)
+				{
+					// 奇数バイトの場合に備えて切り上げる
+					dst.resize((bytes + sizeof(CharType) - 1) / sizeof(CharType));
+				};
+
+			const int64 size = reader.size();
+
+			// 読み込み元のサイズが分かっている場合は、一度に読み込む
+			if (0 <= size)
+			{
+				const int64 readSize = Max<int64>((size - reader.getPos()), 0);
+
+				ResizeBytes(offset + static_cast<size_t>(readSize));
+
+				const int64 readBytes = Max<int64>(reader.read((reinterpret_cast<uint8*>(dst.data()) + offset), readSize), 0);
+
+				return (offset + static_cast<size_t>(readBytes));
+			}
+
+			// 読み込み元のサイズが不明な場合は、read() が 0 を返すまで読み込む
+			size_t end = offset;
+
+			for (;;)
+			{
+				ResizeBytes(end + chunkSize);
+
+				const int64 readBytes = reader.read((reinterpret_cast<uint8*>(dst.data()) + end), static_cast<int64>(chunkSize));
+
+				if (readBytes <= 0)
+				{
+					break;
+				}
+
+				end += static_cast<size_t>(readBytes);
+			}
+
+			return end;
 		}
 	}
 
@@ -111,6 +249,11 @@ namespace s3d
 			m_reader->skip(bomSize);
 		}
 
+		if (not m_buffer)
+		{
+			m_buffer = std::make_unique_for_overwrite<uint8[]>(BufferSize);
+		}
+
 		return true;
 	}
 
@@ -145,6 +288,11 @@ namespace s3d
 			m_reader->skip(bomSize);
 		}
 
+		if (not m_buffer)
+		{
+			m_buffer = std::make_unique_for_overwrite<uint8[]>(BufferSize);
+		}
+
 		return true;
 	}
 
@@ -164,6 +312,10 @@ namespace s3d
 		m_reader.reset();
 
 		m_info = {};
+
+		m_bufferPos = 0;
+
+		m_bufferEnd = 0;
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -228,13 +380,22 @@ namespace s3d
 			return false;
 		}
 
-		switch (m_info.encoding)
+		if ((m_info.encoding == TextEncoding::UTF16LE)
+			|| (m_info.encoding == TextEncoding::UTF16BE))
+		{
+			std::u16string line16;
+
+			if (not readLineUTF16(line16))
+			{
+				return false;
+			}
+
+			line = Unicode::UTF16ToUTF8(line16);
+
+			return true;
+		}
+		else
 		{
-		case TextEncoding::UTF16LE:
-			return readLineUTF16LE(line);
-		case TextEncoding::UTF16BE:
-			return readLineUTF16BE(line);
-		default:
 			return readLineUTF8(line);
 		}
 	}
@@ -248,30 +409,33 @@ namespace s3d
 			return false;
 		}
 
-		bool eof = true;
-
-		for (;;)
+		if ((m_info.encoding == TextEncoding::UTF16LE)
+			|| (m_info.encoding == TextEncoding::UTF16BE))
 		{
-			char32 codePoint;
+			std::u16string line16;
 
-			if (not readCodePoint(codePoint))
+			if (not readLineUTF16(line16))
 			{
-				break;
+				return false;
 			}
 
-			eof = false;
+			line = Unicode::FromUTF16(line16);
 
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				break;
-			}
-			else if (codePoint != U'\r')
+			return true;
+		}
+		else
+		{
+			std::string line8;
+
+			if (not readLineUTF8(line8))
 			{
-				line.push_back(codePoint);
+				return false;
 			}
-		}
 
-		return (not eof);
+			line = Unicode::FromUTF8(line8);
+
+			return true;
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -284,13 +448,27 @@ namespace s3d
 	{
 		lines.clear();
 
-		if (m_info.encoding == TextEncoding::UTF16LE)
-		{
-			return readLinesUTF16LE(lines);
-		}
-		else if (m_info.encoding == TextEncoding::UTF16BE)
+		if ((m_info.encoding == TextEncoding::UTF16LE)
+			|| (m_info.encoding == TextEncoding::UTF16BE))
 		{
-			return readLinesUTF16BE(lines);
+			if (not m_info.isOpen)
+			{
+				return false;
+			}
+
+			std::u16string s16;
+
+			if (not readAllUTF16(s16))
+			{
+				return false;
+			}
+
+			// NUL も行の区切りとして扱う
+			std::replace(s16.begin(), s16.end(), u'\0', u'\n');
+
+			SplitLines(std::u16string_view{ s16 }, lines, [](const std::u16string_view line) { return Unicode::UTF16ToUTF8(line); });
+
+			return true;
 		}
 		else
 		{
@@ -301,7 +479,7 @@ namespace s3d
 				return false;
 			}
 
-			SplitLines(s8, lines);
+			SplitLines(std::string_view{ s8 }, lines, [](const std::string_view line) { return std::string(line); });
 
 			return true;
 		}
@@ -319,38 +497,19 @@ namespace s3d
 				return false;
 			}
 
-			String line;
+			std::u16string s16;
 
-			bool eof = true;
-
-			for (;;)
+			if (not readAllUTF16(s16))
 			{
-				char32 codePoint;
-
-				if (not readCodePoint(codePoint))
-				{
-					if (not eof)
-					{
-						lines.push_back(std::move(line));
-					}
-
-					break;
-				}
+				return false;
+			}
 
-				eof = false;
+			// NUL も行の区切りとして扱う
+			std::replace(s16.begin(), s16.end(), u'\0', u'\n');
 
-				if ((codePoint == U'\n') || (codePoint == U'\0'))
-				{
-					lines.push_back(line);
-					line.clear();
-				}
-				else if (codePoint != U'\r')
-				{
-					line.push_back(codePoint);
-				}
-			}
+			SplitLines(std::u16string_view{ s16 }, lines, [](const std::u16string_view line) { return Unicode::FromUTF16(line); });
 
-			return (not eof);
+			return true;
 		}
 		else
 		{
@@ -361,7 +520,7 @@ namespace s3d
 				return false;
 			}
 
-			SplitLines(s8, lines);
+			SplitLines(std::string_view{ s8 }, lines, [](const std::string_view line) { return Unicode::FromUTF8(line); });
 
 			return true;
 		}
@@ -382,13 +541,22 @@ namespace s3d
 			return false;
 		}
 
-		switch (m_info.encoding)
+		if ((m_info.encoding == TextEncoding::UTF16LE)
+			|| (m_info.encoding == TextEncoding::UTF16BE))
+		{
+			std::u16string s16;
+
+			if (not readAllUTF16(s16))
+			{
+				return false;
+			}
+
+			s = Unicode::UTF16ToUTF8(s16);
+
+			return true;
+		}
+		else
 		{
-		case TextEncoding::UTF16LE:
-			return readAllUTF16LE(s);
-		case TextEncoding::UTF16BE:
-			return readAllUTF16BE(s);
-		default:
 			return readAllUTF8(s);
 		}
 	}
@@ -405,30 +573,22 @@ namespace s3d
 				return false;
 			}
 
-			bool eof = true;
+			std::u16string s16;
 
-			for (;;)
+			if (not readAllUTF16(s16))
 			{
-				char32 codePoint;
-
-				if (not readCodePoint(codePoint))
-				{
-					break;
-				}
-
-				eof = false;
+				return false;
+			}
 
-				if (codePoint == U'\0')
-				{
-					break;
-				}
-				else if (codePoint != U'\r')
-				{
-					s.push_back(codePoint);
-				}
+			// NUL 以降は読み込まない
+			if (const size_t nul = s16.find(u'\0'); nul != std::u16string::npos)
+			{
+				s16.resize(nul);
 			}
 
-			return (not eof);
+			s = Unicode::FromUTF16(s16);
+
+			return true;
 		}
 		else
 		{
@@ -472,6 +632,35 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
+	size_t TextReader::TextReaderDetail::bufferedSize() const noexcept
+	{
+		return (m_bufferEnd - m_bufferPos);
+	}
+
+	bool TextReader::TextReaderDetail::fillBuffer()
+	{
+		const size_t leftover = bufferedSize();
+
+		if (leftover && m_bufferPos)
+		{
+			std::memmove(m_buffer.get(), (m_buffer.get() + m_bufferPos), leftover);
+		}
+
+		m_bufferPos = 0;
+		m_bufferEnd = leftover;
+
+		const int64 readBytes = m_reader->read((m_buffer.get() + leftover), static_cast<int64>(BufferSize - leftover));
+
+		if (readBytes <= 0)
+		{
+			return false;
+		}
+
+		m_bufferEnd += static_cast<size_t>(readBytes);
+
+		return true;
+	}
+
 	bool TextReader::TextReaderDetail::readCodePoint(char32& codePoint)
 	{
 		switch (m_info.encoding)
@@ -596,243 +785,98 @@ namespace s3d
 
 	bool TextReader::TextReaderDetail::readByte(uint8& c)
 	{
-		return m_reader->read(c);
-	}
-
-	bool TextReader::TextReaderDetail::readTwoBytes(uint16& c)
-	{
-		return m_reader->read(c);
-	}
-
-	bool TextReader::TextReaderDetail::readLineUTF8(std::string& line)
-	{
-		bool eof = true;
-
-		for (;;)
+		if ((m_bufferPos == m_bufferEnd) && (not fillBuffer()))
 		{
-			uint8 ch;
-
-			if (not readByte(ch))
-			{
-				break;
-			}
-
-			eof = false;
-
-			if ((ch == '\n') || (ch == '\0'))
-			{
-				break;
-			}
-			else if (ch != '\r')
-			{
-				line.push_back(ch);
-			}
+			return false;
 		}
 
-		return (not eof);
+		c = m_buffer[m_bufferPos++];
+		return true;
 	}
 
-	bool TextReader::TextReaderDetail::readLineUTF16LE(std::string& line)
+	bool TextReader::TextReaderDetail::readTwoBytes(uint16& c)
 	{
-		// [Siv3D ToDo] バッファを使わないようにする
-		std::u16string line16;
-
-		bool eof = true;
-
-		for (;;)
+		if ((bufferedSize() < sizeof(uint16)) && ((not fillBuffer()) || (bufferedSize() < sizeof(uint16))))
 		{
-			uint16 c0;
-
-			if (not readTwoBytes(c0))
-			{
-				break;
-			}
-
-			eof = false;
-
-			if (Unicode::IsHighSurrogate(c0))
-			{
-				uint16 c1;
-
-				if (not readTwoBytes(c1))
-				{
-					break;
-				}
-
-				line16.push_back(c0);
-				line16.push_back(c1);
-			}
-			else
-			{
-				if (c0 == u'\n' || c0 == u'\0')
-				{
-					break;
-				}
-				else if (c0 != u'\r')
-				{
-					line16.push_back(c0);
-				}
-			}
+			return false;
 		}
 
-		line = Unicode::UTF16ToUTF8(line16);
-
-		return (not eof);
+		std::memcpy(&c, (m_buffer.get() + m_bufferPos), sizeof(uint16));
+		m_bufferPos += sizeof(uint16);
+		return true;
 	}
 
-	bool TextReader::TextReaderDetail::readLineUTF16BE(std::string& line)
+	bool TextReader::TextReaderDetail::readLineUTF8(std::string& line)
 	{
-		// [Siv3D ToDo] バッファを使わないようにする
-		std::u16string line16;
-
 		bool eof = true;
 
 		for (;;)
 		{
-			uint16 c0;
-
-			if (not readTwoBytes(c0))
+			if ((m_bufferPos == m_bufferEnd) && (not fillBuffer()))
 			{
 				break;
 			}
 
 			eof = false;
 
-			c0 = SwapEndian(c0);
-
-			if (Unicode::IsHighSurrogate(c0))
-			{
-				uint16 c1;
-
-				if (not readTwoBytes(c1))
-				{
-					break;
-				}
+			const uint8* const first = (m_buffer.get() + m_bufferPos);
+			const uint8* const last = (m_buffer.get() + m_bufferEnd);
+			const uint8* const lineEnd = FindLineEndUTF8(first, last);
 
-				c1 = SwapEndian(c1);
+			AppendWithoutCR(line, reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(lineEnd));
 
-				line16.push_back(c0);
-				line16.push_back(c1);
-			}
-			else
+			if (lineEnd != last)
 			{
-				if (c0 == u'\n' || c0 == u'\0')
-				{
-					break;
-				}
-				else if (c0 != u'\r')
-				{
-					line16.push_back(c0);
-				}
+				m_bufferPos = ((lineEnd - m_buffer.get()) + 1);
+				break;
 			}
-		}
 
-		line = Unicode::UTF16ToUTF8(line16);
+			m_bufferPos = m_bufferEnd;
+		}
 
 		return (not eof);
 	}
 
-	bool TextReader::TextReaderDetail::readLinesUTF16LE(Array<std::string>& lines)
+	bool TextReader::TextReaderDetail::readLineUTF16(std::u16string& line)
 	{
-		std::u16string line16;
+		const bool bigEndian = (m_info.encoding == TextEncoding::UTF16BE);
 
 		bool eof = true;
 
 		for (;;)
 		{
-			uint16 c0;
-
-			if (not readTwoBytes(c0))
+			if ((bufferedSize() < sizeof(char16)) && ((not fillBuffer()) || (bufferedSize() < sizeof(char16))))
 			{
-				if (not eof)
-				{
-					lines.push_back(Unicode::UTF16ToUTF8(line16));
-				}
-
 				break;
 			}
 
 			eof = false;
 
-			if (Unicode::IsHighSurrogate(c0))
-			{
-				uint16 c1;
+			const uint8* const first = (m_buffer.get() + m_bufferPos);
+			const size_t numUnits = (bufferedSize() / sizeof(char16));
+			const size_t lineLength = FindLineEndUTF16(first, numUnits, bigEndian);
 
-				if (not readTwoBytes(c1))
-				{
-					break;
-				}
+			const size_t oldSize = line.size();
+			line.resize(oldSize + lineLength);
+			std::memcpy((line.data() + oldSize), first, (lineLength * sizeof(char16)));
 
-				line16.push_back(c0);
-				line16.push_back(c1);
-			}
-			else
+			if (bigEndian)
 			{
-				if ((c0 == u'\n') || (c0 == u'\0'))
-				{
-					lines.push_back(Unicode::UTF16ToUTF8(line16));
-					line16.clear();
-				}
-				else if (c0 != u'\r')
-				{
-					line16.push_back(c0);
-				}
+				simdutf::change_endianness_utf16((line.data() + oldSize), lineLength, (line.data() + oldSize));
 			}
-		}
 
-		return (not eof);
-	}
-
-	bool TextReader::TextReaderDetail::readLinesUTF16BE(Array<std::string>& lines)
-	{
-		std::u16string line16;
-
-		bool eof = true;
-
-		for (;;)
-		{
-			uint16 c0;
-
-			if (not readTwoBytes(c0))
+			if (line.find(u'\r', oldSize) != std::u16string::npos)
 			{
-				if (not eof)
-				{
-					lines.push_back(Unicode::UTF16ToUTF8(line16));
-				}
-
-				break;
+				line.erase(std::remove((line.begin() + oldSize), line.end(), u'\r'), line.end());
 			}
 
-			eof = false;
-
-			c0 = SwapEndian(c0);
-
-			if (Unicode::IsHighSurrogate(c0))
-			{
-				uint16 c1;
-
-				if (not readTwoBytes(c1))
-				{
-					break;
-				}
-
-				c1 = SwapEndian(c1);
-
-				line16.push_back(c0);
-				line16.push_back(c1);
-			}
-			else
+			if (lineLength < numUnits)
 			{
-				if ((c0 == u'\n') || (c0 == u'\0'))
-				{
-					lines.push_back(Unicode::UTF16ToUTF8(line16));
-					line16.clear();
-				}
-				else if (c0 != u'\r')
-				{
-					line16.push_back(c0);
-				}
+				m_bufferPos += ((lineLength + 1) * sizeof(char16));
+				break;
 			}
+
+			m_bufferPos += (numUnits * sizeof(char16));
 		}
 
 		return (not eof);
@@ -840,127 +884,47 @@ namespace s3d
 
 	bool TextReader::TextReaderDetail::readAllUTF8(std::string& s)
 	{
-		const int64 readSize = (m_reader->size() - m_reader->getPos());
-
-		s.resize(readSize);
-
-		const int64 readBytes = m_reader->read(s.data(), readSize);
-
-		if (readBytes < readSize)
-		{
-			s.resize(readBytes);
-		}
-
-		s.erase(std::remove(s.begin(), s.end(), '\r'), s.end());
-
-		return (0 < readBytes);
-	}
-
-	bool TextReader::TextReaderDetail::readAllUTF16LE(std::string& s)
-	{
-		std::u16string line;
-
-		bool eof = true;
-
-		for (;;)
-		{
-			uint16 c0;
+		const size_t buffered = bufferedSize();
 
-			if (not readTwoBytes(c0))
-			{
-				if (not eof)
-				{
-					s.append(Unicode::UTF16ToUTF8(line));
-				}
+		s.resize(buffered);
 
-				break;
-			}
+		std::memcpy(s.data(), (m_buffer.get() + m_bufferPos), buffered);
 
-			eof = false;
+		m_bufferPos = m_bufferEnd = 0;
 
-			if (Unicode::IsHighSurrogate(c0))
-			{
-				uint16 c1;
+		const size_t end = ReadToEnd(*m_reader, s, buffered, BufferSize);
 
-				if (not readTwoBytes(c1))
-				{
-					break;
-				}
+		s.resize(end);
 
-				line.push_back(c0);
-				line.push_back(c1);
-			}
-			else
-			{
-				if (c0 == u'\n')
-				{
-					line.push_back(c0);
-					s.append(Unicode::UTF16ToUTF8(line));
-					line.clear();
-				}
-				else if (c0 != u'\r')
-				{
-					line.push_back(c0);
-				}
-			}
-		}
+		s.erase(std::remove(s.begin(), s.end(), '\r'), s.end());
 
-		return (not eof);
+		return (0 < end);
 	}
 
-	bool TextReader::TextReaderDetail::readAllUTF16BE(std::string& s)
+	bool TextReader::TextReaderDetail::readAllUTF16(std::u16string& s)
 	{
-		std::u16string line;
-
-		bool eof = true;
-
-		for (;;)
-		{
-			uint16 c0;
-
-			if (not readTwoBytes(c0))
-			{
-				if (not eof)
-				{
-					s.append(Unicode::UTF16ToUTF8(line));
-				}
+		const size_t buffered = bufferedSize();
 
-				break;
-			}
+		// 奇数バイトの場合に備えて 1 コードユニット余分に確保する
+		s.resize((buffered + 1) / sizeof(char16));
 
-			eof = false;
+		std::memcpy(s.data(), (m_buffer.get() + m_bufferPos), buffered);
 
-			c0 = SwapEndian(c0);
+		m_bufferPos = m_bufferEnd = 0;
 
-			if (Unicode::IsHighSurrogate(c0))
-			{
-				uint16 c1;
+		const size_t end = ReadToEnd(*m_reader, s, buffered, BufferSize);
 
-				if (not readTwoBytes(c1))
-				{
-					break;
-				}
+		const size_t numUnits = (end / sizeof(char16));
 
-				c1 = SwapEndian(c1);
+		s.resize(numUnits);
 
-				line.push_back(c0);
-				line.push_back(c1);
-			}
-			else
-			{
-				if (c0 == u'\n')
-				{
-					line.push_back(c0);
-					s.append(Unicode::UTF16ToUTF8(line));
-					line.clear();
-				}
-				else if (c0 != u'\r')
-				{
-					line.push_back(c0);
-				}
-			}
+		if (m_info.encoding == TextEncoding::UTF16BE)
+		{
+			simdutf::change_endianness_utf16(s.data(), s.size(), s.data());
 		}
 
-		return (not eof);
+		s.erase(std::remove(s.begin(), s.end(), u'\r'), s.end());
+
+		return (0 < numUnits);
 	}
 }
@@ -58,6 +58,9 @@ namespace s3d
 
 	private:
 
+		/// @brief 先読みバッファのサイズ（バイト）
+		static constexpr size_t BufferSize = (64 * 1024);
+
 		std::unique_ptr<IReader> m_reader;
 
 		struct Info
@@ -67,6 +70,23 @@ namespace s3d
 			bool isOpen = false;
 		} m_info;
 
+		/// @brief 先読みバッファ
+		std::unique_ptr<uint8[]> m_buffer;
+
+		/// @brief 先読みバッファ内の次に読む位置
+		size_t m_bufferPos = 0;
+
+		/// @brief 先読みバッファ内の有効なデータの終端
+		size_t m_bufferEnd = 0;
+
+		[[nodiscard]]
+		size_t bufferedSize() const noexcept;
+
+		/// @brief 未読のデータをバッファの先頭に移動し、残りの領域に新しいデータを読み込みます。
+		/// @return 新しいデータを 1 バイト以上読み込んだ場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool fillBuffer();
+
 		[[nodiscard]]
 		bool readCodePoint(char32& codePoint);
 
@@ -88,25 +108,19 @@ namespace s3d
 		[[nodiscard]]
 		bool readLineUTF8(std::string& line);
 
+		/// @brief UTF-16 の 1 行を UTF-16LE 文字列として読み込みます。
+		/// @param line 読み込んだ行の格納先。改行文字と CR は含みません。
+		/// @return 1 コードユニット以上読み込んだ場合 true, それ以外の場合は false
 		[[nodiscard]]
-		bool readLineUTF16LE(std::string& line);
-
-		[[nodiscard]]
-		bool readLineUTF16BE(std::string& line);
-
-		[[nodiscard]]
-		bool readLinesUTF16LE(Array<std::string>& lines);
-
-		[[nodiscard]]
-		bool readLinesUTF16BE(Array<std::string>& lines);
+		bool readLineUTF16(std::u16string& line);
 
 		[[nodiscard]]
 		bool readAllUTF8(std::string& s);
 
+		/// @brief 残りのすべてのデータを UTF-16LE 文字列として読み込みます。
+		/// @param s 読み込んだ文字列の格納先。CR は含みません。
+		/// @return 1 コードユニット以上読み込んだ場合 true, それ以外の場合は false
 		[[nodiscard]]
-		bool readAllUTF16LE(std::string& s);
-
-		[[nodiscard]]
-		bool readAllUTF16BE(std::string& s);
+		bool readAllUTF16(std::u16string& s);
 	};
 }
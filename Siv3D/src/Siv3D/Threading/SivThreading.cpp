@@ -10,11 +10,39 @@
 //-----------------------------------------------
 
 # include <thread>
+# include <mutex>
 # include <Siv3D/Threading.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/Utility.hpp>
+# include "ThreadPool.hpp"
 
 namespace s3d
 {
+	namespace
+	{
+		[[nodiscard]]
+		static ThreadPool& GetThreadPool()
+		{
+			static ThreadPool pool{ (Threading::GetConcurrency() - 1) };
+			return pool;
+		}
+
+		/// @brief TaskExecutor::MainThread に積まれた関数
+		struct MainThreadTaskQueue
+		{
+			std::mutex mutex;
+
+			Array<std::function<void()>> tasks;
+		};
+
+		[[nodiscard]]
+		static MainThreadTaskQueue& GetMainThreadTaskQueue()
+		{
+			static MainThreadTaskQueue queue;
+			return queue;
+		}
+	}
+
 	namespace Threading
 	{
 		////////////////////////////////////////////////////////////////
@@ -28,5 +56,87 @@ namespace s3d
 			static const size_t n = Max<size_t>(1, std::thread::hardware_concurrency());
 			return n;
 		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetWorkerCount
+		//
+		////////////////////////////////////////////////////////////////
+
+		size_t GetWorkerCount()
+		{
+			return GetThreadPool().numWorkers();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	SetWorkerCount
+		//
+		////////////////////////////////////////////////////////////////
+
+		void SetWorkerCount(const size_t numWorkers)
+		{
+			GetThreadPool().setNumWorkers(numWorkers);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ParallelFor
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ParallelFor(const size_t begin, const size_t end, const FunctionRef<void(size_t, size_t)> f, const size_t grainSize)
+		{
+			GetThreadPool().parallelFor(begin, end, f, grainSize);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Post
+		//
+		////////////////////////////////////////////////////////////////
+
+		void Post(const TaskExecutor executor, std::function<void()> f)
+		{
+			switch (executor)
+			{
+			case TaskExecutor::ThreadPool:
+				GetThreadPool().submit(std::move(f));
+				break;
+			case TaskExecutor::MainThread:
+				{
+					MainThreadTaskQueue& queue = GetMainThreadTaskQueue();
+					std::lock_guard lock{ queue.mutex };
+					queue.tasks.push_back(std::move(f));
+					break;
+				}
+			default:
+				f();
+				break;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ProcessMainThreadTasks
+		//
+		////////////////////////////////////////////////////////////////
+
+		size_t ProcessMainThreadTasks()
+		{
+			MainThreadTaskQueue& queue = GetMainThreadTaskQueue();
+			Array<std::function<void()>> tasks;
+			{
+				std::lock_guard lock{ queue.mutex };
+				tasks.swap(queue.tasks);
+			}
+
+			for (auto& task : tasks)
+			{
+				task();
+			}
+
+			return tasks.size();
+		}
 	}
 }
@@ -0,0 +1,508 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ThreadPool.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 現在のスレッドが属するスレッドプール（ワーカースレッドでない場合は nullptr）
+		thread_local const ThreadPool* tl_pool = nullptr;
+
+		/// @brief 現在のスレッドのワーカーインデックス
+		thread_local size_t tl_workerIndex = 0;
+
+		/// @brief 眠る前にタスクを探す回数
+		constexpr int32 SpinCount = 64;
+
+		/// @brief grainSize が 0 の場合に、1 スレッドあたりに作るチャンクの目安
+		constexpr size_t ChunksPerThread = 8;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ThreadPool::ThreadPool(const size_t numWorkers)
+	{
+		start(numWorkers);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ThreadPool::~ThreadPool()
+	{
+		stop();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	numWorkers
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t ThreadPool::numWorkers() const noexcept
+	{
+		return m_workers.size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setNumWorkers
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::setNumWorkers(const size_t numWorkers)
+	{
+		if (numWorkers == m_workers.size())
+		{
+			return;
+		}
+
+		stop();
+
+		start(numWorkers);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	parallelFor
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::parallelFor(const size_t begin, const size_t end, const FunctionRef<void(size_t, size_t)> f, size_t grainSize)
+	{
+		if (end <= begin)
+		{
+			return;
+		}
+
+		const size_t count = (end - begin);
+
+		if (grainSize == 0)
+		{
+			grainSize = Max<size_t>(1, (count / ((m_workers.size() + 1) * ChunksPerThread)));
+		}
+
+		if (m_workers.empty() || (count <= grainSize))
+		{
+			f(begin, end);
+			return;
+		}
+
+		Job job{ .f = f, .grainSize = grainSize, .remaining{ count }, .hasException{ false }, .exception{} };
+
+		const size_t queueIndex = currentQueueIndex();
+
+		// 呼び出し元のスレッドも処理に参加する
+		execute(queueIndex, Task{ &job, begin, end });
+
+		// 他のスレッドに盗まれたチャンクが終わるまで、このジョブの残りのチャンクを手伝う
+		// （submit() で積まれた関数は無関係な処理を待つことがあるため、ここでは実行しない）
+		while (job.remaining.load(std::memory_order_acquire) != 0)
+		{
+			Task task;
+
+			if (tryAcquire(queueIndex, &job, task))
+			{
+				execute(queueIndex, task);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (job.exception)
+		{
+			std::rethrow_exception(job.exception);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	submit
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::submit(std::function<void()> f)
+	{
+		if (m_workers.empty())
+		{
+			RunFunction(f);
+			return;
+		}
+
+		{
+			std::lock_guard lock{ m_functionQueue.mutex };
+			m_functionQueue.functions.push_back(std::move(f));
+		}
+
+		notifyPushed();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	start
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::start(const size_t numWorkers)
+	{
+		m_stop = false;
+
+		m_queues.clear();
+
+		for (size_t i = 0; i < (numWorkers + 1); ++i)
+		{
+			m_queues.push_back(std::make_unique<WorkQueue>());
+		}
+
+		m_workers.reserve(numWorkers);
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	stop
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::stop()
+	{
+		{
+			std::lock_guard lock{ m_sleepMutex };
+			m_stop = true;
+		}
+
+		m_sleepCondition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			if (worker.joinable())
+			{
+				worker.join();
+			}
+		}
+
+		m_workers.clear();
+
+		// submit() で積まれたまま残っている関数は、ここで実行する
+		while (not m_functionQueue.functions.empty())
+		{
+			std::function<void()> function = std::move(m_functionQueue.functions.front());
+			m_functionQueue.functions.pop_front();
+			m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+			RunFunction(function);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	workerLoop
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::workerLoop(const size_t workerIndex)
+	{
+		tl_pool = this;
+		tl_workerIndex = workerIndex;
+
+		for (;;)
+		{
+			Task task;
+			std::function<void()> function;
+			bool found = false;
+
+			for (int32 i = 0; i < SpinCount; ++i)
+			{
+				// parallelFor のチャンクを優先する
+				if (tryAcquire(workerIndex, nullptr, task))
+				{
+					found = true;
+					break;
+				}
+
+				if (tryAcquireFunction(function))
+				{
+					found = true;
+					break;
+				}
+
+				std::this_thread::yield();
+			}
+
+			if (found)
+			{
+				if (function)
+				{
+					RunFunction(function);
+				}
+				else
+				{
+					execute(workerIndex, task);
+				}
+
+				continue;
+			}
+
+			std::unique_lock lock{ m_sleepMutex };
+
+			++m_numSleeping;
+
+			m_sleepCondition.wait(lock, [this]() { return (m_stop || (m_pendingTasks.load() != 0)); });
+
+			--m_numSleeping;
+
+			if (m_stop)
+			{
+				break;
+			}
+		}
+
+		tl_pool = nullptr;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	currentQueueIndex
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t ThreadPool::currentQueueIndex() const noexcept
+	{
+		if (tl_pool == this)
+		{
+			return tl_workerIndex;
+		}
+
+		// ワーカー以外のスレッドは共有キューを使う
+		return m_workers.size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	push
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::push(const size_t queueIndex, const Task& task)
+	{
+		{
+			WorkQueue& queue = *m_queues[queueIndex];
+			std::lock_guard lock{ queue.mutex };
+			queue.tasks.push_back(task);
+		}
+
+		notifyPushed();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	notifyPushed
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::notifyPushed()
+	{
+		m_pendingTasks.fetch_add(1);
+
+		if (m_numSleeping.load() != 0)
+		{
+			{
+				// 眠りにつく直前のワーカーが通知を取りこぼさないようにする
+				std::lock_guard lock{ m_sleepMutex };
+			}
+
+			m_sleepCondition.notify_one();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	tryPop
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ThreadPool::tryPop(const size_t queueIndex, const Job* job, Task& task)
+	{
+		WorkQueue& queue = *m_queues[queueIndex];
+		std::lock_guard lock{ queue.mutex };
+
+		// 自分のキューからは最後に積んだ（最も小さい）タスクを取り出す
+		for (auto it = queue.tasks.rbegin(); it != queue.tasks.rend(); ++it)
+		{
+			if (job && (it->job != job))
+			{
+				continue;
+			}
+
+			task = *it;
+			queue.tasks.erase(std::next(it).base());
+			m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	trySteal
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ThreadPool::trySteal(const size_t thiefIndex, const Job* job, Task& task)
+	{
+		const size_t numQueues = m_queues.size();
+
+		for (size_t i = 1; i < numQueues; ++i)
+		{
+			WorkQueue& queue = *m_queues[(thiefIndex + i) % numQueues];
+			std::unique_lock lock{ queue.mutex, std::try_to_lock };
+
+			if (not lock)
+			{
+				continue;
+			}
+
+			// 他のキューからは最も古い（最も大きい）タスクを盗む
+			for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it)
+			{
+				if (job && (it->job != job))
+				{
+					continue;
+				}
+
+				task = *it;
+				queue.tasks.erase(it);
+				m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	tryAcquire
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ThreadPool::tryAcquire(const size_t queueIndex, const Job* job, Task& task)
+	{
+		if (m_pendingTasks.load(std::memory_order_acquire) == 0)
+		{
+			return false;
+		}
+
+		return (tryPop(queueIndex, job, task) || trySteal(queueIndex, job, task));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	tryAcquireFunction
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ThreadPool::tryAcquireFunction(std::function<void()>& function)
+	{
+		if (m_pendingTasks.load(std::memory_order_acquire) == 0)
+		{
+			return false;
+		}
+
+		std::lock_guard lock{ m_functionQueue.mutex };
+
+		if (m_functionQueue.functions.empty())
+		{
+			return false;
+		}
+
+		function = std::move(m_functionQueue.functions.front());
+		m_functionQueue.functions.pop_front();
+		m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	execute
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::execute(const size_t queueIndex, Task task)
+	{
+		Job& job = *task.job;
+
+		// 範囲が grainSize 以下になるまで後半を自分のキューに積み、盗めるようにする
+		while (job.grainSize < (task.end - task.begin))
+		{
+			const size_t middle = (task.begin + (task.end - task.begin) / 2);
+			push(queueIndex, Task{ task.job, middle, task.end });
+			task.end = middle;
+		}
+
+		if (not job.hasException.load(std::memory_order_relaxed))
+		{
+			try
+			{
+				job.f(task.begin, task.end);
+			}
+			catch (...)
+			{
+				if (not job.hasException.exchange(true))
+				{
+					job.exception = std::current_exception();
+				}
+			}
+		}
+
+		job.remaining.fetch_sub((task.end - task.begin), std::memory_order_acq_rel);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RunFunction
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ThreadPool::RunFunction(std::function<void()>& function)
+	{
+		// 例外をワーカースレッドの外に出すと std::terminate() が呼ばれるため、ここで止める
+		try
+		{
+			function();
+		}
+		catch (const std::exception& e)
+		{
+			LOG_FAIL(fmt::format("❌ ThreadPool: A task threw an exception: {}", e.what()));
+		}
+		catch (...)
+		{
+			LOG_FAIL("❌ ThreadPool: A task threw an unknown exception");
+		}
+	}
+}
@@ -0,0 +1,153 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <exception>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <vector>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/FunctionRef.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ThreadPool
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief ワークスティーリング方式のスレッドプール
+	/// @remark 各ワーカーは自身のキューの末尾からタスクを取り出し、他のワーカーのキューの先頭からタスクを盗みます。
+	/// @remark submit() で積まれた関数は別のキューに入り、ワーカーだけが実行します。parallelFor() の完了を待つスレッドは、同じ parallelFor() のチャンクだけを手伝います。
+	class ThreadPool
+	{
+	public:
+
+		[[nodiscard]]
+		explicit ThreadPool(size_t numWorkers);
+
+		~ThreadPool();
+
+		[[nodiscard]]
+		size_t numWorkers() const noexcept;
+
+		/// @brief ワーカースレッドを作り直します。
+		/// @param numWorkers 新しいワーカースレッドの数
+		/// @remark 実行中のタスクがあるときに呼んではいけません。
+		void setNumWorkers(size_t numWorkers);
+
+		void parallelFor(size_t begin, size_t end, FunctionRef<void(size_t, size_t)> f, size_t grainSize);
+
+		/// @brief 関数をキューに積み、いずれかのワーカーで実行します。
+		/// @remark ワーカーがいない場合は、呼び出し元のスレッドでただちに実行します。
+		/// @remark 関数が送出した例外は、ログに出力して破棄します。
+		void submit(std::function<void()> f);
+
+	private:
+
+		/// @brief 1 回の parallelFor 呼び出しで共有される状態
+		struct Job
+		{
+			FunctionRef<void(size_t, size_t)> f;
+
+			size_t grainSize = 1;
+
+			std::atomic<size_t> remaining{ 0 };
+
+			std::atomic<bool> hasException{ false };
+
+			std::exception_ptr exception;
+		};
+
+		struct Task
+		{
+			Job* job = nullptr;
+
+			size_t begin = 0;
+
+			size_t end = 0;
+		};
+
+		struct WorkQueue
+		{
+			std::mutex mutex;
+
+			std::deque<Task> tasks;
+		};
+
+		// [0, numWorkers) はワーカー専用、最後の 1 つはワーカー以外のスレッドが共有する
+		std::vector<std::unique_ptr<WorkQueue>> m_queues;
+
+		/// @brief submit() で積まれた関数。ワーカーだけが取り出す
+		struct FunctionQueue
+		{
+			std::mutex mutex;
+
+			std::deque<std::function<void()>> functions;
+
+		} m_functionQueue;
+
+		std::vector<std::thread> m_workers;
+
+		std::atomic<size_t> m_pendingTasks{ 0 };
+
+		std::atomic<size_t> m_numSleeping{ 0 };
+
+		std::mutex m_sleepMutex;
+
+		std::condition_variable m_sleepCondition;
+
+		bool m_stop = false;
+
+		void start(size_t numWorkers);
+
+		void stop();
+
+		void workerLoop(size_t workerIndex);
+
+		[[nodiscard]]
+		size_t currentQueueIndex() const noexcept;
+
+		void push(size_t queueIndex, const Task& task);
+
+		/// @brief キューに積まれたタスクの数を増やし、眠っているワーカーを起こします。
+		void notifyPushed();
+
+		[[nodiscard]]
+		bool tryPop(size_t queueIndex, const Job* job, Task& task);
+
+		[[nodiscard]]
+		bool trySteal(size_t thiefIndex, const Job* job, Task& task);
+
+		/// @brief parallelFor() のチャンクを取り出します。
+		/// @param queueIndex 呼び出し元のスレッドのキュー
+		/// @param job nullptr でない場合は、このジョブのチャンクだけを取り出す
+		/// @param task 取り出したチャンク
+		/// @return 取り出した場合 true
+		[[nodiscard]]
+		bool tryAcquire(size_t queueIndex, const Job* job, Task& task);
+
+		/// @brief submit() で積まれた関数を取り出します。ワーカーだけが呼びます。
+		[[nodiscard]]
+		bool tryAcquireFunction(std::function<void()>& function);
+
+		void execute(size_t queueIndex, Task task);
+
+		/// @brief submit() で積まれた関数を実行します。例外はログに出力して破棄します。
+		static void RunFunction(std::function<void()>& function);
+	};
+}
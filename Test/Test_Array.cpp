@@ -193,3 +193,105 @@ TEST_CASE("Array.all")
 		static_assert(Array<int32>{ 2, 4, 6 }.all(IsOdd) == false);
 	}
 }
+
+TEST_CASE("Array.parallel")
+{
+	Array<int32> v(100000);
+
+	for (size_t i = 0; i < v.size(); ++i)
+	{
+		v[i] = static_cast<int32>(i);
+	}
+
+	CHECK_EQ(v.parallel_count_if(IsEven), v.count_if(IsEven));
+	CHECK_EQ(v.parallel_map([](int32 x) { return (x * 2); }), v.map([](int32 x) { return (x * 2); }));
+
+	{
+		Array<int32> a = v;
+		a.parallel_each([](int32& x) { x += 1; });
+		CHECK_EQ(a, v.map([](int32 x) { return (x + 1); }));
+	}
+
+	{
+		std::atomic<int64> sum = 0;
+		std::as_const(v).parallel_each([&](int32 x) { sum += x; });
+		CHECK_EQ(sum.load(), (static_cast<int64>(v.size()) * (static_cast<int64>(v.size()) - 1) / 2));
+	}
+
+	{
+		Array<int32> hits(1000);
+		Threading::ParallelFor(0, hits.size(), [&](size_t begin, size_t end) { for (size_t i = begin; i < end; ++i) { ++hits[i]; } }, 7);
+		CHECK(hits.all([](int32 x) { return (x == 1); }));
+	}
+
+	CHECK_THROWS(Threading::ParallelFor(0, 1000, [](size_t begin, size_t) { if (begin == 0) { throw std::runtime_error{ "error" }; } }, 1));
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+namespace
+{
+	// ワーカースレッドを呼び出しごとに作る、従来の std::async による分割
+	template <class Fty>
+	static void AsyncFanOut(const size_t count, Fty f)
+	{
+		const size_t numThreads = Threading::GetConcurrency();
+		const size_t countPerThread = Max<size_t>(1, ((count + (numThreads - 1)) / numThreads));
+
+		Array<std::future<void>> tasks;
+		size_t begin = 0;
+
+		for (size_t i = 0; (i < (numThreads - 1)) && (begin < count); ++i)
+		{
+			const size_t end = Min((begin + countPerThread), count);
+			tasks.emplace_back(std::async(std::launch::async, [=, &f]() { f(begin, end); }));
+			begin = end;
+		}
+
+		if (begin < count)
+		{
+			f(begin, count);
+		}
+
+		for (auto& task : tasks)
+		{
+			task.get();
+		}
+	}
+}
+
+TEST_CASE("Array.parallel.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	for (const size_t size : { 1'000, 10'000, 100'000, 1'000'000 })
+	{
+		Array<float> v(size, 1.0f);
+		const std::string title = ("Array<float>(" + std::to_string(size) + ").each(sqrt)");
+
+		Bench{}.title(title).run("serial", [&]() { v.each([](float& x) { x = std::sqrt(x); }); doNotOptimizeAway(v); });
+		Bench{}.title(title).run("std::async fan-out", [&]()
+		{
+			AsyncFanOut(v.size(), [&](size_t begin, size_t end) { for (size_t i = begin; i < end; ++i) { v[i] = std::sqrt(v[i]); } });
+			doNotOptimizeAway(v);
+		});
+		Bench{}.title(title).run("parallel_each", [&]() { v.parallel_each([](float& x) { x = std::sqrt(x); }); doNotOptimizeAway(v); });
+	}
+
+	for (const size_t size : { 1'000, 10'000, 100'000, 1'000'000 })
+	{
+		const Array<int32> v(size, 1);
+		const std::string title = ("Array<int32>(" + std::to_string(size) + ").count_if(IsOdd)");
+
+		Bench{}.title(title).run("serial", [&]() { doNotOptimizeAway(v.count_if(IsOdd)); });
+		Bench{}.title(title).run("std::async fan-out", [&]()
+		{
+			std::atomic<isize> result = 0;
+			AsyncFanOut(v.size(), [&](size_t begin, size_t end) { result += std::count_if((v.begin() + begin), (v.begin() + end), IsOdd); });
+			doNotOptimizeAway(result.load());
+		});
+		Bench{}.title(title).run("parallel_count_if", [&]() { doNotOptimizeAway(v.parallel_count_if(IsOdd)); });
+	}
+}
+
+# endif
@@ -0,0 +1,358 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	static AsyncTask<int32> AddLater(const int32 a, const int32 b)
+	{
+		const int32 x = co_await Async(TaskExecutor::ThreadPool, [=]() { return a; });
+		const int32 y = co_await Async(TaskExecutor::ThreadPool, [=]() { return b; });
+		co_return (x + y);
+	}
+
+	[[nodiscard]]
+	static AsyncTask<std::thread::id> ResumeOnMainThread()
+	{
+		co_await ResumeOn(TaskExecutor::ThreadPool);
+		co_await ResumeOn(TaskExecutor::MainThread);
+		co_return std::this_thread::get_id();
+	}
+
+	[[nodiscard]]
+	static AsyncTask<void> ThrowAfterAwait()
+	{
+		co_await Async(TaskExecutor::ThreadPool, []() {});
+		throw std::runtime_error{ "error" };
+	}
+
+	/// @brief タスクが完了するまで、メインスレッドの関数を実行します。
+	template <class Type>
+	static void RunMainThreadUntilReady(const AsyncTask<Type>& task)
+	{
+		while (not task.isReady())
+		{
+			Threading::ProcessMainThreadTasks();
+			std::this_thread::yield();
+		}
+	}
+}
+
+TEST_CASE("AsyncTask.then")
+{
+	// 値を受け取る継続
+	{
+		auto task = Async(TaskExecutor::ThreadPool, []() { return 20; })
+			.then([](int32 x) { return (x + 1); })
+			.then([](int32 x) { return (int64{ x } * 2); });
+		CHECK_EQ(task.get(), 42);
+	}
+
+	// std::async によるタスクにも継続を登録できる
+	{
+		auto task = Async([]() { return 10; }).then([](int32 x) { return (x * 3); }, TaskExecutor::Inline);
+		CHECK_EQ(task.get(), 30);
+	}
+
+	// void のタスク
+	{
+		std::atomic<int32> count = 0;
+		auto task = Async(TaskExecutor::ThreadPool, [&]() { ++count; })
+			.then([&]() { ++count; })
+			.then([&]() { return count.load(); });
+		CHECK_EQ(task.get(), 2);
+	}
+
+	// 例外は値を受け取る継続を飛ばして伝わる
+	{
+		bool called = false;
+		auto task = Async(TaskExecutor::ThreadPool, []() -> int32 { throw std::runtime_error{ "error" }; })
+			.then([&](int32 x) { called = true; return x; });
+		CHECK_THROWS_AS(task.get(), std::runtime_error);
+		CHECK_FALSE(called);
+	}
+
+	// タスクを受け取る継続は例外を処理できる
+	{
+		auto task = Async(TaskExecutor::ThreadPool, []() -> int32 { throw std::runtime_error{ "error" }; })
+			.then([](AsyncTask<int32> t)
+				{
+					try
+					{
+						return t.get();
+					}
+					catch (const std::runtime_error&)
+					{
+						return -1;
+					}
+				});
+		CHECK_EQ(task.get(), -1);
+	}
+}
+
+TEST_CASE("AsyncTask.Cancellation")
+{
+	const CancellationToken token;
+	CHECK_FALSE(token.isCanceled());
+
+	std::promise<void> gate;
+	AsyncTask<void> first = Async([future = gate.get_future().share()]() { future.wait(); });
+
+	bool called = false;
+	auto task = first.then([&]() { called = true; }, TaskExecutor::ThreadPool, token);
+
+	token.cancel();
+	CHECK(token.isCanceled());
+	gate.set_value();
+
+	CHECK_THROWS_AS(task.get(), TaskCanceledError);
+	CHECK_FALSE(called);
+	CHECK_THROWS_AS(token.throwIfCanceled(), TaskCanceledError);
+}
+
+TEST_CASE("AsyncTask.WhenAll")
+{
+	{
+		Array<AsyncTask<int32>> tasks;
+
+		for (int32 i = 0; i < 64; ++i)
+		{
+			tasks << Async(TaskExecutor::ThreadPool, [i]() { return (i * i); });
+		}
+
+		const Array<int32> results = WhenAll(std::move(tasks)).get();
+		REQUIRE_EQ(results.size(), 64);
+
+		for (int32 i = 0; i < 64; ++i)
+		{
+			CHECK_EQ(results[i], (i * i));
+		}
+	}
+
+	{
+		std::atomic<int32> count = 0;
+		Array<AsyncTask<void>> tasks;
+
+		for (int32 i = 0; i < 16; ++i)
+		{
+			tasks << Async(TaskExecutor::ThreadPool, [&]() { ++count; });
+		}
+
+		tasks << Async(TaskExecutor::ThreadPool, []() { throw std::runtime_error{ "error" }; });
+
+		CHECK_THROWS_AS(WhenAll(std::move(tasks)).get(), std::runtime_error);
+		CHECK_EQ(count.load(), 16);
+	}
+
+	CHECK(WhenAll(Array<AsyncTask<int32>>{}).get().isEmpty());
+}
+
+TEST_CASE("AsyncTask.WhenAny")
+{
+	std::promise<void> gate;
+	Array<AsyncTask<int32>> tasks;
+	tasks << Async([future = gate.get_future().share()]() { future.wait(); return 0; });
+	tasks << Async(TaskExecutor::ThreadPool, []() { return 1; });
+
+	const auto [index, value] = WhenAny(std::move(tasks)).get();
+	CHECK_EQ(index, 1);
+	CHECK_EQ(value, 1);
+	gate.set_value();
+
+	CHECK_THROWS_AS((void)WhenAny(Array<AsyncTask<int32>>{}), Error);
+}
+
+TEST_CASE("AsyncTask.MainThread")
+{
+	const std::thread::id mainThreadID = std::this_thread::get_id();
+
+	auto task = Async(TaskExecutor::ThreadPool, []() { return std::this_thread::get_id(); })
+		.then([](std::thread::id) { return std::this_thread::get_id(); }, TaskExecutor::MainThread);
+
+	RunMainThreadUntilReady(task);
+	CHECK_EQ(task.get(), mainThreadID);
+}
+
+TEST_CASE("AsyncTask.Coroutine")
+{
+	CHECK_EQ(AddLater(20, 22).get(), 42);
+
+	CHECK_THROWS_AS(ThrowAfterAwait().get(), std::runtime_error);
+
+	{
+		auto task = ResumeOnMainThread();
+		RunMainThreadUntilReady(task);
+		CHECK_EQ(task.get(), std::this_thread::get_id());
+	}
+
+	// コルーチンにも継続を登録できる
+	{
+		auto task = AddLater(1, 2).then([](int32 x) { return (x * 10); });
+		CHECK_EQ(task.get(), 30);
+	}
+}
+
+TEST_CASE("Threading.Post")
+{
+	// ワーカースレッドが無いと Post() がその場で実行されるため、少なくとも 1 つ用意する
+	const size_t workerCount = Threading::GetWorkerCount();
+	const ScopeExit restoreWorkerCount = [&]() { Threading::SetWorkerCount(workerCount); };
+	Threading::SetWorkerCount(Max<size_t>(workerCount, 1));
+
+	SUBCASE("ParallelFor does not run blocking posted functions")
+	{
+		// ワーカーより 1 つ多く積むので、少なくとも 1 つはキューに残る
+		const size_t numBlocking = (Threading::GetWorkerCount() + 1);
+		std::atomic<bool> released = false;
+		std::atomic<size_t> finished = 0;
+
+		for (size_t i = 0; i < numBlocking; ++i)
+		{
+			Threading::Post(TaskExecutor::ThreadPool, [&]()
+			{
+				released.wait(false);
+				++finished;
+			});
+		}
+
+		// 呼び出し元のスレッドは自分のチャンクだけを処理し、キューに残った関数を待たずに完了する
+		std::atomic<uint64> sum = 0;
+		Threading::ParallelFor(0, 10000, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				sum += i;
+			}
+		}, 16);
+
+		CHECK_EQ(sum.load(), (10000ull * 9999ull / 2));
+		CHECK_LT(finished.load(), numBlocking);
+
+		released = true;
+		released.notify_all();
+
+		while (finished.load() < numBlocking)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	SUBCASE("exceptions are caught")
+	{
+		const ScopedLogSilencer logSilencer;
+
+		std::atomic<bool> done = false;
+		Threading::Post(TaskExecutor::ThreadPool, []() { throw std::runtime_error{ "error" }; });
+		Threading::Post(TaskExecutor::ThreadPool, []() { throw 0; });
+		Threading::Post(TaskExecutor::ThreadPool, [&]()
+		{
+			done = true;
+			done.notify_all();
+		});
+
+		// 例外を送出した関数の後も、ワーカーは関数を実行し続ける
+		done.wait(false);
+		CHECK(done.load());
+	}
+
+	SUBCASE("continuations of std::async tasks do not occupy workers")
+	{
+		// 完了通知を持たないタスクに、ワーカーより多くの継続をつなぐ
+		const size_t numBlocking = (Threading::GetWorkerCount() + 1);
+		std::atomic<bool> released = false;
+		Array<AsyncTask<int32>> tasks;
+
+		for (size_t i = 0; i < numBlocking; ++i)
+		{
+			tasks << Async([&]()
+				{
+					released.wait(false);
+					return 1;
+				}).then([](int32 x) { return (x + 1); });
+		}
+
+		// 継続が完了を待っている間も、ワーカーは Post() された関数を実行できる
+		std::atomic<bool> posted = false;
+		Threading::Post(TaskExecutor::ThreadPool, [&]() { posted = true; });
+
+		const auto deadline = (std::chrono::steady_clock::now() + std::chrono::seconds{ 5 });
+
+		while ((not posted.load()) && (std::chrono::steady_clock::now() < deadline))
+		{
+			std::this_thread::yield();
+		}
+
+		CHECK(posted.load());
+
+		released = true;
+		released.notify_all();
+
+		for (auto& task : tasks)
+		{
+			CHECK_EQ(task.get(), 2);
+		}
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("AsyncTask.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	Bench{}.title("AsyncTask (1000 small tasks)").run("Async (std::async)", [&]()
+		{
+			Array<AsyncTask<int32>> tasks;
+
+			for (int32 i = 0; i < 1000; ++i)
+			{
+				tasks << Async([i]() { return i; });
+			}
+
+			int64 sum = 0;
+
+			for (auto& task : tasks)
+			{
+				sum += task.get();
+			}
+
+			doNotOptimizeAway(sum);
+		});
+
+	Bench{}.title("AsyncTask (1000 small tasks)").run("Async (TaskExecutor::ThreadPool) + WhenAll", [&]()
+		{
+			Array<AsyncTask<int32>> tasks;
+
+			for (int32 i = 0; i < 1000; ++i)
+			{
+				tasks << Async(TaskExecutor::ThreadPool, [i]() { return i; });
+			}
+
+			doNotOptimizeAway(WhenAll(std::move(tasks)).get());
+		});
+
+	Bench{}.title("AsyncTask (then chain)").run("100 continuations", [&]()
+		{
+			AsyncTask<int32> task = Async(TaskExecutor::ThreadPool, []() { return 0; });
+
+			for (int32 i = 0; i < 100; ++i)
+			{
+				task = task.then([](int32 x) { return (x + 1); });
+			}
+
+			doNotOptimizeAway(task.get());
+		});
+}
+
+# endif
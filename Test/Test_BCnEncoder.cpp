@@ -0,0 +1,129 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+static Image MakeBCnTestImage(const int32 width, const int32 height)
+{
+	Image image{ width, height };
+
+	for (int32 y = 0; y < height; ++y)
+	{
+		for (int32 x = 0; x < width; ++x)
+		{
+			image[y][x] = Color{ static_cast<uint8>(x), static_cast<uint8>(y), static_cast<uint8>((x ^ y) + RandomUint8() % 16), static_cast<uint8>(255 - (x + y) / 2) };
+		}
+	}
+
+	return image;
+}
+
+/// @brief DDS ヘッダのサイズ
+static constexpr size_t DDSHeaderSize = (4 + 124);
+
+/// @brief DX10 拡張ヘッダのサイズ
+static constexpr size_t DX10HeaderSize = 20;
+
+static size_t CountBlocks(const int32 width, const int32 height, const bool mipmaps)
+{
+	const size_t mipCount = (mipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
+	size_t numBlocks = 0;
+
+	for (size_t mip = 0; mip < mipCount; ++mip)
+	{
+		const size_t mipWidth = Max(1, (width >> mip));
+		const size_t mipHeight = Max(1, (height >> mip));
+		numBlocks += (((mipWidth + 3) / 4) * ((mipHeight + 3) / 4));
+	}
+
+	return numBlocks;
+}
+
+TEST_CASE("BCnEncoder.size")
+{
+	const Image image = MakeBCnTestImage(256, 128);
+	const BCnEncoder encoder;
+
+	for (const bool mipmaps : { false, true })
+	{
+		const GenerateMipmaps generateMipmaps{ mipmaps };
+		const size_t numBlocks = CountBlocks(image.width(), image.height(), mipmaps);
+
+		CHECK_EQ(encoder.encodeBC1(image, generateMipmaps).size(), (DDSHeaderSize + numBlocks * 8));
+		CHECK_EQ(encoder.encodeBC3(image, generateMipmaps).size(), (DDSHeaderSize + numBlocks * 16));
+		CHECK_EQ(encoder.encodeBC4(image, generateMipmaps).size(), (DDSHeaderSize + numBlocks * 8));
+		CHECK_EQ(encoder.encodeBC5(image, generateMipmaps).size(), (DDSHeaderSize + numBlocks * 16));
+		CHECK_EQ(encoder.encodeBC7(image, generateMipmaps).size(), (DDSHeaderSize + DX10HeaderSize + numBlocks * 16));
+	}
+
+	// 幅と高さが 4 の倍数でない画像はエンコードできない
+	CHECK(encoder.encodeBC7(MakeBCnTestImage(30, 30)).isEmpty());
+}
+
+TEST_CASE("BCnEncoder.deterministic")
+{
+	// 並列にエンコードしても、結果はスレッドの割り当てに依存しない
+	const Image image = MakeBCnTestImage(512, 256);
+	const BCnEncoder encoder;
+
+	CHECK_EQ(encoder.encodeBC1(image), encoder.encodeBC1(image));
+	CHECK_EQ(encoder.encodeBC7(image), encoder.encodeBC7(image));
+
+	BCnEncodeOptions options;
+	options.rdoLambda = 1.0f;
+
+	const Blob rdo1 = encoder.encodeBC7(image, GenerateMipmaps::Yes, options);
+	const Blob rdo2 = encoder.encodeBC7(image, GenerateMipmaps::Yes, options);
+	CHECK_EQ(rdo1, rdo2);
+	CHECK_EQ(rdo1.size(), encoder.encodeBC7(image).size());
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("BCnEncoder.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Image image = MakeBCnTestImage(1024, 1024);
+	const BCnEncoder encoder;
+
+	// ミップマップを含めたピクセル数
+	const double megapixels = (CountBlocks(image.width(), image.height(), true) * 16 / 1'000'000.0);
+
+	const auto run = [&](const StringView name, auto f)
+	{
+		MillisecClock clock;
+		const Blob blob = f();
+		const int64 ms = Max<int64>(clock.ms(), 1);
+		Console << U"BCnEncoder::encode{} | {} x {} + mipmaps | {} ms ({:.2f} MP/s)"_fmt(name, image.width(), image.height(), ms, (megapixels / (ms / 1000.0)));
+		CHECK_FALSE(blob.isEmpty());
+	};
+
+	run(U"BC1", [&]() { return encoder.encodeBC1(image); });
+	run(U"BC3", [&]() { return encoder.encodeBC3(image); });
+	run(U"BC4", [&]() { return encoder.encodeBC4(image); });
+	run(U"BC5", [&]() { return encoder.encodeBC5(image); });
+	run(U"BC7", [&]() { return encoder.encodeBC7(image); });
+
+	{
+		BCnEncodeOptions options;
+		options.bc7UberLevel = 4;
+		run(U"BC7 (uber level 4)", [&]() { return encoder.encodeBC7(image, GenerateMipmaps::Yes, options); });
+	}
+
+	{
+		BCnEncodeOptions options;
+		options.rdoLambda = 1.0f;
+		run(U"BC7 (RDO lambda 1.0)", [&]() { return encoder.encodeBC7(image, GenerateMipmaps::Yes, options); });
+	}
+}
+
+# endif
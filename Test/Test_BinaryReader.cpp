@@ -140,3 +140,136 @@ TEST_CASE("BinaryReader")
 		CHECK(reader.getPos() == FileSize);
 	}
 }
+
+TEST_CASE("BinaryReader.Async")
+{
+	constexpr int64 FileSize = (1 << 20);
+	const FilePath path{ U"../../Test/output/binaryreader/async.bin" };
+	{
+		CHECK(not FileSystem::Exists(path));
+		{
+			BinaryWriter writer{ path };
+			CHECK(writer.isOpen());
+
+			for (uint32 i = 0; i < (FileSize / sizeof(uint32)); ++i)
+			{
+				writer.write(i * 2654435761u);
+			}
+		}
+	}
+
+	BinaryReader reader{ path };
+	REQUIRE(reader.isOpen());
+	REQUIRE(reader.size() == FileSize);
+
+	// 1 つの範囲
+	{
+		CHECK(reader.setPos(100) == 100);
+		CHECK(reader.readBlobAsync(4096, 256).get() == reader.lookaheadBlob(4096, 256));
+		CHECK(reader.readBlobAsync((FileSize - 10), 256).get().size() == 10);
+		CHECK(reader.readBlobAsync(FileSize, 256).get().isEmpty());
+		CHECK(reader.readBlobAsync(0, 0).get().isEmpty());
+		CHECK(reader.getPos() == 100);
+
+		CHECK_THROWS_AS((void)reader.readBlobAsync(-1, 4), Error);
+		CHECK_THROWS_AS((void)reader.readBlobAsync((FileSize + 1), 4), Error);
+	}
+
+	// 多数の小さな範囲
+	{
+		Array<AsyncReadRequest> requests;
+
+		for (int32 i = 0; i < 2000; ++i)
+		{
+			const int64 pos = Random<int64>(0, FileSize);
+			requests << AsyncReadRequest{ pos, Random<int64>(0, 4096) };
+		}
+
+		requests << AsyncReadRequest{ 0, FileSize };
+
+		const Array<Blob> blobs = reader.readBlobAsync(requests).get();
+		REQUIRE(blobs.size() == requests.size());
+
+		for (size_t i = 0; i < requests.size(); ++i)
+		{
+			CHECK(blobs[i] == reader.lookaheadBlob(requests[i].pos, requests[i].size));
+		}
+
+		CHECK(reader.readBlobAsync(Array<AsyncReadRequest>{}).get().isEmpty());
+	}
+
+	// 完了のコールバック
+	{
+		constexpr size_t RequestCount = 64;
+		std::atomic<size_t> completedCount{ 0 };
+		std::atomic<size_t> indexSum{ 0 };
+		std::atomic<size_t> readBytes{ 0 };
+		std::promise<void> done;
+
+		reader.readAsync(Array<AsyncReadRequest>(RequestCount, AsyncReadRequest{ 16, 16 }), [&](const size_t index, Blob&& blob)
+			{
+				readBytes += blob.size();
+				indexSum += index;
+
+				if (++completedCount == RequestCount)
+				{
+					done.set_value();
+				}
+			});
+
+		done.get_future().get();
+		CHECK(readBytes == (RequestCount * 16));
+		CHECK(indexSum == ((RequestCount * (RequestCount - 1)) / 2));
+	}
+
+	// 読み込み中にファイルを閉じる
+	{
+		AsyncTask<Array<Blob>> task = reader.readBlobAsync(Array<AsyncReadRequest>(16, AsyncReadRequest{ 0, FileSize }));
+		const Blob expected = reader.lookaheadBlob(0, FileSize);
+		reader.close();
+		CHECK(not reader.isOpen());
+
+		for (const auto& blob : task.get())
+		{
+			CHECK(blob == expected);
+		}
+
+		CHECK(reader.readBlobAsync(0, 16).get().isEmpty());
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("BinaryReader.Async.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	constexpr int64 FileSize = (64 << 20);
+	const FilePath path{ U"../../Test/output/binaryreader/async_benchmark.bin" };
+	{
+		const Blob data(FileSize);
+		BinaryWriter writer{ path };
+		writer.write(data.data(), data.size());
+	}
+
+	BinaryReader reader{ path };
+	const Array<AsyncReadRequest> requests = Array<AsyncReadRequest>::IndexedGenerate(10'000, [](size_t)
+		{
+			return AsyncReadRequest{ Random<int64>(0, (FileSize - 4096)), 4096 };
+		});
+
+	Bench{}.title("BinaryReader (10k random 4 KiB reads, 64 MiB file)").run("lookaheadBlob", [&]()
+		{
+			for (const auto& request : requests)
+			{
+				doNotOptimizeAway(reader.lookaheadBlob(request.pos, request.size));
+			}
+		});
+
+	Bench{}.title("BinaryReader (10k random 4 KiB reads, 64 MiB file)").run("readBlobAsync (batched)", [&]()
+		{
+			doNotOptimizeAway(reader.readBlobAsync(requests).get());
+		});
+}
+
+# endif
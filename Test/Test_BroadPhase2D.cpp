@@ -0,0 +1,341 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+static BroadPhaseShape MakeRandomShape(const RectF& area)
+{
+	const Vec2 center = RandomVec2(area);
+
+	switch (Random(0, 5))
+	{
+	case 0:
+		return Circle{ center, Random(2.0, 20.0) };
+	case 1:
+		return RectF{ Arg::center = center, Random(4.0, 40.0), Random(4.0, 40.0) };
+	case 2:
+		return Line{ center, center.movedBy(RandomVec2(Random(5.0, 40.0))) };
+	case 3:
+		return Triangle{ center, Random(5.0, 40.0), Random(0.0, Math::TwoPi) };
+	case 4:
+		return RectF{ Arg::center = center, Random(4.0, 30.0) }.rotated(Random(0.0, Math::TwoPi));
+	default:
+		return Circle{ center, Random(4.0, 20.0) }.asPolygon(QualityFactor{ 0.2 });
+	}
+}
+
+static bool IntersectsBruteForce(const BroadPhaseShape& a, const BroadPhaseShape& b)
+{
+	return std::visit([](const auto& x, const auto& y) { return Geometry2D::Intersect(x, y); }, a, b);
+}
+
+static void CheckAgainstBruteForce(const BroadPhase2D& broadPhase, const Array<Optional<BroadPhaseShape>>& shapes, const RectF& area)
+{
+	using IDType = BroadPhase2D::IDType;
+
+	Array<BroadPhase2D::IDPair> expectedPairs;
+
+	for (IDType i = 0; i < shapes.size(); ++i)
+	{
+		for (IDType k = (i + 1); k < shapes.size(); ++k)
+		{
+			if (shapes[i] && shapes[k] && IntersectsBruteForce(*shapes[i], *shapes[k]))
+			{
+				expectedPairs.emplace_back(i, k);
+			}
+		}
+	}
+
+	CHECK_EQ(broadPhase.findPairs(), expectedPairs);
+
+	const Array<BroadPhase2D::IDPair> candidatePairs = broadPhase.findCandidatePairs();
+	CHECK(std::includes(candidatePairs.begin(), candidatePairs.end(), expectedPairs.begin(), expectedPairs.end()));
+
+	Array<BroadPhaseShape> queries;
+
+	for (int32 i = 0; i < 32; ++i)
+	{
+		queries << MakeRandomShape(area);
+	}
+
+	const Array<Array<IDType>> batchResults = broadPhase.intersects(queries);
+	REQUIRE_EQ(batchResults.size(), queries.size());
+
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		Array<IDType> expected;
+
+		for (IDType k = 0; k < shapes.size(); ++k)
+		{
+			if (shapes[k] && IntersectsBruteForce(queries[i], *shapes[k]))
+			{
+				expected << k;
+			}
+		}
+
+		CHECK_EQ(broadPhase.intersects(queries[i]), expected);
+		CHECK_EQ(batchResults[i], expected);
+	}
+}
+
+TEST_CASE("BroadPhase2D")
+{
+	const RectF area{ 0, 0, 800, 600 };
+
+	for (const auto algorithm : { BroadPhaseAlgorithm::AABBTree, BroadPhaseAlgorithm::SortAndSweep })
+	{
+		BroadPhase2D broadPhase{ algorithm };
+		CHECK(broadPhase.isEmpty());
+		CHECK_EQ(broadPhase.getAlgorithm(), algorithm);
+
+		Array<Optional<BroadPhaseShape>> shapes;
+
+		for (int32 i = 0; i < 400; ++i)
+		{
+			const BroadPhaseShape shape = MakeRandomShape(area);
+			const BroadPhase2D::IDType id = broadPhase.add(shape);
+			REQUIRE_EQ(id, shapes.size());
+			shapes << shape;
+		}
+
+		CHECK_EQ(broadPhase.size(), 400);
+		CheckAgainstBruteForce(broadPhase, shapes, area);
+
+		// 移動と削除
+		for (BroadPhase2D::IDType id = 0; id < shapes.size(); ++id)
+		{
+			if ((id % 7) == 0)
+			{
+				broadPhase.remove(id);
+				shapes[id].reset();
+			}
+			else if ((id % 2) == 0)
+			{
+				const BroadPhaseShape shape = MakeRandomShape(area);
+				broadPhase.update(id, shape);
+				shapes[id] = shape;
+			}
+		}
+
+		CHECK_FALSE(broadPhase.contains(0));
+		CHECK(broadPhase.contains(1));
+		CHECK_THROWS_AS((void)broadPhase.getShape(0), std::out_of_range);
+		CheckAgainstBruteForce(broadPhase, shapes, area);
+
+		// 削除した ID は再利用される
+		const BroadPhaseShape shape = MakeRandomShape(area);
+		const BroadPhase2D::IDType id = broadPhase.add(shape);
+		REQUIRE(id < shapes.size());
+		CHECK_FALSE(shapes[id].has_value());
+		shapes[id] = shape;
+		CheckAgainstBruteForce(broadPhase, shapes, area);
+
+		broadPhase.clear();
+		CHECK(broadPhase.isEmpty());
+		CHECK(broadPhase.findPairs().isEmpty());
+	}
+}
+
+TEST_CASE("BroadPhase2D.query")
+{
+	for (const auto algorithm : { BroadPhaseAlgorithm::AABBTree, BroadPhaseAlgorithm::SortAndSweep })
+	{
+		BroadPhase2D broadPhase{ algorithm };
+		const auto a = broadPhase.add(Circle{ 100, 100, 10 });
+		const auto b = broadPhase.add(RectF{ 200, 100, 50, 50 });
+		const auto c = broadPhase.add(Line{ 0, 300, 400, 300 });
+
+		CHECK_EQ(broadPhase.query(RectF{ 0, 0, 300, 200 }), Array<BroadPhase2D::IDType>{ a, b });
+		CHECK_EQ(broadPhase.query(RectF{ 390, 290, 20, 20 }), Array<BroadPhase2D::IDType>{ c });
+		CHECK(broadPhase.query(RectF{ 500, 0, 20, 20 }).isEmpty());
+
+		// バウンディングボックスは重なるが、図形は交差しない
+		CHECK_EQ(broadPhase.query(RectF{ 108, 108, 5, 5 }), Array<BroadPhase2D::IDType>{ a });
+		CHECK(broadPhase.intersects(RectF{ 108, 108, 5, 5 }).isEmpty());
+
+		// AABBTree では、広げたバウンディングボックスの中での移動はツリーを更新しない
+		const bool updated = broadPhase.update(a, Circle{ 101, 100, 10 });
+		CHECK_EQ(updated, (algorithm == BroadPhaseAlgorithm::SortAndSweep));
+		CHECK_EQ(broadPhase.intersects(Circle{ 115, 100, 5 }), Array<BroadPhase2D::IDType>{ a });
+		CHECK(broadPhase.update(a, Circle{ 500, 500, 10 }));
+		CHECK(broadPhase.intersects(Circle{ 115, 100, 5 }).isEmpty());
+	}
+}
+
+TEST_CASE("BroadPhase2D.query (large N)")
+{
+	// 多数の小さな長方形と、少数の横に長い線分
+	const RectF area{ 0, 0, 20000, 2000 };
+	Array<BroadPhaseShape> shapes = Array<BroadPhaseShape>::IndexedGenerate(50'000, [&](size_t)
+		{
+			return BroadPhaseShape{ RectF{ Arg::center = RandomVec2(area), Random(2.0, 10.0) } };
+		});
+
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const Vec2 begin = RandomVec2(area);
+		shapes << Line{ begin, begin.movedBy(Random(1000.0, 8000.0), Random(-100.0, 100.0)) };
+	}
+
+	BroadPhase2D tree{ BroadPhaseAlgorithm::AABBTree };
+	BroadPhase2D sweep{ BroadPhaseAlgorithm::SortAndSweep };
+
+	for (const auto& shape : shapes)
+	{
+		tree.add(shape);
+		sweep.add(shape);
+	}
+
+	const Array<RectF> regions = Array<RectF>::IndexedGenerate(2000, [&](size_t) { return RectF{ RandomVec2(area), Random(1.0, 200.0), Random(1.0, 200.0) }; });
+
+	const auto check = [&]()
+		{
+			for (const auto& region : regions)
+			{
+				CHECK_EQ(sweep.query(region), tree.query(region));
+			}
+
+			const Array<BroadPhaseShape> queries = regions.map([](const RectF& region) { return BroadPhaseShape{ region }; });
+			CHECK_EQ(sweep.intersects(queries), tree.intersects(queries));
+		};
+
+	check();
+
+	// 線分を動かして、幅の最大値が変わった後も結果が一致する
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		const BroadPhase2D::IDType id = static_cast<BroadPhase2D::IDType>(shapes.size() - 4 + i);
+		const Vec2 begin = RandomVec2(area);
+		const Line line{ begin, begin.movedBy(Random(10.0, 100.0), 0) };
+		tree.update(id, line);
+		sweep.update(id, line);
+	}
+
+	check();
+}
+
+TEST_CASE("BroadPhase2D.update (widen in place)")
+{
+	const RectF area{ 0, 0, 2000, 400 };
+
+	for (const auto algorithm : { BroadPhaseAlgorithm::AABBTree, BroadPhaseAlgorithm::SortAndSweep })
+	{
+		BroadPhase2D broadPhase{ algorithm };
+		Array<Optional<BroadPhaseShape>> shapes;
+
+		for (int32 i = 0; i < 200; ++i)
+		{
+			const BroadPhaseShape shape = RectF{ RandomVec2(area), Random(2.0, 10.0) };
+			broadPhase.add(shape);
+			shapes << shape;
+		}
+
+		// 一度問い合わせて、並び順を確定させる
+		CheckAgainstBruteForce(broadPhase, shapes, area);
+
+		// 左端を保ったまま、右へ大きく広げる
+		for (BroadPhase2D::IDType id = 0; id < 200; id += 50)
+		{
+			const RectF rect = std::get<RectF>(*shapes[id]);
+			const BroadPhaseShape shape = RectF{ rect.pos, Random(800.0, 1500.0), rect.h };
+			broadPhase.update(id, shape);
+			shapes[id] = shape;
+		}
+
+		CheckAgainstBruteForce(broadPhase, shapes, area);
+
+		for (int32 i = 0; i < 64; ++i)
+		{
+			const RectF region{ RandomVec2(area), Random(1.0, 50.0), Random(1.0, 50.0) };
+			Array<BroadPhase2D::IDType> expected;
+
+			for (BroadPhase2D::IDType k = 0; k < shapes.size(); ++k)
+			{
+				if (region.intersects(std::get<RectF>(*shapes[k])))
+				{
+					expected << k;
+				}
+			}
+
+			CHECK_EQ(broadPhase.query(region), expected);
+		}
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("BroadPhase2D.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	// 100,000 個の動く円
+	const RectF area{ 0, 0, 4000, 4000 };
+	Array<Circle> circles = Array<Circle>::IndexedGenerate(100'000, [&](size_t) { return Circle{ RandomVec2(area), 3 }; });
+	const Array<Vec2> velocities = Array<Vec2>::IndexedGenerate(circles.size(), [](size_t) { return RandomVec2(1.0); });
+
+	for (const auto algorithm : { BroadPhaseAlgorithm::AABBTree, BroadPhaseAlgorithm::SortAndSweep })
+	{
+		BroadPhase2D broadPhase{ algorithm };
+
+		for (const auto& circle : circles)
+		{
+			broadPhase.add(circle);
+		}
+
+		const std::string title = ((algorithm == BroadPhaseAlgorithm::AABBTree) ? "BroadPhase2D (AABBTree, 100k moving circles)" : "BroadPhase2D (SortAndSweep, 100k moving circles)");
+
+		Bench{}.title(title).run("update + findPairs", [&]()
+			{
+				for (uint32 i = 0; i < circles.size(); ++i)
+				{
+					circles[i].moveBy(velocities[i]);
+					broadPhase.update(i, circles[i]);
+				}
+
+				doNotOptimizeAway(broadPhase.findPairs());
+			});
+
+		Bench{}.title(title).run("intersects x 1000 (batched)", [&]()
+			{
+				const Array<BroadPhaseShape> queries = Array<BroadPhaseShape>::IndexedGenerate(1000, [&](size_t i) { return BroadPhaseShape{ Circle{ circles[i * 97].center, 20 } }; });
+				doNotOptimizeAway(broadPhase.intersects(queries));
+			});
+
+		Bench{}.title(title).run("query x 1000", [&]()
+			{
+				for (size_t i = 0; i < 1000; ++i)
+				{
+					doNotOptimizeAway(broadPhase.query(RectF{ Arg::center = circles[i * 97].center, 40 }));
+				}
+			});
+	}
+
+	{
+		const Array<Circle> subset = circles.take(5'000);
+
+		Bench{}.title("5k circles").run("brute force O(N^2) pairs", [&]()
+			{
+				size_t count = 0;
+
+				for (size_t i = 0; i < subset.size(); ++i)
+				{
+					for (size_t k = (i + 1); k < subset.size(); ++k)
+					{
+						count += subset[i].intersects(subset[k]);
+					}
+				}
+
+				doNotOptimizeAway(count);
+			});
+	}
+}
+
+# endif
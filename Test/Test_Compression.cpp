@@ -323,6 +323,421 @@ TEST_CASE("Compression")
 
 # endif
 
+[[nodiscard]]
+static Array<Blob> MakeRecordBlobs(const size_t count)
+{
+	Array<Blob> records(Arg::reserve = count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const std::string record = fmt::format(R"({{"id":{},"name":"player{}","score":{},"level":{},"guild":"siv3d"}})", i, (i % 97), (i * 7919 % 100000), (i % 50));
+		records << Blob{ record.data(), record.size() };
+	}
+
+	return records;
+}
+
+TEST_CASE("Compressor")
+{
+	const Blob original = MakeRandomBlob(1024 * 64 + 123);
+
+	Compressor compressor;
+	Decompressor decompressor;
+	REQUIRE(compressor);
+	REQUIRE(decompressor);
+
+	// 同じコンテキストで繰り返し圧縮・展開できる
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const Blob compressed = compressor.compress(original);
+		CHECK_EQ(decompressor.decompress(compressed), original);
+	}
+
+	CHECK_EQ(decompressor.decompress(compressor.compress(Blob{})), Blob{});
+
+	// 壊れたデータの展開は失敗し、その後も使い続けられる
+	{
+		Blob broken = compressor.compress(original);
+		broken.resize(broken.size() / 2);
+
+		Blob dst;
+		CHECK_FALSE(decompressor.decompress(broken, dst));
+		CHECK(dst.isEmpty());
+		CHECK_EQ(decompressor.decompress(compressor.compress(original)), original);
+	}
+
+	// 複数のフレームが連結されたデータ
+	{
+		Blob concatenated = compressor.compress(original);
+		concatenated.append(compressor.compress(original));
+
+		Blob expected = original;
+		expected.append(original);
+
+		CHECK_EQ(decompressor.decompress(concatenated), expected);
+		CHECK_EQ(Compression::Decompress(concatenated), expected);
+	}
+
+	// フレームヘッダに巨大な展開後のサイズが記録された、細工されたデータ
+	{
+		const Byte crafted[] =
+		{
+			Byte{ 0x28 }, Byte{ 0xB5 }, Byte{ 0x2F }, Byte{ 0xFD }, // マジックナンバー
+			Byte{ 0xE0 }, // Single_Segment_flag, 8 バイトの Frame_Content_Size
+			Byte{ 0x00 }, Byte{ 0x00 }, Byte{ 0x00 }, Byte{ 0x00 }, Byte{ 0x01 }, Byte{ 0x00 }, Byte{ 0x00 }, Byte{ 0x00 }, // 4 GiB
+			Byte{ 0x09 }, Byte{ 0x00 }, Byte{ 0x00 }, // 1 バイトの Raw_Block（最後のブロック）
+			Byte{ 0x41 },
+		};
+
+		Blob dst;
+		CHECK_FALSE(decompressor.decompress(Blob{ crafted, sizeof(crafted) }, dst));
+		CHECK(dst.isEmpty());
+		CHECK_EQ(decompressor.decompress(compressor.compress(original)), original);
+	}
+}
+
+TEST_CASE("Compression::TrainDictionary")
+{
+	const Array<Blob> records = MakeRecordBlobs(2000);
+
+	const Blob dictionary = Compression::TrainDictionary(records, (16 * 1024));
+	REQUIRE_FALSE(dictionary.isEmpty());
+	CHECK(dictionary.size() <= (16 * 1024));
+
+	Compressor compressor{ dictionary };
+	Decompressor decompressor{ dictionary };
+	CHECK(compressor.hasDictionary());
+	CHECK(decompressor.hasDictionary());
+
+	size_t sizeWithDictionary = 0;
+	size_t sizeWithoutDictionary = 0;
+
+	for (const auto& record : records)
+	{
+		const Blob compressed = compressor.compress(record);
+		CHECK_EQ(decompressor.decompress(compressed), record);
+
+		sizeWithDictionary += compressed.size();
+		sizeWithoutDictionary += Compression::Compress(record).size();
+	}
+
+	// 小さなデータでは辞書を使うほうが小さくなる
+	CHECK(sizeWithDictionary < sizeWithoutDictionary);
+
+	// サンプルが無い場合は失敗する
+	{
+		const ScopedLogSilencer logSilencer;
+		CHECK(Compression::TrainDictionary(Array<Blob>{}).isEmpty());
+	}
+}
+
+TEST_CASE("CompressionWriter")
+{
+	const Blob original = MakeRandomBlob(1024 * 512 + 77);
+
+	Blob compressed;
+	{
+		CompressionWriter writer{ MemoryWriter{} };
+		REQUIRE(writer);
+
+		// 書き込みを細かく分割しても結果は変わらない
+		for (size_t pos = 0; pos < original.size(); pos += 1000)
+		{
+			const int64 size = static_cast<int64>(Min<size_t>(1000, (original.size() - pos)));
+			CHECK_EQ(writer.write((original.data() + pos), size), size);
+		}
+
+		CHECK_EQ(writer.size(), static_cast<int64>(original.size()));
+		CHECK_FALSE(writer.setPos(0));
+
+		std::unique_ptr<IWriter> memoryWriter = writer.release();
+		REQUIRE(memoryWriter);
+		CHECK_FALSE(writer.isOpen());
+		compressed = static_cast<MemoryWriter&>(*memoryWriter).retrieve();
+	}
+
+	CHECK_EQ(Compression::Decompress(compressed), original);
+
+	// 何も書き込まなくても、空のフレームが書き出される
+	{
+		CompressionWriter writer{ MemoryWriter{} };
+		std::unique_ptr<IWriter> memoryWriter = writer.release();
+		const Blob empty = static_cast<MemoryWriter&>(*memoryWriter).retrieve();
+		CHECK_FALSE(empty.isEmpty());
+		CHECK(Compression::Decompress(empty).isEmpty());
+	}
+
+	// 辞書を使う
+	{
+		const Array<Blob> records = MakeRecordBlobs(2000);
+		const Blob dictionary = Compression::TrainDictionary(records, (16 * 1024));
+		REQUIRE_FALSE(dictionary.isEmpty());
+
+		CompressionWriter writer{ std::make_unique<MemoryWriter>(), dictionary };
+		CHECK_EQ(writer.write(records[0].data(), static_cast<int64>(records[0].size())), static_cast<int64>(records[0].size()));
+
+		std::unique_ptr<IWriter> memoryWriter = writer.release();
+		const Blob result = static_cast<MemoryWriter&>(*memoryWriter).retrieve();
+		CHECK_EQ(Decompressor{ dictionary }.decompress(result), records[0]);
+	}
+}
+
+TEST_CASE("DecompressionReader")
+{
+	const Blob original = MakeRandomBlob(1024 * 512 + 77);
+	const Blob compressed = Compression::Compress(original);
+
+	{
+		DecompressionReader reader{ MemoryReader{ compressed } };
+		REQUIRE(reader);
+		CHECK_EQ(reader.size(), static_cast<int64>(original.size()));
+
+		// 少しずつ読み込む
+		Blob decompressed;
+		Byte buffer[1000];
+
+		while (const int64 readSize = reader.read(buffer, sizeof(buffer)))
+		{
+			decompressed.append(buffer, static_cast<size_t>(readSize));
+		}
+
+		CHECK_FALSE(reader.hasError());
+		CHECK_EQ(decompressed, original);
+		CHECK_EQ(reader.getPos(), static_cast<int64>(original.size()));
+	}
+
+	// 前方・後方へのシーク
+	{
+		DecompressionReader reader{ MemoryReader{ compressed } };
+
+		Byte a[16], b[16];
+		CHECK_EQ(reader.read(a, 300000, sizeof(a)), static_cast<int64>(sizeof(a)));
+		CHECK(std::memcmp(a, (original.data() + 300000), sizeof(a)) == 0);
+
+		CHECK_EQ(reader.read(b, 1234, sizeof(b)), static_cast<int64>(sizeof(b)));
+		CHECK(std::memcmp(b, (original.data() + 1234), sizeof(b)) == 0);
+		CHECK_EQ(reader.getPos(), static_cast<int64>(1234 + sizeof(b)));
+	}
+
+	// Zstandard 形式でないデータ
+	{
+		DecompressionReader reader{ MemoryReader{ MakeRandomBlob(1024) } };
+		REQUIRE(reader);
+		CHECK_EQ(reader.size(), -1);
+
+		Byte buffer[1000];
+		CHECK_EQ(reader.read(buffer, sizeof(buffer)), 0);
+		CHECK(reader.hasError());
+	}
+
+	// 複数のフレームが連結されたデータ
+	{
+		Blob concatenated = compressed;
+		concatenated.append(Compression::Compress(MakeRandomBlob(1000)));
+		concatenated.append(compressed);
+
+		DecompressionReader reader{ MemoryReader{ concatenated } };
+		REQUIRE(reader);
+		CHECK_EQ(reader.size(), static_cast<int64>(original.size() * 2 + 1000));
+
+		const Blob decompressed{ reader };
+		REQUIRE_EQ(decompressed.size(), (original.size() * 2 + 1000));
+		CHECK(std::memcmp(decompressed.data(), original.data(), original.size()) == 0);
+		CHECK(std::memcmp((decompressed.data() + original.size() + 1000), original.data(), original.size()) == 0);
+		CHECK_FALSE(reader.hasError());
+	}
+
+	// 展開後のサイズが記録されていないデータ
+	{
+		std::string text;
+
+		for (int32 i = 0; i < 20000; ++i)
+		{
+			text += "Siv3D\r\n";
+		}
+
+		Blob streamed;
+		{
+			CompressionWriter writer{ MemoryWriter{} };
+			CHECK_EQ(writer.write(text.data(), static_cast<int64>(text.size())), static_cast<int64>(text.size()));
+
+			std::unique_ptr<IWriter> memoryWriter = writer.release();
+			streamed = static_cast<MemoryWriter&>(*memoryWriter).retrieve();
+		}
+
+		{
+			DecompressionReader reader{ MemoryReader{ streamed } };
+			REQUIRE(reader);
+			CHECK_EQ(reader.size(), -1);
+
+			const Blob decompressed{ reader };
+			REQUIRE_EQ(decompressed.size(), text.size());
+			CHECK(std::memcmp(decompressed.data(), text.data(), text.size()) == 0);
+		}
+
+		// サイズが不明でも、TextReader は終端まで読み込む
+		{
+			TextReader reader{ DecompressionReader{ MemoryReader{ streamed } }, TextEncoding::UTF8_NO_BOM };
+			REQUIRE(reader);
+
+			std::string result;
+			CHECK(reader.readAll(result));
+			CHECK_EQ(result.size(), (20000 * 6));
+			CHECK(result.starts_with("Siv3D\nSiv3D\n"));
+		}
+	}
+}
+
+TEST_CASE("Compression::CompressSeekable")
+{
+	const Blob original = MakeRandomBlob(1024 * 1024 + 4321);
+	constexpr size_t FrameSize = (64 * 1024);
+
+	const Blob compressed = Compression::CompressSeekable(original, Compression::DefaultLevel, FrameSize);
+	REQUIRE_FALSE(compressed.isEmpty());
+
+	// 通常の Zstandard データとしても展開できる
+	CHECK_EQ(Compression::Decompress(compressed), original);
+
+	SeekableDecompressionReader reader{ compressed, 2 };
+	REQUIRE(reader);
+	CHECK_EQ(reader.numFrames(), ((original.size() + FrameSize - 1) / FrameSize));
+	CHECK_EQ(reader.size(), static_cast<int64>(original.size()));
+	CHECK_EQ(reader.decompressAll(), original);
+
+	// フレームの境界をまたぐランダムアクセス
+	for (const int64 pos : { int64{ 0 }, int64{ 65530 }, int64{ 1024 * 1024 }, int64{ 123 }, static_cast<int64>(original.size() - 10) })
+	{
+		Byte buffer[100];
+		const int64 expectedSize = Min<int64>(sizeof(buffer), (static_cast<int64>(original.size()) - pos));
+
+		CHECK_EQ(reader.lookahead(buffer, pos, sizeof(buffer)), expectedSize);
+		CHECK(std::memcmp(buffer, (original.data() + pos), static_cast<size_t>(expectedSize)) == 0);
+
+		CHECK_EQ(reader.read(buffer, pos, sizeof(buffer)), expectedSize);
+		CHECK(std::memcmp(buffer, (original.data() + pos), static_cast<size_t>(expectedSize)) == 0);
+		CHECK_EQ(reader.getPos(), (pos + expectedSize));
+	}
+
+	// 順に全体を読み込む
+	{
+		Blob decompressed;
+		decompressed.resize(original.size());
+		reader.setPos(0);
+		CHECK_EQ(reader.read(decompressed.data(), static_cast<int64>(decompressed.size())), static_cast<int64>(original.size()));
+		CHECK_EQ(decompressed, original);
+	}
+
+	// ファイル
+	{
+		CHECK(Compression::CompressSeekableToFile(original, U"../../Test/output/compression/original.seekable.zstd", Compression::DefaultLevel, FrameSize));
+		SeekableDecompressionReader fileReader{ U"../../Test/output/compression/original.seekable.zstd" };
+		REQUIRE(fileReader);
+		CHECK_EQ(fileReader.decompressAll(), original);
+	}
+
+	// 空のデータ
+	{
+		const Blob empty = Compression::CompressSeekable(Blob{});
+		SeekableDecompressionReader emptyReader{ empty };
+		REQUIRE(emptyReader);
+		CHECK(emptyReader.numFrames() == 0);
+		CHECK_EQ(emptyReader.size(), 0);
+		CHECK(emptyReader.decompressAll().isEmpty());
+	}
+
+	// シーク可能形式でないデータ
+	{
+		const ScopedLogSilencer logSilencer;
+		CHECK_FALSE(SeekableDecompressionReader{ Compression::Compress(original) }.isOpen());
+	}
+
+	// シークテーブルの展開後のサイズが不正なデータ
+	{
+		const ScopedLogSilencer logSilencer;
+
+		// 最初のエントリの展開後のサイズを書き換える
+		const auto withFirstFrameSize = [&](const uint32 size)
+			{
+				constexpr size_t FooterSize = 9;
+				constexpr size_t EntrySize = 8;
+				Blob blob = compressed;
+				const size_t entryOffset = (blob.size() - FooterSize - (reader.numFrames() * EntrySize));
+				std::memcpy((blob.data() + entryOffset + 4), &size, sizeof(size));
+				return blob;
+			};
+
+		CHECK(SeekableDecompressionReader{ withFirstFrameSize(static_cast<uint32>(FrameSize)) }.isOpen());
+		CHECK_FALSE(SeekableDecompressionReader{ withFirstFrameSize(0xFFFF'FFFF) }.isOpen());
+		CHECK_FALSE(SeekableDecompressionReader{ withFirstFrameSize(static_cast<uint32>(FrameSize + 1)) }.isOpen());
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("Compressor.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Array<Blob> records = MakeRecordBlobs(20000);
+	const Blob dictionary = Compression::TrainDictionary(records);
+
+	Compressor compressor;
+	Compressor compressorWithDictionary{ dictionary };
+
+	Bench{}.title("Compress 20000 small records").relative(true)
+		.run("new context per call", [&]()
+		{
+			for (const auto& record : records)
+			{
+				doNotOptimizeAway(Compressor{}.compress(record));
+			}
+		})
+		.run("Compression::Compress", [&]()
+		{
+			for (const auto& record : records)
+			{
+				doNotOptimizeAway(Compression::Compress(record));
+			}
+		})
+		.run("Compressor::compress", [&]()
+		{
+			Blob dst;
+
+			for (const auto& record : records)
+			{
+				compressor.compress(record, dst);
+				doNotOptimizeAway(dst);
+			}
+		})
+		.run("Compressor::compress (dictionary)", [&]()
+		{
+			Blob dst;
+
+			for (const auto& record : records)
+			{
+				compressorWithDictionary.compress(record, dst);
+				doNotOptimizeAway(dst);
+			}
+		});
+}
+
+TEST_CASE("SeekableDecompressionReader.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Blob original = MakeRandomBlob(1024 * 1024 * 32);
+	const Blob compressed = Compression::Compress(original);
+	const Blob seekable = Compression::CompressSeekable(original);
+	const SeekableDecompressionReader reader{ seekable };
+
+	Bench{}.title("Decompress 32 MB").relative(true).minEpochIterations(3)
+		.run("Compression::Decompress", [&]() { doNotOptimizeAway(Compression::Decompress(compressed)); })
+		.run("SeekableDecompressionReader::decompressAll", [&]() { doNotOptimizeAway(reader.decompressAll()); });
+}
+
+# endif
+
 # if SIV3D_RUN_BENCHMARK && SIV3D_RUN_HEAVY_TEST
 
 TEST_CASE("Compression.Benchmark")
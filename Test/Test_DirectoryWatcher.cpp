@@ -0,0 +1,153 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+# if SIV3D_PLATFORM(LINUX)
+
+// 少なくとも minCount 個の変更が届き、その後しばらく変更が届かなくなるまで待つ
+static Array<FileChange> WaitForChanges(const DirectoryWatcher& watcher, const size_t minCount)
+{
+	Array<FileChange> results;
+	Array<FileChange> changes;
+	int32 idleCount = 0;
+
+	const Stopwatch stopwatch{ StartImmediately::Yes };
+
+	while (stopwatch.sF() < 20.0)
+	{
+		if (watcher.retrieveChanges(changes))
+		{
+			results.append(changes);
+			idleCount = 0;
+		}
+		else if ((minCount <= results.size()) && (10 <= ++idleCount))
+		{
+			break;
+		}
+
+		System::Sleep(50);
+	}
+
+	return results;
+}
+
+static void WriteFile(const FilePath& path, const OpenMode openMode = OpenMode::Trunc)
+{
+	BinaryWriter writer{ path, openMode };
+	REQUIRE(writer.isOpen());
+	writer.write(uint32{ 12345 });
+}
+
+TEST_CASE("DirectoryWatcher.Linux")
+{
+	const FilePath directory{ U"../../Test/output/directorywatcher/" };
+	FileSystem::Remove(directory);
+	REQUIRE(FileSystem::CreateDirectories(directory));
+
+	SUBCASE("Stress")
+	{
+		const DirectoryWatcher watcher{ directory, { U"txt" }, SecondsF{ 0.05 } };
+		REQUIRE(watcher);
+		CHECK_EQ(watcher.directory(), FileSystem::FullPath(directory));
+		CHECK_EQ(watcher.applicableExtensions(), Array<String>{ U"txt" });
+
+		// 監視の開始後に作られたサブディレクトリの中に、大量のファイルを作る
+		constexpr size_t FileCount = 2000;
+		Array<FilePath> txtFiles;
+
+		for (size_t i = 0; i < FileCount; ++i)
+		{
+			const FilePath subDirectory = U"{}sub{}/nested/"_fmt(directory, (i % 20));
+			const FilePath txtPath = U"{}{}.txt"_fmt(subDirectory, i);
+			WriteFile(txtPath);
+			WriteFile(U"{}{}.dat"_fmt(subDirectory, i));
+			txtFiles << FileSystem::FullPath(txtPath);
+		}
+
+		// 同じファイルへの追記
+		for (const auto& path : txtFiles)
+		{
+			WriteFile(path, OpenMode::Append);
+		}
+
+		const Array<FileChange> changes = WaitForChanges(watcher, FileCount);
+		HashMap<FilePath, FileAction> firstActions;
+
+		for (const auto& change : changes)
+		{
+			// 拡張子が一致しないファイルと、ディレクトリは報告されない
+			CHECK(change.path.ends_with(U".txt"));
+			firstActions.try_emplace(change.path, change.action);
+		}
+
+		CHECK_EQ(firstActions.size(), FileCount);
+
+		for (const auto& path : txtFiles)
+		{
+			REQUIRE(firstActions.contains(path));
+			CHECK_EQ(firstActions[path], FileAction::Added);
+		}
+
+		// 作成と書き込み（1 ファイルあたり 3 回以上のイベント）がまとめられている
+		CHECK(changes.size() <= (FileCount * 2));
+
+		// 削除
+		REQUIRE(FileSystem::RemoveContents(directory));
+		const Array<FileChange> removals = WaitForChanges(watcher, FileCount);
+		CHECK_EQ(removals.size(), FileCount);
+		CHECK(removals.all([](const FileChange& change) { return (change.action == FileAction::Removed); }));
+	}
+
+	SUBCASE("Coalescing")
+	{
+		const DirectoryWatcher watcher{ directory, {}, SecondsF{ 0.2 } };
+		REQUIRE(watcher);
+
+		const FilePath a = (FileSystem::FullPath(directory) + U"a.txt");
+		const FilePath b = (FileSystem::FullPath(directory) + U"b.txt");
+		const FilePath c = (FileSystem::FullPath(directory) + U"c/");
+
+		// 作成してすぐに削除したファイルは報告されない
+		WriteFile(a);
+		FileSystem::Remove(a);
+
+		// ディレクトリのパスの末尾は '/'
+		REQUIRE(FileSystem::CreateDirectories(c));
+
+		// 作成後の書き込みと名前の変更は 1 つにまとめられる
+		WriteFile(a);
+		WriteFile(a, OpenMode::Append);
+		REQUIRE(FileSystem::Rename(a, b));
+
+		Array<FileChange> changes = WaitForChanges(watcher, 2);
+		changes.sort_by([](const FileChange& x, const FileChange& y) { return (x.path < y.path); });
+		REQUIRE_EQ(changes.size(), 2);
+		CHECK_EQ(changes[0].path, b);
+		CHECK_EQ(changes[0].action, FileAction::Added);
+		CHECK_EQ(changes[1].path, c);
+		CHECK_EQ(changes[1].action, FileAction::Added);
+
+		// 既存のファイルの名前の変更は、削除と追加として報告される
+		REQUIRE(FileSystem::Rename(b, a));
+		changes = WaitForChanges(watcher, 2);
+		changes.sort_by([](const FileChange& x, const FileChange& y) { return (x.path < y.path); });
+		REQUIRE_EQ(changes.size(), 2);
+		CHECK_EQ(changes[0].path, a);
+		CHECK_EQ(changes[0].action, FileAction::Added);
+		CHECK_EQ(changes[1].path, b);
+		CHECK_EQ(changes[1].action, FileAction::Removed);
+	}
+
+	FileSystem::Remove(directory);
+}
+
+# endif
@@ -0,0 +1,184 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+static bool Overlaps(const FloatRect& a, const FloatRect& b)
+{
+	return ((a.left <= b.right) && (b.left <= a.right) && (a.top <= b.bottom) && (b.top <= a.bottom));
+}
+
+TEST_CASE("DrawCallReorder")
+{
+	SUBCASE("Merge")
+	{
+		// A, B, A（重ならない） -> A, A, B
+		const Array<DrawCallInfo> drawCalls = {
+			{ 0, FloatRect{ 0, 0, 10, 10 }, 6 },
+			{ 1, FloatRect{ 20, 0, 30, 10 }, 12 },
+			{ 0, FloatRect{ 40, 0, 50, 10 }, 6 },
+		};
+
+		const DrawCallReorderResult result = DrawCallReorder::Reorder(drawCalls);
+		CHECK_EQ(result.order, Array<uint32>{ 0, 2, 1 });
+		REQUIRE_EQ(result.drawCalls.size(), 2);
+		CHECK_EQ(result.drawCalls[0].stateID, 0);
+		CHECK_EQ(result.drawCalls[0].first, 0);
+		CHECK_EQ(result.drawCalls[0].count, 2);
+		CHECK_EQ(result.drawCalls[0].indexCount, 12);
+		CHECK_EQ(result.drawCalls[1].stateID, 1);
+		CHECK_EQ(result.drawCalls[1].first, 2);
+		CHECK_EQ(result.drawCalls[1].indexCount, 12);
+		CHECK_EQ(result.numSaved(), 1);
+	}
+
+	SUBCASE("Overlap")
+	{
+		// B と 2 つ目の A が重なるので、並べ替えられない
+		const Array<DrawCallInfo> drawCalls = {
+			{ 0, FloatRect{ 0, 0, 10, 10 }, 6 },
+			{ 1, FloatRect{ 20, 0, 30, 10 }, 6 },
+			{ 0, FloatRect{ 25, 5, 35, 15 }, 6 },
+		};
+
+		const DrawCallReorderResult result = DrawCallReorder::Reorder(drawCalls);
+		CHECK_EQ(result.order, Array<uint32>{ 0, 1, 2 });
+		CHECK_EQ(result.drawCalls.size(), 3);
+		CHECK_EQ(result.numSaved(), 0);
+	}
+
+	SUBCASE("Adjacent")
+	{
+		// 連続する同じステートは、重なっていても統合できる
+		const Array<DrawCallInfo> drawCalls = {
+			{ 0, FloatRect{ 0, 0, 10, 10 }, 6 },
+			{ 0, FloatRect{ 5, 5, 15, 15 }, 6 },
+		};
+
+		const DrawCallReorderResult result = DrawCallReorder::Reorder(drawCalls);
+		CHECK_EQ(result.drawCalls.size(), 1);
+		CHECK_EQ(result.numSaved(), 1);
+	}
+
+	SUBCASE("Lookback")
+	{
+		const Array<DrawCallInfo> drawCalls = {
+			{ 0, FloatRect{ 0, 0, 10, 10 }, 6 },
+			{ 1, FloatRect{ 20, 0, 30, 10 }, 6 },
+			{ 0, FloatRect{ 40, 0, 50, 10 }, 6 },
+		};
+
+		CHECK_EQ(DrawCallReorder::Reorder(drawCalls, 1).numSaved(), 0);
+		CHECK_EQ(DrawCallReorder::Reorder(drawCalls, 2).numSaved(), 1);
+	}
+
+	SUBCASE("Empty")
+	{
+		const DrawCallReorderResult result = DrawCallReorder::Reorder({});
+		CHECK(result.order.isEmpty());
+		CHECK(result.drawCalls.isEmpty());
+	}
+}
+
+TEST_CASE("DrawCallReorder.Random")
+{
+	for (int32 trial = 0; trial < 100; ++trial)
+	{
+		const Array<DrawCallInfo> drawCalls = Array<DrawCallInfo>::IndexedGenerate(Random(1, 300), [](size_t)
+			{
+				const float x = static_cast<float>(Random(0.0, 800.0));
+				const float y = static_cast<float>(Random(0.0, 600.0));
+				const float w = static_cast<float>(Random(1.0, 60.0));
+				const float h = static_cast<float>(Random(1.0, 60.0));
+				return DrawCallInfo{ Random(0u, 4u), FloatRect{ x, y, (x + w), (y + h) }, (Random(1u, 20u) * 3) };
+			});
+
+		const DrawCallReorderResult result = DrawCallReorder::Reorder(drawCalls);
+
+		// order は順列である
+		REQUIRE_EQ(result.order.size(), drawCalls.size());
+		CHECK_EQ(result.order.sorted(), Array<uint32>::IndexedGenerate(drawCalls.size(), [](size_t i) { return static_cast<uint32>(i); }));
+
+		// 重なる描画コールの順序は保たれる
+		Array<size_t> position(drawCalls.size());
+
+		for (size_t i = 0; i < result.order.size(); ++i)
+		{
+			position[result.order[i]] = i;
+		}
+
+		for (size_t i = 0; i < drawCalls.size(); ++i)
+		{
+			for (size_t k = (i + 1); k < drawCalls.size(); ++k)
+			{
+				if (Overlaps(drawCalls[i].bounds, drawCalls[k].bounds))
+				{
+					CHECK(position[i] < position[k]);
+				}
+			}
+		}
+
+		// 統合された描画コールは order を分割し、同じステートだけを含む
+		uint32 first = 0;
+
+		for (const auto& drawCall : result.drawCalls)
+		{
+			CHECK_EQ(drawCall.first, first);
+			REQUIRE(0 < drawCall.count);
+
+			uint32 indexCount = 0;
+
+			for (uint32 i = drawCall.first; i < (drawCall.first + drawCall.count); ++i)
+			{
+				CHECK_EQ(drawCalls[result.order[i]].stateID, drawCall.stateID);
+				indexCount += drawCalls[result.order[i]].indexCount;
+			}
+
+			CHECK_EQ(drawCall.indexCount, indexCount);
+			first += drawCall.count;
+		}
+
+		CHECK_EQ(first, drawCalls.size());
+	}
+}
+
+TEST_CASE("Graphics2D::SetDrawCallReorderingEnabled")
+{
+	CHECK_FALSE(Graphics2D::IsDrawCallReorderingEnabled());
+
+	Graphics2D::SetDrawCallReorderingEnabled(true);
+	CHECK(Graphics2D::IsDrawCallReorderingEnabled());
+
+	Graphics2D::SetDrawCallReorderingEnabled(false);
+	CHECK_FALSE(Graphics2D::IsDrawCallReorderingEnabled());
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("DrawCallReorder.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	// 4 種類のテクスチャで交互に描かれる 10,000 個のスプライト
+	const Array<DrawCallInfo> drawCalls = Array<DrawCallInfo>::IndexedGenerate(10'000, [](size_t i)
+		{
+			const float x = static_cast<float>(Random(0.0, 1920.0));
+			const float y = static_cast<float>(Random(0.0, 1080.0));
+			return DrawCallInfo{ static_cast<uint32>(i % 4), FloatRect{ x, y, (x + 16), (y + 16) }, 6 };
+		});
+
+	Bench{}.title("DrawCallReorder (10k sprites, 4 states)").run("Reorder", [&]()
+		{
+			doNotOptimizeAway(DrawCallReorder::Reorder(drawCalls));
+		});
+}
+
+# endif
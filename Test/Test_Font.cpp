@@ -0,0 +1,122 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+// エンジンに同梱されている絵文字フォントを展開して使う
+static FilePath GetTestFontPath()
+{
+	const FilePath path = U"../../Test/output/font/Noto-COLRv1.ttf";
+
+	if (not FileSystem::Exists(path))
+	{
+		Compression::DecompressFileToFile(Resource(U"engine/font/noto-emoji/Noto-COLRv1.ttf.zstdcmp"), path);
+	}
+
+	return path;
+}
+
+static Array<GlyphIndex> ToGlyphIndices(const Array<ResolvedGlyph>& glyphs)
+{
+	return glyphs.map([](const ResolvedGlyph& glyph) { return glyph.glyphIndex; });
+}
+
+TEST_CASE("Font cache")
+{
+	const FilePath path = GetTestFontPath();
+
+	SUBCASE("Shaping cache LRU")
+	{
+		const Font font{ 32, path };
+		REQUIRE(font);
+
+		font.setShapingCacheCapacity(2);
+
+		const Array<GlyphIndex> a = ToGlyphIndices(font.getResolvedGlyphs(U"🔥"));
+		const Array<GlyphIndex> b = ToGlyphIndices(font.getResolvedGlyphs(U"🍣"));
+		CHECK(a.size() == 1);
+		CHECK(b.size() == 1);
+
+		CHECK(ToGlyphIndices(font.getResolvedGlyphs(U"🔥")) == a);	// ヒット
+		CHECK(font.getResolvedGlyphs(U"🐈").size() == 1);	// 最も長い間使われていない "🍣" が破棄される
+
+		{
+			const FontCacheStat stat = font.getCacheStat();
+			CHECK(stat.shapingHits == 1);
+			CHECK(stat.shapingMisses == 3);
+			CHECK(stat.cachedShapes == 2);
+			CHECK(stat.shapingCacheCapacity == 2);
+		}
+
+		CHECK(ToGlyphIndices(font.getResolvedGlyphs(U"🔥")) == a);	// ヒット
+		CHECK(ToGlyphIndices(font.getResolvedGlyphs(U"🍣")) == b);	// ミス（破棄済み）
+		CHECK(font.getResolvedGlyphs(U"🔥", Ligature::No).size() == 1);	// リガチャの有無は別のキャッシュ
+
+		{
+			const FontCacheStat stat = font.getCacheStat();
+			CHECK(stat.shapingHits == 2);
+			CHECK(stat.shapingMisses == 5);
+			CHECK(stat.cachedShapes == 2);
+			CHECK(stat.shapingHitRate() == doctest::Approx(2.0 / 7.0));
+		}
+
+		// 容量を減らすと、古い結果から破棄される
+		font.setShapingCacheCapacity(1);
+		CHECK(font.getCacheStat().cachedShapes == 1);
+
+		// 容量 0 ではキャッシュしない
+		font.setShapingCacheCapacity(0);
+		CHECK(ToGlyphIndices(font.getResolvedGlyphs(U"🔥")) == a);
+		CHECK(ToGlyphIndices(font.getResolvedGlyphs(U"🔥")) == a);
+		CHECK(font.getCacheStat().cachedShapes == 0);
+		CHECK(font.getCacheStat().shapingHits == 2);
+		CHECK(font.getCacheStat().shapingMisses == 7);
+	}
+
+	SUBCASE("Preload")
+	{
+		const Font font{ 32, path };
+		REQUIRE(font);
+
+		CHECK(font.preload(U"🔥🍣🔥"));
+
+		{
+			const FontCacheStat stat = font.getCacheStat();
+			CHECK(stat.cachedGlyphs == 2);
+
+			// プリロードはキャッシュの統計に影響しない
+			CHECK(stat.glyphHits == 0);
+			CHECK(stat.glyphMisses == 0);
+			CHECK(stat.shapingHits == 0);
+			CHECK(stat.shapingMisses == 0);
+			CHECK(stat.cachedShapes == 0);
+		}
+
+		// キャッシュ済みのグリフは再びラスタライズされない
+		const int64 usedArea = font.getCacheStat().atlasUsedArea;
+		CHECK(font.preload(U"🍣🔥"));
+		CHECK(font.getCacheStat().cachedGlyphs == 2);
+		CHECK(font.getCacheStat().atlasUsedArea == usedArea);
+
+		// 新しいグリフだけが追加される
+		CHECK(font.preload(U"🔥🐈"));
+		CHECK(font.getCacheStat().cachedGlyphs == 3);
+		CHECK(usedArea <= font.getCacheStat().atlasUsedArea);
+
+		// プリロードした文字列はシェーピングキャッシュを押し出さない
+		font.setShapingCacheCapacity(1);
+		const Array<GlyphIndex> glyphs = ToGlyphIndices(font.getResolvedGlyphs(U"🔥"));
+		CHECK(font.preload(U"🍣🐈🔥"));
+		CHECK(ToGlyphIndices(font.getResolvedGlyphs(U"🔥")) == glyphs);
+		CHECK(font.getCacheStat().shapingHits == 1);
+		CHECK(font.getCacheStat().shapingMisses == 1);
+	}
+}
@@ -0,0 +1,204 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Graphics2D.DrawRects")
+{
+	const Array<FloatRect> rects(3, FloatRect{ 0, 0, 10, 10 });
+	const Array<Float4> colors(2, Float4{ 1.0f, 1.0f, 1.0f, 1.0f });
+
+	CHECK_NOTHROW(Graphics2D::DrawRects(rects, ColorF{ 1.0 }));
+	CHECK_NOTHROW(Graphics2D::DrawRects(rects, Array<Float4>(3, Float4{ 1.0f, 1.0f, 1.0f, 1.0f })));
+	CHECK_THROWS_AS(Graphics2D::DrawRects(rects, colors), Error);
+}
+
+TEST_CASE("Graphics2D.DrawCircles")
+{
+	const Array<Float2> centers(3, Float2{ 100, 100 });
+	const Array<float> rs(3, 10.0f);
+	const Array<Float4> colors(3, Float4{ 1.0f, 1.0f, 1.0f, 1.0f });
+
+	CHECK_NOTHROW(Graphics2D::DrawCircles(centers, 10.0f, ColorF{ 1.0 }));
+	CHECK_NOTHROW(Graphics2D::DrawCircles(centers, rs, colors));
+	CHECK_THROWS_AS(Graphics2D::DrawCircles(centers, rs.take(2), colors), Error);
+	CHECK_THROWS_AS(Graphics2D::DrawCircles(centers, rs, colors.take(2)), Error);
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("Graphics2D.Benchmark")
+{
+	// 頂点は次のフレームまで蓄積されるので、頂点バッファの上限 (4,194,304) に達しないよう実行回数を固定する
+	const auto MakeBench = [](const std::string& title)
+		{
+			return Bench{}.title(title).warmup(0).epochs(5).epochIterations(1);
+		};
+
+	// 円弧・扇形・線端の頂点生成
+	{
+		const Circle circle{ 400, 300, 100 };
+
+		MakeBench("Vertex2DBuilder (200 shapes, r = 100)").run("Circle::drawPie", [&]()
+			{
+				for (int32 i = 0; i < 200; ++i)
+				{
+					circle.drawPie((i * 0.01), 270_deg);
+				}
+			});
+
+		MakeBench("Vertex2DBuilder (200 shapes, r = 100)").run("Circle::drawArc", [&]()
+			{
+				for (int32 i = 0; i < 200; ++i)
+				{
+					circle.drawArc((i * 0.01), 270_deg, 10, 10);
+				}
+			});
+
+		MakeBench("Vertex2DBuilder (200 shapes, r = 100)").run("Circle::drawArc (LineCap::Round)", [&]()
+			{
+				for (int32 i = 0; i < 200; ++i)
+				{
+					circle.drawArc(LineCap::Round, (i * 0.01), 270_deg, 10, 10);
+				}
+			});
+
+		MakeBench("Vertex2DBuilder (200 shapes, r = 100)").run("Circle::drawSegment", [&]()
+			{
+				for (int32 i = 0; i < 200; ++i)
+				{
+					circle.drawSegment((i * 0.01), 50);
+				}
+			});
+	}
+
+	// 円周上の頂点の生成を、変更前の 1 頂点ごとに FastMath::SinCos を呼ぶ実装と比べる
+	// （Renderer2DCommandList 側は記録の処理も含むため、差は実際より小さく出る）
+	{
+		const Float2 center{ 400, 300 };
+		constexpr float R = 1000.0f;
+
+		// 変更前の BuildCirclePie / BuildRoundCap と同じ、周上の頂点ごとの三角関数
+		const auto writeArcVertices = [](Vertex2D* pVertex, Vertex2D::IndexType* pIndex, const Float2& center, const float r, const float startAngle, const float angle, const Vertex2D::IndexType quality, const bool gradient)
+			{
+				const float radDelta = (angle / (quality - 1));
+
+				pVertex[0].set(center, Float4{ 1.0f, 1.0f, 1.0f, 1.0f });
+
+				for (Vertex2D::IndexType i = 0; i < quality; ++i)
+				{
+					const auto [s, c] = FastMath::SinCos(startAngle + (radDelta * i));
+					const float f = (gradient ? (std::cos(radDelta * i) * -0.5f + 0.5f) : 1.0f);
+					pVertex[i + 1].set((center.x + r * s), (center.y - r * c), Float4{ f, f, f, 1.0f });
+				}
+
+				for (Vertex2D::IndexType i = 0; i < (quality - 1); ++i)
+				{
+					*pIndex++ = 0;
+					*pIndex++ = (i + 1);
+					*pIndex++ = (i + 2);
+				}
+			};
+
+		Renderer2DCommandList commandList;
+		Array<Vertex2D> vertices;
+		Array<Vertex2D::IndexType> indices;
+
+		// 扇形（WriteArcVertices）
+		{
+			const Circle circle{ center, R };
+			commandList.addCirclePie(circle, 0.3, 6.0, Palette::White);
+			const Vertex2D::IndexType quality = static_cast<Vertex2D::IndexType>(commandList.num_vertices() - 1);
+			vertices.resize(quality + 1);
+			indices.resize((quality - 1) * 3);
+
+			Bench{}.title(fmt::format("CirclePie vertices (r = {}, quality = {})", R, quality)).relative(true)
+				.run("FastMath::SinCos per vertex", [&]()
+				{
+					writeArcVertices(vertices.data(), indices.data(), center, R, 0.3f, 6.0f, quality, false);
+					doNotOptimizeAway(vertices.back());
+				})
+				.run("WriteArcVertices", [&]()
+				{
+					commandList.clear();
+					commandList.addCirclePie(circle, 0.3, 6.0, Palette::White);
+					doNotOptimizeAway(commandList.getVertices().back());
+				});
+		}
+
+		// 丸い線端（WriteRoundCapVertices）
+		{
+			const Line line{ center, center.movedBy(300, 200) };
+			commandList.clear();
+			commandList.addLine(line, LineCap::Round, (R * 2), Palette::White);
+
+			// 線分の 4 頂点と、両端の線端（中心 + 周）
+			const Vertex2D::IndexType quality = static_cast<Vertex2D::IndexType>((commandList.num_vertices() - 4) / 2 - 1);
+			vertices.resize((quality + 1) * 2);
+			indices.resize((quality - 1) * 3 * 2);
+
+			const Float2 direction = line.vector().normalized();
+			const float startAngle = static_cast<float>(std::atan2(-direction.y, -direction.x));
+
+			Bench{}.title(fmt::format("Round cap vertices (r = {}, quality = {})", R, quality)).relative(true)
+				.run("FastMath::SinCos per vertex", [&]()
+				{
+					writeArcVertices(vertices.data(), indices.data(), Float2{ line.start }, R, startAngle, Math::PiF, quality, true);
+					writeArcVertices((vertices.data() + quality + 1), (indices.data() + (quality - 1) * 3), Float2{ line.end }, R, (startAngle + Math::PiF), Math::PiF, quality, true);
+					doNotOptimizeAway(vertices.back());
+				})
+				.run("WriteRoundCapVertices", [&]()
+				{
+					commandList.clear();
+					commandList.addLine(line, LineCap::Round, (R * 2), Palette::White);
+					doNotOptimizeAway(commandList.getVertices().back());
+				});
+		}
+	}
+
+	// 同じ半径の円 5,000 個
+	{
+		const Array<Float2> centers = Array<Float2>::IndexedGenerate(5'000, [](size_t i) { return Float2{ ((i % 100) * 8.0f), ((i / 100) * 6.0f) }; });
+
+		MakeBench("5,000 circles (r = 3)").run("Circle::draw", [&]()
+			{
+				for (const auto& center : centers)
+				{
+					Circle{ center, 3 }.draw();
+				}
+			});
+
+		MakeBench("5,000 circles (r = 3)").run("Graphics2D::DrawCircles", [&]()
+			{
+				Graphics2D::DrawCircles(centers, 3.0f, ColorF{ 1.0 });
+			});
+	}
+
+	// 長方形 5,000 個
+	{
+		const Array<FloatRect> rects = Array<FloatRect>::IndexedGenerate(5'000, [](size_t i) { const float x = ((i % 100) * 8.0f), y = ((i / 100) * 6.0f); return FloatRect{ x, y, (x + 4), (y + 4) }; });
+
+		MakeBench("5,000 rects").run("RectF::draw", [&]()
+			{
+				for (const auto& rect : rects)
+				{
+					RectF{ rect.left, rect.top, (rect.right - rect.left), (rect.bottom - rect.top) }.draw();
+				}
+			});
+
+		MakeBench("5,000 rects").run("Graphics2D::DrawRects", [&]()
+			{
+				Graphics2D::DrawRects(rects, ColorF{ 1.0 });
+			});
+	}
+}
+
+# endif
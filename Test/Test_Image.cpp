@@ -50,6 +50,79 @@ TEST_CASE("Image.bgraToRGBA")
 	CHECK_EQ(image1, image2);
 }
 
+TEST_CASE("Image.resizeHeight")
+{
+	const Image testImage = MakeTestImage(64);
+
+	Image image = testImage;
+	image.resizeHeight(128, Palette::Red);
+	CHECK_EQ(image.size(), Size{ 64, 128 });
+	CHECK_EQ(image[63][10], testImage[63][10]);
+	CHECK_EQ(image[64][10], Color{ Palette::Red });
+
+	image.resizeHeight(32);
+	CHECK_EQ(image.size(), Size{ 64, 32 });
+	CHECK_EQ(image[31][10], testImage[31][10]);
+}
+
+static Color PatternColor(const int32 x, const int32 y)
+{
+	return Color{ static_cast<uint8>(x), static_cast<uint8>(y), static_cast<uint8>(x ^ y), static_cast<uint8>(x + y) };
+}
+
+static Color PatternColor0_1(const double x, const double y)
+{
+	return ColorF{ x, y, (x * y), 1.0 }.toColor();
+}
+
+TEST_CASE("Image.parallelGenerator")
+{
+	for (const Size size : { Size{ 1, 1 }, Size{ 333, 257 }, Size{ 2048, 8 }, Size{ 0, 16 } })
+	{
+		const Image expected{ size, Arg::generator = PatternColor };
+
+		CHECK_EQ(Image{ size, Arg::parallelGenerator = PatternColor }, expected);
+		CHECK_EQ(Image{ size, Arg::parallelGenerator = [](Point p) { return PatternColor(p.x, p.y); } }, expected);
+		CHECK_EQ(Image{ size, Arg::rowGenerator = [](int32 y, std::span<Color> row)
+			{
+				for (int32 x = 0; x < static_cast<int32>(row.size()); ++x)
+				{
+					row[x] = PatternColor(x, y);
+				}
+			} }, expected);
+
+		const Image expected0_1{ size, Arg::generator0_1 = PatternColor0_1 };
+		CHECK_EQ(Image{ size, Arg::parallelGenerator0_1 = PatternColor0_1 }, expected0_1);
+		CHECK_EQ(Image{ size, Arg::parallelGenerator0_1 = [](Vec2 p) { return PatternColor0_1(p.x, p.y); } }, expected0_1);
+	}
+}
+
+TEST_CASE("Image.parallel")
+{
+	const Image testImage = MakeTestImage(300);
+
+	const auto invert = [](const Color& color) { return Color{ static_cast<uint8>(255 - color.r), static_cast<uint8>(255 - color.g), static_cast<uint8>(255 - color.b), color.a }; };
+	const Image inverted = testImage.parallel_map(invert);
+	REQUIRE_EQ(inverted.size(), testImage.size());
+
+	for (int32 y = 0; y < testImage.height(); y += 7)
+	{
+		for (int32 x = 0; x < testImage.width(); x += 5)
+		{
+			CHECK_EQ(inverted[y][x], invert(testImage[y][x]));
+		}
+	}
+
+	Image image = testImage;
+	image.parallel_each([&](Color& color) { color = invert(color); });
+	CHECK_EQ(image, inverted);
+
+	const auto isBright = [](const Color& color) { return (128 <= color.r); };
+	CHECK_EQ(testImage.parallel_count_if(isBright), static_cast<isize>(std::count_if(testImage.begin(), testImage.end(), isBright)));
+
+	CHECK(Image{}.parallel_map(invert).isEmpty());
+}
+
 # if SIV3D_RUN_BENCHMARK
 
 TEST_CASE("Image.premultiplyAlpha.Benchmark")
@@ -80,4 +153,33 @@ TEST_CASE("Image.bgraToRGBA.Benchmark")
 	}
 }
 
+TEST_CASE("Image.parallelGenerator.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	// 4K の手続き的なテクスチャ
+	const Size size{ 3840, 2160 };
+	const auto noise = [](const int32 x, const int32 y)
+		{
+			const uint32 h = ((static_cast<uint32>(x) * 73856093u) ^ (static_cast<uint32>(y) * 19349663u));
+			return Color{ static_cast<uint8>(h), static_cast<uint8>(h >> 8), static_cast<uint8>(h >> 16) };
+		};
+
+	Bench bench;
+	bench.title("Image generator (3840x2160)").relative(true);
+
+	bench.run("generator", [&]() { doNotOptimizeAway(Image{ size, Arg::generator = noise }); });
+	bench.run("parallelGenerator", [&]() { doNotOptimizeAway(Image{ size, Arg::parallelGenerator = noise }); });
+	bench.run("rowGenerator", [&]()
+		{
+			doNotOptimizeAway(Image{ size, Arg::rowGenerator = [&](int32 y, std::span<Color> row)
+				{
+					for (int32 x = 0; x < static_cast<int32>(row.size()); ++x)
+					{
+						row[x] = noise(x, y);
+					}
+				} });
+		});
+}
+
 # endif
@@ -0,0 +1,260 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+static Array<FilePath> SaveTestImages(const FilePathView directory, const size_t count, const int32 size)
+{
+	Array<FilePath> paths;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		Image image{ size, (size + static_cast<int32>(i)) };
+
+		for (auto& pixel : image)
+		{
+			pixel = Color{ RandomUint8(), RandomUint8(), RandomUint8(), RandomUint8() };
+		}
+
+		const bool isPNG = ((i % 4) != 3);
+		const FilePath path = (directory + U"{}.{}"_fmt(i, (isPNG ? U"png" : U"bmp")));
+		image.save(path);
+		paths << path;
+	}
+
+	return paths;
+}
+
+TEST_CASE("ImageDecoder.DecodeBatch")
+{
+	const ScopedLogSilencer logSilencer;
+
+	Array<FilePath> paths = SaveTestImages(U"../../Test/output/imagedecoder/", 16, 37);
+	paths << U"../../Test/output/imagedecoder/missing.png";
+
+	ImageDecoder::ResetStat();
+
+	const Array<Image> images = ImageDecoder::DecodeBatch(paths, PremultiplyAlpha::No);
+	REQUIRE_EQ(images.size(), paths.size());
+
+	for (size_t i = 0; i < (paths.size() - 1); ++i)
+	{
+		CHECK_EQ(images[i], ImageDecoder::Decode(paths[i], PremultiplyAlpha::No));
+		CHECK_EQ(images[i].height(), (37 + static_cast<int32>(i)));
+	}
+
+	CHECK(images.back().isEmpty());
+
+	// キャッシュは無効
+	{
+		const ImageDecoderStat stat = ImageDecoder::GetStat();
+		CHECK_EQ(stat.cacheHits, 0);
+		CHECK_EQ(stat.cachedImages, 0);
+
+		const auto png = std::find_if(stat.timings.begin(), stat.timings.end(), [](const ImageDecodeTiming& timing) { return (timing.imageFormat == ImageFormat::PNG); });
+		REQUIRE(png != stat.timings.end());
+		CHECK(24 <= png->decodeCount);
+		CHECK(0.0 < png->totalMillisec);
+		CHECK(png->maxMillisec <= png->totalMillisec);
+	}
+
+	// キャッシュ
+	{
+		ImageDecoder::SetCacheCapacity(64 * 1024 * 1024);
+		ImageDecoder::ResetStat();
+
+		const Array<Image> first = ImageDecoder::DecodeBatch(paths, PremultiplyAlpha::No);
+		const Array<Image> second = ImageDecoder::DecodeBatch(paths, PremultiplyAlpha::No);
+		CHECK(std::ranges::equal(first, images));
+		CHECK(std::ranges::equal(second, images));
+
+		ImageDecoderStat stat = ImageDecoder::GetStat();
+		CHECK_EQ(stat.cacheHits, 16);
+		CHECK_EQ(stat.cacheMisses, 16);
+		CHECK_EQ(stat.cachedImages, 16);
+		CHECK_EQ(stat.cacheHitRate(), 0.5);
+
+		// アルファ乗算の設定が異なる場合は別の画像としてキャッシュする
+		const Array<Image> premultiplied = ImageDecoder::DecodeBatch(paths, PremultiplyAlpha::Yes);
+		CHECK_EQ(premultiplied[0], ImageDecoder::Decode(paths[0], PremultiplyAlpha::Yes));
+		CHECK_EQ(ImageDecoder::GetStat().cachedImages, 32);
+
+		// 容量を超えた画像は、最も長い間使われていないものから破棄される
+		const size_t oneImageBytes = images[0].size_bytes();
+		ImageDecoder::SetCacheCapacity(oneImageBytes * 2);
+		stat = ImageDecoder::GetStat();
+		CHECK(stat.cachedBytes <= (oneImageBytes * 2));
+		CHECK_LE(stat.cachedImages, 2);
+
+		ImageDecoder::ClearCache();
+		CHECK_EQ(ImageDecoder::GetStat().cachedImages, 0);
+
+		ImageDecoder::SetCacheCapacity(0);
+		CHECK_EQ(ImageDecoder::GetCacheCapacity(), 0);
+	}
+
+	CHECK(ImageDecoder::DecodeBatch({}, PremultiplyAlpha::No).isEmpty());
+}
+
+static Image MakeGradientImage(const Size& size)
+{
+	return Image{ size, Arg::generator = [](const int32 x, const int32 y) { return Color{ static_cast<uint8>(x), static_cast<uint8>(y), static_cast<uint8>(x + y) }; } };
+}
+
+static Image CropImage(const Image& image, const Rect& region)
+{
+	Image result{ region.size };
+
+	for (int32 y = 0; y < region.h; ++y)
+	{
+		for (int32 x = 0; x < region.w; ++x)
+		{
+			result[y][x] = image[region.y + y][region.x + x];
+		}
+	}
+
+	return result;
+}
+
+/// @brief 2 つの画像の、チャンネルごとの差の絶対値の平均を返します。
+static double MeanAbsoluteDifference(const Image& a, const Image& b)
+{
+	double sum = 0.0;
+
+	for (int32 y = 0; y < a.height(); ++y)
+	{
+		for (int32 x = 0; x < a.width(); ++x)
+		{
+			sum += (std::abs(a[y][x].r - b[y][x].r) + std::abs(a[y][x].g - b[y][x].g) + std::abs(a[y][x].b - b[y][x].b));
+		}
+	}
+
+	return (sum / (a.num_pixels() * 3.0));
+}
+
+TEST_CASE("ImageDecoder.DecodeOptions")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Image source = MakeGradientImage(Size{ 256, 192 });
+
+	// PNG: 範囲の指定
+	{
+		const FilePath path = U"../../Test/output/imagedecoder/options.png";
+		source.save(path);
+
+		const Rect region{ 37, 21, 100, 50 };
+		const Image image = ImageDecoder::Decode(path, ImageDecodeOptions{ .premultiplyAlpha = PremultiplyAlpha::No, .region = region });
+		CHECK_EQ(image, CropImage(source, region));
+
+		// 画像の外側は無視される
+		CHECK_EQ(ImageDecoder::Decode(path, ImageDecodeOptions{ .region = Rect{ 200, 150, 100, 100 } }).size(), Size{ 56, 42 });
+		CHECK(ImageDecoder::Decode(path, ImageDecodeOptions{ .region = Rect{ 300, 0, 10, 10 } }).isEmpty());
+
+		// PNG は縮小しない
+		CHECK_EQ(ImageDecoder::Decode(path, ImageDecodeOptions{ .targetSize = Size{ 32, 24 } }).size(), source.size());
+	}
+
+	// JPEG: 縮小と範囲の指定
+	{
+		const FilePath path = U"../../Test/output/imagedecoder/options.jpg";
+		source.save(path);
+
+		const Image full = ImageDecoder::Decode(path, PremultiplyAlpha::No);
+		REQUIRE_EQ(full.size(), source.size());
+
+		// 目標サイズ以上になる、最も小さい縮小率が選ばれる
+		CHECK_EQ(ImageDecoder::Decode(path, ImageDecodeOptions{ .targetSize = Size{ 64, 48 } }).size(), Size{ 64, 48 });
+		CHECK_EQ(ImageDecoder::Decode(path, ImageDecodeOptions{ .targetSize = Size{ 65, 48 } }).size(), Size{ 128, 96 });
+		CHECK_EQ(ImageDecoder::Decode(path, ImageDecodeOptions{ .targetSize = Size{ 1, 1 } }).size(), Size{ 32, 24 });
+
+		const Image half = ImageDecoder::Decode(path, ImageDecodeOptions{ .targetSize = Size{ 128, 96 } });
+		REQUIRE_EQ(half.size(), Size{ 128, 96 });
+		CHECK(MeanAbsoluteDifference(half, Image{ half.size(), Arg::generator = [&](int32 x, int32 y) { return full[y * 2][x * 2]; } }) < 4.0);
+
+		// MCU の境界にそろっていない範囲
+		const Rect region{ 37, 21, 100, 50 };
+		const Image cropped = ImageDecoder::Decode(path, ImageDecodeOptions{ .region = region });
+		REQUIRE_EQ(cropped.size(), region.size);
+		CHECK(MeanAbsoluteDifference(cropped, CropImage(full, region)) < 2.0);
+
+		// 範囲の指定と縮小の組み合わせ
+		CHECK_EQ(ImageDecoder::Decode(path, ImageDecodeOptions{ .targetSize = Size{ 25, 12 }, .region = region }).size(), Size{ 26, 13 });
+	}
+
+	// DecodeBatch
+	{
+		const Array<FilePath> paths = { U"../../Test/output/imagedecoder/options.png", U"../../Test/output/imagedecoder/options.jpg" };
+		const Array<Image> images = ImageDecoder::DecodeBatch(paths, ImageDecodeOptions{ .targetSize = Size{ 64, 48 }, .region = Rect{ 0, 0, 128, 96 } });
+		REQUIRE_EQ(images.size(), 2);
+		CHECK_EQ(images[0].size(), Size{ 128, 96 });
+		CHECK_EQ(images[1].size(), Size{ 64, 48 });
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("ImageDecoder.DecodeBatch.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Array<FilePath> paths = SaveTestImages(U"../../Test/output/imagedecoder_benchmark/", 256, 128);
+
+	Bench{}.title("ImageDecoder (256 images, 128x128)").run("Decode (sequential)", [&]()
+		{
+			for (const auto& path : paths)
+			{
+				doNotOptimizeAway(ImageDecoder::Decode(path, PremultiplyAlpha::Yes));
+			}
+		});
+
+	Bench{}.title("ImageDecoder (256 images, 128x128)").run("DecodeBatch", [&]()
+		{
+			doNotOptimizeAway(ImageDecoder::DecodeBatch(paths, PremultiplyAlpha::Yes));
+		});
+
+	ImageDecoder::SetCacheCapacity(256 * 1024 * 1024);
+	(void)ImageDecoder::DecodeBatch(paths, PremultiplyAlpha::Yes);
+
+	Bench{}.title("ImageDecoder (256 images, 128x128)").run("DecodeBatch (cached)", [&]()
+		{
+			doNotOptimizeAway(ImageDecoder::DecodeBatch(paths, PremultiplyAlpha::Yes));
+		});
+
+	ImageDecoder::SetCacheCapacity(0);
+}
+
+TEST_CASE("ImageDecoder.DecodeOptions.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	// 24 メガピクセルの写真からサムネイルを作る
+	const FilePath path = U"../../Test/output/imagedecoder_benchmark/large.jpg";
+	MakeGradientImage(Size{ 6000, 4000 }).save(path);
+
+	Bench{}.title("JPEG 6000x4000").run("full decode", [&]()
+		{
+			doNotOptimizeAway(ImageDecoder::Decode(path, PremultiplyAlpha::No));
+		});
+
+	Bench{}.title("JPEG 6000x4000").run("targetSize 256x256 (1/8)", [&]()
+		{
+			doNotOptimizeAway(ImageDecoder::Decode(path, ImageDecodeOptions{ .targetSize = Size{ 256, 256 } }));
+		});
+
+	Bench{}.title("JPEG 6000x4000").run("region 512x512", [&]()
+		{
+			doNotOptimizeAway(ImageDecoder::Decode(path, ImageDecodeOptions{ .region = Rect{ 2000, 1500, 512, 512 } }));
+		});
+}
+
+# endif
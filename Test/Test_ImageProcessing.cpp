@@ -0,0 +1,644 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+static Image MakeTestImage(const Size& size)
+{
+	Image image{ size, Palette::White };
+
+	for (auto& pixel : image)
+	{
+		pixel.r = RandomUint8();
+		pixel.g = RandomUint8();
+		pixel.b = RandomUint8();
+		pixel.a = RandomUint8();
+	}
+
+	return image;
+}
+
+template <class Type>
+static Grid<Type> MakeTestGrid(const Size& size)
+{
+	Grid<Type> grid(size);
+
+	for (auto& value : grid)
+	{
+		if constexpr (std::is_same_v<Type, uint8>)
+		{
+			value = RandomUint8();
+		}
+		else if constexpr (std::is_same_v<Type, uint16>)
+		{
+			value = RandomUint16();
+		}
+		else
+		{
+			value = static_cast<float>(Random(-1.0, 1.0));
+		}
+	}
+
+	return grid;
+}
+
+template <class Type>
+static Type ToElement(const double value)
+{
+	if constexpr (std::is_floating_point_v<Type>)
+	{
+		return static_cast<Type>(value);
+	}
+	else
+	{
+		return static_cast<Type>(Clamp(std::round(value), 0.0, static_cast<double>(std::numeric_limits<Type>::max())));
+	}
+}
+
+// 各要素について f(sample, x, y, channel) を計算するスカラーの参照実装。sample(x, y) は範囲外を端の値で返す
+template <class Type, class Fty>
+static Grid<Type> ReferenceFilter(const Grid<Type>& src, Fty f)
+{
+	Grid<Type> dst(src.size());
+
+	const auto sample = [&](const int32 x, const int32 y)
+		{
+			return static_cast<double>(src[Clamp(y, 0, (src.height() - 1))][Clamp(x, 0, (src.width() - 1))]);
+		};
+
+	for (int32 y = 0; y < src.height(); ++y)
+	{
+		for (int32 x = 0; x < src.width(); ++x)
+		{
+			dst[y][x] = ToElement<Type>(f(sample, x, y, 0));
+		}
+	}
+
+	return dst;
+}
+
+template <class Fty>
+static Image ReferenceFilter(const Image& src, Fty f)
+{
+	Image dst{ src.size() };
+
+	for (int32 channel = 0; channel < 4; ++channel)
+	{
+		const auto sample = [&](const int32 x, const int32 y)
+			{
+				const Color& pixel = src[Clamp(y, 0, (src.height() - 1))][Clamp(x, 0, (src.width() - 1))];
+				return static_cast<double>((&pixel.r)[channel]);
+			};
+
+		for (int32 y = 0; y < src.height(); ++y)
+		{
+			for (int32 x = 0; x < src.width(); ++x)
+			{
+				(&dst[y][x].r)[channel] = ToElement<uint8>(f(sample, x, y, channel));
+			}
+		}
+	}
+
+	return dst;
+}
+
+template <class Type>
+static double MaxDifference(const Grid<Type>& a, const Grid<Type>& b)
+{
+	REQUIRE_EQ(a.size(), b.size());
+
+	double result = 0.0;
+
+	for (size_t i = 0; i < a.num_elements(); ++i)
+	{
+		result = Max(result, std::abs(static_cast<double>(a.data()[i]) - static_cast<double>(b.data()[i])));
+	}
+
+	return result;
+}
+
+static double MaxDifference(const Image& a, const Image& b)
+{
+	REQUIRE_EQ(a.size(), b.size());
+
+	double result = 0.0;
+
+	for (size_t i = 0; i < a.num_pixels(); ++i)
+	{
+		for (int32 channel = 0; channel < 4; ++channel)
+		{
+			result = Max(result, std::abs(static_cast<double>((&a.data()[i].r)[channel]) - static_cast<double>((&b.data()[i].r)[channel])));
+		}
+	}
+
+	return result;
+}
+
+static auto GaussianReference(const double sigma)
+{
+	const int32 radius = Max(1, static_cast<int32>(std::ceil(sigma * 3.0)));
+	Array<double> weights;
+
+	for (int32 i = -radius; i <= radius; ++i)
+	{
+		weights << std::exp(-(i * i) / (2.0 * sigma * sigma));
+	}
+
+	const double sum = weights.sum();
+
+	for (auto& weight : weights)
+	{
+		weight /= sum;
+	}
+
+	return [=](const auto& sample, const int32 x, const int32 y, int32)
+		{
+			double result = 0.0;
+
+			for (int32 dy = -radius; dy <= radius; ++dy)
+			{
+				for (int32 dx = -radius; dx <= radius; ++dx)
+				{
+					result += (weights[dy + radius] * weights[dx + radius] * sample((x + dx), (y + dy)));
+				}
+			}
+
+			return result;
+		};
+}
+
+static auto BoxReference(const int32 radius)
+{
+	return [=](const auto& sample, const int32 x, const int32 y, int32)
+		{
+			double result = 0.0;
+
+			for (int32 dy = -radius; dy <= radius; ++dy)
+			{
+				for (int32 dx = -radius; dx <= radius; ++dx)
+				{
+					result += sample((x + dx), (y + dy));
+				}
+			}
+
+			return (result / ((radius * 2 + 1) * (radius * 2 + 1)));
+		};
+}
+
+// Image のアルファチャンネル (channel == 3) は元の値のまま
+template <size_t N>
+static auto ConvolveReference(const std::array<float, N>& kernel)
+{
+	const int32 size = static_cast<int32>(std::sqrt(N));
+	const int32 radius = (size / 2);
+
+	return [=](const auto& sample, const int32 x, const int32 y, const int32 channel)
+		{
+			if (channel == 3)
+			{
+				return sample(x, y);
+			}
+
+			double result = 0.0;
+
+			for (int32 ky = 0; ky < size; ++ky)
+			{
+				for (int32 kx = 0; kx < size; ++kx)
+				{
+					result += (kernel[ky * size + kx] * sample((x + kx - radius), (y + ky - radius)));
+				}
+			}
+
+			return result;
+		};
+}
+
+static auto MorphologyReference(const int32 radius, const bool dilate)
+{
+	return [=](const auto& sample, const int32 x, const int32 y, int32)
+		{
+			double result = sample(x, y);
+
+			for (int32 dy = -radius; dy <= radius; ++dy)
+			{
+				for (int32 dx = -radius; dx <= radius; ++dx)
+				{
+					result = (dilate ? Max(result, sample((x + dx), (y + dy))) : Min(result, sample((x + dx), (y + dy))));
+				}
+			}
+
+			return result;
+		};
+}
+
+static auto SobelReference()
+{
+	return [](const auto& sample, const int32 x, const int32 y, int32)
+		{
+			const double gx = (sample((x + 1), (y - 1)) + 2 * sample((x + 1), y) + sample((x + 1), (y + 1)))
+				- (sample((x - 1), (y - 1)) + 2 * sample((x - 1), y) + sample((x - 1), (y + 1)));
+			const double gy = (sample((x - 1), (y + 1)) + 2 * sample(x, (y + 1)) + sample((x + 1), (y + 1)))
+				- (sample((x - 1), (y - 1)) + 2 * sample(x, (y - 1)) + sample((x + 1), (y - 1)));
+			return std::sqrt(gx * gx + gy * gy);
+		};
+}
+
+static Grid<float> ToFloatGrid(const Grid<uint8>& grid)
+{
+	Grid<float> result(grid.size());
+
+	for (size_t i = 0; i < grid.num_elements(); ++i)
+	{
+		result.data()[i] = grid.data()[i];
+	}
+
+	return result;
+}
+
+static Grid<uint8> GrayscaleReference(const Image& image)
+{
+	Grid<uint8> result(image.size());
+
+	for (size_t i = 0; i < image.num_pixels(); ++i)
+	{
+		const Color& pixel = image.data()[i];
+		result.data()[i] = static_cast<uint8>((77 * pixel.r + 150 * pixel.g + 29 * pixel.b + 128) >> 8);
+	}
+
+	return result;
+}
+
+template <class Type>
+static Grid<uint8> ThresholdReference(const Grid<Type>& grid, const Type threshold)
+{
+	Grid<uint8> result(grid.size());
+
+	for (size_t i = 0; i < grid.num_elements(); ++i)
+	{
+		result.data()[i] = ((threshold < grid.data()[i]) ? 255 : 0);
+	}
+
+	return result;
+}
+
+static void CompositePremultipliedReference(const Image& src, Image& dst, const Point& pos)
+{
+	for (int32 y = 0; y < src.height(); ++y)
+	{
+		for (int32 x = 0; x < src.width(); ++x)
+		{
+			const Point p = (pos + Point{ x, y });
+
+			if ((p.x < 0) || (p.y < 0) || (dst.width() <= p.x) || (dst.height() <= p.y))
+			{
+				continue;
+			}
+
+			const Color& s = src[y][x];
+			Color& d = dst[p.y][p.x];
+
+			for (int32 channel = 0; channel < 4; ++channel)
+			{
+				const double value = ((&s.r)[channel] + std::round((&d.r)[channel] * (255 - s.a) / 255.0));
+				(&d.r)[channel] = static_cast<uint8>(Min(value, 255.0));
+			}
+		}
+	}
+}
+
+// Image と Grid の各要素型について、参照実装との差が tolerance 以下であることを確かめる
+template <class Fty, class Reference>
+static void CheckAgainstReference(Fty f, Reference reference, const double tolerance)
+{
+	for (const auto size : { Size{ 67, 45 }, Size{ 5, 3 }, Size{ 1, 1 } })
+	{
+		{
+			const Image image = MakeTestImage(size);
+			CHECK_LE(MaxDifference(f(image), ReferenceFilter(image, reference)), tolerance);
+		}
+
+		{
+			const Grid<uint8> grid = MakeTestGrid<uint8>(size);
+			CHECK_LE(MaxDifference(f(grid), ReferenceFilter(grid, reference)), tolerance);
+		}
+
+		{
+			const Grid<uint16> grid = MakeTestGrid<uint16>(size);
+			CHECK_LE(MaxDifference(f(grid), ReferenceFilter(grid, reference)), tolerance);
+		}
+
+		{
+			const Grid<float> grid = MakeTestGrid<float>(size);
+			CHECK_LE(MaxDifference(f(grid), ReferenceFilter(grid, reference)), 1e-4);
+		}
+	}
+}
+
+TEST_CASE("ImageProcessing.Resample")
+{
+	// 同じサイズへのリサンプリングでは画像が変わらない
+	{
+		const Image testImage = MakeTestImage(Size{ 67, 45 });
+
+		for (const auto filter : { ResampleFilter::Box, ResampleFilter::Bilinear, ResampleFilter::Bicubic, ResampleFilter::Lanczos3 })
+		{
+			CHECK_EQ(ImageProcessing::Resample(testImage, testImage.size(), filter), testImage);
+		}
+	}
+
+	// 単色の画像は、リサンプリング後も同じ色になる
+	{
+		const Color color{ 12, 34, 200, 255 };
+		const Image testImage{ Size{ 101, 77 }, color };
+
+		for (const auto filter : { ResampleFilter::Box, ResampleFilter::Bilinear, ResampleFilter::Bicubic, ResampleFilter::Lanczos3, ResampleFilter::Mitchell })
+		{
+			for (const auto size : { Size{ 50, 38 }, Size{ 13, 7 }, Size{ 1, 1 }, Size{ 240, 160 } })
+			{
+				const Image image = ImageProcessing::Resample(testImage, size, filter);
+				CHECK_EQ(image, Image{ size, color });
+			}
+		}
+	}
+
+	// 同じ画像を src と dst に渡す
+	{
+		const Image testImage = MakeTestImage(Size{ 40, 30 });
+
+		Image image = testImage;
+		ImageProcessing::Resample(image, image, ResampleFilter::Bilinear);
+		CHECK_EQ(image, testImage);
+	}
+}
+
+TEST_CASE("ImageProcessing.GenerateMipmaps")
+{
+	const Image testImage = MakeTestImage(Size{ 100, 40 });
+
+	Array<Image> mipmaps;
+	ImageProcessing::GenerateMipmaps(testImage, mipmaps);
+
+	REQUIRE_EQ(mipmaps.size(), (ImageProcessing::CalculateMipmapLevel(100, 40) - 1));
+	CHECK_EQ(mipmaps[0].size(), Size{ 50, 20 });
+	CHECK_EQ(mipmaps[1].size(), Size{ 25, 10 });
+	CHECK_EQ(mipmaps.back().size(), Size{ 1, 1 });
+
+	// 既存の画像を再利用する
+	const Color* data = mipmaps[0].data();
+	ImageProcessing::GenerateMipmaps(testImage, mipmaps, ResampleFilter::Mitchell);
+	CHECK_EQ(mipmaps[0].data(), data);
+}
+
+TEST_CASE("ImageProcessing.GaussianBlur")
+{
+	for (const double sigma : { 0.5, 1.0, 2.5 })
+	{
+		CheckAgainstReference([=](const auto& src) { return ImageProcessing::GaussianBlur(src, sigma); }, GaussianReference(sigma), 1.0);
+	}
+
+	// sigma が 0 以下の場合は変化しない
+	const Image testImage = MakeTestImage(Size{ 20, 10 });
+	CHECK_EQ(ImageProcessing::GaussianBlur(testImage, 0.0), testImage);
+
+	// 単色の画像は変化しない
+	const Image image{ Size{ 33, 17 }, Color{ 12, 34, 200, 255 } };
+	CHECK_EQ(ImageProcessing::GaussianBlur(image, 3.0), image);
+}
+
+TEST_CASE("ImageProcessing.BoxBlur")
+{
+	for (const int32 radius : { 1, 2, 7, 40 })
+	{
+		CheckAgainstReference([=](const auto& src) { return ImageProcessing::BoxBlur(src, radius); }, BoxReference(radius), 1.0);
+	}
+
+	// 累積和の誤差が蓄積しない
+	{
+		const Grid<uint16> grid = MakeTestGrid<uint16>(Size{ 300, 500 });
+		CHECK_LE(MaxDifference(ImageProcessing::BoxBlur(grid, 3), ReferenceFilter(grid, BoxReference(3))), 1.0);
+	}
+}
+
+TEST_CASE("ImageProcessing.Convolve")
+{
+	const std::array<float, 9> sharpen = { 0, -1, 0, -1, 5, -1, 0, -1, 0 };
+	const std::array<float, 9> emboss = { -2, -1, 0, -1, 1, 1, 0, 1, 2 };
+	std::array<float, 25> kernel5x5;
+
+	for (size_t i = 0; i < kernel5x5.size(); ++i)
+	{
+		kernel5x5[i] = (static_cast<float>(static_cast<int32>(i % 7) - 3) * 0.1f);
+	}
+
+	// Image のアルファチャンネルは変化しない
+	CheckAgainstReference([&](const auto& src) { return ImageProcessing::Convolve(src, sharpen); }, ConvolveReference(sharpen), 1.0);
+	CheckAgainstReference([&](const auto& src) { return ImageProcessing::Convolve(src, emboss); }, ConvolveReference(emboss), 1.0);
+	CheckAgainstReference([&](const auto& src) { return ImageProcessing::Convolve(src, kernel5x5); }, ConvolveReference(kernel5x5), 1.0);
+}
+
+TEST_CASE("ImageProcessing.Dilate/Erode")
+{
+	for (const int32 radius : { 1, 3 })
+	{
+		CheckAgainstReference([=](const auto& src) { return ImageProcessing::Dilate(src, radius); }, MorphologyReference(radius, true), 0.0);
+		CheckAgainstReference([=](const auto& src) { return ImageProcessing::Erode(src, radius); }, MorphologyReference(radius, false), 0.0);
+	}
+}
+
+TEST_CASE("ImageProcessing.Grayscale/Threshold")
+{
+	for (const auto size : { Size{ 67, 45 }, Size{ 3, 1 } })
+	{
+		const Image image = MakeTestImage(size);
+		CHECK_EQ(ImageProcessing::Grayscale(image), GrayscaleReference(image));
+
+		const Grid<uint8> grid8 = MakeTestGrid<uint8>(size);
+		const Grid<uint16> grid16 = MakeTestGrid<uint16>(size);
+		const Grid<float> gridF = MakeTestGrid<float>(size);
+
+		for (const uint8 threshold : { 0, 127, 254, 255 })
+		{
+			CHECK_EQ(ImageProcessing::Threshold(grid8, threshold), ThresholdReference(grid8, threshold));
+		}
+
+		for (const uint16 threshold : { 0, 1000, 65535 })
+		{
+			CHECK_EQ(ImageProcessing::Threshold(grid16, threshold), ThresholdReference(grid16, threshold));
+		}
+
+		for (const float threshold : { -1.0f, 0.0f, 0.5f })
+		{
+			CHECK_EQ(ImageProcessing::Threshold(gridF, threshold), ThresholdReference(gridF, threshold));
+		}
+	}
+}
+
+TEST_CASE("ImageProcessing.Sobel")
+{
+	for (const auto size : { Size{ 67, 45 }, Size{ 2, 2 } })
+	{
+		const Grid<uint8> grid8 = MakeTestGrid<uint8>(size);
+		CHECK_LE(MaxDifference(ImageProcessing::Sobel(grid8), ReferenceFilter(ToFloatGrid(grid8), SobelReference())), 1e-2);
+
+		const Grid<float> gridF = MakeTestGrid<float>(size);
+		CHECK_LE(MaxDifference(ImageProcessing::Sobel(gridF), ReferenceFilter(gridF, SobelReference())), 1e-4);
+	}
+}
+
+TEST_CASE("ImageProcessing.Canny")
+{
+	// 64x64 の中央にある 32x32 の正方形
+	Grid<uint8> grid(Size{ 64, 64 }, 0);
+
+	for (int32 y = 16; y < 48; ++y)
+	{
+		for (int32 x = 16; x < 48; ++x)
+		{
+			grid[y][x] = 200;
+		}
+	}
+
+	const Grid<uint8> edges = ImageProcessing::Canny(grid, 100.0, 300.0);
+
+	size_t count = 0;
+
+	for (int32 y = 0; y < 64; ++y)
+	{
+		for (int32 x = 0; x < 64; ++x)
+		{
+			if (edges[y][x] == 0)
+			{
+				continue;
+			}
+
+			CHECK_EQ(edges[y][x], 255);
+			++count;
+
+			// エッジは正方形の境界から 1 ピクセル以内にある
+			const bool nearVertical = ((InRange(x, 14, 17) || InRange(x, 46, 49)) && InRange(y, 14, 49));
+			const bool nearHorizontal = ((InRange(y, 14, 17) || InRange(y, 46, 49)) && InRange(x, 14, 49));
+			CHECK((nearVertical || nearHorizontal));
+		}
+	}
+
+	// 4 辺すべてでエッジが見つかる
+	CHECK_GE(count, (28 * 4));
+	CHECK((edges[32][16] || edges[32][15]));
+	CHECK((edges[16][32] || edges[15][32]));
+	CHECK((edges[32][47] || edges[32][48]));
+	CHECK((edges[47][32] || edges[48][32]));
+
+	// しきい値が高すぎるとエッジは見つからない
+	CHECK_EQ(ImageProcessing::Canny(grid, 2000.0, 3000.0), Grid<uint8>(Size{ 64, 64 }, 0));
+}
+
+TEST_CASE("ImageProcessing.CompositePremultiplied")
+{
+	Image src = MakeTestImage(Size{ 37, 21 });
+	src.premultiplyAlpha();
+
+	for (const auto pos : { Point{ 0, 0 }, Point{ 5, 3 }, Point{ -7, 10 }, Point{ 40, 30 }, Point{ 100, 0 } })
+	{
+		Image dst = MakeTestImage(Size{ 50, 35 });
+		dst.premultiplyAlpha();
+
+		Image expected = dst;
+		CompositePremultipliedReference(src, expected, pos);
+
+		ImageProcessing::CompositePremultiplied(src, dst, pos);
+		CHECK_EQ(dst, expected);
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("ImageProcessing.Resample.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Image testImage = MakeTestImage(Size{ 3840, 2160 });
+	const Size size{ 1920, 1080 };
+	Image dst{ size };
+
+	{
+		Bench bench;
+		bench.title("3840x2160 -> 1920x1080").relative(true);
+		bench.run("Resize (stb)", [&]() { doNotOptimizeAway(ImageProcessing::Resize(testImage, size)); });
+		bench.run("Resample Box", [&]() { ImageProcessing::Resample(testImage, dst, ResampleFilter::Box); });
+		bench.run("Resample Bilinear", [&]() { ImageProcessing::Resample(testImage, dst, ResampleFilter::Bilinear); });
+		bench.run("Resample Bicubic", [&]() { ImageProcessing::Resample(testImage, dst, ResampleFilter::Bicubic); });
+		bench.run("Resample Lanczos3", [&]() { ImageProcessing::Resample(testImage, dst, ResampleFilter::Lanczos3); });
+		bench.run("Resample Mitchell", [&]() { ImageProcessing::Resample(testImage, dst, ResampleFilter::Mitchell); });
+	}
+}
+
+TEST_CASE("ImageProcessing.Filter.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	// スカラーの参照実装は遅いため、小さめの画像で比較する
+	const Size size{ 640, 360 };
+	const Image image = MakeTestImage(size);
+	const Grid<uint8> grid = ImageProcessing::Grayscale(image);
+	const std::array<float, 9> sharpen = { 0, -1, 0, -1, 5, -1, 0, -1, 0 };
+
+	Image dst{ size };
+	Image premultiplied = image;
+	premultiplied.premultiplyAlpha();
+
+	const auto compare = [](const char* title, auto&& simd, auto&& reference)
+		{
+			Bench bench;
+			bench.title(title).relative(true);
+			bench.run("scalar reference", reference);
+			bench.run("ImageProcessing", simd);
+		};
+
+	compare("GaussianBlur (640x360 RGBA, sigma = 2)",
+		[&]() { doNotOptimizeAway(ImageProcessing::GaussianBlur(image, 2.0)); },
+		[&]() { doNotOptimizeAway(ReferenceFilter(image, GaussianReference(2.0))); });
+
+	compare("BoxBlur (640x360 RGBA, radius = 4)",
+		[&]() { doNotOptimizeAway(ImageProcessing::BoxBlur(image, 4)); },
+		[&]() { doNotOptimizeAway(ReferenceFilter(image, BoxReference(4))); });
+
+	compare("Convolve 3x3 (640x360 RGBA)",
+		[&]() { doNotOptimizeAway(ImageProcessing::Convolve(image, sharpen)); },
+		[&]() { doNotOptimizeAway(ReferenceFilter(image, ConvolveReference(sharpen))); });
+
+	compare("Dilate (640x360 RGBA, radius = 2)",
+		[&]() { doNotOptimizeAway(ImageProcessing::Dilate(image, 2)); },
+		[&]() { doNotOptimizeAway(ReferenceFilter(image, MorphologyReference(2, true))); });
+
+	compare("Grayscale (640x360 RGBA)",
+		[&]() { doNotOptimizeAway(ImageProcessing::Grayscale(image)); },
+		[&]() { doNotOptimizeAway(GrayscaleReference(image)); });
+
+	compare("Threshold (640x360 uint8)",
+		[&]() { doNotOptimizeAway(ImageProcessing::Threshold(grid, uint8{ 127 })); },
+		[&]() { doNotOptimizeAway(ThresholdReference(grid, uint8{ 127 })); });
+
+	compare("Sobel (640x360 uint8)",
+		[&]() { doNotOptimizeAway(ImageProcessing::Sobel(grid)); },
+		[&]() { doNotOptimizeAway(ReferenceFilter(ToFloatGrid(grid), SobelReference())); });
+
+	compare("CompositePremultiplied (640x360 RGBA)",
+		[&]() { ImageProcessing::CompositePremultiplied(premultiplied, dst, Point{ 0, 0 }); },
+		[&]() { CompositePremultipliedReference(premultiplied, dst, Point{ 0, 0 }); });
+
+	{
+		Bench bench;
+		bench.title("Canny (640x360 uint8)");
+		bench.run("ImageProcessing", [&]() { doNotOptimizeAway(ImageProcessing::Canny(grid, 50.0, 150.0)); });
+	}
+}
+
+# endif
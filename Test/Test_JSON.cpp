@@ -156,4 +156,378 @@ TEST_CASE("JSON Invalid")
 		const JSON json = JSON::Parse(U"{ \"a\": \"Siv3D\"");
 		CHECK(json.isInvalid());
 	}
-}
\ No newline at end of file
+}
+
+// offset バイト目から token が始まる JSON 配列を作る
+static std::string MakeJSONWithTokenAt(const size_t offset, const std::string_view token)
+{
+	// [" + 詰め物 + ", + token + ]
+	return ("[\"" + std::string((offset - 4), 'a') + "\"," + std::string{ token } + "]");
+}
+
+TEST_CASE("JSONReader buffer boundary")
+{
+	// IReader から読み込むときのバッファサイズ
+	constexpr size_t BufferSize = (64 * 1024);
+
+	// token の最初の 1 バイトから最後の 1 バイトまで、すべての位置でバッファの境界をまたがせて読む
+	const auto readAcrossBoundary = [&](const std::string_view token, const auto& check)
+	{
+		for (size_t i = 1; i < token.size(); ++i)
+		{
+			const std::string text = MakeJSONWithTokenAt((BufferSize - i), token);
+
+			JSONReader reader{ MemoryReader{ text.data(), text.size() } };
+			REQUIRE(reader.isOpen());
+
+			CHECK_EQ(reader.next(), JSONEvent::BeginArray);
+			CHECK_EQ(reader.next(), JSONEvent::String);
+			CHECK_EQ(reader.getStringUTF8().size(), (BufferSize - i - 4));
+
+			check(reader);
+
+			CHECK_EQ(reader.next(), JSONEvent::EndArray);
+			CHECK_EQ(reader.next(), JSONEvent::EndOfDocument);
+			CHECK_FALSE(reader.hasError());
+		}
+	};
+
+	// 文字列
+	readAcrossBoundary(R"("Siv3D OpenSiv3D")", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::String);
+			CHECK_EQ(reader.getStringUTF8(), "Siv3D OpenSiv3D");
+		});
+
+	// エスケープシーケンス
+	readAcrossBoundary(R"("a\n\u00e9\"b\ud83d\udd25🔥")", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::String);
+			CHECK_EQ(reader.getString(), U"a\né\"b🔥🔥");
+		});
+
+	// 数値
+	readAcrossBoundary("-1234567890", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::NumberInt);
+			CHECK_EQ(reader.getInt64(), -1234567890);
+		});
+
+	readAcrossBoundary("12345678901234", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::NumberUint);
+			CHECK_EQ(reader.getUint64(), 12345678901234ull);
+		});
+
+	readAcrossBoundary("-12.5e3", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::NumberFloat);
+			CHECK_EQ(reader.getDouble(), -12500.0);
+		});
+
+	readAcrossBoundary("true", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::Bool);
+			CHECK(reader.getBool());
+		});
+
+	// バッファを参照しているキーが、値の読み込みで退避される
+	readAcrossBoundary(R"({"key":"value","n":[1,2]})", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::BeginObject);
+			CHECK_EQ(reader.readJSON(), JSON::Parse(U"{ \"key\": \"value\", \"n\": [1, 2] }"));
+		});
+
+	// 部分木の読み飛ばし
+	readAcrossBoundary(R"([["\"]"],{"a":1}])", [](JSONReader& reader)
+		{
+			CHECK_EQ(reader.next(), JSONEvent::BeginArray);
+			CHECK_EQ(reader.skip(), JSONEvent::EndArray);
+		});
+}
+
+TEST_CASE("JSONReader")
+{
+	const std::string text = R"({ "name": "Siv3D", "values": [1, -2, 3.5, true, null, "a\"b\u00e9"], "nested": { "x": [[]], "y": {} }, "last": 42 })";
+
+	// イベント列
+	{
+		JSONReader reader{ text.data(), text.size() };
+		REQUIRE(reader.isOpen());
+
+		CHECK_EQ(reader.next(), JSONEvent::BeginObject);
+		CHECK_EQ(reader.getDepth(), 1);
+		CHECK_EQ(reader.next(), JSONEvent::Key);
+		CHECK_EQ(reader.getStringUTF8(), "name");
+		CHECK_EQ(reader.next(), JSONEvent::String);
+		CHECK_EQ(reader.getString(), U"Siv3D");
+		CHECK_EQ(reader.next(), JSONEvent::Key);
+		CHECK_EQ(reader.next(), JSONEvent::BeginArray);
+		CHECK_EQ(reader.next(), JSONEvent::NumberUint);
+		CHECK_EQ(reader.getInt64(), 1);
+		CHECK_EQ(reader.next(), JSONEvent::NumberInt);
+		CHECK_EQ(reader.getInt64(), -2);
+		CHECK_EQ(reader.next(), JSONEvent::NumberFloat);
+		CHECK_EQ(reader.getDouble(), 3.5);
+		CHECK_EQ(reader.next(), JSONEvent::Bool);
+		CHECK(reader.getBool());
+		CHECK_EQ(reader.next(), JSONEvent::Null);
+		CHECK_EQ(reader.next(), JSONEvent::String);
+		CHECK_EQ(reader.getString(), U"a\"b\u00e9");
+		CHECK_EQ(reader.next(), JSONEvent::EndArray);
+
+		// 部分木を読み飛ばす
+		CHECK_EQ(reader.next(), JSONEvent::Key);
+		CHECK_EQ(reader.getStringUTF8(), "nested");
+		CHECK_EQ(reader.skip(), JSONEvent::EndObject);
+
+		CHECK_EQ(reader.next(), JSONEvent::Key);
+		CHECK_EQ(reader.next(), JSONEvent::NumberUint);
+		CHECK_EQ(reader.getUint64(), 42);
+		CHECK_EQ(reader.next(), JSONEvent::EndObject);
+		CHECK_EQ(reader.getDepth(), 0);
+		CHECK_EQ(reader.next(), JSONEvent::EndOfDocument);
+		CHECK_FALSE(reader.hasError());
+	}
+
+	// IReader から読み込み、必要な部分木だけを JSON にする
+	{
+		JSONReader reader{ MemoryReader{ text.data(), text.size() } };
+		REQUIRE(reader.isOpen());
+
+		CHECK_EQ(reader.next(), JSONEvent::BeginObject);
+
+		while (reader.next() == JSONEvent::Key)
+		{
+			if (reader.getStringUTF8() == "nested")
+			{
+				CHECK_EQ(reader.readJSON(), JSON::Parse(U"{ \"x\": [[]], \"y\": {} }"));
+			}
+			else
+			{
+				reader.skip();
+			}
+		}
+
+		CHECK_EQ(reader.getEvent(), JSONEvent::EndObject);
+		CHECK_EQ(reader.next(), JSONEvent::EndOfDocument);
+	}
+
+	// ドキュメント全体
+	{
+		JSONReader reader{ text.data(), text.size() };
+		reader.next();
+		CHECK_EQ(reader.readJSON(), JSON::Parse(text));
+	}
+
+	// 不正な JSON
+	{
+		const ScopedLogSilencer logSilencer;
+
+		for (const std::string_view invalid : { "[1,]", "{\"a\" 1}", "[01]", "\"abc", "[1 2]", "tru", "1 2", "[" })
+		{
+			JSONReader reader{ invalid.data(), invalid.size() };
+
+			JSONEvent event;
+
+			do
+			{
+				event = reader.next();
+			} while ((event != JSONEvent::EndOfDocument) && (event != JSONEvent::Error));
+
+			CHECK_EQ(event, JSONEvent::Error);
+			CHECK(reader.hasError());
+			CHECK_FALSE(reader.getErrorMessage().isEmpty());
+		}
+	}
+
+	// 深い入れ子
+	{
+		const ScopedLogSilencer logSilencer;
+
+		// 制限内の入れ子は読み込める
+		{
+			const std::string nested = (std::string(100, '[') + std::string(100, ']'));
+			JSONReader reader{ nested.data(), nested.size() };
+			reader.next();
+			CHECK_EQ(reader.readJSON(), JSON::Parse(std::string_view{ nested }));
+		}
+
+		// スタックを使い切るほど深い入れ子は、エラーとして扱う
+		{
+			const std::string nested(1'000'000, '[');
+			JSONReader reader{ nested.data(), nested.size() };
+			reader.next();
+			CHECK_FALSE(reader.readJSON());
+			CHECK(reader.hasError());
+		}
+	}
+}
+
+TEST_CASE("JSONWriter")
+{
+	const JSON json = JSON::Parse(U"{ \"name\": \"Siv3D\", \"values\": [1, -2, 3.5, true, null, \"a\\\"b\\n\"], \"empty\": {}, \"nested\": { \"x\": [[]] } }");
+
+	for (const size_t spaceCount : { 0, 2, 4 })
+	{
+		std::unique_ptr<MemoryWriter> output = std::make_unique<MemoryWriter>();
+		MemoryWriter* pOutput = output.get();
+
+		JSONWriter writer{ std::move(output) };
+		REQUIRE(writer.isOpen());
+		writer.setIndent(U' ', spaceCount);
+
+		// JSON のキーは辞書順に並ぶため、同じ順で書き込む
+		writer.startObject();
+		writer.key(U"empty").startObject().endObject();
+		writer.key(U"name").write(U"Siv3D");
+		writer.keyUTF8("nested").write(JSON::Parse(U"{ \"x\": [[]] }"));
+		writer.key(U"values").startArray();
+		writer.write(1).write(-2).write(3.5).write(true).write(nullptr).write(U"a\"b\n");
+		writer.endArray();
+		writer.endObject();
+
+		CHECK(writer.isComplete());
+		CHECK(writer.flush());
+
+		const Blob& blob = pOutput->getBlob();
+		const std::string_view result{ reinterpret_cast<const char*>(blob.data()), blob.size() };
+
+		CHECK_EQ(JSON::Parse(result), json);
+
+		if (spaceCount == 0)
+		{
+			CHECK_EQ(result, json.formatUTF8Minified());
+		}
+		else
+		{
+			CHECK_EQ(result, json.formatUTF8(U' ', spaceCount));
+		}
+	}
+
+	// 対応の取れていない書き込み
+	{
+		JSONWriter writer{ std::make_unique<MemoryWriter>() };
+		writer.startArray();
+		CHECK_THROWS_AS(writer.key(U"a"), Error);
+		CHECK_THROWS_AS(writer.endObject(), Error);
+		writer.endArray();
+		CHECK_THROWS_AS(writer.write(1), Error);
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+/// @brief テレメトリのような、同じ形のレコードが並ぶ JSON を生成します。
+static std::string MakeTelemetryJSON(const size_t count)
+{
+	std::unique_ptr<MemoryWriter> output = std::make_unique<MemoryWriter>();
+	MemoryWriter* pOutput = output.get();
+
+	JSONWriter writer{ std::move(output) };
+	writer.startArray();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		writer.startObject();
+		writer.keyUTF8("id").write(i);
+		writer.keyUTF8("name").writeUTF8("sample");
+		writer.keyUTF8("position").startArray().write(i * 0.5).write(i * -0.25).write(1.0).endArray();
+		writer.keyUTF8("tags").startArray().writeUTF8("a").writeUTF8("b").writeUTF8("c").endArray();
+		writer.keyUTF8("detail").startObject().keyUTF8("active").write((i % 2) == 0).keyUTF8("score").write(i % 100).endObject();
+		writer.endObject();
+	}
+
+	writer.endArray();
+	writer.flush();
+
+	const Blob& blob = pOutput->getBlob();
+	return std::string{ reinterpret_cast<const char*>(blob.data()), blob.size() };
+}
+
+TEST_CASE("JSONReader.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const std::string text = MakeTelemetryJSON(100000);
+
+	Bench bench;
+	bench.title("JSON read (" + std::to_string(text.size() / 1024) + " KiB)").relative(true).unit("byte").batch(text.size());
+
+	bench.run("JSON::Parse (DOM)", [&]()
+	{
+		doNotOptimizeAway(JSON::Parse(text));
+	});
+
+	bench.run("JSONReader (all events)", [&]()
+	{
+		JSONReader reader{ text.data(), text.size() };
+		int64 sum = 0;
+
+		for (JSONEvent event = reader.next(); (event != JSONEvent::EndOfDocument) && (event != JSONEvent::Error); event = reader.next())
+		{
+			if (event == JSONEvent::NumberUint)
+			{
+				sum += reader.getInt64();
+			}
+		}
+
+		doNotOptimizeAway(sum);
+	});
+
+	bench.run("JSONReader (skip \"detail\")", [&]()
+	{
+		JSONReader reader{ text.data(), text.size() };
+		int64 sum = 0;
+
+		for (JSONEvent event = reader.next(); (event != JSONEvent::EndOfDocument) && (event != JSONEvent::Error); event = reader.next())
+		{
+			if ((event == JSONEvent::Key) && (reader.getStringUTF8() == "detail"))
+			{
+				reader.skip();
+			}
+			else if (event == JSONEvent::NumberUint)
+			{
+				sum += reader.getInt64();
+			}
+		}
+
+		doNotOptimizeAway(sum);
+	});
+
+	bench.run("JSONReader (IReader)", [&]()
+	{
+		JSONReader reader{ MemoryViewReader{ text.data(), text.size() } };
+		size_t count = 0;
+
+		while (reader.next() != JSONEvent::EndOfDocument)
+		{
+			++count;
+		}
+
+		doNotOptimizeAway(count);
+	});
+}
+
+TEST_CASE("JSONWriter.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const std::string text = MakeTelemetryJSON(100000);
+	const JSON json = JSON::Parse(text);
+
+	Bench bench;
+	bench.title("JSON write").relative(true).unit("byte").batch(text.size());
+
+	bench.run("JSON::formatUTF8Minified (DOM)", [&]()
+	{
+		doNotOptimizeAway(json.formatUTF8Minified());
+	});
+
+	bench.run("JSONWriter", [&]()
+	{
+		doNotOptimizeAway(MakeTelemetryJSON(100000));
+	});
+}
+
+# endif
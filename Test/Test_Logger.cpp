@@ -0,0 +1,95 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <atomic>
+# include <thread>
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Logger.async")
+{
+	const LoggerStat before = Logger.getStat();
+
+	Logger.enableAsync(1024);
+	CHECK(Logger.isAsync());
+
+	Threading::ParallelFor(0, 64, [](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				Logger << U"Logger.async " << i;
+			}
+		}, 1);
+
+	Logger.flush();
+
+	const LoggerStat after = Logger.getStat();
+	CHECK(64 <= (after.messageCount - before.messageCount));
+	CHECK_EQ(after.queuedMessageCount, 0);
+	CHECK_EQ(after.droppedMessageCount, before.droppedMessageCount);
+
+	Logger.disableAsync();
+	CHECK_FALSE(Logger.isAsync());
+
+	// 同期モードでも統計をとる
+	Logger << U"Logger.async (sync)";
+	CHECK_EQ((Logger.getStat().writeCount - after.writeCount), 1);
+}
+
+TEST_CASE("Logger.async.Drop")
+{
+	const LoggerStat before = Logger.getStat();
+
+	// キューが一杯の場合は破棄する
+	Logger.enableAsync(2, LogOverflowPolicy::Drop);
+
+	for (int32 i = 0; i < 256; ++i)
+	{
+		Logger << U"Logger.async.Drop " << i;
+	}
+
+	Logger.disableAsync();
+
+	const LoggerStat after = Logger.getStat();
+	CHECK(256 <= ((after.messageCount - before.messageCount) + (after.droppedMessageCount - before.droppedMessageCount)));
+	CHECK_EQ(after.queuedMessageCount, 0);
+}
+
+TEST_CASE("Logger.async.Switch")
+{
+	const LoggerStat before = Logger.getStat();
+
+	// 他のスレッドが書き込んでいる間に、非同期モードを切り替える
+	std::atomic<bool> done{ false };
+
+	std::thread producer{ [&]()
+		{
+			for (int32 i = 0; i < 2000; ++i)
+			{
+				Logger << U"Logger.async.Switch " << i;
+			}
+
+			done = true;
+		} };
+
+	for (int32 i = 0; (not done); ++i)
+	{
+		Logger.enableAsync((16 << (i % 4)), LogOverflowPolicy::Block);
+		Logger.disableAsync();
+	}
+
+	producer.join();
+
+	// 切り替える前の書き出し先に残っていたメッセージも失われない
+	const LoggerStat after = Logger.getStat();
+	CHECK(2000 <= (after.messageCount - before.messageCount));
+	CHECK_EQ(after.droppedMessageCount, before.droppedMessageCount);
+	CHECK_EQ(after.queuedMessageCount, 0);
+}
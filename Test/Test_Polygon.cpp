@@ -0,0 +1,146 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+static Polygon MakeStarPolygon(const size_t vertexCount)
+{
+	Array<Vec2> points(vertexCount);
+
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		const double r = ((i % 2) ? 380.0 : 400.0);
+		points[i] = OffsetCircular{ Vec2{ 400, 400 }, r, (i * Math::TwoPi / vertexCount) };
+	}
+
+	return Polygon{ points };
+}
+
+template <class Shape>
+static bool IntersectsBruteForce(const Polygon& polygon, const Shape& shape)
+{
+	for (size_t i = 0; i < polygon.num_triangles(); ++i)
+	{
+		if (Geometry2D::Intersect(shape, polygon.triangleAtIndex(i)))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+TEST_CASE("Polygon.intersects")
+{
+	// 三角形の数が多いポリゴンでは BVH による判定になる
+	for (const size_t vertexCount : { 16, 2000 })
+	{
+		const Polygon polygon = MakeStarPolygon(vertexCount);
+		REQUIRE_FALSE(polygon.isEmpty());
+
+		const RectF area{ -50, -50, 900, 900 };
+
+		for (int32 i = 0; i < 500; ++i)
+		{
+			const Vec2 point = RandomVec2(area);
+			CHECK_EQ(polygon.intersects(point), IntersectsBruteForce(polygon, point));
+
+			const Line line{ RandomVec2(area), RandomVec2(area) };
+			CHECK_EQ(polygon.intersects(line), IntersectsBruteForce(polygon, line));
+
+			const Circle circle{ RandomVec2(area), Random(1.0, 30.0) };
+			CHECK_EQ(polygon.intersects(circle), IntersectsBruteForce(polygon, circle));
+
+			const Triangle triangle{ RandomVec2(area), RandomVec2(area), RandomVec2(area) };
+			CHECK_EQ(polygon.intersects(triangle), IntersectsBruteForce(polygon, triangle));
+		}
+
+		CHECK(polygon.intersects(Vec2{ 400, 400 }));
+		CHECK(polygon.intersects(Vec2{ 400, 100 }));
+		CHECK_FALSE(polygon.intersects(Vec2{ 400, -10 }));
+		CHECK_FALSE(polygon.intersects(Circle{ 400, -30, 10 }));
+		CHECK(polygon.intersects(Line{ 400, -30, 400, 10 }));
+	}
+}
+
+TEST_CASE("Polygon.intersects.RectF")
+{
+	const Polygon polygon = MakeStarPolygon(2000);
+
+	CHECK(polygon.intersects(RectF{ 390, 0, 20, 20 }));
+	CHECK(polygon.intersects(RectF{ 300, 300, 200, 200 }));
+	CHECK_FALSE(polygon.intersects(RectF{ 0, 0, 40, 40 }));
+	CHECK_FALSE(polygon.intersects(RectF{ 900, 900, 10, 10 }));
+}
+
+TEST_CASE("Polygon.intersects.copy")
+{
+	Polygon polygon = MakeStarPolygon(2000);
+	CHECK(polygon.intersects(Vec2{ 400, 100 }));
+
+	// 代入で頂点が置き換わったとき、古い BVH を使わない
+	polygon = Polygon{ { Vec2{ 0, 0 }, Vec2{ 100, 0 }, Vec2{ 100, 100 } } };
+	CHECK_FALSE(polygon.intersects(Vec2{ 400, 100 }));
+	CHECK(polygon.intersects(Vec2{ 90, 10 }));
+
+	const Polygon polygon2 = MakeStarPolygon(2000);
+	Polygon polygon3 = polygon2;
+	CHECK(polygon3.intersects(Vec2{ 400, 100 }));
+	CHECK(polygon2.intersects(Vec2{ 400, 100 }));
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("Polygon.intersects.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	// TriangleIndex は 16 ビットのため、1 つのポリゴンの三角形は 65,533 個まで
+	for (const size_t vertexCount : { 1'000, 10'000, 60'000 })
+	{
+		const Polygon polygon = MakeStarPolygon(vertexCount);
+		const std::string title = ("Geometry2D::Intersect(..., Polygon) (" + std::to_string(polygon.num_triangles()) + " triangles)");
+
+		const Array<Vec2> points = Array<Vec2>::IndexedGenerate(256, [](size_t) { return RandomVec2(RectF{ 0, 0, 800, 800 }); });
+		size_t index = 0;
+
+		Bench bench;
+		bench.title(title).relative(true);
+
+		bench.run("Vec2", [&]()
+			{
+				doNotOptimizeAway(Geometry2D::Intersect(points[(index++) % points.size()], polygon));
+			});
+
+		bench.run("Line", [&]()
+			{
+				const Vec2& p = points[(index++) % points.size()];
+				doNotOptimizeAway(Geometry2D::Intersect(Line{ p, p.movedBy(40, 30) }, polygon));
+			});
+
+		bench.run("RectF", [&]()
+			{
+				doNotOptimizeAway(Geometry2D::Intersect(RectF{ points[(index++) % points.size()], 20 }, polygon));
+			});
+
+		bench.run("Circle", [&]()
+			{
+				doNotOptimizeAway(Geometry2D::Intersect(Circle{ points[(index++) % points.size()], 10 }, polygon));
+			});
+
+		bench.run("Circle (brute force)", [&]()
+			{
+				doNotOptimizeAway(IntersectsBruteForce(polygon, Circle{ points[(index++) % points.size()], 10 }));
+			});
+	}
+}
+
+# endif
@@ -0,0 +1,122 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("ProfilerScope")
+{
+	CHECK_FALSE(Profiler::IsScopeProfilingEnabled());
+
+	// 無効な間は何も記録しない
+	{
+		SIV3D_PROFILE_SCOPE(U"Disabled");
+	}
+
+	Profiler::EnableScopeProfiling(true);
+	REQUIRE(Profiler::IsScopeProfilingEnabled());
+
+	{
+		SIV3D_PROFILE_SCOPE(U"Outer");
+
+		for (int32 i = 0; i < 3; ++i)
+		{
+			SIV3D_PROFILE_SCOPE(U"Inner");
+		}
+	}
+
+	Threading::ParallelFor(0, 64, [](size_t, size_t)
+		{
+			SIV3D_PROFILE_SCOPE(U"Worker");
+		}, 1);
+
+	Profiler::EnableScopeProfiling(false);
+
+	const FilePath path = U"../../Test/output/profiler/trace.json";
+	REQUIRE(Profiler::ExportChromeTrace(path));
+
+	const JSON json = JSON::Load(path);
+	REQUIRE(json[U"traceEvents"].isArray());
+
+	Optional<std::pair<double, double>> outer;
+	Array<std::pair<double, double>> inner;
+	size_t workerCount = 0;
+
+	const JSON events = json[U"traceEvents"];
+
+	for (size_t i = 0; i < events.size(); ++i)
+	{
+		const JSON event = events[i];
+
+		if (event[U"ph"].getString() != U"X")
+		{
+			continue;
+		}
+
+		const String name = event[U"name"].getString();
+		const double ts = event[U"ts"].get<double>();
+		const double dur = event[U"dur"].get<double>();
+		CHECK(0.0 <= dur);
+		CHECK_NE(name, U"Disabled");
+
+		if (name == U"Outer")
+		{
+			outer.emplace(ts, (ts + dur));
+		}
+		else if (name == U"Inner")
+		{
+			inner.emplace_back(ts, (ts + dur));
+		}
+		else if (name == U"Worker")
+		{
+			++workerCount;
+		}
+	}
+
+	// 内側の計測区間は外側の計測区間に含まれる
+	REQUIRE(outer);
+	REQUIRE_EQ(inner.size(), 3);
+
+	for (const auto& [begin, end] : inner)
+	{
+		CHECK(outer->first <= begin);
+		CHECK(end <= (outer->second + 0.001));
+	}
+
+	// ワーカースレッドの記録も含まれる
+	CHECK_EQ(workerCount, 64);
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("ProfilerScope.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	Bench bench;
+	bench.title("ProfilerScope").relative(true);
+
+	bench.run("disabled", [&]()
+		{
+			SIV3D_PROFILE_SCOPE(U"Benchmark");
+		});
+
+	Profiler::EnableScopeProfiling(true);
+
+	// バッファが一杯になると記録は破棄されるが、コストはほぼ変わらない
+	bench.run("enabled", [&]()
+		{
+			SIV3D_PROFILE_SCOPE(U"Benchmark");
+		});
+
+	Profiler::EnableScopeProfiling(false);
+}
+
+# endif
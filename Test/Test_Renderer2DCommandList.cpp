@@ -0,0 +1,414 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+static void RecordShape(Renderer2DCommandList& commandList, const size_t i)
+{
+	const Vec2 pos{ ((i % 40) * 20.0), ((i / 40) * 20.0) };
+
+	switch (i % 4)
+	{
+	case 0:
+		commandList.addRect(RectF{ pos, 16 }, Palette::Orange);
+		break;
+	case 1:
+		commandList.addCircle(Circle{ pos, 8 }, Palette::Skyblue);
+		break;
+	case 2:
+		commandList.addLine(Line{ pos, pos.movedBy(16, 8) }, 2.0, Palette::White);
+		break;
+	default:
+		commandList.addRoundRect(RoundRect{ pos, 16, 16, 4 }, Palette::Seagreen);
+		break;
+	}
+}
+
+// バッチの分割に依存しない形で、三角形の頂点位置を列挙する
+static Array<Float2> FlattenTriangles(const Renderer2DCommandList& commandList)
+{
+	const auto& vertices = commandList.getVertices();
+	const auto& indices = commandList.getIndices();
+	Array<Float2> result;
+
+	for (const auto& batch : commandList.getBatches())
+	{
+		for (uint32 i = 0; i < batch.indexCount; ++i)
+		{
+			result << vertices[batch.vertexOffset + indices[batch.indexOffset + i]].pos;
+		}
+	}
+
+	return result;
+}
+
+// 頂点の位置と色、インデックス、バッチがすべて一致するかを調べる
+static void CheckSameRecording(const Renderer2DCommandList& batched, const Renderer2DCommandList& perShape)
+{
+	CHECK(std::ranges::equal(batched.getVertices(), perShape.getVertices(),
+		[](const Vertex2D& a, const Vertex2D& b) { return ((a.pos == b.pos) && (a.color == b.color)); }));
+	CHECK(std::ranges::equal(batched.getIndices(), perShape.getIndices()));
+	CHECK(std::ranges::equal(batched.getBatches(), perShape.getBatches(),
+		[](const Renderer2DCommandList::Batch& a, const Renderer2DCommandList::Batch& b)
+		{
+			return ((a.vertexOffset == b.vertexOffset) && (a.vertexCount == b.vertexCount)
+				&& (a.indexOffset == b.indexOffset) && (a.indexCount == b.indexCount));
+		}));
+}
+
+// 頂点 [first, first + count) と、中心から角度 startAngle + radDelta * i の方向 (sin, -cos) に r 離れた位置との最大の誤差を求める
+static double MaxArcError(const Renderer2DCommandList& commandList, const size_t first, const size_t count, const Vec2& center, const double r, const double startAngle, const double radDelta)
+{
+	const auto& vertices = commandList.getVertices();
+	double maxError = 0.0;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const double angle = (startAngle + radDelta * i);
+		const Vec2 expected{ (center.x + std::sin(angle) * r), (center.y - std::cos(angle) * r) };
+		const Float2& pos = vertices[first + i].pos;
+		maxError = Max(maxError, expected.distanceFrom(Vec2{ pos.x, pos.y }));
+	}
+
+	return maxError;
+}
+
+TEST_CASE("Renderer2DCommandList.Transform")
+{
+	Renderer2DCommandList commandList;
+	CHECK(commandList.isEmpty());
+	CHECK_EQ(commandList.getTransform(), Mat3x2::Identity());
+
+	// 空のスタックからのポップは何もしない
+	commandList.popTransform();
+	CHECK_EQ(commandList.getTransform(), Mat3x2::Identity());
+
+	{
+		const Renderer2DCommandList::ScopedTransform t0{ commandList, Mat3x2::Translate(100, 0) };
+		const Renderer2DCommandList::ScopedTransform t1{ commandList, Mat3x2::Scale(2) };
+		CHECK_EQ(commandList.getTransform(), (Mat3x2::Scale(2) * Mat3x2::Translate(100, 0)));
+
+		commandList.addRect(RectF{ 10, 20, 30, 40 }, Palette::White);
+	}
+
+	CHECK_EQ(commandList.getTransform(), Mat3x2::Identity());
+	REQUIRE_EQ(commandList.num_vertices(), 4);
+	CHECK_EQ(commandList.num_indices(), 6);
+	CHECK_EQ(commandList.getVertices()[0].pos, Float2{ 120, 40 });
+	CHECK_EQ(commandList.getVertices()[3].pos, Float2{ 180, 120 });
+
+	commandList.clear();
+	CHECK(commandList.isEmpty());
+	CHECK(commandList.getBatches().isEmpty());
+}
+
+TEST_CASE("Renderer2DCommandList.Batch")
+{
+	// 1 つのバッチの頂点数は 65535 以下
+	Renderer2DCommandList commandList;
+
+	for (int32 i = 0; i < 20'000; ++i)
+	{
+		commandList.addRect(RectF{ i, 0, 1, 1 }, Palette::White);
+	}
+
+	CHECK_EQ(commandList.num_vertices(), 80'000);
+	CHECK_EQ(commandList.num_indices(), 120'000);
+
+	const auto& batches = commandList.getBatches();
+	REQUIRE(2 <= batches.size());
+
+	uint32 vertexOffset = 0, indexOffset = 0;
+
+	for (const auto& batch : batches)
+	{
+		CHECK_EQ(batch.vertexOffset, vertexOffset);
+		CHECK_EQ(batch.indexOffset, indexOffset);
+		CHECK(batch.vertexCount <= 0xFFFF);
+		CHECK(batch.indexCount <= 0xFFFF);
+		vertexOffset += batch.vertexCount;
+		indexOffset += batch.indexCount;
+	}
+
+	CHECK_EQ(vertexOffset, commandList.num_vertices());
+	CHECK_EQ(indexOffset, commandList.num_indices());
+	CHECK(std::ranges::all_of(commandList.getIndices(), [](Vertex2D::IndexType index) { return (index < 0xFFFF); }));
+	CHECK_NOTHROW(commandList.draw());
+}
+
+TEST_CASE("Renderer2DCommandList.Parallel")
+{
+	constexpr size_t N = 4'000;
+	constexpr size_t NumLists = 8;
+
+	Renderer2DCommandList serial;
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		RecordShape(serial, i);
+	}
+
+	// スレッドごとのコマンドリストに記録し、順番どおりに連結する
+	Array<Renderer2DCommandList> lists(NumLists);
+
+	Threading::ParallelFor(0, NumLists, [&](size_t begin, size_t end)
+		{
+			for (size_t k = begin; k < end; ++k)
+			{
+				for (size_t i = (N * k / NumLists); i < (N * (k + 1) / NumLists); ++i)
+				{
+					RecordShape(lists[k], i);
+				}
+			}
+		}, 1);
+
+	Renderer2DCommandList merged;
+
+	for (const auto& list : lists)
+	{
+		merged.append(list);
+	}
+
+	CHECK_EQ(merged.num_vertices(), serial.num_vertices());
+	CHECK_EQ(merged.num_indices(), serial.num_indices());
+	CHECK(std::ranges::equal(FlattenTriangles(merged), FlattenTriangles(serial)));
+	CHECK_NOTHROW(merged.draw());
+}
+
+TEST_CASE("Renderer2DCommandList.addRects")
+{
+	// 1 つのバッチに収まらない数を含める
+	for (const size_t n : { 1, 100, 25'000 })
+	{
+		CAPTURE(n);
+
+		Array<FloatRect> rects;
+		Array<Float4> colors;
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			const float x = static_cast<float>((i % 200) * 4);
+			const float y = static_cast<float>((i / 200) * 3);
+			rects.emplace_back(x, y, (x + 3), (y + 2));
+			colors.emplace_back((i % 7) / 8.0f, (i % 5) / 4.0f, 0.5f, 1.0f);
+		}
+
+		// 同じ色
+		{
+			Renderer2DCommandList batched, perShape;
+			batched.addRects(rects, Palette::Orange);
+
+			for (const auto& rect : rects)
+			{
+				perShape.addRect(RectF{ rect.left, rect.top, (rect.right - rect.left), (rect.bottom - rect.top) }, Palette::Orange);
+			}
+
+			CheckSameRecording(batched, perShape);
+		}
+
+		// 長方形ごとの色
+		{
+			Renderer2DCommandList batched, perShape;
+			batched.addRects(rects, colors);
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				const FloatRect& rect = rects[i];
+				perShape.addRect(RectF{ rect.left, rect.top, (rect.right - rect.left), (rect.bottom - rect.top) }, ColorF{ colors[i] });
+			}
+
+			CheckSameRecording(batched, perShape);
+		}
+	}
+
+	Renderer2DCommandList commandList;
+	CHECK_THROWS_AS(commandList.addRects(Array<FloatRect>(3), Array<Float4>(2)), Error);
+	CHECK(commandList.isEmpty());
+}
+
+TEST_CASE("Renderer2DCommandList.addCircles")
+{
+	// 半径によって円の分割数が変わり、1 回のバッファ確保に収まる円の数も変わる
+	constexpr size_t N = 3'000;
+	Array<Float2> centers;
+	Array<float> rs;
+	Array<Float4> colors;
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		centers.emplace_back(static_cast<float>((i % 50) * 16), static_cast<float>((i / 50) * 16));
+		rs.push_back(static_cast<float>(1 + (i % 13) * 9));
+		colors.emplace_back(0.25f, (i % 5) / 4.0f, (i % 3) / 2.0f, 1.0f);
+	}
+
+	// 座標変換の拡大率も円の分割数に影響する
+	for (const double scale : { 1.0, 2.5 })
+	{
+		CAPTURE(scale);
+
+		// 同じ半径と色
+		for (const float r : { 2.0f, 10.0f, 300.0f })
+		{
+			CAPTURE(r);
+			Renderer2DCommandList batched, perShape;
+			const Renderer2DCommandList::ScopedTransform t0{ batched, Mat3x2::Scale(scale) };
+			const Renderer2DCommandList::ScopedTransform t1{ perShape, Mat3x2::Scale(scale) };
+
+			batched.addCircles(centers, r, Palette::Skyblue);
+
+			for (const auto& center : centers)
+			{
+				perShape.addCircle(Circle{ center, r }, Palette::Skyblue);
+			}
+
+			CheckSameRecording(batched, perShape);
+		}
+
+		// 円ごとの半径と色
+		{
+			Renderer2DCommandList batched, perShape;
+			const Renderer2DCommandList::ScopedTransform t0{ batched, Mat3x2::Scale(scale) };
+			const Renderer2DCommandList::ScopedTransform t1{ perShape, Mat3x2::Scale(scale) };
+
+			batched.addCircles(centers, rs, colors);
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				perShape.addCircle(Circle{ centers[i], rs[i] }, ColorF{ colors[i] });
+			}
+
+			CheckSameRecording(batched, perShape);
+		}
+	}
+
+	Renderer2DCommandList commandList;
+	CHECK_THROWS_AS(commandList.addCircles(centers, rs.take(2), colors), Error);
+	CHECK_THROWS_AS(commandList.addCircles(centers, rs, colors.take(2)), Error);
+	CHECK(commandList.isEmpty());
+}
+
+TEST_CASE("Renderer2DCommandList.ArcAccuracy")
+{
+	// 表と回転の漸化式で求めた円周上の頂点を、std::sin / std::cos で直接求めた位置と比べる（半径 1000 あたり 0.005 px 未満）
+	const Vec2 center{ 400, 300 };
+	const std::array<double, 2> radii = { 1000.0, 4000.0 };
+
+	SUBCASE("Circle")
+	{
+		// 全周を 4 * 63 等分する表
+		for (const double r : radii)
+		{
+			CAPTURE(r);
+			Renderer2DCommandList commandList;
+			commandList.addCircle(Circle{ center, r }, Palette::White);
+
+			const size_t quality = (commandList.num_vertices() - 1);
+			CHECK_EQ(quality, 252);
+			CHECK_LT(MaxArcError(commandList, 1, quality, center, r, 0.0, (Math::TwoPi / quality)), (r * 0.000005));
+		}
+	}
+
+	SUBCASE("CirclePie")
+	{
+		// 先頭の 4 つ以降を、64 個ごとに回転の漸化式で求める
+		for (const double r : radii)
+		{
+			for (const double angle : { 6.0, -6.0 })
+			{
+				CAPTURE(r);
+				CAPTURE(angle);
+				Renderer2DCommandList commandList;
+				commandList.addCirclePie(Circle{ center, r }, 0.3, angle, Palette::White);
+
+				const size_t quality = (commandList.num_vertices() - 1);
+				REQUIRE_GT(quality, 200);
+
+				const double startAngle = (static_cast<float>(0.3) + ((angle < 0.0) ? static_cast<float>(angle) : 0.0f));
+				const double radDelta = (Abs(static_cast<float>(angle)) / (quality - 1));
+				CHECK_LT(MaxArcError(commandList, 1, quality, center, r, startAngle, radDelta), (r * 0.000005));
+			}
+		}
+	}
+
+	SUBCASE("Round cap")
+	{
+		// 半周の表を、線分の向きに回転する
+		const Line line{ Vec2{ -500, -200 }, Vec2{ 700, 400 } };
+		const Vec2 direction = line.vector().normalized();
+		const double startAngle = static_cast<float>(std::atan2(-direction.y, -direction.x));
+
+		for (const double r : radii)
+		{
+			CAPTURE(r);
+			Renderer2DCommandList commandList;
+			commandList.addLine(line, LineCap::Round, (r * 2), Palette::White);
+
+			// 線分の 4 頂点、始点側の線端（中心 + 周）、終点側の線端（中心 + 周）
+			const size_t quality = ((commandList.num_vertices() - 4) / 2 - 1);
+			REQUIRE_GT(quality, 100);
+
+			const double radDelta = (Math::Pi / (quality - 1));
+			CHECK_LT(MaxArcError(commandList, 5, quality, line.start, r, startAngle, radDelta), (r * 0.000005));
+			CHECK_LT(MaxArcError(commandList, (6 + quality), quality, line.end, r, (startAngle + Math::Pi), radDelta), (r * 0.000005));
+		}
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("Renderer2DCommandList.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	constexpr size_t N = 100'000;
+	const size_t numLists = Threading::GetConcurrency();
+	Array<Renderer2DCommandList> lists(numLists);
+	Renderer2DCommandList serial, merged;
+
+	Bench{}.title("Renderer2DCommandList (100k shapes)").run("serial", [&]()
+		{
+			serial.clear();
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				RecordShape(serial, i);
+			}
+
+			doNotOptimizeAway(serial.num_vertices());
+		});
+
+	Bench{}.title("Renderer2DCommandList (100k shapes)").run("ParallelFor + append", [&]()
+		{
+			Threading::ParallelFor(0, numLists, [&](size_t begin, size_t end)
+				{
+					for (size_t k = begin; k < end; ++k)
+					{
+						lists[k].clear();
+
+						for (size_t i = (N * k / numLists); i < (N * (k + 1) / numLists); ++i)
+						{
+							RecordShape(lists[k], i);
+						}
+					}
+				}, 1);
+
+			merged.clear();
+
+			for (const auto& list : lists)
+			{
+				merged.append(list);
+			}
+
+			doNotOptimizeAway(merged.num_vertices());
+		});
+}
+
+# endif
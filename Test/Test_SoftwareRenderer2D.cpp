@@ -0,0 +1,214 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+// 条件を満たすピクセルを foreground, それ以外を background で塗った画像を作る
+template <class Predicate>
+static Image MakeExpectedImage(const Size& size, const Color& background, const Color& foreground, Predicate predicate)
+{
+	Image image{ size, background };
+
+	for (int32 y = 0; y < size.y; ++y)
+	{
+		for (int32 x = 0; x < size.x; ++x)
+		{
+			if (predicate(x, y))
+			{
+				image[y][x] = foreground;
+			}
+		}
+	}
+
+	return image;
+}
+
+static Image Render(SoftwareRenderer2D& renderer, const Renderer2DCommandList& commandList)
+{
+	renderer.draw(commandList);
+	renderer.flush();
+	return renderer.getImage();
+}
+
+TEST_CASE("SoftwareRenderer2D")
+{
+	SUBCASE("Render target")
+	{
+		SoftwareRenderer2D renderer{ Size{ 8, 4 }, ColorF{ 0.0, 0.0, 1.0 } };
+		CHECK(renderer.getImage().size() == Size{ 8, 4 });
+		CHECK(renderer.getImage() == Image{ Size{ 8, 4 }, Color{ 0, 0, 255 } });
+
+		renderer.resize(Size{ 5, 3 });
+		renderer.beginFrame(ColorF{ 1.0, 0.0, 0.0 });
+		CHECK(renderer.getImage() == Image{ Size{ 5, 3 }, Color{ 255, 0, 0 } });
+	}
+
+	SUBCASE("Filled triangle")
+	{
+		SoftwareRenderer2D renderer{ Size{ 16, 16 } };
+
+		Renderer2DCommandList commandList;
+		commandList.addTriangle(Triangle{ Vec2{ 0, 0 }, Vec2{ 10, 0 }, Vec2{ 0, 7 } }, ColorF{ 1.0 });
+
+		// ピクセル中心が斜辺 7x + 10y = 70 より内側にあるピクセルだけが塗られる
+		const Image expected = MakeExpectedImage(Size{ 16, 16 }, Color{ 0, 255 }, Color{ 255 },
+			[](int32 x, int32 y) { return ((7 * (x + 0.5)) + (10 * (y + 0.5))) < 70.0; });
+
+		CHECK(Render(renderer, commandList) == expected);
+	}
+
+	SUBCASE("Rect edge")
+	{
+		{
+			SoftwareRenderer2D renderer{ Size{ 12, 12 } };
+			Renderer2DCommandList commandList;
+			commandList.addRect(RectF{ 2, 3, 4, 5 }, ColorF{ 1.0 });
+
+			const Image expected = MakeExpectedImage(Size{ 12, 12 }, Color{ 0, 255 }, Color{ 255 },
+				[](int32 x, int32 y) { return (InRange(x, 2, 5) && InRange(y, 3, 7)); });
+
+			CHECK(Render(renderer, commandList) == expected);
+		}
+
+		// ピクセル中心に乗る辺は、左辺と上辺だけが塗られる (top-left rule)
+		{
+			SoftwareRenderer2D renderer{ Size{ 12, 12 } };
+			Renderer2DCommandList commandList;
+			commandList.addRect(RectF{ 2.5, 3.5, 4, 4 }, ColorF{ 1.0 });
+
+			const Image expected = MakeExpectedImage(Size{ 12, 12 }, Color{ 0, 255 }, Color{ 255 },
+				[](int32 x, int32 y) { return (InRange(x, 2, 5) && InRange(y, 3, 6)); });
+
+			CHECK(Render(renderer, commandList) == expected);
+		}
+
+		// 2 つの三角形の共有辺が二重に塗られない
+		{
+			SoftwareRenderer2D renderer{ Size{ 12, 12 } };
+			Renderer2DCommandList commandList;
+			commandList.addRect(RectF{ 2, 3, 4, 5 }, ColorF{ 1.0, 0.5 });
+
+			const Image expected = MakeExpectedImage(Size{ 12, 12 }, Color{ 0, 255 }, Color{ 128, 255 },
+				[](int32 x, int32 y) { return (InRange(x, 2, 5) && InRange(y, 3, 7)); });
+
+			CHECK(Render(renderer, commandList) == expected);
+		}
+	}
+
+	SUBCASE("Scissor")
+	{
+		SoftwareRenderer2D renderer{ Size{ 16, 16 } };
+		Renderer2DCommandList commandList;
+		commandList.addRect(RectF{ 0, 0, 16, 16 }, ColorF{ 1.0 });
+
+		renderer.setScissorRect(Rect{ 4, 4, 6, 5 });
+		{
+			const Image expected = MakeExpectedImage(Size{ 16, 16 }, Color{ 0, 255 }, Color{ 255 },
+				[](int32 x, int32 y) { return (InRange(x, 4, 9) && InRange(y, 4, 8)); });
+
+			CHECK(Render(renderer, commandList) == expected);
+		}
+
+		renderer.beginFrame(ColorF{ 0.0 });
+		renderer.setScissorRect(none);
+		CHECK(Render(renderer, commandList) == Image{ Size{ 16, 16 }, Color{ 255 } });
+	}
+
+	SUBCASE("Blending")
+	{
+		const Size size{ 4, 4 };
+
+		Renderer2DCommandList commandList;
+		commandList.addRect(RectF{ 0, 0, 4, 4 }, ColorF{ 0.0, 0.0, 1.0, 0.5 });
+
+		{
+			SoftwareRenderer2D renderer{ size, ColorF{ 1.0, 0.0, 0.0 } };
+			renderer.setBlendState(BlendState::Default2D);
+			CHECK(Render(renderer, commandList) == Image{ size, Color{ 128, 0, 128, 255 } });
+		}
+
+		{
+			SoftwareRenderer2D renderer{ size, ColorF{ 1.0, 0.0, 0.0 } };
+			renderer.setBlendState(BlendState::Opaque);
+			CHECK(Render(renderer, commandList) == Image{ size, Color{ 0, 0, 128, 128 } });
+		}
+
+		{
+			Renderer2DCommandList additive;
+			additive.addRect(RectF{ 0, 0, 4, 4 }, ColorF{ 0.0, 1.0, 0.0, 0.5 });
+
+			SoftwareRenderer2D renderer{ size, ColorF{ 1.0, 0.0, 0.0 } };
+			renderer.setBlendState(BlendState::Additive);
+			CHECK(Render(renderer, additive) == Image{ size, Color{ 255, 128, 0, 255 } });
+		}
+	}
+
+	SUBCASE("Stat")
+	{
+		SoftwareRenderer2D renderer{ Size{ 8, 8 } };
+		Renderer2DCommandList commandList;
+		commandList.addRect(RectF{ 0, 0, 4, 4 }, ColorF{ 1.0 });
+
+		renderer.draw(commandList);
+		renderer.flush();
+		CHECK(renderer.getStat().drawCalls == 1);
+		CHECK(renderer.getStat().triangleCount == 2);
+
+		// beginFrame で統計がリセットされる
+		renderer.beginFrame(ColorF{ 0.0 });
+		CHECK(renderer.getStat().drawCalls == 0);
+		CHECK(renderer.getStat().triangleCount == 0);
+	}
+
+	SUBCASE("Draw call reordering")
+	{
+		// ブレンドステートを Default2D, Additive と交互に切り替えながら、半透明の長方形を 6 つ描く
+		const auto renderScene = [](const bool reordering, const int32 step)
+			{
+				SoftwareRenderer2D renderer{ Size{ 64, 12 }, ColorF{ 0.2, 0.3, 0.4 } };
+				renderer.setDrawCallReorderingEnabled(reordering);
+
+				for (int32 i = 0; i < 6; ++i)
+				{
+					Renderer2DCommandList commandList;
+					commandList.addRect(RectF{ (2 + i * step), 2, 8, 8 }, ColorF{ (i * 0.15), 0.5, (1.0 - i * 0.1), 0.5 });
+
+					renderer.setBlendState(IsEven(i) ? BlendState::Default2D : BlendState::Additive);
+					renderer.draw(commandList);
+				}
+
+				renderer.flush();
+				return std::pair{ renderer.getImage(), renderer.getStat() };
+			};
+
+		// 重ならない長方形は、同じブレンドステートどうしがまとめられる
+		{
+			const auto [orderedImage, ordered] = renderScene(false, 10);
+			const auto [reorderedImage, reordered] = renderScene(true, 10);
+
+			CHECK(reorderedImage == orderedImage);
+			CHECK(ordered.drawCalls == 6);
+			CHECK(ordered.drawCallsSaved == 0);
+			CHECK(reordered.drawCalls < ordered.drawCalls);
+			CHECK(reordered.drawCallsSaved == (ordered.drawCalls - reordered.drawCalls));
+			CHECK(reordered.triangleCount == ordered.triangleCount);
+		}
+
+		// 重なる長方形は、描画順を変えずに描かれる
+		{
+			const auto [orderedImage, ordered] = renderScene(false, 4);
+			const auto [reorderedImage, reordered] = renderScene(true, 4);
+
+			CHECK(reorderedImage == orderedImage);
+			CHECK(reordered.triangleCount == ordered.triangleCount);
+		}
+	}
+}
@@ -1095,3 +1095,64 @@ TEST_CASE("TextReader.benchmark")
 }
 
 # endif
+
+# if SIV3D_RUN_BENCHMARK && SIV3D_RUN_HEAVY_TEST
+
+TEST_CASE("TextReader.benchmark.1GB")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const FilePath path{ U"../../Test/output/textreader/large_utf8.txt" };
+	constexpr int64 TargetSize = (1024LL * 1024 * 1024);
+
+	{
+		const Blob source{ U"../../Test/data/text/utf8_longCRLF.txt" };
+		BinaryWriter writer{ path };
+		REQUIRE(writer.isOpen());
+
+		for (int64 written = 0; written < TargetSize; written += source.size())
+		{
+			writer.write(source.data(), source.size());
+		}
+	}
+
+	const double sizeMB = (FileSystem::FileSize(path) / (1024.0 * 1024.0));
+
+	Console << U"\n----------------";
+	{
+		Console << U"TextReader::readLine(std::string&) | {:.0f} MB"_fmt(sizeMB);
+		MillisecClock clock;
+		TextReader reader{ path };
+		std::string line;
+		size_t numLines = 0;
+
+		while (reader.readLine(line))
+		{
+			++numLines;
+		}
+
+		const int64 ms = Max<int64>(clock.ms(), 1);
+		Console << U"| {} lines, {} ms ({:.1f} MB/s)"_fmt(numLines, ms, (sizeMB / (ms / 1000.0)));
+	}
+
+	{
+		Console << U"TextReader::readLine(String&) | {:.0f} MB"_fmt(sizeMB);
+		MillisecClock clock;
+		TextReader reader{ path };
+		String line;
+		size_t numLines = 0;
+
+		while (reader.readLine(line))
+		{
+			++numLines;
+		}
+
+		const int64 ms = Max<int64>(clock.ms(), 1);
+		Console << U"| {} lines, {} ms ({:.1f} MB/s)"_fmt(numLines, ms, (sizeMB / (ms / 1000.0)));
+	}
+	Console << U"----------------\n";
+
+	FileSystem::Remove(path);
+}
+
+# endif
@@ -0,0 +1,144 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <atomic>
+# include <mutex>
+# include <thread>
+# include "Siv3DTest.hpp"
+
+static Array<Texture> MakeTextures(const size_t count)
+{
+	const Image image{ 4, 4, Palette::White };
+
+	Array<Texture> textures(Arg::reserve = count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		textures << Texture{ image };
+	}
+
+	return textures;
+}
+
+TEST_CASE("Texture.id")
+{
+	Array<Texture> textures = MakeTextures(16);
+
+	for (const auto& texture : textures)
+	{
+		CHECK_FALSE(texture.isEmpty());
+		CHECK_FALSE(texture.id().isNull());
+		CHECK_FALSE(texture.id().isInvalid());
+		CHECK_EQ(texture.size(), Size{ 4, 4 });
+	}
+
+	for (size_t i = 0; i < textures.size(); ++i)
+	{
+		for (size_t k = (i + 1); k < textures.size(); ++k)
+		{
+			CHECK_NE(textures[i].id(), textures[k].id());
+		}
+	}
+
+	// 解放したテクスチャの ID は、同じスロットが再利用されても再び使われない
+	const Texture::IDType releasedID = textures.back().id();
+	textures.back().release();
+
+	const Texture texture{ Image{ 8, 8, Palette::White } };
+	CHECK_NE(texture.id(), releasedID);
+	CHECK_EQ(texture.size(), Size{ 8, 8 });
+}
+
+TEST_CASE("Texture.concurrentCreation")
+{
+	const Array<Texture> textures = MakeTextures(256);
+
+	std::atomic<bool> done{ false };
+
+	std::thread thread{ [&]()
+		{
+			const Image image{ 2, 2, Palette::White };
+
+			for (int32 i = 0; i < 256; ++i)
+			{
+				const Texture texture{ image };
+			}
+
+			done = true;
+		} };
+
+	bool allCorrect = true;
+
+	while (not done)
+	{
+		for (const auto& texture : textures)
+		{
+			allCorrect &= (texture.size() == Size{ 4, 4 });
+		}
+	}
+
+	thread.join();
+
+	CHECK(allCorrect);
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("Texture.Benchmark")
+{
+	const Array<Texture> textures = MakeTextures(10000);
+
+	// 比較用: スロットマップ導入前の AssetHandleManager と同じ HashMap + std::mutex による参照
+	struct ReferenceData
+	{
+		Size size;
+	};
+
+	HashMap<Texture::IDType, std::unique_ptr<ReferenceData>> referenceData;
+	std::mutex referenceMutex;
+
+	for (const auto& texture : textures)
+	{
+		referenceData.emplace(texture.id(), std::make_unique<ReferenceData>(texture.size()));
+	}
+
+	const auto findReference = [&](const Texture::IDType id)
+		{
+			std::lock_guard lock{ referenceMutex };
+			return referenceData[id].get();
+		};
+
+	Bench{}.title("Texture lookup")
+		.run("HashMap + std::mutex x 10000", [&]()
+		{
+			int64 sum = 0;
+
+			for (const auto& texture : textures)
+			{
+				sum += findReference(texture.id())->size.x;
+			}
+
+			doNotOptimizeAway(sum);
+		})
+		.run("Texture::size() x 10000", [&]()
+		{
+			int64 sum = 0;
+
+			for (const auto& texture : textures)
+			{
+				sum += texture.size().x;
+			}
+
+			doNotOptimizeAway(sum);
+		});
+}
+
+# endif